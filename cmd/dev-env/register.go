@@ -28,6 +28,7 @@ func (p devEnvCmdProvider) Metadata() registry.CommandMetadata {
 		Dependencies: []string{}, // 동적으로 확인 (aws, gcloud, docker 등)
 		Tags:         []string{"development", "environment", "aws", "gcp", "azure", "docker", "kubernetes"},
 		Lifecycle:    registry.LifecycleStable,
+		Short:        "Manage development environment configurations",
 	}
 }
 
@@ -752,6 +752,33 @@ func runPerformanceChecks(report *DiagnosticReport, _ logger.CommonLogger, _ *er
 		Duration:  time.Since(start),
 		Timestamp: time.Now(),
 	})
+
+	// CLI startup time
+	start = time.Now()
+	startup, err := measureStartupTime()
+
+	status = statusPass
+	message = fmt.Sprintf("Startup: %v (budget %v)", startup.Round(time.Millisecond), startupBudget)
+
+	switch {
+	case err != nil:
+		status = statusWarn
+		message = fmt.Sprintf("Startup time not measured: %v", err)
+	case startup > startupBudget:
+		status = statusWarn
+		message += " (slow)"
+	}
+
+	report.Results = append(report.Results, DiagnosticResult{
+		Name:          "CLI Startup Time",
+		Category:      "performance",
+		Status:        status,
+		Message:       message,
+		Details:       map[string]any{"startup_ms": startup.Milliseconds(), "budget_ms": startupBudget.Milliseconds()},
+		FixSuggestion: "Register commands with Short metadata so that they are built lazily",
+		Duration:      time.Since(start),
+		Timestamp:     time.Now(),
+	})
 }
 
 func runSecurityChecks(report *DiagnosticReport, _ logger.CommonLogger, _ *errors.ErrorRecovery) {
@@ -936,6 +963,40 @@ func runCPUBenchmark() float64 {
 	return float64(iterations) / duration.Seconds()
 }
 
+// startupBudget is the time a gz invocation may take before the dispatched
+// command runs. Shell completion invokes gz on every keystroke, so startup
+// has to stay well below what users notice.
+const startupBudget = 150 * time.Millisecond
+
+// measureStartupTime returns the fastest of a few completion requests for
+// `gz git repo`, which only build the root stubs and the git subtree.
+func measureStartupTime() (time.Duration, error) {
+	exe, err := os.Executable()
+	if err != nil {
+		return 0, err
+	}
+
+	ctx, cancel := context.WithTimeout(context.Background(), 10*time.Second)
+	defer cancel()
+
+	var fastest time.Duration
+
+	for i := range 3 {
+		start := time.Now()
+
+		cmd := exec.CommandContext(ctx, exe, cobra.ShellCompNoDescRequestCmd, "git", "repo", "")
+		if err := cmd.Run(); err != nil {
+			return 0, fmt.Errorf("failed to run %s: %w", filepath.Base(exe), err)
+		}
+
+		if elapsed := time.Since(start); i == 0 || elapsed < fastest {
+			fastest = elapsed
+		}
+	}
+
+	return fastest, nil
+}
+
 func runDiskBenchmark() float64 {
 	// Simple disk I/O benchmark
 	testFile := filepath.Join(os.TempDir(), "gzh-disk-bench")
@@ -15,6 +15,7 @@ import (
 
 	"github.com/gizzahub/gzh-cli/internal/logger"
 	"github.com/gizzahub/gzh-cli/internal/profiling"
+	"github.com/gizzahub/gzh-cli/internal/profiling/macro"
 )
 
 // PerformanceSnapshot represents a point-in-time performance measurement.
@@ -279,6 +280,9 @@ func (sm *SnapshotManager) performComparison(analysis *SnapshotAnalysis, options
 			totalChange += changePercent
 			changeCount++
 
+			analysis.Regressions = append(analysis.Regressions,
+				detectCostRegressions(currentBench, baselineBench, options.RegressionThreshold)...)
+
 			// Check for regressions and improvements
 			if changePercent < -options.RegressionThreshold {
 				regression := PerformanceRegression{
@@ -512,6 +516,72 @@ func calculatePerformanceChange(current, baseline profiling.BenchmarkResult) flo
 	return ((current.OpsPerSec - baseline.OpsPerSec) / baseline.OpsPerSec) * 100
 }
 
+// costMetrics returns the lower-is-better figures of a result: allocations
+// for every benchmark and, for the macro-benchmarks, API calls per repository.
+func costMetrics(result profiling.BenchmarkResult) map[string]float64 {
+	metrics := map[string]float64{
+		"allocs_per_op":      float64(result.AllocsPerOp),
+		"alloc_bytes_per_op": float64(result.AllocBytesPerOp),
+	}
+
+	if calls, ok := result.Metrics[macro.MetricAPICallsPerRepo]; ok {
+		metrics[macro.MetricAPICallsPerRepo] = calls
+	}
+
+	return metrics
+}
+
+// detectCostRegressions reports the cost metrics that grew by more than
+// threshold percent over the baseline, in metric name order.
+func detectCostRegressions(current, baseline profiling.BenchmarkResult, threshold float64) []PerformanceRegression {
+	currentCosts := costMetrics(current)
+	baselineCosts := costMetrics(baseline)
+
+	names := make([]string, 0, len(currentCosts))
+	for name := range currentCosts {
+		names = append(names, name)
+	}
+
+	sort.Strings(names)
+
+	var regressions []PerformanceRegression
+
+	for _, name := range names {
+		baselineValue, ok := baselineCosts[name]
+		if !ok || baselineValue == 0 {
+			continue
+		}
+
+		increase := (currentCosts[name] - baselineValue) / baselineValue * 100
+		if increase <= threshold {
+			continue
+		}
+
+		regressions = append(regressions, PerformanceRegression{
+			BenchmarkName:     current.Name,
+			CurrentOpsPerSec:  current.OpsPerSec,
+			BaselineOpsPerSec: baseline.OpsPerSec,
+			RegressionPercent: increase,
+			Severity:          calculateSeverity(increase, threshold),
+			Impact:            generateImpactDescription(increase),
+			Metric:            name,
+			CurrentValue:      currentCosts[name],
+			BaselineValue:     baselineValue,
+		})
+	}
+
+	return regressions
+}
+
+// regressionLabel names a regression for display.
+func regressionLabel(reg PerformanceRegression) string {
+	if reg.Metric == "" {
+		return reg.BenchmarkName
+	}
+
+	return fmt.Sprintf("%s (%s %.2f → %.2f)", reg.BenchmarkName, reg.Metric, reg.BaselineValue, reg.CurrentValue)
+}
+
 func calculateSeverity(regressionPercent, threshold float64) string {
 	switch {
 	case regressionPercent >= threshold*3:
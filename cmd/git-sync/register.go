@@ -25,6 +25,7 @@ func (p gitSyncCmdProvider) Metadata() registry.CommandMetadata {
 		Dependencies: []string{"git"},
 		Tags:         []string{"sync", "clone", "repos", "git"},
 		Lifecycle:    registry.LifecycleStable,
+		Short:        "Git repository synchronization",
 	}
 }
 
@@ -160,7 +160,7 @@ without waiting for actual GitHub events.`,
 }
 
 func runEventServer(_ *cobra.Command, _ []string, host string, port int, secret string) error {
-	_ = context.Background() // ctx unused in mock implementation
+	ctx := context.Background()
 
 	logger := getLogger()
 	logger.Info("Starting GitHub webhook server", "host", host, "port", port)
@@ -174,6 +174,16 @@ func runEventServer(_ *cobra.Command, _ []string, host string, port int, secret
 	// Create webhook server
 	server := github.NewEventWebhookServer(processor, secret, logger)
 
+	// Acknowledge deliveries once queued; storage and handlers run on workers
+	var dispatchers []github.EventDispatcher
+	if dispatcher, ok := processor.(github.EventDispatcher); ok {
+		dispatchers = append(dispatchers, dispatcher)
+	}
+
+	ingestor := github.NewWebhookIngestor(storage, logger, nil, dispatchers...)
+	ingestor.Start(ctx)
+	server.SetIngestor(ingestor)
+
 	// Setup HTTP routes
 	mux := http.NewServeMux()
 	mux.HandleFunc("/webhook", server.HandleWebhook)
@@ -191,6 +201,17 @@ func runEventServer(_ *cobra.Command, _ []string, host string, port int, secret
 			http.Error(w, "Failed to encode metrics", http.StatusInternalServerError)
 		}
 	})
+	mux.HandleFunc("/metrics/ingest", func(w http.ResponseWriter, r *http.Request) {
+		if r.Method != http.MethodGet {
+			http.Error(w, "Method not allowed", http.StatusMethodNotAllowed)
+			return
+		}
+
+		w.Header().Set("Content-Type", "application/json")
+		if err := json.NewEncoder(w).Encode(ingestor.GetMetrics()); err != nil {
+			http.Error(w, "Failed to encode metrics", http.StatusInternalServerError)
+		}
+	})
 
 	// Start server
 	addr := fmt.Sprintf("%s:%d", host, port)
@@ -205,6 +226,7 @@ func runEventServer(_ *cobra.Command, _ []string, host string, port int, secret
 	fmt.Printf("Webhook endpoint: http://%s/webhook\n", addr)
 	fmt.Printf("Health check: http://%s/health\n", addr)
 	fmt.Printf("Metrics: http://%s/metrics\n", addr)
+	fmt.Printf("Ingest metrics: http://%s/metrics/ingest\n", addr)
 
 	return srv.ListenAndServe()
 }
@@ -25,6 +25,7 @@ func (p gitCmdProvider) Metadata() registry.CommandMetadata {
 		Dependencies: []string{"git"},
 		Tags:         []string{"git", "repository", "vcs", "clone", "pull"},
 		Lifecycle:    registry.LifecycleStable,
+		Short:        "🔗 통합 Git 플랫폼 관리 도구 (config, webhook, event)",
 	}
 }
 
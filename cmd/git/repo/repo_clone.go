@@ -109,6 +109,8 @@ using the stable 'gz synclone' command.`,
 	cmd.Flags().IntVar(&opts.Depth, "depth", 0, "Clone depth (0 = full clone)")
 	cmd.Flags().BoolVar(&opts.SingleBranch, "single-branch", false, "Clone single branch only")
 	cmd.Flags().StringVar(&opts.Branch, "branch", "", "Specific branch to clone")
+	cmd.Flags().StringVar(&opts.Filter, "filter", "", "Partial clone filter (blob:none, tree:0)")
+	cmd.Flags().StringVar(&opts.ObjectCache, "object-cache", "", "Shared object cache directory reused across clones")
 
 	// Flag validations and relationships
 	cmd.MarkFlagRequired("provider")
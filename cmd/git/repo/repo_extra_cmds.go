@@ -35,6 +35,10 @@ func newRepoSyncCmd() *cobra.Command {
   gz git repo sync --from github:org/repo --to gitlab:group/repo \
     --include-issues --include-wiki --include-releases
 
+  # Mirror an organization incrementally through persistent bare mirrors
+  gz git repo sync --from github:myorg --to gitea:myorg --mirror \
+    --include-issues --include-releases --parallel 8
+
   # Dry run to preview changes
   gz git repo sync --from github:org/repo --to gitlab:group/repo --dry-run`,
 		RunE: func(cmd *cobra.Command, args []string) error {
@@ -63,8 +67,14 @@ func newRepoSyncCmd() *cobra.Command {
 	cmd.Flags().StringVar(&opts.Match, "match", "", "Repository name pattern")
 	cmd.Flags().StringVar(&opts.Exclude, "exclude", "", "Exclude pattern")
 
+	// Mirror mode
+	cmd.Flags().BoolVar(&opts.Mirror, "mirror", false, "Keep persistent bare mirrors and push only changed refs (git push --mirror)")
+	cmd.Flags().StringVar(&opts.MirrorDir, "mirror-dir", "", "Directory for persistent mirrors (default: user cache dir)")
+
 	// Execution options
 	cmd.Flags().IntVar(&opts.Parallel, "parallel", 1, "Parallel sync workers")
+	cmd.Flags().IntVar(&opts.ComponentParallel, "component-parallel", sync.DefaultComponentParallel,
+		"Concurrent issue/wiki/release syncs across all repositories")
 	cmd.Flags().BoolVar(&opts.DryRun, "dry-run", false, "Preview without making changes")
 	cmd.Flags().BoolVar(&opts.Verbose, "verbose", false, "Verbose output")
 
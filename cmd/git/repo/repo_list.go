@@ -66,8 +66,12 @@ type ListOptions struct {
 	Limit   int
 	Quiet   bool
 	Verbose bool
+	Stream  bool
 }
 
+// listOutputFormats are the output formats of repo list.
+var listOutputFormats = []string{"table", "json", "yaml", "csv", "ndjson"}
+
 // newRepoListCmd creates the repo list command.
 func newRepoListCmd() *cobra.Command {
 	opts := &ListOptions{
@@ -85,9 +89,15 @@ func newRepoListCmd() *cobra.Command {
 This command provides comprehensive repository listing capabilities including:
 - Support for multiple Git platforms (GitHub, GitLab, Gitea)
 - Advanced filtering by various criteria
-- Multiple output formats (table, json, yaml, csv)
+- Multiple output formats (table, json, yaml, csv, ndjson)
 - Aggregation across multiple providers
-- Real-time repository statistics`,
+- Real-time repository statistics
+
+With --stream (implied by --format ndjson) repositories are printed page by
+page as they are fetched, in the order the provider returns them, instead of
+being collected and sorted first. Output starts immediately and memory stays
+constant, for piping large organizations into jq or grep. Streamed tables use
+fixed column widths; yaml cannot be streamed.`,
 		Example: `  # List repositories from a GitHub organization
   gz git repo list --provider github --org myorg
 
@@ -104,7 +114,10 @@ This command provides comprehensive repository listing capabilities including:
   gz git repo list --provider github --org myorg --archived-only
 
   # List with sorting and limits
-  gz git repo list --provider github --org myorg --sort stars --order desc --limit 10`,
+  gz git repo list --provider github --org myorg --sort stars --order desc --limit 10
+
+  # Stream a large organization as NDJSON
+  gz git repo list --provider github --org bigorg --format ndjson | jq -r .full_name`,
 		RunE: func(cmd *cobra.Command, args []string) error {
 			return runRepoList(cmd.Context(), opts)
 		},
@@ -130,10 +143,11 @@ This command provides comprehensive repository listing capabilities including:
 	cmd.Flags().StringVar(&opts.Order, "order", "asc", "Sort order (asc, desc)")
 
 	// Output options
-	cmd.Flags().StringVar(&opts.Format, "format", "table", "Output format (table, json, yaml, csv)")
+	cmd.Flags().StringVar(&opts.Format, "format", "table", "Output format (table, json, yaml, csv, ndjson)")
 	cmd.Flags().IntVar(&opts.Limit, "limit", 0, "Limit number of results (0 = no limit)")
 	cmd.Flags().BoolVar(&opts.Quiet, "quiet", false, "Suppress headers and extra output")
 	cmd.Flags().BoolVar(&opts.Verbose, "verbose", false, "Include additional repository details")
+	cmd.Flags().BoolVar(&opts.Stream, "stream", false, "Print repositories as they are fetched, in provider order")
 
 	// Validation rules
 	cmd.MarkFlagsMutuallyExclusive("archived-only", "no-archived")
@@ -159,6 +173,10 @@ func runRepoList(ctx context.Context, opts *ListOptions) error {
 		return fmt.Errorf("invalid options: %w", err)
 	}
 
+	if opts.streaming() {
+		return opts.streamRepositories(ctx, os.Stdout)
+	}
+
 	var allRepos []provider.Repository
 
 	if opts.AllProviders {
@@ -220,10 +238,14 @@ func (opts *ListOptions) Validate() error {
 	}
 
 	// Validate output format
-	if !isValidOutputFormat(opts.Format) {
+	if !contains(listOutputFormats, opts.Format) {
 		return fmt.Errorf("invalid output format: %s", opts.Format)
 	}
 
+	if opts.streaming() && opts.Format == "yaml" {
+		return fmt.Errorf("yaml output cannot be streamed")
+	}
+
 	// Validate star range
 	if opts.MinStars < 0 {
 		return fmt.Errorf("min-stars cannot be negative")
@@ -259,14 +281,9 @@ const (
 
 // listFromAllProviders gets repositories from all configured providers.
 func (opts *ListOptions) listFromAllProviders(ctx context.Context) ([]provider.Repository, error) {
-	// Load configuration
-	cfg, err := config.LoadConfig()
+	targets, err := configuredTargets()
 	if err != nil {
-		return nil, fmt.Errorf("failed to load configuration: %w", err)
-	}
-
-	if len(cfg.Providers) == 0 {
-		return nil, fmt.Errorf("no providers configured in configuration file")
+		return nil, err
 	}
 
 	var (
@@ -281,50 +298,42 @@ func (opts *ListOptions) listFromAllProviders(ctx context.Context) ([]provider.R
 	sem := make(chan struct{}, maxConcurrentRequests)
 
 	// 각 프로바이더에서 저장소 목록 조회
-	for providerType, providerConfig := range cfg.Providers {
-		// GitHub/Gitea는 Orgs 사용, GitLab은 Groups 사용
-		targets := providerConfig.Orgs
-		if providerType == config.ProviderGitLab {
-			targets = providerConfig.Groups
-		}
-
-		for _, target := range targets {
-			wg.Add(1)
-			go func(pType string, t config.GitTarget) {
-				defer wg.Done()
-
-				// Check context cancellation before acquiring semaphore
-				select {
-				case <-ctx.Done():
-					errMu.Lock()
-					errs = append(errs, fmt.Sprintf("%s/%s: %v", pType, t.Name, ctx.Err()))
-					errMu.Unlock()
-					return
-				case sem <- struct{}{}: // acquire semaphore
-					defer func() { <-sem }() // release semaphore
-				}
-
-				// Check context cancellation after acquiring semaphore
-				if ctx.Err() != nil {
-					errMu.Lock()
-					errs = append(errs, fmt.Sprintf("%s/%s: %v", pType, t.Name, ctx.Err()))
-					errMu.Unlock()
-					return
-				}
-
-				repos, err := opts.listFromProvider(ctx, pType, t.Name)
-				if err != nil {
-					errMu.Lock()
-					errs = append(errs, fmt.Sprintf("%s/%s: %v", pType, t.Name, err))
-					errMu.Unlock()
-					return
-				}
-
-				mu.Lock()
-				allRepos = append(allRepos, repos...)
-				mu.Unlock()
-			}(providerType, target)
-		}
+	for _, target := range targets {
+		wg.Add(1)
+		go func(t listTarget) {
+			defer wg.Done()
+
+			// Check context cancellation before acquiring semaphore
+			select {
+			case <-ctx.Done():
+				errMu.Lock()
+				errs = append(errs, fmt.Sprintf("%s: %v", t, ctx.Err()))
+				errMu.Unlock()
+				return
+			case sem <- struct{}{}: // acquire semaphore
+				defer func() { <-sem }() // release semaphore
+			}
+
+			// Check context cancellation after acquiring semaphore
+			if ctx.Err() != nil {
+				errMu.Lock()
+				errs = append(errs, fmt.Sprintf("%s: %v", t, ctx.Err()))
+				errMu.Unlock()
+				return
+			}
+
+			repos, err := opts.listFromProvider(ctx, t.providerType, t.org)
+			if err != nil {
+				errMu.Lock()
+				errs = append(errs, fmt.Sprintf("%s: %v", t, err))
+				errMu.Unlock()
+				return
+			}
+
+			mu.Lock()
+			allRepos = append(allRepos, repos...)
+			mu.Unlock()
+		}(target)
 	}
 
 	wg.Wait()
@@ -341,6 +350,54 @@ func (opts *ListOptions) listFromAllProviders(ctx context.Context) ([]provider.R
 	return allRepos, nil
 }
 
+// listTarget is an organization or group of a provider.
+type listTarget struct {
+	providerType string
+	org          string
+}
+
+func (t listTarget) String() string {
+	return t.providerType + "/" + t.org
+}
+
+// configuredTargets returns the organizations and groups of the configured
+// providers, ordered by provider and name.
+func configuredTargets() ([]listTarget, error) {
+	// Load configuration
+	cfg, err := config.LoadConfig()
+	if err != nil {
+		return nil, fmt.Errorf("failed to load configuration: %w", err)
+	}
+
+	if len(cfg.Providers) == 0 {
+		return nil, fmt.Errorf("no providers configured in configuration file")
+	}
+
+	var targets []listTarget
+
+	for providerType, providerConfig := range cfg.Providers {
+		// GitHub/Gitea는 Orgs 사용, GitLab은 Groups 사용
+		orgs := providerConfig.Orgs
+		if providerType == config.ProviderGitLab {
+			orgs = providerConfig.Groups
+		}
+
+		for _, org := range orgs {
+			targets = append(targets, listTarget{providerType: providerType, org: org.Name})
+		}
+	}
+
+	sort.Slice(targets, func(i, j int) bool {
+		if targets[i].providerType != targets[j].providerType {
+			return targets[i].providerType < targets[j].providerType
+		}
+
+		return targets[i].org < targets[j].org
+	})
+
+	return targets, nil
+}
+
 // listFromProvider gets repositories from a single provider.
 func (opts *ListOptions) listFromProvider(ctx context.Context, providerType, org string) ([]provider.Repository, error) {
 	// Get provider
@@ -349,6 +406,17 @@ func (opts *ListOptions) listFromProvider(ctx context.Context, providerType, org
 		return nil, fmt.Errorf("failed to get provider: %w", err)
 	}
 
+	// Get repositories
+	repoList, err := gitProvider.ListRepositories(ctx, opts.providerListOptions(org))
+	if err != nil {
+		return nil, fmt.Errorf("failed to list repositories: %w", err)
+	}
+
+	return repoList.Repositories, nil
+}
+
+// providerListOptions converts the options to provider list options for org.
+func (opts *ListOptions) providerListOptions(org string) provider.ListOptions {
 	// Convert visibility
 	var visibility provider.VisibilityType
 	switch opts.Visibility {
@@ -384,19 +452,25 @@ func (opts *ListOptions) listFromProvider(ctx context.Context, providerType, org
 		listOpts.Language = opts.Language
 	}
 
-	// Get repositories
-	repoList, err := gitProvider.ListRepositories(ctx, listOpts)
-	if err != nil {
-		return nil, fmt.Errorf("failed to list repositories: %w", err)
-	}
-
-	return repoList.Repositories, nil
+	return listOpts
 }
 
 // applyFilters applies client-side filtering to repositories.
 func (opts *ListOptions) applyFilters(repos []provider.Repository) []provider.Repository {
 	var filtered []provider.Repository
 
+	matches := opts.filter()
+	for _, repo := range repos {
+		if matches(repo) {
+			filtered = append(filtered, repo)
+		}
+	}
+
+	return filtered
+}
+
+// filter returns the client-side filter of the options.
+func (opts *ListOptions) filter() func(provider.Repository) bool {
 	// Parse updated-since date (already validated in Validate())
 	var updatedSinceTime time.Time
 	if opts.UpdatedSince != "" {
@@ -409,29 +483,27 @@ func (opts *ListOptions) applyFilters(repos []provider.Repository) []provider.Re
 		matchPattern, _ = regexp.Compile(opts.Match)
 	}
 
-	for _, repo := range repos {
+	return func(repo provider.Repository) bool {
 		// Name pattern filter
 		if matchPattern != nil && !matchPattern.MatchString(repo.Name) {
-			continue
+			return false
 		}
 
 		// Stars filter
 		if opts.MinStars > 0 && repo.Stars < opts.MinStars {
-			continue
+			return false
 		}
 		if opts.MaxStars > 0 && repo.Stars > opts.MaxStars {
-			continue
+			return false
 		}
 
 		// Updated-since filter
 		if !updatedSinceTime.IsZero() && repo.UpdatedAt.Before(updatedSinceTime) {
-			continue
+			return false
 		}
 
-		filtered = append(filtered, repo)
+		return true
 	}
-
-	return filtered
 }
 
 // applySorting sorts repositories according to options.
@@ -596,31 +668,13 @@ func (opts *ListOptions) outputCSV(repos []provider.Repository) error {
 	defer writer.Flush()
 
 	// Write CSV header
-	header := []string{"Name", "Full Name", "Default Branch", "Private", "Fork", "Language", "Description", "Stars", "Forks", "Clone URL", "SSH URL", "HTML URL", "Created At", "Updated At"}
-	if err := writer.Write(header); err != nil {
+	if err := writer.Write(csvHeader); err != nil {
 		return fmt.Errorf("failed to write CSV header: %w", err)
 	}
 
 	// Write repository data
 	for _, repo := range repos {
-		record := []string{
-			repo.Name,
-			repo.FullName,
-			repo.DefaultBranch,
-			fmt.Sprintf("%t", repo.Private),
-			fmt.Sprintf("%t", repo.Fork),
-			repo.Language,
-			repo.Description,
-			fmt.Sprintf("%d", repo.Stars),
-			fmt.Sprintf("%d", repo.Forks),
-			repo.CloneURL,
-			repo.SSHURL,
-			repo.HTMLURL,
-			formatTime(repo.CreatedAt),
-			formatTime(repo.UpdatedAt),
-		}
-
-		if err := writer.Write(record); err != nil {
+		if err := writer.Write(csvRecord(repo)); err != nil {
 			return fmt.Errorf("failed to write CSV record: %w", err)
 		}
 	}
@@ -628,6 +682,29 @@ func (opts *ListOptions) outputCSV(repos []provider.Repository) error {
 	return nil
 }
 
+// csvHeader is the header of the CSV output.
+var csvHeader = []string{"Name", "Full Name", "Default Branch", "Private", "Fork", "Language", "Description", "Stars", "Forks", "Clone URL", "SSH URL", "HTML URL", "Created At", "Updated At"}
+
+// csvRecord returns the CSV fields of a repository.
+func csvRecord(repo provider.Repository) []string {
+	return []string{
+		repo.Name,
+		repo.FullName,
+		repo.DefaultBranch,
+		fmt.Sprintf("%t", repo.Private),
+		fmt.Sprintf("%t", repo.Fork),
+		repo.Language,
+		repo.Description,
+		fmt.Sprintf("%d", repo.Stars),
+		fmt.Sprintf("%d", repo.Forks),
+		repo.CloneURL,
+		repo.SSHURL,
+		repo.HTMLURL,
+		formatTime(repo.CreatedAt),
+		formatTime(repo.UpdatedAt),
+	}
+}
+
 // formatTime formats a time.Time for CSV output
 func formatTime(t time.Time) string {
 	if t.IsZero() {
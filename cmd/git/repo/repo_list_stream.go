@@ -0,0 +1,215 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package repo
+
+import (
+	"context"
+	"fmt"
+	"io"
+	"os"
+	"strconv"
+	"strings"
+
+	"github.com/gizzahub/gzh-cli/internal/cli"
+	"github.com/gizzahub/gzh-cli/pkg/git/provider"
+)
+
+// streaming reports whether repositories are printed as they are fetched.
+func (opts *ListOptions) streaming() bool {
+	return opts.Stream || opts.Format == cli.FormatNDJSON
+}
+
+// streamRepositories prints the repositories of the targets as the provider
+// pages arrive. Targets are listed one after another, so the output keeps
+// each provider's order; client-side sorting would need the full listing.
+func (opts *ListOptions) streamRepositories(ctx context.Context, w io.Writer) error {
+	targets := []listTarget{{providerType: opts.Provider, org: opts.Org}}
+
+	if opts.AllProviders {
+		var err error
+
+		if targets, err = configuredTargets(); err != nil {
+			return fmt.Errorf("failed to list from all providers: %w", err)
+		}
+	}
+
+	records := &repositoryRecords{
+		targets: targets,
+		open: func(t listTarget) (provider.RepositoryIterator, error) {
+			gitProvider, err := getGitProvider(t.providerType, t.org)
+			if err != nil {
+				return nil, fmt.Errorf("failed to get provider: %w", err)
+			}
+
+			return provider.IterateRepositories(ctx, gitProvider, opts.providerListOptions(t.org)), nil
+		},
+		matches: opts.filter(),
+		limit:   opts.Limit,
+	}
+
+	return opts.writeRepositories(w, records)
+}
+
+// writeRepositories writes the records in the output format. A target that
+// fails does not stop the others, but the listing fails when nothing could be
+// listed, or when the only target failed.
+func (opts *ListOptions) writeRepositories(w io.Writer, records *repositoryRecords) error {
+	defer records.Close()
+
+	writer, err := cli.NewOutputFormatterWithWriter(opts.Format, w).NewStreamWriter(opts.streamColumns())
+	if err != nil {
+		return err
+	}
+
+	for records.Next() {
+		if err := writer.Write(records.Record()); err != nil {
+			return fmt.Errorf("failed to write repository: %w", err)
+		}
+	}
+
+	if err := writer.Close(); err != nil {
+		return fmt.Errorf("failed to write repositories: %w", err)
+	}
+
+	if len(records.failures) > 0 {
+		if !opts.AllProviders {
+			return fmt.Errorf("failed to list repositories: %s", strings.Join(records.failures, "; "))
+		}
+
+		if writer.Count() == 0 {
+			return fmt.Errorf("failed to list repositories from all providers: %s", strings.Join(records.failures, "; "))
+		}
+
+		fmt.Fprintf(os.Stderr, "Warning: some providers failed: %s\n", strings.Join(records.failures, "; "))
+	}
+
+	if opts.Format == cli.FormatTable && !opts.Quiet {
+		fmt.Fprintf(w, "\nTotal: %d repositories\n", writer.Count())
+	}
+
+	return nil
+}
+
+// streamColumns returns the CSV and table columns of streamed repositories.
+// Table columns have the fixed widths of the collected table, so rows print
+// without sampling.
+func (opts *ListOptions) streamColumns() cli.StreamColumns {
+	if opts.Format == cli.FormatCSV {
+		return cli.StreamColumns{
+			Headers: csvHeader,
+			Row:     func(record any) []string { return csvRecord(record.(provider.Repository)) },
+		}
+	}
+
+	columns := cli.StreamColumns{
+		Headers:  []string{"NAME", "PRIVATE", "LANGUAGE", "STARS", "UPDATED"},
+		Widths:   []int{colWidthName, colWidthPrivate, colWidthLanguage, colWidthStars, colWidthUpdated},
+		NoHeader: opts.Quiet,
+	}
+
+	if opts.Verbose {
+		columns.Headers = []string{"NAME", "PRIVATE", "LANGUAGE", "STARS", "FORKS", "ISSUES", "UPDATED"}
+		columns.Widths = []int{colWidthName, colWidthPrivate, colWidthLanguage, colWidthStarsV, colWidthForks, colWidthIssues, colWidthUpdated}
+	}
+
+	columns.Row = func(record any) []string {
+		repo := record.(provider.Repository)
+
+		private := "public"
+		if repo.Private {
+			private = "private"
+		}
+
+		language := repo.Language
+		if language == "" {
+			language = "n/a"
+		}
+
+		if opts.Verbose {
+			return []string{repo.FullName, private, language, strconv.Itoa(repo.Stars), strconv.Itoa(repo.Forks),
+				strconv.Itoa(repo.Issues), repo.UpdatedAt.Format("2006-01-02")}
+		}
+
+		return []string{repo.FullName, private, language, strconv.Itoa(repo.Stars), repo.UpdatedAt.Format("2006-01-02")}
+	}
+
+	return columns
+}
+
+// repositoryRecords iterates the filtered repositories of targets, one
+// target after another, fetching pages as they are consumed. Failures of
+// targets are collected and the iteration continues with the next target.
+type repositoryRecords struct {
+	targets []listTarget
+	open    func(listTarget) (provider.RepositoryIterator, error)
+	matches func(provider.Repository) bool
+	limit   int
+
+	current  provider.RepositoryIterator
+	target   listTarget
+	repo     provider.Repository
+	returned int
+	failures []string
+}
+
+func (r *repositoryRecords) Next() bool {
+	if r.limit > 0 && r.returned >= r.limit {
+		r.Close()
+		return false
+	}
+
+	for {
+		if r.current == nil {
+			if len(r.targets) == 0 {
+				return false
+			}
+
+			r.target, r.targets = r.targets[0], r.targets[1:]
+
+			it, err := r.open(r.target)
+			if err != nil {
+				r.failures = append(r.failures, fmt.Sprintf("%s: %v", r.target, err))
+				continue
+			}
+
+			r.current = it
+		}
+
+		for r.current.Next() {
+			if repo := r.current.Repository(); r.matches(repo) {
+				r.repo = repo
+				r.returned++
+
+				return true
+			}
+		}
+
+		if err := r.current.Err(); err != nil {
+			r.failures = append(r.failures, fmt.Sprintf("%s: %v", r.target, err))
+		}
+
+		_ = r.current.Close()
+		r.current = nil
+	}
+}
+
+func (r *repositoryRecords) Record() any {
+	return r.repo
+}
+
+// Err returns nil: failures of targets do not stop the iteration and are
+// reported by writeRepositories.
+func (r *repositoryRecords) Err() error {
+	return nil
+}
+
+// Close releases the iterator of the current target and skips the rest.
+func (r *repositoryRecords) Close() {
+	if r.current != nil {
+		_ = r.current.Close()
+		r.current = nil
+	}
+
+	r.targets = nil
+}
@@ -0,0 +1,181 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package repo
+
+import (
+	"bytes"
+	"encoding/json"
+	"errors"
+	"strings"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+
+	"github.com/gizzahub/gzh-cli/pkg/git/provider"
+)
+
+// fakeRepositoryIterator yields repositories, then fails with err if set.
+type fakeRepositoryIterator struct {
+	repos  []provider.Repository
+	err    error
+	pulled int
+	closed bool
+}
+
+func (it *fakeRepositoryIterator) Next() bool {
+	if it.closed || it.pulled >= len(it.repos) {
+		return false
+	}
+
+	it.pulled++
+
+	return true
+}
+
+func (it *fakeRepositoryIterator) Repository() provider.Repository {
+	return it.repos[it.pulled-1]
+}
+
+func (it *fakeRepositoryIterator) Err() error {
+	return it.err
+}
+
+func (it *fakeRepositoryIterator) Close() error {
+	it.closed = true
+	return nil
+}
+
+func fakeRecords(opts *ListOptions, iterators map[string]*fakeRepositoryIterator, targets ...string) *repositoryRecords {
+	records := &repositoryRecords{
+		open: func(t listTarget) (provider.RepositoryIterator, error) {
+			it, ok := iterators[t.org]
+			if !ok {
+				return nil, errors.New("unknown organization")
+			}
+
+			return it, nil
+		},
+		matches: opts.filter(),
+		limit:   opts.Limit,
+	}
+
+	for _, org := range targets {
+		records.targets = append(records.targets, listTarget{providerType: "github", org: org})
+	}
+
+	return records
+}
+
+func repos(names ...string) []provider.Repository {
+	list := make([]provider.Repository, 0, len(names))
+	for i, name := range names {
+		list = append(list, provider.Repository{Name: name, FullName: "org/" + name, Stars: i})
+	}
+
+	return list
+}
+
+func TestWriteRepositories_NDJSON(t *testing.T) {
+	opts := &ListOptions{Format: "ndjson", AllProviders: true, MinStars: 1, Limit: 2}
+	first := &fakeRepositoryIterator{repos: repos("zero", "one")}
+	second := &fakeRepositoryIterator{repos: repos("skipped", "two", "three")}
+
+	var out bytes.Buffer
+	err := opts.writeRepositories(&out, fakeRecords(opts, map[string]*fakeRepositoryIterator{"a": first, "b": second}, "a", "missing", "b"))
+	require.NoError(t, err)
+
+	var names []string
+	for _, line := range strings.Split(strings.TrimSpace(out.String()), "\n") {
+		var repo provider.Repository
+		require.NoError(t, json.Unmarshal([]byte(line), &repo))
+		names = append(names, repo.Name)
+	}
+
+	assert.Equal(t, []string{"one", "two"}, names, "filtered and limited in provider order")
+	assert.True(t, second.closed, "the listing stops at the limit")
+	assert.Equal(t, 2, second.pulled)
+}
+
+func TestWriteRepositories_Failures(t *testing.T) {
+	failure := errors.New("rate limited")
+
+	// A single target fails the listing, after what it listed was written
+	opts := &ListOptions{Format: "ndjson", Provider: "github", Org: "a"}
+	var out bytes.Buffer
+	err := opts.writeRepositories(&out, fakeRecords(opts, map[string]*fakeRepositoryIterator{
+		"a": {repos: repos("zero"), err: failure},
+	}, "a"))
+	assert.ErrorContains(t, err, "github/a: rate limited")
+	assert.Contains(t, out.String(), `"name":"zero"`)
+
+	// All providers only fail when nothing was listed
+	opts = &ListOptions{Format: "json", AllProviders: true}
+	out.Reset()
+	err = opts.writeRepositories(&out, fakeRecords(opts, map[string]*fakeRepositoryIterator{
+		"a": {err: failure},
+		"b": {repos: repos("zero")},
+	}, "a", "b"))
+	require.NoError(t, err)
+
+	var listed []provider.Repository
+	require.NoError(t, json.Unmarshal(out.Bytes(), &listed))
+	assert.Len(t, listed, 1)
+
+	out.Reset()
+	err = opts.writeRepositories(&out, fakeRecords(opts, map[string]*fakeRepositoryIterator{"a": {err: failure}}, "a"))
+	assert.ErrorContains(t, err, "failed to list repositories from all providers")
+}
+
+func TestWriteRepositories_Table(t *testing.T) {
+	opts := &ListOptions{Format: "table", Stream: true}
+
+	var out bytes.Buffer
+	err := opts.writeRepositories(&out, fakeRecords(opts, map[string]*fakeRepositoryIterator{
+		"a": {repos: []provider.Repository{{FullName: "org/" + strings.Repeat("x", 50), Private: true, Stars: 7}}},
+	}, "a"))
+	require.NoError(t, err)
+
+	lines := strings.Split(out.String(), "\n")
+	assert.True(t, strings.HasPrefix(lines[0], "NAME"+strings.Repeat(" ", colWidthName-len("NAME")+2)+"PRIVATE"))
+	assert.Contains(t, lines[2], "org/"+strings.Repeat("x", colWidthName-7)+"...")
+	assert.Contains(t, lines[2], "private")
+	assert.Contains(t, lines[2], "n/a")
+	assert.Contains(t, out.String(), "Total: 1 repositories")
+
+	// Quiet drops the header and the summary
+	opts.Quiet = true
+	out.Reset()
+	err = opts.writeRepositories(&out, fakeRecords(opts, map[string]*fakeRepositoryIterator{"a": {repos: repos("zero")}}, "a"))
+	require.NoError(t, err)
+	assert.Equal(t, 1, strings.Count(out.String(), "\n"))
+}
+
+func TestWriteRepositories_CSV(t *testing.T) {
+	opts := &ListOptions{Format: "csv", Stream: true}
+
+	var out bytes.Buffer
+	err := opts.writeRepositories(&out, fakeRecords(opts, map[string]*fakeRepositoryIterator{"a": {repos: repos("zero")}}, "a"))
+	require.NoError(t, err)
+
+	lines := strings.Split(strings.TrimSpace(out.String()), "\n")
+	require.Len(t, lines, 2)
+	assert.Equal(t, strings.Join(csvHeader, ","), lines[0])
+	assert.True(t, strings.HasPrefix(lines[1], "zero,org/zero,"))
+}
+
+func TestListOptions_Validate_Streaming(t *testing.T) {
+	base := ListOptions{Visibility: "all", Sort: "name", Order: "asc"}
+
+	for _, format := range []string{"csv", "ndjson"} {
+		opts := base
+		opts.Format = format
+		assert.NoError(t, opts.Validate(), format)
+	}
+
+	opts := base
+	opts.Format = "yaml"
+	opts.Stream = true
+	assert.EqualError(t, opts.Validate(), "yaml output cannot be streamed")
+}
@@ -22,6 +22,7 @@ func NewCmd() *cobra.Command {
 	cmd.AddCommand(newRepoCloneCmd())
 	cmd.AddCommand(newRepoCloneOrUpdateCmd())
 	cmd.AddCommand(newRepoListCmd())
+	cmd.AddCommand(newRepoStatusCmd())
 	cmd.AddCommand(newRepoCreateCmd())
 	cmd.AddCommand(newRepoDeleteCmd())
 	cmd.AddCommand(newRepoArchiveCmd())
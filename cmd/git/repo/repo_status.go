@@ -0,0 +1,198 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package repo
+
+import (
+	"context"
+	"encoding/json"
+	"fmt"
+	"io"
+	"os"
+	"path/filepath"
+	"text/tabwriter"
+
+	"github.com/spf13/cobra"
+
+	"github.com/gizzahub/gzh-cli/internal/synclone/discovery"
+)
+
+// StatusOptions contains options for fleet working-tree status.
+type StatusOptions struct {
+	// Scan options
+	Path     string
+	MaxDepth int
+
+	// Index options
+	Parallel int
+	Refresh  bool
+	NoIndex  bool
+
+	// Output options
+	Format    string
+	DirtyOnly bool
+}
+
+// newRepoStatusCmd creates the repo status command.
+func newRepoStatusCmd() *cobra.Command {
+	opts := &StatusOptions{
+		Path:     ".",
+		MaxDepth: 3,
+		Format:   "table",
+	}
+
+	cmd := &cobra.Command{
+		Use:   "status",
+		Short: "Show working-tree status of every local repository",
+		Long: `Show the branch, dirty state and ahead/behind counts of every repository
+under a directory, such as a workspace synced by synclone.
+
+Statuses are kept in an index under ~/.gzh/cache/status. Only repositories
+whose .git/index, HEAD, refs or config changed since the last query are
+refreshed with git status; the others are answered without running git.
+Edits to tracked files that git has not looked at yet are picked up with
+--refresh.`,
+		Example: `  # Status of every repository under the current directory
+  gz git repo status
+
+  # Only repositories with local changes, as JSON
+  gz git repo status --path ~/workspace --dirty-only --format json
+
+  # Ignore the index and ask git for every repository
+  gz git repo status --refresh`,
+		RunE: func(cmd *cobra.Command, args []string) error {
+			return runRepoStatus(cmd.Context(), cmd.OutOrStdout(), opts)
+		},
+	}
+
+	// Scan options
+	cmd.Flags().StringVar(&opts.Path, "path", ".", "Directory to scan for repositories")
+	cmd.Flags().IntVar(&opts.MaxDepth, "max-depth", 3, "Maximum directory depth to scan")
+
+	// Index options
+	cmd.Flags().IntVar(&opts.Parallel, "parallel", 0, "Number of concurrent git status workers (default: number of CPUs)")
+	cmd.Flags().BoolVar(&opts.Refresh, "refresh", false, "Refresh every repository instead of trusting the index")
+	cmd.Flags().BoolVar(&opts.NoIndex, "no-index", false, "Do not read or write the status index")
+
+	// Output options
+	cmd.Flags().StringVar(&opts.Format, "format", "table", "Output format (table, json)")
+	cmd.Flags().BoolVar(&opts.DirtyOnly, "dirty-only", false, "Show only repositories with local changes or unpushed commits")
+
+	return cmd
+}
+
+// runRepoStatus executes the repo status command.
+func runRepoStatus(ctx context.Context, out io.Writer, opts *StatusOptions) error {
+	if opts.Format != "table" && opts.Format != "json" {
+		return fmt.Errorf("invalid output format: %s", opts.Format)
+	}
+
+	if ctx == nil {
+		ctx = context.Background()
+	}
+
+	basePath, err := filepath.Abs(opts.Path)
+	if err != nil {
+		return fmt.Errorf("invalid path: %w", err)
+	}
+
+	discoverer := discovery.NewRepoDiscoverer(basePath)
+	discoverer.SetMaxDepth(opts.MaxDepth)
+
+	repos, err := discoverer.DiscoverRepos()
+	if err != nil {
+		return err
+	}
+
+	repoPaths := make([]string, len(repos))
+	for i, repo := range repos {
+		repoPaths[i] = repo.Path
+	}
+
+	indexPath := discovery.StatusIndexPath(basePath)
+	if opts.NoIndex {
+		indexPath = ""
+	}
+
+	index := discovery.LoadStatusIndex(indexPath)
+	if opts.Parallel > 0 {
+		index.Workers = opts.Parallel
+	}
+
+	statuses, stats, err := index.Status(ctx, repoPaths, opts.Refresh)
+	if err != nil {
+		return fmt.Errorf("failed to get repository status: %w", err)
+	}
+
+	if err := index.Save(); err != nil {
+		// The index only saves work; failing to persist it is not an error
+		fmt.Fprintf(os.Stderr, "Warning: %v\n", err)
+	}
+
+	if opts.DirtyOnly {
+		filtered := statuses[:0]
+		for _, status := range statuses {
+			if status.Dirty || status.Ahead > 0 || status.Err != "" {
+				filtered = append(filtered, status)
+			}
+		}
+
+		statuses = filtered
+	}
+
+	if opts.Format == "json" {
+		encoder := json.NewEncoder(out)
+		encoder.SetIndent("", "  ")
+
+		return encoder.Encode(statuses)
+	}
+
+	return writeStatusTable(out, basePath, statuses, stats)
+}
+
+// writeStatusTable prints one row per repository, with paths relative to basePath.
+func writeStatusTable(out io.Writer, basePath string, statuses []discovery.RepoStatus, stats discovery.StatusStats) error {
+	w := tabwriter.NewWriter(out, 0, 0, 2, ' ', 0)
+	fmt.Fprintln(w, "REPOSITORY\tBRANCH\tSTATE\tAHEAD\tBEHIND\tUPSTREAM")
+
+	for _, status := range statuses {
+		name, err := filepath.Rel(basePath, status.Path)
+		if err != nil {
+			name = status.Path
+		}
+
+		if status.Err != "" {
+			fmt.Fprintf(w, "%s\t-\terror: %s\t-\t-\t-\n", name, status.Err)
+			continue
+		}
+
+		branch := status.Branch
+		if branch == "" {
+			branch = "(detached)"
+		}
+
+		state := "clean"
+		if status.Dirty {
+			state = "dirty"
+		}
+
+		upstream := status.Upstream
+		switch {
+		case upstream == "":
+			upstream = "-"
+		case status.UpstreamHead == "":
+			upstream += " (gone)"
+		}
+
+		fmt.Fprintf(w, "%s\t%s\t%s\t%d\t%d\t%s\n", name, branch, state, status.Ahead, status.Behind, upstream)
+	}
+
+	if err := w.Flush(); err != nil {
+		return err
+	}
+
+	_, err := fmt.Fprintf(out, "\n%d repositories: %d from index, %d refreshed, %d failed\n",
+		stats.Cached+stats.Refreshed+stats.Failed, stats.Cached, stats.Refreshed, stats.Failed)
+
+	return err
+}
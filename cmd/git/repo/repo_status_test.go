@@ -0,0 +1,41 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package repo
+
+import (
+	"bytes"
+	"context"
+	"path/filepath"
+	"strings"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+
+	"github.com/gizzahub/gzh-cli/internal/synclone/discovery"
+)
+
+func TestWriteStatusTable(t *testing.T) {
+	base := filepath.Join(string(filepath.Separator), "work")
+	statuses := []discovery.RepoStatus{
+		{Path: filepath.Join(base, "org", "api"), Branch: "main", Upstream: "origin/main", UpstreamHead: "abc", Ahead: 2},
+		{Path: filepath.Join(base, "org", "web"), Dirty: true, Upstream: "origin/old"},
+		{Path: filepath.Join(base, "org", "broken"), Err: "git status failed"},
+	}
+
+	var out bytes.Buffer
+	require.NoError(t, writeStatusTable(&out, base, statuses, discovery.StatusStats{Cached: 2, Failed: 1}))
+
+	lines := strings.Split(strings.TrimSpace(out.String()), "\n")
+	require.Len(t, lines, 6)
+	assert.Equal(t, []string{"org/api", "main", "clean", "2", "0", "origin/main"}, strings.Fields(lines[1]))
+	assert.Equal(t, []string{"org/web", "(detached)", "dirty", "0", "0", "origin/old", "(gone)"}, strings.Fields(lines[2]))
+	assert.Contains(t, lines[3], "error: git status failed")
+	assert.Equal(t, "3 repositories: 2 from index, 0 refreshed, 1 failed", lines[5])
+}
+
+func TestRunRepoStatus_InvalidFormat(t *testing.T) {
+	err := runRepoStatus(context.Background(), &bytes.Buffer{}, &StatusOptions{Path: t.TempDir(), Format: "yaml"})
+	assert.EqualError(t, err, "invalid output format: yaml")
+}
@@ -192,6 +192,7 @@ func newBulkWebhookCmd() *cobra.Command {
 	createCmd.Flags().StringSlice("events", []string{"push"}, "이벤트 목록")
 	createCmd.Flags().Bool("active", true, "웹훅 활성화 여부")
 	createCmd.Flags().StringSlice("repos", nil, "특정 리포지토리만 (비어있으면 모든 리포지토리)")
+	createCmd.Flags().Int("parallel", github.DefaultPipelineConcurrency, "동시에 처리할 리포지토리 수")
 	if err := createCmd.MarkFlagRequired("name"); err != nil {
 		// Error marking flag as required - continue without marking
 		fmt.Printf("Warning: could not mark 'name' flag as required: %v\n", err)
@@ -601,6 +602,7 @@ func runBulkCreateWebhooks(cmd *cobra.Command, args []string) error {
 	events, _ := cmd.Flags().GetStringSlice("events")
 	active, _ := cmd.Flags().GetBool("active")
 	repos, _ := cmd.Flags().GetStringSlice("repos")
+	parallel, _ := cmd.Flags().GetInt("parallel")
 
 	webhookService := createMockWebhookService()
 
@@ -617,6 +619,17 @@ func runBulkCreateWebhooks(cmd *cobra.Command, args []string) error {
 				ContentType: "json",
 			},
 		},
+		BulkWebhookOptions: github.BulkWebhookOptions{
+			Concurrency: parallel,
+			// Report each repository as soon as it is done
+			OnResult: func(r github.WebhookOperationResult) {
+				if r.Success {
+					fmt.Printf("✅ %s\n", r.Repository)
+				} else {
+					fmt.Printf("❌ %s: %s\n", r.Repository, r.Error)
+				}
+			},
+		},
 	}
 
 	fmt.Printf("🚀 %s 조직에 대량 웹훅 생성을 시작합니다...\n", org)
@@ -632,16 +645,6 @@ func runBulkCreateWebhooks(cmd *cobra.Command, args []string) error {
 	fmt.Printf("• 실패: %d\n", result.FailureCount)
 	fmt.Printf("• 실행 시간: %s\n", result.ExecutionTime)
 
-	if result.FailureCount > 0 {
-		fmt.Printf("\n❌ 실패한 작업:\n")
-
-		for _, r := range result.Results {
-			if !r.Success {
-				fmt.Printf("• %s: %s\n", r.Repository, r.Error)
-			}
-		}
-	}
-
 	return nil
 }
 
@@ -11,7 +11,9 @@ import (
 	"os/exec"
 	"path/filepath"
 	"runtime"
+	"slices"
 	"strings"
+	"sync"
 	"time"
 
 	"github.com/gizzahub/gzh-cli/internal/idecore"
@@ -202,46 +204,142 @@ func (d *IDEDetector) queryFlatpak(appName string) string {
 	return ""
 }
 
-// DetectIDEs scans the system for installed IDEs.
+// maxConcurrentProbes bounds the installations probed at once. Probes mostly
+// wait for forked package managers and IDE binaries.
+const maxConcurrentProbes = 4
+
+// installCacheTTL bounds how long a cached probe result is reused. Snap and
+// Flatpak launchers are shared binaries that do not change when the IDE
+// behind them is updated, so the fingerprint alone cannot catch every update.
+const installCacheTTL = 24 * time.Hour
+
+// installation is an IDE found on disk. Probing it for its version and
+// install method may fork package managers and IDE binaries, so probe only
+// runs when the cache has no recent result for the installation's current
+// fingerprint.
+type installation struct {
+	executable string
+	// versionSource is the file holding the installation's version, such as
+	// product-info.json or package.json. Its fingerprint is used instead of
+	// the executable's when set, since launchers often outlive updates.
+	versionSource string
+	probe         func() IDE
+}
+
+// fingerprint returns the fingerprint of the version source, or of the
+// executable when there is none.
+func (install installation) fingerprint() (idecore.Fingerprint, error) {
+	if install.versionSource != "" {
+		return idecore.FingerprintOf(install.versionSource)
+	}
+
+	return idecore.FingerprintOf(install.executable)
+}
+
+// DetectIDEs scans the system for installed IDEs. With useCache, an
+// installation that is unchanged since a recent scan is served from the
+// cache, so only new and updated installations are probed.
 func (d *IDEDetector) DetectIDEs(useCache bool) ([]IDE, error) {
+	var cached map[string]idecore.CachedInstall
 	if useCache {
-		if ides, err := d.loadFromCache(); err == nil {
-			return ides, nil
-		}
+		cached = d.loadFromCache()
 	}
 
-	var allIDEs []IDE
+	ides, installs := d.probeInstallations(d.discoverInstallations(), cached)
 
-	// Detect JetBrains IDEs
-	jetbrainsIDEs, err := d.detectJetBrainsIDEs()
-	if err == nil {
-		allIDEs = append(allIDEs, jetbrainsIDEs...)
+	// Save to cache
+	if err := d.saveToCache(ides, installs); err != nil {
+		// Don't fail if we can't save cache
+		fmt.Printf("Warning: Failed to save IDE cache: %v\n", err)
 	}
 
-	// Detect VS Code family
-	vscodeIDEs, err := d.detectVSCodeFamily()
-	if err == nil {
-		allIDEs = append(allIDEs, vscodeIDEs...)
+	return ides, nil
+}
+
+// discoverInstallations runs the detectors concurrently and returns their
+// installations in detector order.
+func (d *IDEDetector) discoverInstallations() []installation {
+	detectors := []func() []installation{
+		d.detectJetBrainsIDEs,
+		d.detectVSCodeFamily,
+		d.detectOtherIDEs,
 	}
 
-	// Detect other IDEs
-	otherIDEs, err := d.detectOtherIDEs()
-	if err == nil {
-		allIDEs = append(allIDEs, otherIDEs...)
+	results := make([][]installation, len(detectors))
+
+	var wg sync.WaitGroup
+	for i, detect := range detectors {
+		wg.Add(1)
+
+		go func() {
+			defer wg.Done()
+			results[i] = detect()
+		}()
 	}
 
-	// Save to cache
-	if err := d.saveToCache(allIDEs); err != nil {
-		// Don't fail if we can't save cache
-		fmt.Printf("Warning: Failed to save IDE cache: %v\n", err)
+	wg.Wait()
+
+	var installs []installation
+	for _, result := range results {
+		installs = append(installs, result...)
+	}
+
+	return installs
+}
+
+// probeInstallations probes the installations concurrently, reusing cached
+// results younger than installCacheTTL whose fingerprint still matches. It
+// returns the IDEs in installation order and the cache entries for the next
+// scan.
+func (d *IDEDetector) probeInstallations(installs []installation, cached map[string]idecore.CachedInstall) ([]IDE, map[string]idecore.CachedInstall) {
+	ides := make([]IDE, len(installs))
+	entries := make(map[string]idecore.CachedInstall, len(installs))
+	sem := make(chan struct{}, maxConcurrentProbes)
+
+	var (
+		wg sync.WaitGroup
+		mu sync.Mutex
+	)
+
+	for i, install := range installs {
+		fingerprint, err := install.fingerprint()
+		if entry, ok := cached[install.executable]; ok && err == nil && entry.Fingerprint.Equal(fingerprint) &&
+			time.Since(entry.ProbedAt) < installCacheTTL {
+			ides[i] = entry.IDE
+
+			mu.Lock()
+			entries[install.executable] = entry
+			mu.Unlock()
+
+			continue
+		}
+
+		wg.Add(1)
+
+		go func() {
+			defer wg.Done()
+
+			sem <- struct{}{}
+			defer func() { <-sem }()
+
+			ides[i] = install.probe()
+
+			if err == nil {
+				mu.Lock()
+				entries[install.executable] = idecore.CachedInstall{Fingerprint: fingerprint, ProbedAt: time.Now(), IDE: ides[i]}
+				mu.Unlock()
+			}
+		}()
 	}
 
-	return allIDEs, nil
+	wg.Wait()
+
+	return ides, entries
 }
 
 // detectJetBrainsIDEs detects JetBrains IDE installations.
-func (d *IDEDetector) detectJetBrainsIDEs() ([]IDE, error) {
-	var ides []IDE
+func (d *IDEDetector) detectJetBrainsIDEs() []installation {
+	var installs []installation
 
 	// Check JetBrains Toolbox installations
 	toolboxPath := d.getJetBrainsToolboxPath()
@@ -256,8 +354,8 @@ func (d *IDEDetector) detectJetBrainsIDEs() ([]IDE, error) {
 				ideName := entry.Name()
 				idePath := filepath.Join(toolboxPath, ideName)
 
-				if ide := d.createJetBrainsIDE(ideName, idePath); ide != nil {
-					ides = append(ides, *ide)
+				if install, ok := d.jetBrainsInstallation(ideName, idePath); ok {
+					installs = append(installs, install)
 				}
 			}
 		}
@@ -267,18 +365,18 @@ func (d *IDEDetector) detectJetBrainsIDEs() ([]IDE, error) {
 	systemPaths := d.getJetBrainsSystemPaths()
 	for _, path := range systemPaths {
 		if _, err := os.Stat(path); err == nil {
-			if ide := d.createJetBrainsIDE(filepath.Base(path), path); ide != nil {
-				ides = append(ides, *ide)
+			if install, ok := d.jetBrainsInstallation(filepath.Base(path), path); ok {
+				installs = append(installs, install)
 			}
 		}
 	}
 
-	return ides, nil
+	return installs
 }
 
 // detectVSCodeFamily detects VS Code family IDEs.
-func (d *IDEDetector) detectVSCodeFamily() ([]IDE, error) {
-	var ides []IDE
+func (d *IDEDetector) detectVSCodeFamily() []installation {
+	var installs []installation
 
 	vscodeTypes := []struct {
 		name        string
@@ -294,33 +392,34 @@ func (d *IDEDetector) detectVSCodeFamily() ([]IDE, error) {
 
 	for _, vscode := range vscodeTypes {
 		if path := d.findExecutable(vscode.executable); path != "" {
-			// Detect installation method first
-			installMethod, installPath := d.detectInstallMethod(path)
-
-			// Enhanced version detection based on installation method
-			version := d.getEnhancedVersion(path, vscode.versionArgs, installMethod, installPath, vscode.name)
-			lastUpdated := d.getExecutableLastModified(path)
-
-			ide := IDE{
-				Name:          vscode.name,
-				Executable:    path,
-				Version:       version,
-				Type:          "vscode",
-				InstallMethod: installMethod,
-				InstallPath:   installPath,
-				LastUpdated:   lastUpdated,
-				Aliases:       vscode.aliases,
-			}
-			ides = append(ides, ide)
+			installs = append(installs, installation{executable: path, versionSource: d.vscodePackageFile(path), probe: func() IDE {
+				// Detect installation method first
+				installMethod, installPath := d.detectInstallMethod(path)
+
+				// Enhanced version detection based on installation method
+				version := d.getEnhancedVersion(path, vscode.versionArgs, installMethod, installPath, vscode.name)
+				lastUpdated := d.getExecutableLastModified(path)
+
+				return IDE{
+					Name:          vscode.name,
+					Executable:    path,
+					Version:       version,
+					Type:          "vscode",
+					InstallMethod: installMethod,
+					InstallPath:   installPath,
+					LastUpdated:   lastUpdated,
+					Aliases:       vscode.aliases,
+				}
+			}})
 		}
 	}
 
-	return ides, nil
+	return installs
 }
 
 // detectOtherIDEs detects other IDE installations.
-func (d *IDEDetector) detectOtherIDEs() ([]IDE, error) {
-	var ides []IDE
+func (d *IDEDetector) detectOtherIDEs() []installation {
+	var installs []installation
 
 	otherIDEs := []struct {
 		name       string
@@ -336,31 +435,33 @@ func (d *IDEDetector) detectOtherIDEs() ([]IDE, error) {
 
 	for _, other := range otherIDEs {
 		if path := d.findExecutable(other.executable); path != "" {
-			// Detect installation method
-			installMethod, installPath := d.detectInstallMethod(path)
-
-			version := d.getExecutableVersion(path, other.versionArg)
-			lastUpdated := d.getExecutableLastModified(path)
-
-			ide := IDE{
-				Name:          other.name,
-				Executable:    path,
-				Version:       version,
-				Type:          "other",
-				InstallMethod: installMethod,
-				InstallPath:   installPath,
-				LastUpdated:   lastUpdated,
-				Aliases:       other.aliases,
-			}
-			ides = append(ides, ide)
+			installs = append(installs, installation{executable: path, probe: func() IDE {
+				// Detect installation method
+				installMethod, installPath := d.detectInstallMethod(path)
+
+				version := d.getExecutableVersion(path, other.versionArg)
+				lastUpdated := d.getExecutableLastModified(path)
+
+				return IDE{
+					Name:          other.name,
+					Executable:    path,
+					Version:       version,
+					Type:          "other",
+					InstallMethod: installMethod,
+					InstallPath:   installPath,
+					LastUpdated:   lastUpdated,
+					Aliases:       other.aliases,
+				}
+			}})
 		}
 	}
 
-	return ides, nil
+	return installs
 }
 
-// createJetBrainsIDE creates an IDE instance for JetBrains products.
-func (d *IDEDetector) createJetBrainsIDE(ideName, idePath string) *IDE {
+// jetBrainsInstallation returns the installation of a JetBrains product
+// directory, or false if the directory is not a known product.
+func (d *IDEDetector) jetBrainsInstallation(ideName, idePath string) (installation, bool) {
 	// Map JetBrains product names
 	jetbrainsProducts := map[string]struct {
 		displayName string
@@ -390,30 +491,32 @@ func (d *IDEDetector) createJetBrainsIDE(ideName, idePath string) *IDE {
 			// Find the executable
 			execPath := d.findJetBrainsExecutable(idePath, product.executable)
 			if execPath == "" {
-				return nil
+				return installation{}, false
 			}
 
-			// Get version from build.txt file first, then fallback to other methods
-			version := d.getJetBrainsVersion(idePath, execPath, ideName)
-			lastUpdated := d.getExecutableLastModified(execPath)
-
-			// Detect installation method
-			installMethod, installPath := d.detectInstallMethod(execPath)
-
-			return &IDE{
-				Name:          product.displayName,
-				Executable:    execPath,
-				Version:       version,
-				Type:          "jetbrains",
-				InstallMethod: installMethod,
-				InstallPath:   installPath,
-				LastUpdated:   lastUpdated,
-				Aliases:       product.aliases,
-			}
+			return installation{executable: execPath, versionSource: d.jetBrainsVersionFile(idePath, execPath), probe: func() IDE {
+				// Get version from the product files first, then fallback to other methods
+				version := d.getJetBrainsVersion(idePath, execPath, ideName)
+				lastUpdated := d.getExecutableLastModified(execPath)
+
+				// Detect installation method
+				installMethod, installPath := d.detectInstallMethod(execPath)
+
+				return IDE{
+					Name:          product.displayName,
+					Executable:    execPath,
+					Version:       version,
+					Type:          "jetbrains",
+					InstallMethod: installMethod,
+					InstallPath:   installPath,
+					LastUpdated:   lastUpdated,
+					Aliases:       product.aliases,
+				}
+			}}, true
 		}
 	}
 
-	return nil
+	return installation{}, false
 }
 
 // findJetBrainsExecutable finds the executable for a JetBrains product.
@@ -442,9 +545,16 @@ func (d *IDEDetector) findJetBrainsExecutable(productPath, executableName string
 
 // getJetBrainsVersion gets version from multiple sources with priority.
 func (d *IDEDetector) getJetBrainsVersion(productPath, execPath, productDir string) string {
-	// 1. Try to read from build.txt file (most accurate)
-	if version := d.getJetBrainsVersionFromBuildFile(productPath); version != "unknown" {
-		return version
+	// 1. Read product-info.json or build.txt of the installation (most
+	// accurate, and no process is forked)
+	for _, dir := range d.jetBrainsMetadataDirs(productPath, execPath) {
+		if version := d.getJetBrainsVersionFromProductInfo(dir); version != "unknown" {
+			return version
+		}
+
+		if version := d.getJetBrainsVersionFromBuildFile(dir); version != "unknown" {
+			return version
+		}
 	}
 
 	// 2. Try to get version from executable --version command
@@ -456,6 +566,56 @@ func (d *IDEDetector) getJetBrainsVersion(productPath, execPath, productDir stri
 	return d.extractJetBrainsVersionFromDir(productDir)
 }
 
+// jetBrainsMetadataDirs returns the directories that may hold the product
+// files of an installation: the product directory and the installation root
+// above bin/ (Contents/Resources on macOS).
+func (d *IDEDetector) jetBrainsMetadataDirs(productPath, execPath string) []string {
+	root := filepath.Dir(filepath.Dir(execPath))
+	dirs := []string{productPath}
+
+	for _, dir := range []string{root, filepath.Join(root, "Resources")} {
+		if !slices.Contains(dirs, dir) {
+			dirs = append(dirs, dir)
+		}
+	}
+
+	return dirs
+}
+
+// jetBrainsVersionFile returns the product-info.json or build.txt of the
+// installation, or "" if it has neither.
+func (d *IDEDetector) jetBrainsVersionFile(productPath, execPath string) string {
+	for _, dir := range d.jetBrainsMetadataDirs(productPath, execPath) {
+		for _, name := range []string{"product-info.json", "build.txt"} {
+			path := filepath.Join(dir, name)
+			if _, err := os.Stat(path); err == nil {
+				return path
+			}
+		}
+	}
+
+	return ""
+}
+
+// getJetBrainsVersionFromProductInfo reads the version from product-info.json,
+// which JetBrains installations ship since 2020.
+func (d *IDEDetector) getJetBrainsVersionFromProductInfo(productPath string) string {
+	data, err := os.ReadFile(filepath.Join(productPath, "product-info.json"))
+	if err != nil {
+		return "unknown"
+	}
+
+	var info struct {
+		Version string `json:"version"`
+	}
+
+	if err := json.Unmarshal(data, &info); err != nil || info.Version == "" {
+		return "unknown"
+	}
+
+	return info.Version
+}
+
 // getJetBrainsVersionFromBuildFile reads version from build.txt file.
 func (d *IDEDetector) getJetBrainsVersionFromBuildFile(productPath string) string {
 	buildFilePath := filepath.Join(productPath, "build.txt")
@@ -641,6 +801,11 @@ func (d *IDEDetector) findExecutable(name string) string {
 
 // getEnhancedVersion gets version using installation method-specific strategies.
 func (d *IDEDetector) getEnhancedVersion(execPath string, versionArgs []string, installMethod, installPath, appName string) string {
+	// Read the version from the installation before starting the editor
+	if version := d.getVSCodeVersionFromPackage(execPath, appName); version != "unknown" {
+		return version
+	}
+
 	// Try standard version detection first
 	version := d.getVSCodeFamilyVersion(execPath, versionArgs)
 	if version != "unknown" && version != "" {
@@ -841,6 +1006,53 @@ func (d *IDEDetector) getVSCodeFamilyVersion(execPath string, versionArgs []stri
 	return "unknown"
 }
 
+// getVSCodeVersionFromPackage reads the version from resources/app/package.json
+// of a Visual Studio Code installation. Forks such as Cursor keep the
+// upstream version there, so they are probed through the executable instead.
+func (d *IDEDetector) getVSCodeVersionFromPackage(execPath, appName string) string {
+	if !strings.HasPrefix(appName, "Visual Studio Code") {
+		return "unknown"
+	}
+
+	data, err := os.ReadFile(d.vscodePackageFile(execPath))
+	if err != nil {
+		return "unknown"
+	}
+
+	var pkg struct {
+		Version string `json:"version"`
+	}
+
+	if err := json.Unmarshal(data, &pkg); err != nil || !d.isVersionNumber(pkg.Version) {
+		return "unknown"
+	}
+
+	return pkg.Version
+}
+
+// vscodePackageFile returns the package.json of the application behind a
+// VS Code family executable, or "" if it cannot be found.
+func (d *IDEDetector) vscodePackageFile(execPath string) string {
+	resolved, err := filepath.EvalSymlinks(execPath)
+	if err != nil {
+		return ""
+	}
+
+	// Linux: <root>/bin/code with <root>/resources/app/package.json
+	// macOS: Contents/Resources/app/bin/code with Contents/Resources/app/package.json
+	root := filepath.Dir(filepath.Dir(resolved))
+	for _, candidate := range []string{
+		filepath.Join(root, "resources", "app", "package.json"),
+		filepath.Join(root, "package.json"),
+	} {
+		if _, err := os.Stat(candidate); err == nil {
+			return candidate
+		}
+	}
+
+	return ""
+}
+
 // parseVSCodeVersion extracts clean version from VS Code output.
 func (d *IDEDetector) parseVSCodeVersion(output string) string {
 	lines := strings.Split(output, "\n")
@@ -896,30 +1108,25 @@ func (d *IDEDetector) getCacheFilePath() string {
 	return filepath.Join(d.cacheDir, "ide.json")
 }
 
-// loadFromCache loads IDE information from cache.
-func (d *IDEDetector) loadFromCache() ([]IDE, error) {
-	cacheFile := d.getCacheFilePath()
-
-	data, err := os.ReadFile(cacheFile)
+// loadFromCache loads the cached probe results of the previous scan. Caches
+// written before per-installation entries existed yield none, which makes
+// the next scan probe every installation.
+func (d *IDEDetector) loadFromCache() map[string]idecore.CachedInstall {
+	data, err := os.ReadFile(d.getCacheFilePath())
 	if err != nil {
-		return nil, err
+		return nil
 	}
 
 	var cache IDECache
 	if err := json.Unmarshal(data, &cache); err != nil {
-		return nil, err
-	}
-
-	// Check if cache is still valid (24 hours)
-	if time.Since(cache.Timestamp) > 24*time.Hour {
-		return nil, fmt.Errorf("cache expired")
+		return nil
 	}
 
-	return cache.IDEs, nil
+	return cache.Installs
 }
 
 // saveToCache saves IDE information to cache.
-func (d *IDEDetector) saveToCache(ides []IDE) error {
+func (d *IDEDetector) saveToCache(ides []IDE, installs map[string]idecore.CachedInstall) error {
 	// Ensure cache directory exists
 	if err := os.MkdirAll(d.cacheDir, 0o755); err != nil {
 		return err
@@ -928,6 +1135,7 @@ func (d *IDEDetector) saveToCache(ides []IDE) error {
 	cache := IDECache{
 		Timestamp: time.Now(),
 		IDEs:      ides,
+		Installs:  installs,
 	}
 
 	data, err := json.MarshalIndent(cache, "", "  ")
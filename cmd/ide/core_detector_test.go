@@ -6,9 +6,12 @@ package ide
 import (
 	"os"
 	"path/filepath"
+	"sync/atomic"
 	"testing"
+	"time"
 
 	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
 )
 
 func TestNewIDEDetector(t *testing.T) {
@@ -400,3 +403,118 @@ func TestCompareVersions(t *testing.T) {
 		})
 	}
 }
+
+func TestGetJetBrainsVersionFromProductInfo(t *testing.T) {
+	detector := NewIDEDetector()
+
+	// Toolbox layout: <product>/<channel>/<build>/bin/pycharm.sh
+	installRoot := filepath.Join(t.TempDir(), "pycharm", "ch-0", "252.23892.515")
+	execPath := filepath.Join(installRoot, "bin", "pycharm.sh")
+	require.NoError(t, os.MkdirAll(filepath.Dir(execPath), 0o755))
+	require.NoError(t, os.WriteFile(execPath, []byte("#!/bin/sh\nexit 1\n"), 0o755))
+	require.NoError(t, os.WriteFile(filepath.Join(installRoot, "product-info.json"),
+		[]byte(`{"name": "PyCharm", "version": "2025.2.1", "buildNumber": "252.23892.515"}`), 0o644))
+
+	assert.Equal(t, "2025.2.1", detector.getJetBrainsVersionFromProductInfo(installRoot))
+	assert.Equal(t, "unknown", detector.getJetBrainsVersionFromProductInfo(t.TempDir()))
+
+	// The installation root is found from the executable, without running it
+	assert.Equal(t, "2025.2.1", detector.getJetBrainsVersion(filepath.Dir(installRoot), execPath, "pycharm"))
+}
+
+func TestGetVSCodeVersionFromPackage(t *testing.T) {
+	detector := NewIDEDetector()
+
+	root := filepath.Join(t.TempDir(), "code")
+	execPath := filepath.Join(root, "bin", "code")
+	require.NoError(t, os.MkdirAll(filepath.Dir(execPath), 0o755))
+	require.NoError(t, os.MkdirAll(filepath.Join(root, "resources", "app"), 0o755))
+	require.NoError(t, os.WriteFile(execPath, []byte("#!/bin/sh\n"), 0o755))
+	require.NoError(t, os.WriteFile(filepath.Join(root, "resources", "app", "package.json"),
+		[]byte(`{"name": "code", "version": "1.103.1"}`), 0o644))
+
+	link := filepath.Join(t.TempDir(), "code")
+	require.NoError(t, os.Symlink(execPath, link))
+
+	assert.Equal(t, "1.103.1", detector.getVSCodeVersionFromPackage(link, "Visual Studio Code"))
+	assert.Equal(t, "unknown", detector.getVSCodeVersionFromPackage(link, "Cursor"))
+}
+
+func TestProbeInstallationsUsesFingerprintCache(t *testing.T) {
+	detector := NewIDEDetector()
+
+	execPath := filepath.Join(t.TempDir(), "nvim")
+	require.NoError(t, os.WriteFile(execPath, []byte("v1"), 0o755))
+
+	var probes atomic.Int32
+
+	installs := []installation{{executable: execPath, probe: func() IDE {
+		probes.Add(1)
+		return IDE{Name: "Neovim", Executable: execPath, Version: "0.10.0"}
+	}}}
+
+	ides, entries := detector.probeInstallations(installs, nil)
+	require.Len(t, ides, 1)
+	assert.Equal(t, "0.10.0", ides[0].Version)
+	assert.Equal(t, int32(1), probes.Load())
+
+	// Unchanged installation is served from the cache
+	ides, entries = detector.probeInstallations(installs, entries)
+	assert.Equal(t, "0.10.0", ides[0].Version)
+	assert.Equal(t, int32(1), probes.Load())
+
+	// Updating the executable invalidates its entry
+	later := time.Now().Add(time.Hour)
+	require.NoError(t, os.Chtimes(execPath, later, later))
+
+	_, entries = detector.probeInstallations(installs, entries)
+	assert.Equal(t, int32(2), probes.Load())
+
+	// Entries older than the TTL are probed again even when unchanged
+	entry := entries[execPath]
+	entry.ProbedAt = time.Now().Add(-installCacheTTL - time.Minute)
+	entries[execPath] = entry
+
+	_, _ = detector.probeInstallations(installs, entries)
+	assert.Equal(t, int32(3), probes.Load())
+}
+
+func TestProbeInstallationsFingerprintsVersionSource(t *testing.T) {
+	detector := NewIDEDetector()
+
+	// A shared launcher such as /usr/bin/snap does not change on updates
+	dir := t.TempDir()
+	launcher := filepath.Join(dir, "snap")
+	versionFile := filepath.Join(dir, "product-info.json")
+	require.NoError(t, os.WriteFile(launcher, []byte("launcher"), 0o755))
+	require.NoError(t, os.WriteFile(versionFile, []byte(`{"version":"2025.1"}`), 0o644))
+
+	var probes atomic.Int32
+
+	installs := []installation{{executable: launcher, versionSource: versionFile, probe: func() IDE {
+		probes.Add(1)
+		return IDE{Name: "GoLand", Executable: launcher}
+	}}}
+
+	_, entries := detector.probeInstallations(installs, nil)
+	_, entries = detector.probeInstallations(installs, entries)
+	assert.Equal(t, int32(1), probes.Load())
+
+	require.NoError(t, os.WriteFile(versionFile, []byte(`{"version":"2025.2.1"}`), 0o644))
+
+	_, _ = detector.probeInstallations(installs, entries)
+	assert.Equal(t, int32(2), probes.Load())
+}
+
+func TestDetectIDEsWritesInstallCache(t *testing.T) {
+	detector := &IDEDetector{cacheDir: t.TempDir()}
+
+	_, err := detector.DetectIDEs(false)
+	require.NoError(t, err)
+
+	_, err = os.Stat(detector.getCacheFilePath())
+	require.NoError(t, err)
+
+	_, err = detector.DetectIDEs(true)
+	assert.NoError(t, err)
+}
@@ -4,6 +4,7 @@
 package fixsync
 
 import (
+	"errors"
 	"fmt"
 	"os"
 	"path/filepath"
@@ -194,34 +195,56 @@ func (o *fixSyncOptions) formatProductName(dirName string) string {
 	return dirName
 }
 
+// syncFixes maps the settings files with known sync issues, relative to a
+// product directory, to the repair for them.
+var syncFixes = map[string]func(o *fixSyncOptions, filePath string) error{
+	filepath.Join("settingsSync", "options", "filetypes.xml"): (*fixSyncOptions).fixFiletypesXML,
+}
+
 func (o *fixSyncOptions) fixProductSyncIssues(product jetbrainsProduct) error {
-	// Fix filetypes.xml sync issues
-	filetypesPath := filepath.Join(product.BasePath, "settingsSync", "options", "filetypes.xml")
-	if err := o.fixFiletypesXML(filetypesPath); err != nil {
-		return fmt.Errorf("failed to fix filetypes.xml: %w", err)
-	}
+	for relPath, fix := range syncFixes {
+		if err := fix(o, filepath.Join(product.BasePath, relPath)); err != nil {
+			return fmt.Errorf("failed to fix %s: %w", filepath.Base(relPath), err)
+		}
 
-	// Check for other common issues
-	if o.verbose {
-		fmt.Printf("   Checked filetypes.xml sync issues\n")
+		if o.verbose {
+			fmt.Printf("   Checked %s sync issues\n", filepath.Base(relPath))
+		}
 	}
 
 	return nil
 }
 
-func (o *fixSyncOptions) fixFiletypesXML(filePath string) error {
-	if _, err := os.Stat(filePath); os.IsNotExist(err) {
-		return nil // File doesn't exist, nothing to fix
-	}
+// FixChangedFiles repairs the settings files among changed that have known
+// sync issues, ignoring all others, so callers that know which files changed
+// need not rescan every product.
+func FixChangedFiles(changed []string, verbose bool) error {
+	o := &fixSyncOptions{verbose: verbose}
 
-	// Create backup
-	backupPath := filePath + ".backup." + time.Now().Format("20060102-150405")
-	if err := o.copyFile(filePath, backupPath); err != nil {
-		return fmt.Errorf("failed to create backup: %w", err)
+	var errs []error
+
+	for _, filePath := range changed {
+		for relPath, fix := range syncFixes {
+			if !strings.HasSuffix(filePath, string(filepath.Separator)+relPath) {
+				continue
+			}
+
+			if err := fix(o, filePath); err != nil {
+				errs = append(errs, fmt.Errorf("failed to fix %s: %w", filePath, err))
+			}
+		}
 	}
 
+	return errors.Join(errs...)
+}
+
+func (o *fixSyncOptions) fixFiletypesXML(filePath string) error {
 	// Read current content
 	content, err := os.ReadFile(filePath)
+	if os.IsNotExist(err) {
+		return nil // File doesn't exist, nothing to fix
+	}
+
 	if err != nil {
 		return fmt.Errorf("failed to read file: %w", err)
 	}
@@ -230,14 +253,22 @@ func (o *fixSyncOptions) fixFiletypesXML(filePath string) error {
 	originalContent := string(content)
 	fixedContent := o.applyFiletypesXMLFixes(originalContent)
 
-	if originalContent != fixedContent {
-		if err := os.WriteFile(filePath, []byte(fixedContent), 0o600); err != nil {
-			return fmt.Errorf("failed to write fixed file: %w", err)
-		}
+	if originalContent == fixedContent {
+		return nil
+	}
 
-		fmt.Printf("   🔧 Fixed filetypes.xml (backup: %s)\n", filepath.Base(backupPath))
+	// Back up only files that are rewritten
+	backupPath := filePath + ".backup." + time.Now().Format("20060102-150405")
+	if err := os.WriteFile(backupPath, content, 0o600); err != nil {
+		return fmt.Errorf("failed to create backup: %w", err)
 	}
 
+	if err := os.WriteFile(filePath, []byte(fixedContent), 0o600); err != nil {
+		return fmt.Errorf("failed to write fixed file: %w", err)
+	}
+
+	fmt.Printf("   🔧 Fixed filetypes.xml (backup: %s)\n", filepath.Base(backupPath))
+
 	return nil
 }
 
@@ -261,17 +292,3 @@ func (o *fixSyncOptions) applyFiletypesXMLFixes(content string) string {
 
 	return strings.Join(uniqueLines, "\n")
 }
-
-func (o *fixSyncOptions) copyFile(src, dst string) error {
-	input, err := os.ReadFile(src)
-	if err != nil {
-		return err
-	}
-
-	err = os.WriteFile(dst, input, 0o600)
-	if err != nil {
-		return err
-	}
-
-	return nil
-}
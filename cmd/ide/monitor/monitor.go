@@ -9,12 +9,14 @@ import (
 	"os"
 	"path/filepath"
 	"runtime"
+	"sort"
 	"strings"
 	"time"
 
 	"github.com/fsnotify/fsnotify"
 	"github.com/spf13/cobra"
 
+	"github.com/gizzahub/gzh-cli/cmd/ide/fixsync"
 	"github.com/gizzahub/gzh-cli/internal/env"
 )
 
@@ -26,12 +28,8 @@ type monitorOptions struct {
 	daemon       bool
 	logPath      string
 	excludePaths []string
-}
-
-type jetbrainsProduct struct {
-	Name     string
-	DirName  string
-	BasePath string
+	debounce     time.Duration
+	fix          bool
 }
 
 func defaultMonitorOptions() *monitorOptions {
@@ -43,6 +41,7 @@ func defaultMonitorOptions() *monitorOptions {
 		daemon:       false,
 		logPath:      filepath.Join(homeDir, ".gz", "logs", "ide-monitor.log"),
 		excludePaths: []string{".git", "node_modules", "target", "build", ".idea/shelf"},
+		debounce:     500 * time.Millisecond,
 	}
 }
 
@@ -59,6 +58,10 @@ This command watches JetBrains settings directories and reports any changes
 in real-time. It can help track settings modifications, detect sync issues,
 and monitor configuration changes across different IDE installations.
 
+Only the settings directories of each product are watched, and directories
+created later, such as those of a newly installed IDE version, are picked up
+as they appear. Changes are reported once per file per debounce window.
+
 Examples:
   # Monitor all JetBrains products
   gz ide monitor
@@ -70,7 +73,10 @@ Examples:
   gz ide monitor --daemon --log /var/log/ide-monitor.log
 
   # Monitor with custom directory
-  gz ide monitor --watch-dir ~/.config/JetBrains/IntelliJIdea2023.2`,
+  gz ide monitor --watch-dir ~/.config/JetBrains/IntelliJIdea2023.2
+
+  # Repair known sync issues as soon as the affected files change
+  gz ide monitor --fix`,
 		RunE: func(cmd *cobra.Command, args []string) error {
 			return o.runMonitor(ctx, cmd, args)
 		},
@@ -83,23 +89,25 @@ Examples:
 	cmd.Flags().BoolVar(&o.daemon, "daemon", false, "Run as background daemon")
 	cmd.Flags().StringVar(&o.logPath, "log", o.logPath, "Log file path (used when running as daemon)")
 	cmd.Flags().StringSliceVar(&o.excludePaths, "exclude", o.excludePaths, "Paths to exclude from monitoring")
+	cmd.Flags().DurationVar(&o.debounce, "debounce", o.debounce, "Window over which changes to the same file are reported once")
+	cmd.Flags().BoolVar(&o.fix, "fix", false, "Repair known sync issues in changed files (see fix-sync)")
 
 	return cmd
 }
 
 func (o *monitorOptions) runMonitor(ctx context.Context, _ *cobra.Command, _ []string) error {
-	watchDirs := o.getWatchDirectories()
+	roots, watchDirs := o.getWatchRoots()
 
-	if len(watchDirs) == 0 {
+	if len(roots) == 0 && len(watchDirs) == 0 {
 		fmt.Println("⚠️  No JetBrains IDE installations found")
 		return nil
 	}
 
 	fmt.Printf("🔍 Starting IDE settings monitor\n")
-	fmt.Printf("   Monitoring %d directories\n", len(watchDirs))
+	fmt.Printf("   Monitoring %d directories\n", len(roots)+len(watchDirs))
 
 	if o.verbose {
-		for _, dir := range watchDirs {
+		for _, dir := range append(roots, watchDirs...) {
 			fmt.Printf("   - %s\n", dir)
 		}
 	}
@@ -118,8 +126,16 @@ func (o *monitorOptions) runMonitor(ctx context.Context, _ *cobra.Command, _ []s
 	}()
 
 	// Add directories to watcher
+	settings := newSettingsWatcher(watcher, o)
+
+	for _, root := range roots {
+		if err := settings.addRoot(root); err != nil {
+			fmt.Printf("⚠️  Warning: Could not watch %s: %v\n", root, err)
+		}
+	}
+
 	for _, dir := range watchDirs {
-		if err := o.addWatchRecursive(watcher, dir); err != nil {
+		if err := settings.addProduct(dir); err != nil {
 			fmt.Printf("⚠️  Warning: Could not watch %s: %v\n", dir, err)
 		}
 	}
@@ -127,19 +143,26 @@ func (o *monitorOptions) runMonitor(ctx context.Context, _ *cobra.Command, _ []s
 	fmt.Printf("📁 Watching %d paths for changes\n", len(watcher.WatchList()))
 	fmt.Printf("🎯 Press Ctrl+C to stop monitoring\n\n")
 
-	// Start monitoring with graceful shutdown support
+	// Watches are added on the coalescing goroutine, the only one touching settings
+	batches := coalesceEvents(ctx, watcher.Events, o.debounce, func(event fsnotify.Event) bool {
+		settings.handle(event)
+		return !o.shouldIgnoreEvent(event)
+	})
+
+	// Start monitoring with graceful shutdown support. Batches are handled
+	// one at a time, so repairs never overlap.
 	for {
 		select {
 		case <-ctx.Done():
 			fmt.Printf("\n🛑 Stopping IDE monitoring (reason: %v)\n", ctx.Err())
 			return nil
 
-		case event, ok := <-watcher.Events:
+		case batch, ok := <-batches:
 			if !ok {
 				return nil
 			}
 
-			o.handleFileEvent(event)
+			o.handleBatch(batch)
 
 		case err, ok := <-watcher.Errors:
 			if !ok {
@@ -151,69 +174,20 @@ func (o *monitorOptions) runMonitor(ctx context.Context, _ *cobra.Command, _ []s
 	}
 }
 
-func (o *monitorOptions) getWatchDirectories() []string {
+// getWatchRoots returns the configuration roots to watch for products, or
+// the directory given with --watch-dir as a single product directory.
+func (o *monitorOptions) getWatchRoots() (roots, productDirs []string) {
 	if o.watchDir != "" {
-		// Use specific directory
-		return []string{o.watchDir}
+		return nil, []string{o.watchDir}
 	}
 
-	// Auto-detect JetBrains directories
-	products := o.detectJetBrainsProducts()
-
-	// Filter by specific product if specified
-	if o.product != "" {
-		filtered := []jetbrainsProduct{}
-
-		for _, p := range products {
-			if strings.Contains(p.DirName, o.product) {
-				filtered = append(filtered, p)
-			}
-		}
-
-		products = filtered
-	}
-
-	dirs := make([]string, 0, len(products))
-	for _, product := range products {
-		dirs = append(dirs, product.BasePath)
-	}
-
-	return dirs
-}
-
-func (o *monitorOptions) detectJetBrainsProducts() []jetbrainsProduct {
-	var products []jetbrainsProduct
-
-	basePaths := o.getJetBrainsBasePaths()
-
-	for _, basePath := range basePaths {
-		if _, err := os.Stat(basePath); os.IsNotExist(err) {
-			continue
-		}
-
-		entries, err := os.ReadDir(basePath)
-		if err != nil {
-			continue
-		}
-
-		for _, entry := range entries {
-			if !entry.IsDir() {
-				continue
-			}
-
-			name := entry.Name()
-			if o.isJetBrainsProduct(name) {
-				product := jetbrainsProduct{
-					Name:     o.formatProductName(name),
-					DirName:  name,
-					BasePath: filepath.Join(basePath, name),
-				}
-				products = append(products, product)
-			}
+	for _, basePath := range o.getJetBrainsBasePaths() {
+		if info, err := os.Stat(basePath); err == nil && info.IsDir() {
+			roots = append(roots, basePath)
 		}
 	}
 
-	return products
+	return roots, nil
 }
 
 func (o *monitorOptions) getJetBrainsBasePaths() []string {
@@ -264,51 +238,44 @@ func (o *monitorOptions) isJetBrainsProduct(name string) bool {
 	return false
 }
 
-func (o *monitorOptions) formatProductName(dirName string) string {
-	// Extract product name and version
-	for i, char := range dirName {
-		if char >= '0' && char <= '9' {
-			product := dirName[:i]
-			version := dirName[i:]
-
-			return fmt.Sprintf("%s %s", product, version)
+func (o *monitorOptions) isExcluded(path string) bool {
+	for _, exclude := range o.excludePaths {
+		if strings.Contains(path, exclude) {
+			return true
 		}
 	}
 
-	return dirName
+	return false
 }
 
-func (o *monitorOptions) addWatchRecursive(watcher *fsnotify.Watcher, root string) error {
-	return filepath.Walk(root, func(path string, info os.FileInfo, err error) error {
-		if err != nil {
-			return err // Skip directories we can't access
-		}
+// handleBatch reports the changes of a debounce window in path order and,
+// with --fix, repairs the changed files with known sync issues.
+func (o *monitorOptions) handleBatch(batch changeBatch) {
+	paths := make([]string, 0, len(batch))
+	for path := range batch {
+		paths = append(paths, path)
+	}
 
-		if !info.IsDir() {
-			return nil
-		}
+	sort.Strings(paths)
 
-		// Check if path should be excluded
-		for _, exclude := range o.excludePaths {
-			if strings.Contains(path, exclude) {
-				if info.IsDir() {
-					return filepath.SkipDir
-				}
+	var problematic []string
 
-				return nil
-			}
+	for _, path := range paths {
+		o.handleFileEvent(fsnotify.Event{Name: path, Op: batch[path]})
+
+		if o.isSyncProblematicFile(path) {
+			problematic = append(problematic, path)
 		}
+	}
 
-		return watcher.Add(path)
-	})
+	if o.fix && len(problematic) > 0 {
+		if err := fixsync.FixChangedFiles(problematic, o.verbose); err != nil {
+			fmt.Printf("   ❌ Repair failed: %v\n", err)
+		}
+	}
 }
 
 func (o *monitorOptions) handleFileEvent(event fsnotify.Event) {
-	// Filter out certain events we don't care about
-	if o.shouldIgnoreEvent(event) {
-		return
-	}
-
 	timestamp := time.Now().Format("15:04:05")
 	relativePath := o.getRelativePath(event.Name)
 
@@ -332,7 +299,7 @@ func (o *monitorOptions) handleFileEvent(event fsnotify.Event) {
 	fmt.Printf("[%s] %s %s %s\n", timestamp, icon, event.Op.String(), relativePath)
 
 	// Check for sync issues
-	if o.isSyncProblematicFile(event.Name) {
+	if o.isSyncProblematicFile(event.Name) && !o.fix {
 		fmt.Printf("   ⚠️  Potential sync issue detected in: %s\n", relativePath)
 	}
 
@@ -350,6 +317,7 @@ func (o *monitorOptions) shouldIgnoreEvent(event fsnotify.Event) bool {
 	ignorePatterns := []string{
 		".tmp", "~", ".swp", ".DS_Store", "Thumbs.db",
 		".lock", ".log", "___jb_", // JetBrains temp files
+		".backup.", // fix-sync backups
 	}
 
 	for _, pattern := range ignorePatterns {
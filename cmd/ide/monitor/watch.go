@@ -0,0 +1,232 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package monitor
+
+import (
+	"context"
+	"os"
+	"path/filepath"
+	"strings"
+	"time"
+
+	"github.com/fsnotify/fsnotify"
+)
+
+// settingsDirs are the directories of a JetBrains configuration directory
+// that hold settings, relative to it. Caches, logs, plugins and the like are
+// not watched.
+var settingsDirs = []string{
+	"codestyles", "colors", "fileTemplates", "inspection",
+	"keymaps", "options", "settingsSync", "templates",
+}
+
+// pathWatcher is the part of fsnotify.Watcher that settingsWatcher needs.
+type pathWatcher interface {
+	Add(name string) error
+}
+
+// settingsWatcher watches the settings directories of JetBrains products
+// instead of every directory below the configuration roots, which keeps the
+// number of watches within inotify limits on machines with many IDE
+// versions. Directories created later, such as the configuration of a newly
+// installed IDE version, are added as their creation is reported.
+type settingsWatcher struct {
+	watcher pathWatcher
+	o       *monitorOptions
+
+	roots    map[string]bool // configuration roots holding product directories
+	products map[string]bool // product configuration directories
+	watched  map[string]bool
+}
+
+func newSettingsWatcher(watcher pathWatcher, o *monitorOptions) *settingsWatcher {
+	return &settingsWatcher{
+		watcher:  watcher,
+		o:        o,
+		roots:    make(map[string]bool),
+		products: make(map[string]bool),
+		watched:  make(map[string]bool),
+	}
+}
+
+// addRoot watches a configuration root for new products and adds the
+// settings of the products it holds.
+func (w *settingsWatcher) addRoot(root string) error {
+	if err := w.add(root); err != nil {
+		return err
+	}
+
+	w.roots[root] = true
+
+	entries, err := os.ReadDir(root)
+	if err != nil {
+		return err
+	}
+
+	for _, entry := range entries {
+		if entry.IsDir() && w.isWatchedProduct(entry.Name()) {
+			_ = w.addProduct(filepath.Join(root, entry.Name()))
+		}
+	}
+
+	return nil
+}
+
+// addProduct watches a product configuration directory and the settings
+// directories it already has.
+func (w *settingsWatcher) addProduct(dir string) error {
+	if err := w.add(dir); err != nil {
+		return err
+	}
+
+	w.products[dir] = true
+
+	if !w.o.recursive {
+		return nil
+	}
+
+	for _, name := range settingsDirs {
+		if info, err := os.Stat(filepath.Join(dir, name)); err == nil && info.IsDir() {
+			w.addTree(filepath.Join(dir, name))
+		}
+	}
+
+	return nil
+}
+
+// addTree watches a settings directory and its subdirectories.
+func (w *settingsWatcher) addTree(root string) {
+	_ = filepath.WalkDir(root, func(path string, entry os.DirEntry, err error) error {
+		if err != nil || !entry.IsDir() {
+			return nil //nolint:nilerr // Skip entries we can't access
+		}
+
+		if w.o.isExcluded(path) {
+			return filepath.SkipDir
+		}
+
+		if err := w.add(path); err != nil {
+			return filepath.SkipDir
+		}
+
+		return nil
+	})
+}
+
+func (w *settingsWatcher) add(dir string) error {
+	if w.watched[dir] {
+		return nil
+	}
+
+	if err := w.watcher.Add(dir); err != nil {
+		return err
+	}
+
+	w.watched[dir] = true
+
+	return nil
+}
+
+// handle adds a watch for a directory whose creation the event reports if
+// it is a product or settings directory.
+func (w *settingsWatcher) handle(event fsnotify.Event) {
+	if !event.Has(fsnotify.Create) {
+		return
+	}
+
+	info, err := os.Stat(event.Name)
+	if err != nil || !info.IsDir() {
+		return
+	}
+
+	parent, name := filepath.Dir(event.Name), filepath.Base(event.Name)
+
+	switch {
+	case w.roots[parent]:
+		if w.isWatchedProduct(name) {
+			_ = w.addProduct(event.Name)
+		}
+	case !w.o.recursive || w.o.isExcluded(event.Name):
+	case w.products[parent]:
+		for _, settingsDir := range settingsDirs {
+			if name == settingsDir {
+				w.addTree(event.Name)
+			}
+		}
+	case w.watched[parent]:
+		// A subdirectory of a settings directory
+		w.addTree(event.Name)
+	}
+}
+
+func (w *settingsWatcher) isWatchedProduct(name string) bool {
+	return w.o.isJetBrainsProduct(name) && (w.o.product == "" || strings.Contains(name, w.o.product))
+}
+
+// changeBatch is the set of paths changed during a debounce window, with the
+// operations seen for each.
+type changeBatch map[string]fsnotify.Op
+
+// coalesceEvents batches the events accepted by accept, so that the storm of
+// events an IDE produces while starting or syncing settings is delivered as
+// one batch per debounce window, with one entry per path. Batches the
+// receiver is not ready for yet are merged with the next ones. The channel
+// is closed when ctx ends or events is closed.
+func coalesceEvents(ctx context.Context, events <-chan fsnotify.Event, window time.Duration, accept func(fsnotify.Event) bool) <-chan changeBatch {
+	out := make(chan changeBatch)
+
+	go func() {
+		defer close(out)
+
+		var (
+			pending changeBatch // collected during the current window
+			ready   changeBatch // waiting for the receiver
+			timer   <-chan time.Time
+		)
+
+		for {
+			// Sending on a nil channel blocks, disabling the case
+			var send chan<- changeBatch
+			if ready != nil {
+				send = out
+			}
+
+			select {
+			case <-ctx.Done():
+				return
+			case event, ok := <-events:
+				if !ok {
+					return
+				}
+
+				if !accept(event) {
+					continue
+				}
+
+				if pending == nil {
+					pending = make(changeBatch)
+					timer = time.After(window)
+				}
+
+				pending[event.Name] |= event.Op
+			case <-timer:
+				timer = nil
+
+				if ready == nil {
+					ready = pending
+				} else {
+					for path, op := range pending {
+						ready[path] |= op
+					}
+				}
+
+				pending = nil
+			case send <- ready:
+				ready = nil
+			}
+		}
+	}()
+
+	return out
+}
@@ -0,0 +1,130 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package monitor
+
+import (
+	"context"
+	"os"
+	"path/filepath"
+	"sort"
+	"testing"
+	"time"
+
+	"github.com/fsnotify/fsnotify"
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+// fakeWatcher records the directories added to it.
+type fakeWatcher struct {
+	added []string
+}
+
+func (f *fakeWatcher) Add(name string) error {
+	f.added = append(f.added, name)
+	return nil
+}
+
+func (f *fakeWatcher) relative(t *testing.T, root string) []string {
+	t.Helper()
+
+	paths := make([]string, 0, len(f.added))
+
+	for _, path := range f.added {
+		rel, err := filepath.Rel(root, path)
+		require.NoError(t, err)
+
+		paths = append(paths, filepath.ToSlash(rel))
+	}
+
+	sort.Strings(paths)
+
+	return paths
+}
+
+func TestSettingsWatcher(t *testing.T) {
+	root := t.TempDir()
+
+	for _, dir := range []string{
+		"GoLand2024.1/options/sub",
+		"GoLand2024.1/caches",
+		"GoLand2024.1/settingsSync/.git",
+		"PyCharm2024.1/options",
+		"Toolbox/options",
+	} {
+		require.NoError(t, os.MkdirAll(filepath.Join(root, filepath.FromSlash(dir)), 0o755))
+	}
+
+	o := defaultMonitorOptions()
+	o.product = "GoLand"
+
+	fake := &fakeWatcher{}
+	settings := newSettingsWatcher(fake, o)
+	require.NoError(t, settings.addRoot(root))
+
+	assert.Equal(t, []string{
+		".",
+		"GoLand2024.1",
+		"GoLand2024.1/options",
+		"GoLand2024.1/options/sub",
+		"GoLand2024.1/settingsSync",
+	}, fake.relative(t, root))
+
+	// Directories created later are added as they are reported
+	newDirs := []string{"GoLand2024.2", "GoLand2024.2/keymaps", "GoLand2024.1/options/sub/new", "GoLand2024.1/caches/new", "PyCharm2024.2"}
+	for _, dir := range newDirs {
+		path := filepath.Join(root, filepath.FromSlash(dir))
+		require.NoError(t, os.MkdirAll(path, 0o755))
+		settings.handle(fsnotify.Event{Name: path, Op: fsnotify.Create})
+	}
+
+	settings.handle(fsnotify.Event{Name: filepath.Join(root, "GoLand2024.2"), Op: fsnotify.Write})
+
+	assert.Equal(t, []string{
+		".",
+		"GoLand2024.1",
+		"GoLand2024.1/options",
+		"GoLand2024.1/options/sub",
+		"GoLand2024.1/options/sub/new",
+		"GoLand2024.1/settingsSync",
+		"GoLand2024.2",
+		"GoLand2024.2/keymaps",
+	}, fake.relative(t, root))
+}
+
+func TestCoalesceEvents(t *testing.T) {
+	ctx, cancel := context.WithCancel(context.Background())
+	defer cancel()
+
+	events := make(chan fsnotify.Event)
+	batches := coalesceEvents(ctx, events, 50*time.Millisecond, func(event fsnotify.Event) bool {
+		return event.Name != "ignored"
+	})
+
+	events <- fsnotify.Event{Name: "a.xml", Op: fsnotify.Create}
+	events <- fsnotify.Event{Name: "a.xml", Op: fsnotify.Write}
+	events <- fsnotify.Event{Name: "ignored", Op: fsnotify.Write}
+	events <- fsnotify.Event{Name: "b.xml", Op: fsnotify.Write}
+	events <- fsnotify.Event{Name: "a.xml", Op: fsnotify.Write}
+
+	select {
+	case batch := <-batches:
+		assert.Equal(t, changeBatch{"a.xml": fsnotify.Create | fsnotify.Write, "b.xml": fsnotify.Write}, batch)
+	case <-time.After(5 * time.Second):
+		t.Fatal("no batch delivered")
+	}
+
+	// Batches not received yet are merged
+	events <- fsnotify.Event{Name: "a.xml", Op: fsnotify.Remove}
+	time.Sleep(150 * time.Millisecond)
+	events <- fsnotify.Event{Name: "c.xml", Op: fsnotify.Create}
+	time.Sleep(150 * time.Millisecond)
+
+	assert.Equal(t, changeBatch{"a.xml": fsnotify.Remove, "c.xml": fsnotify.Create}, <-batches)
+
+	close(events)
+
+	_, ok := <-batches
+	assert.False(t, ok)
+}
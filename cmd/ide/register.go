@@ -30,6 +30,7 @@ func (p ideCmdProvider) Metadata() registry.CommandMetadata {
 		Dependencies: []string{}, // IDE는 선택적
 		Tags:         []string{"ide", "jetbrains", "intellij", "vscode", "monitor", "settings"},
 		Lifecycle:    registry.LifecycleStable,
+		Short:        "Monitor and manage IDE configuration changes",
 	}
 }
 
@@ -28,7 +28,14 @@ func NewNetEnvCmd(ctx context.Context, appCtx *app.AppContext) *cobra.Command {
 	//
 	// To switch back to the legacy implementation, comment out the return below
 	// and uncomment the _legacyNetEnvCmd() call instead.
-	return LibraryNetEnvCmd()
+	cmd := LibraryNetEnvCmd()
+
+	// Keep the name and summary in line with the registry metadata, which
+	// the root help shows before the command is built
+	cmd.Use = "net-env"
+	cmd.Short = "Manage network environment transitions"
+
+	return cmd
 
 	// Legacy implementation (commented out for now)
 	// return _legacyNetEnvCmd(ctx)
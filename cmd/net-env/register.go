@@ -30,6 +30,7 @@ func (p netEnvCmdProvider) Metadata() registry.CommandMetadata {
 		Dependencies: []string{},
 		Tags:         []string{"network", "environment", "proxy", "vpn", "switch"},
 		Lifecycle:    registry.LifecycleStable,
+		Short:        "Manage network environment transitions",
 	}
 }
 
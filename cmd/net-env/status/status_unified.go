@@ -107,11 +107,16 @@ func runSingleStatusCheck(ctx context.Context, detector *netenv.NetworkDetector,
 	return displayStatus(status, format, verbose)
 }
 
-// runStatusWatch runs status in watch mode.
+// runStatusWatch runs status in watch mode. The display is redrawn as soon as
+// the network changes, and every five seconds for component health.
 func runStatusWatch(ctx context.Context, detector *netenv.NetworkDetector, profileManager *netenv.ProfileManager, verbose bool, format string, includeHealth bool, timeout time.Duration) error {
 	ticker := time.NewTicker(5 * time.Second)
 	defer ticker.Stop()
 
+	// Keeps the detected profile current without re-probing on every redraw
+	changes := detector.Watch(ctx)
+	<-changes
+
 	// Clear screen function
 	clearScreen := func() {
 		fmt.Print("\033[2J\033[H")
@@ -136,6 +141,12 @@ func runStatusWatch(ctx context.Context, detector *netenv.NetworkDetector, profi
 			return ctx.Err()
 		case <-ticker.C:
 			// Continue loop
+		case _, ok := <-changes:
+			if !ok {
+				return ctx.Err()
+			}
+
+			ticker.Reset(5 * time.Second)
 		}
 	}
 }
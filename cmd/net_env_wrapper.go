@@ -82,6 +82,8 @@ func (p netEnvCmdProvider) Metadata() registry.CommandMetadata {
 		Dependencies: []string{}, // Dynamically checks (networksetup, nmcli, etc.)
 		Tags:         []string{"network", "environment", "wifi", "vpn", "dns", "proxy"},
 		Lifecycle:    registry.LifecycleStable,
+		Short:        "Manage network environment configurations",
+		Aliases:      []string{"ne", "netenv"},
 	}
 }
 
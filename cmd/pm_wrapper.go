@@ -73,6 +73,7 @@ func (p pmCmdProvider) Metadata() registry.CommandMetadata {
 		Dependencies: []string{}, // 패키지 관리자들은 동적으로 확인
 		Tags:         []string{"package", "manager", "brew", "apt", "npm", "pip", "update"},
 		Lifecycle:    registry.LifecycleStable,
+		Short:        "Package manager operations",
 	}
 }
 
@@ -6,6 +6,7 @@ package profile
 import (
 	"context"
 	"fmt"
+	"math"
 	"os"
 	"path/filepath"
 	"runtime"
@@ -195,6 +196,11 @@ Examples:
 
 // CompareProfiles compares two profile files and returns the differences.
 func (pa *ProfileAnalyzer) CompareProfiles(baselineFile, currentFile string, threshold float64) (*ProfileComparison, error) {
+	// Heap deltas of the flight recorder are compared by their allocations
+	if baseline, current, ok := readHeapDeltas(baselineFile, currentFile); ok {
+		return compareHeapDeltas(baselineFile, currentFile, baseline, current, threshold), nil
+	}
+
 	// This is a simplified implementation - in reality you'd parse the pprof files
 	// and compare the actual profiling data
 
@@ -249,6 +255,119 @@ func (pa *ProfileAnalyzer) CompareProfiles(baselineFile, currentFile string, thr
 	return comparison, nil
 }
 
+// readHeapDeltas parses both files as heap delta profiles, reporting false if
+// either is not one.
+func readHeapDeltas(baselineFile, currentFile string) (*simpleprof.HeapDelta, *simpleprof.HeapDelta, bool) {
+	deltas := make([]*simpleprof.HeapDelta, 0, 2)
+
+	for _, file := range []string{baselineFile, currentFile} {
+		f, err := os.Open(file)
+		if err != nil {
+			return nil, nil, false
+		}
+
+		delta, err := simpleprof.ParseHeapDelta(f)
+		_ = f.Close()
+
+		if err != nil {
+			return nil, nil, false
+		}
+
+		deltas = append(deltas, delta)
+	}
+
+	return deltas[0], deltas[1], true
+}
+
+// compareHeapDeltas reports the functions whose allocated bytes changed by
+// more than threshold percent. Changes below 0.1% of the allocations of the
+// larger profile are noise and ignored.
+func compareHeapDeltas(baselineFile, currentFile string, baseline, current *simpleprof.HeapDelta, threshold float64) *ProfileComparison {
+	const mb = 1024 * 1024
+
+	comparison := &ProfileComparison{
+		BaselineFile: baselineFile,
+		CurrentFile:  currentFile,
+		Improvements: []ProfileDifference{},
+		Regressions:  []ProfileDifference{},
+		Issues:       []PerformanceIssue{},
+	}
+
+	functions := make(map[string]struct{}, len(baseline.AllocBytes)+len(current.AllocBytes))
+	for function := range baseline.AllocBytes {
+		functions[function] = struct{}{}
+	}
+
+	for function := range current.AllocBytes {
+		functions[function] = struct{}{}
+	}
+
+	noise := max(baseline.TotalAllocBytes, current.TotalAllocBytes) / 1000
+
+	for function := range functions {
+		base, cur := baseline.AllocBytes[function], current.AllocBytes[function]
+
+		change := cur - base
+		if change == 0 || math.Abs(float64(change)) <= float64(noise) {
+			continue
+		}
+
+		percent := 100.0
+		if base != 0 {
+			percent = float64(change) / float64(base) * 100
+		}
+
+		if percent > -threshold && percent < threshold {
+			continue
+		}
+
+		diff := ProfileDifference{
+			Function:      function,
+			Metric:        "Allocated MB",
+			BaseValue:     float64(base) / mb,
+			CurrentValue:  float64(cur) / mb,
+			PercentChange: percent,
+		}
+
+		if change > 0 {
+			comparison.Regressions = append(comparison.Regressions, diff)
+		} else {
+			comparison.Improvements = append(comparison.Improvements, diff)
+		}
+	}
+
+	// Largest changes in bytes first
+	for _, diffs := range [][]ProfileDifference{comparison.Regressions, comparison.Improvements} {
+		sort.Slice(diffs, func(i, j int) bool {
+			di := math.Abs(diffs[i].CurrentValue - diffs[i].BaseValue)
+			dj := math.Abs(diffs[j].CurrentValue - diffs[j].BaseValue)
+
+			if di != dj {
+				return di > dj
+			}
+
+			return diffs[i].Function < diffs[j].Function
+		})
+	}
+
+	comparison.Summary = ProfileComparisonSummary{
+		TotalFunctions: len(functions),
+		ImprovedCount:  len(comparison.Improvements),
+		RegressedCount: len(comparison.Regressions),
+		Recommendation: "No significant allocation changes",
+	}
+
+	if baseline.TotalAllocBytes != 0 {
+		comparison.Summary.OverallChange = float64(current.TotalAllocBytes-baseline.TotalAllocBytes) / float64(baseline.TotalAllocBytes) * 100
+	}
+
+	if len(comparison.Regressions) > 0 {
+		comparison.Summary.Recommendation = fmt.Sprintf("Review allocations in %s, the largest regression", comparison.Regressions[0].Function)
+	}
+
+	return comparison
+}
+
 // RunContinuousProfiling runs continuous profiling for the specified duration.
 func (pa *ProfileAnalyzer) RunContinuousProfiling(ctx context.Context, profileType string, interval, duration time.Duration, autoAnalyze bool) error {
 	fmt.Printf("🔄 Starting continuous %s profiling...\n", profileType)
@@ -128,6 +128,46 @@ func TestCompareProfilesNonBaseline(t *testing.T) {
 	assert.Equal(t, 0, len(comparison.Issues))
 }
 
+func TestCompareProfilesHeapDeltas(t *testing.T) {
+	analyzer := NewProfileAnalyzer("tmp/test-profiles")
+	tempDir := t.TempDir()
+
+	writeDelta := func(name string, samples ...string) string {
+		path := filepath.Join(tempDir, name)
+		data := "heap profile: 0: 0 [0: 0] @ heap/1024\n" + strings.Join(samples, "\n")
+		require.NoError(t, os.WriteFile(path, []byte(data), 0o600))
+
+		return path
+	}
+
+	baseline := writeDelta("heap_delta_1.prof",
+		"0: 0 [10: 10485760] @ 0x1\n#\t0x1\tmain.clone+0x10\tmain.go:10\n",
+		"0: 0 [10: 10485760] @ 0x2\n#\t0x2\tmain.parse+0x20\tmain.go:20\n",
+		"0: 0 [1: 1048576] @ 0x3\n#\t0x3\tmain.steady+0x30\tmain.go:30\n",
+	)
+	current := writeDelta("heap_delta_2.prof",
+		"0: 0 [30: 31457280] @ 0x1\n#\t0x1\tmain.clone+0x10\tmain.go:10\n",
+		"0: 0 [5: 5242880] @ 0x2\n#\t0x2\tmain.parse+0x20\tmain.go:20\n",
+		"0: 0 [1: 1049000] @ 0x3\n#\t0x3\tmain.steady+0x30\tmain.go:30\n",
+	)
+
+	comparison, err := analyzer.CompareProfiles(baseline, current, 5.0)
+	require.NoError(t, err)
+
+	require.Len(t, comparison.Regressions, 1)
+	assert.Equal(t, "main.clone", comparison.Regressions[0].Function)
+	assert.InDelta(t, 200.0, comparison.Regressions[0].PercentChange, 0.01)
+	assert.InDelta(t, 30.0, comparison.Regressions[0].CurrentValue, 0.01)
+
+	require.Len(t, comparison.Improvements, 1)
+	assert.Equal(t, "main.parse", comparison.Improvements[0].Function)
+	assert.InDelta(t, -50.0, comparison.Improvements[0].PercentChange, 0.01)
+
+	assert.Equal(t, 3, comparison.Summary.TotalFunctions)
+	assert.InDelta(t, 71.4, comparison.Summary.OverallChange, 0.1)
+	assert.Contains(t, comparison.Summary.Recommendation, "main.clone")
+}
+
 func TestAnalyzeProfile(t *testing.T) {
 	analyzer := NewProfileAnalyzer("tmp/test-profiles")
 
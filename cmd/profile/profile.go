@@ -33,6 +33,13 @@ Enhanced commands:
   continuous  Run continuous profiling over time
   analyze     Analyze profile for performance issues
 
+Flight recorder:
+  Set GZH_FLIGHT_RECORDER=<dir> to keep the last seconds of execution trace
+  and a few delta CPU/heap profiles in memory during any gz command. They are
+  written to <dir> when goroutines spike, a repository operation stalls,
+  synclone passes its memory threshold, or the process receives SIGUSR1.
+  Consecutive heap_delta_N.prof files can be diffed with "gz profile compare".
+
 Examples:
   gz profile server --port 6060
   gz profile cpu --duration 30s
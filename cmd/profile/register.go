@@ -28,6 +28,7 @@ func (p profileCmdProvider) Metadata() registry.CommandMetadata {
 		Dependencies: []string{},
 		Tags:         []string{"profile", "performance", "pprof", "cpu", "memory", "benchmark"},
 		Lifecycle:    registry.LifecycleStable,
+		Short:        "Performance profiling using standard Go pprof",
 	}
 }
 
@@ -50,6 +50,8 @@ func (p qualityCmdProvider) Metadata() registry.CommandMetadata {
 		Dependencies: []string{}, // 언어별 도구들은 동적으로 확인
 		Tags:         []string{"quality", "lint", "format", "code", "check"},
 		Lifecycle:    registry.LifecycleStable,
+		Short:        "통합 코드 품질 도구 (포매팅 + 린팅)",
+		Aliases:      []string{"q", "qual"},
 	}
 }
 
@@ -0,0 +1,108 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package registry
+
+import (
+	"strings"
+	"sync"
+
+	"github.com/spf13/cobra"
+)
+
+var (
+	lazyMu       sync.Mutex
+	lazyBuilders = make(map[*cobra.Command]func() *cobra.Command)
+)
+
+// IsLazy reports whether the metadata carries enough information to register
+// the command as a stub.
+func IsLazy(meta CommandMetadata) bool {
+	return meta.Name != "" && meta.Short != ""
+}
+
+// NewLazyCommand returns a stub for the command described by meta. The stub
+// is enough for the root help and for completing top-level command names;
+// build constructs the real subtree and only runs once Expand selects the
+// stub. Building a subtree is what pulls in wrapped external modules, so
+// invocations that dispatch elsewhere never pay for it.
+func NewLazyCommand(meta CommandMetadata, build func() *cobra.Command) *cobra.Command {
+	stub := &cobra.Command{
+		Use:                meta.Name,
+		Short:              meta.Short,
+		Aliases:            meta.Aliases,
+		DisableFlagParsing: true,
+	}
+
+	// Only reached when the root was executed without Expand, e.g. with
+	// arguments set by a test. Swap in the real command and dispatch again.
+	stub.RunE = func(cmd *cobra.Command, args []string) error {
+		root := cmd.Root()
+		command := expand(root, stub)
+
+		root.SetArgs(append([]string{command.Name()}, args...))
+
+		return root.Execute()
+	}
+
+	lazyMu.Lock()
+	lazyBuilders[stub] = build
+	lazyMu.Unlock()
+
+	return stub
+}
+
+// Expand builds the lazy top-level command of root that args dispatch to.
+// Help and shell completion requests expand the command they are about.
+func Expand(root *cobra.Command, args []string) {
+	name := dispatchedCommand(args)
+	if name == "" {
+		return
+	}
+
+	for _, child := range root.Commands() {
+		if child.Name() == name || child.HasAlias(name) {
+			expand(root, child)
+			return
+		}
+	}
+}
+
+// dispatchedCommand returns the first positional argument, skipping the help
+// and completion commands. Root flags are all booleans, so every other
+// argument starting with a dash is a flag without a separate value.
+func dispatchedCommand(args []string) string {
+	for _, arg := range args {
+		switch {
+		case strings.HasPrefix(arg, "-"):
+		case arg == "help", arg == cobra.ShellCompRequestCmd, arg == cobra.ShellCompNoDescRequestCmd:
+		default:
+			return arg
+		}
+	}
+
+	return ""
+}
+
+// expand replaces stub with its real command, which it returns. Commands that
+// are not stubs are returned unchanged.
+func expand(root, stub *cobra.Command) *cobra.Command {
+	lazyMu.Lock()
+	build, ok := lazyBuilders[stub]
+	delete(lazyBuilders, stub)
+	lazyMu.Unlock()
+
+	if !ok {
+		return stub
+	}
+
+	command := build()
+	if stub.Hidden {
+		command.Hidden = true
+	}
+
+	root.RemoveCommand(stub)
+	root.AddCommand(command)
+
+	return command
+}
@@ -0,0 +1,93 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package registry
+
+import (
+	"testing"
+
+	"github.com/spf13/cobra"
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func newLazyRoot(t *testing.T) (*cobra.Command, *int) {
+	t.Helper()
+
+	builds := 0
+	root := &cobra.Command{Use: "gz"}
+	root.AddCommand(&cobra.Command{Use: "version", Run: func(*cobra.Command, []string) {}})
+	root.AddCommand(NewLazyCommand(CommandMetadata{Name: "git", Short: "Git tools", Aliases: []string{"g"}}, func() *cobra.Command {
+		builds++
+
+		cmd := &cobra.Command{Use: "git", Short: "Git tools", Aliases: []string{"g"}}
+		cmd.AddCommand(&cobra.Command{Use: "list", Run: func(*cobra.Command, []string) {}})
+
+		return cmd
+	}))
+
+	return root, &builds
+}
+
+func TestIsLazy(t *testing.T) {
+	assert.True(t, IsLazy(CommandMetadata{Name: "git", Short: "Git tools"}))
+	assert.False(t, IsLazy(CommandMetadata{Name: "git"}))
+}
+
+func TestExpand(t *testing.T) {
+	tests := []struct {
+		name   string
+		args   []string
+		builds int
+	}{
+		{name: "root help", args: []string{"--help"}, builds: 0},
+		{name: "other command", args: []string{"-v", "version"}, builds: 0},
+		{name: "dispatched command", args: []string{"-v", "git", "list"}, builds: 1},
+		{name: "alias", args: []string{"g", "list"}, builds: 1},
+		{name: "help for command", args: []string{"help", "git"}, builds: 1},
+		{name: "completion", args: []string{cobra.ShellCompRequestCmd, "git", ""}, builds: 1},
+		{name: "name completion", args: []string{cobra.ShellCompRequestCmd, "gi"}, builds: 0},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			root, builds := newLazyRoot(t)
+
+			Expand(root, tt.args)
+			Expand(root, tt.args)
+			assert.Equal(t, tt.builds, *builds)
+
+			cmd, _, err := root.Find([]string{"git", "list"})
+			require.NoError(t, err)
+
+			if tt.builds > 0 {
+				assert.Equal(t, "list", cmd.Name())
+			} else {
+				assert.Equal(t, "git", cmd.Name(), "stub is still registered")
+			}
+		})
+	}
+}
+
+func TestLazyCommand_ExecuteWithoutExpand(t *testing.T) {
+	root, builds := newLazyRoot(t)
+
+	ran := false
+	root.SetArgs([]string{"git"})
+
+	stub, _, err := root.Find([]string{"git"})
+	require.NoError(t, err)
+
+	// The stub must dispatch to the real command when Expand was skipped
+	git := lazyBuilders[stub]
+	lazyBuilders[stub] = func() *cobra.Command {
+		cmd := git()
+		cmd.Run = func(*cobra.Command, []string) { ran = true }
+
+		return cmd
+	}
+
+	require.NoError(t, root.Execute())
+	assert.Equal(t, 1, *builds)
+	assert.True(t, ran)
+}
@@ -42,6 +42,11 @@ type CommandMetadata struct {
 	Dependencies []string        // 필요한 외부 도구 목록
 	Tags         []string        // 검색 가능한 태그
 	Lifecycle    LifecycleStage  // 개발 단계
+
+	// Short와 Aliases가 설정된 명령어는 지연 생성됩니다 (NewLazyCommand 참조).
+	// 두 값은 Command()가 반환하는 명령어와 일치해야 합니다.
+	Short   string   // 도움말에 표시되는 한 줄 설명
+	Aliases []string // 명령어 별칭
 }
 
 // CommandProvider defines an interface that exposes a Cobra command.
@@ -61,11 +66,24 @@ var (
 	providers []CommandProvider
 )
 
-// Register adds a command provider to the registry.
+// Register adds a command provider to the registry. A provider whose
+// metadata name is already registered replaces the earlier one, so building
+// the root command more than once does not duplicate commands.
 func Register(p CommandProvider) {
 	mu.Lock()
+	defer mu.Unlock()
+
+	if mp, ok := p.(CommandProviderWithMetadata); ok {
+		name := mp.Metadata().Name
+		for i, existing := range providers {
+			if em, ok := existing.(CommandProviderWithMetadata); ok && em.Metadata().Name == name {
+				providers[i] = p
+				return
+			}
+		}
+	}
+
 	providers = append(providers, p)
-	mu.Unlock()
 }
 
 // List returns all registered command providers.
@@ -4,9 +4,17 @@
 package audit
 
 import (
+	"context"
+	"encoding/json"
 	"fmt"
+	"os"
+	"strconv"
 
 	"github.com/spf13/cobra"
+
+	"github.com/gizzahub/gzh-cli/internal/cli"
+	"github.com/gizzahub/gzh-cli/pkg/config"
+	"github.com/gizzahub/gzh-cli/pkg/github"
 )
 
 // GlobalFlags represents global flags for repo-config commands.
@@ -76,22 +84,20 @@ func NewCmd() *cobra.Command {
 This command analyzes repository configurations against defined policies
 and generates simple compliance reports.
 
+Repository states are collected concurrently; use --parallel to control
+how many repositories are fetched at the same time.
+
 Examples:
   # Basic audit report
-  gz repo-config audit --org myorg`,
-		RunE: func(cmd *cobra.Command, args []string) error {
-			if flags.Organization == "" {
-				return fmt.Errorf("organization is required (use --org flag)")
-			}
+  gz repo-config audit --org myorg
 
-			fmt.Printf("📊 Basic compliance audit for organization: %s\n", flags.Organization)
-			fmt.Printf("⚠️  This is a simplified audit command. Full audit features have been removed.\n")
-			fmt.Printf("Format: %s\n", format)
-			if outputFile != "" {
-				fmt.Printf("Output file: %s\n", outputFile)
-			}
+  # Audit a large organization with 10 concurrent fetches
+  gz repo-config audit --org myorg --parallel 10 --format json --output audit.json
 
-			return nil
+  # One result per repository and line, for jq or grep
+  gz repo-config audit --org myorg --format ndjson | jq 'select(.compliant | not)'`,
+		RunE: func(cmd *cobra.Command, args []string) error {
+			return runAuditCommand(flags, format, outputFile)
 		},
 	}
 
@@ -99,8 +105,140 @@ Examples:
 	addGlobalFlags(cmd, &flags)
 
 	// Add basic flags
-	cmd.Flags().StringVar(&format, "format", "table", "Output format (table, json)")
+	cmd.Flags().StringVar(&format, "format", "table", "Output format (table, json, ndjson, csv)")
 	cmd.Flags().StringVar(&outputFile, "output", "", "Output file path")
 
 	return cmd
 }
+
+// runAuditCommand collects repository states and audits them against the configured policies.
+func runAuditCommand(flags GlobalFlags, format, outputFile string) error {
+	if flags.Organization == "" {
+		return fmt.Errorf("organization is required (use --org flag)")
+	}
+
+	switch format {
+	case "table", "json", cli.FormatNDJSON, cli.FormatCSV:
+	default:
+		return fmt.Errorf("unsupported format: %s", format)
+	}
+
+	// NDJSON and CSV records are the only output on stdout
+	records := format == cli.FormatNDJSON || format == cli.FormatCSV
+
+	token := flags.Token
+	if token == "" {
+		token = os.Getenv("GITHUB_TOKEN")
+	}
+
+	if token == "" {
+		return fmt.Errorf("GitHub token not found. Set GITHUB_TOKEN environment variable or use --token flag")
+	}
+
+	configPath := flags.ConfigFile
+	if configPath == "" {
+		configPath = "repo-config.yaml"
+	}
+
+	if records {
+		fmt.Fprintf(os.Stderr, "📊 Compliance audit for organization: %s\n", flags.Organization)
+	} else {
+		fmt.Printf("📊 Compliance audit for organization: %s\n", flags.Organization)
+	}
+
+	client, err := github.NewPooledRepoConfigClient(token)
+	if err != nil {
+		return err
+	}
+
+	adapter := config.NewGitHubAuditAdapter(client)
+
+	report, err := adapter.RunComplianceAuditWithOptions(context.Background(), configPath, flags.Organization,
+		github.PipelineOptions{Concurrency: flags.Parallel, GraphQLBatchSize: github.DefaultGraphQLBatchSize})
+	if err != nil {
+		return fmt.Errorf("audit failed: %w", err)
+	}
+
+	if records {
+		return writeAuditRecords(report, format, outputFile)
+	}
+
+	if format == "json" {
+		data, err := json.MarshalIndent(report, "", "  ")
+		if err != nil {
+			return fmt.Errorf("failed to serialize audit report: %w", err)
+		}
+
+		if outputFile != "" {
+			if err := os.WriteFile(outputFile, data, 0o600); err != nil {
+				return fmt.Errorf("failed to write audit report: %w", err)
+			}
+
+			fmt.Printf("📄 Audit report written to %s\n", outputFile)
+
+			return nil
+		}
+
+		fmt.Println(string(data))
+
+		return nil
+	}
+
+	summary := report.Summary
+	fmt.Printf("Repositories audited: %d/%d\n", summary.AuditedRepositories, summary.TotalRepositories)
+	fmt.Printf("Compliant repositories: %d (%.1f%%)\n", summary.CompliantRepositories, summary.CompliancePercentage)
+	fmt.Printf("Violations: %d\n", summary.TotalViolations)
+
+	for _, repo := range report.Repositories {
+		if repo.Compliant {
+			continue
+		}
+
+		fmt.Printf("\n❌ %s\n", repo.Repository)
+
+		for _, violation := range repo.Violations {
+			fmt.Printf("  [%s] %s: %s\n", violation.Severity, violation.RuleName, violation.Message)
+		}
+	}
+
+	return nil
+}
+
+// auditColumns are the CSV columns of a repository audit result.
+var auditColumns = cli.StreamColumns{
+	Headers: []string{"repository", "template", "compliant", "violations", "exceptions"},
+	Row: func(record any) []string {
+		result := record.(config.RepoAuditResult)
+
+		return []string{
+			result.Repository, result.Template, strconv.FormatBool(result.Compliant),
+			strconv.Itoa(len(result.Violations)), strconv.Itoa(len(result.Exceptions)),
+		}
+	},
+}
+
+// writeAuditRecords writes one record per audited repository to the output
+// file, or stdout.
+func writeAuditRecords(report *config.AuditReport, format, outputFile string) error {
+	if outputFile == "" {
+		return cli.NewOutputFormatter(format).FormatStream(cli.SliceRecords(report.Repositories), auditColumns)
+	}
+
+	file, err := os.Create(outputFile)
+	if err != nil {
+		return fmt.Errorf("failed to create audit report: %w", err)
+	}
+
+	err = cli.NewOutputFormatterWithWriter(format, file).FormatStream(cli.SliceRecords(report.Repositories), auditColumns)
+	if closeErr := file.Close(); err == nil {
+		err = closeErr
+	}
+
+	if err != nil {
+		return fmt.Errorf("failed to write audit report: %w", err)
+	}
+
+	fmt.Fprintf(os.Stderr, "📄 Audit report written to %s\n", outputFile)
+
+	return nil
+}
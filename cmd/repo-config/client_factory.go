@@ -70,7 +70,10 @@ func (f *DefaultClientFactory) CreateRepoConfigClient(token string) (*github.Rep
 	}
 
 	// Create client with injected configuration
-	client := github.NewRepoConfigClient(token)
+	client, err := github.NewPooledRepoConfigClient(token)
+	if err != nil {
+		return nil, err
+	}
 
 	// Apply optional configuration
 	if f.baseURL != "" {
@@ -9,10 +9,12 @@ import (
 	"fmt"
 	"os"
 	"regexp"
+	"strconv"
 	"strings"
 
 	"github.com/spf13/cobra"
 
+	"github.com/gizzahub/gzh-cli/internal/cli"
 	"github.com/gizzahub/gzh-cli/pkg/config"
 	"github.com/gizzahub/gzh-cli/pkg/github"
 )
@@ -111,12 +113,16 @@ Output Formats:
 - table: Human-readable diff table (default)
 - json: JSON format for programmatic use
 - unified: Unified diff format
+- ndjson: One JSON difference per line, printed as repositories are compared
+- csv: One CSV row per difference, printed as repositories are compared
 
 Examples:
   gz repo-config diff --org myorg                # Show all differences
   gz repo-config diff --filter "^api-.*"        # Filter by repository pattern
   gz repo-config diff --format unified          # Unified diff format
-  gz repo-config diff --show-values             # Include current values`,
+  gz repo-config diff --format ndjson | jq .     # Stream differences into jq
+  gz repo-config diff --show-values             # Include current values
+  gz repo-config diff --parallel 10             # Fetch 10 repositories concurrently`,
 		RunE: func(cmd *cobra.Command, args []string) error {
 			return runDiffCommand(flags, filter, format, showValues, impactFilter, onlyNonCompliant, groupByImpact, detailed)
 		},
@@ -127,7 +133,7 @@ Examples:
 
 	// Add diff-specific flags
 	cmd.Flags().StringVar(&filter, "filter", "", "Filter repositories by name pattern (regex)")
-	cmd.Flags().StringVar(&format, "format", "table", "Output format (table, json, unified)")
+	cmd.Flags().StringVar(&format, "format", "table", "Output format (table, json, unified, ndjson, csv)")
 	cmd.Flags().BoolVar(&showValues, "show-values", false, "Include current values in output")
 	cmd.Flags().StringVar(&impactFilter, "impact", "", "Filter by impact level (low, medium, high)")
 	cmd.Flags().BoolVar(&onlyNonCompliant, "non-compliant", false, "Show only non-compliant configurations")
@@ -143,39 +149,115 @@ func runDiffCommand(flags GlobalFlags, filter, format string, showValues bool, i
 		return fmt.Errorf("organization is required (use --org flag)")
 	}
 
-	if flags.Verbose {
-		fmt.Printf("🔍 Comparing repository configurations for organization: %s\n", flags.Organization)
+	switch format {
+	case "table", "json", "unified", cli.FormatNDJSON, cli.FormatCSV:
+	default:
+		return fmt.Errorf("unsupported format: %s", format)
+	}
+
+	// NDJSON and CSV records are meant for other tools, so they are the only
+	// output on stdout
+	records := format == cli.FormatNDJSON || format == cli.FormatCSV
+
+	if !records {
+		if flags.Verbose {
+			fmt.Printf("🔍 Comparing repository configurations for organization: %s\n", flags.Organization)
+
+			if filter != "" {
+				fmt.Printf("Filter pattern: %s\n", filter)
+			}
 
-		if filter != "" {
-			fmt.Printf("Filter pattern: %s\n", filter)
+			fmt.Printf("Format: %s\n", format)
+			fmt.Println()
 		}
 
-		fmt.Printf("Format: %s\n", format)
+		fmt.Printf("📊 Repository Configuration Comparison\n")
+		fmt.Println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━")
+		fmt.Printf("Organization: %s\n", flags.Organization)
 		fmt.Println()
 	}
 
-	fmt.Printf("📊 Repository Configuration Comparison\n")
-	fmt.Println("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━")
-	fmt.Printf("Organization: %s\n", flags.Organization)
-	fmt.Println()
+	// Records, ungrouped tables and unified output are printed per repository
+	// as soon as it has been compared, keeping only the summary counts; JSON
+	// and grouped tables need the complete result set.
+	streaming := records || (!groupByImpact && format != "json")
+	headerPrinted := false
+
+	var (
+		differences []ConfigurationDifference
+		summary     = newDiffSummary()
+		writer      *cli.StreamWriter
+		writeErr    error
+	)
+
+	if records {
+		var err error
+
+		if writer, err = cli.NewOutputFormatter(format).NewStreamWriter(diffColumns); err != nil {
+			return err
+		}
+	}
+
+	emit := func(repoName string, repoDiffs []ConfigurationDifference) {
+		// Apply additional filters
+		if impactFilter != "" {
+			repoDiffs = filterByImpact(repoDiffs, impactFilter)
+		}
+
+		if onlyNonCompliant {
+			repoDiffs = filterNonCompliant(repoDiffs)
+		}
+
+		if len(repoDiffs) == 0 {
+			return
+		}
+
+		summary.add(repoDiffs)
+
+		if !streaming {
+			differences = append(differences, repoDiffs...)
+			return
+		}
+
+		switch format {
+		case "table":
+			if !headerPrinted {
+				displayDiffTableHeader(showValues)
+
+				headerPrinted = true
+			}
+
+			displayRepositoryDiffs(repoName, repoDiffs, showValues)
+		case "unified":
+			displayDiffUnified(repoDiffs)
+		default:
+			for _, diff := range repoDiffs {
+				if err := writer.Write(diff); err != nil && writeErr == nil {
+					writeErr = err
+				}
+			}
+		}
+	}
 
 	// Get configuration differences
-	differences, err := getConfigurationDifferences(flags.Organization, filter, flags.Token, flags.ConfigFile)
-	if err != nil {
+	if err := getConfigurationDifferences(flags.Organization, filter, flags.Token, flags.ConfigFile, flags.Parallel, emit); err != nil {
 		return fmt.Errorf("failed to get configuration differences: %w", err)
 	}
 
-	// Apply additional filters
-	if impactFilter != "" {
-		differences = filterByImpact(differences, impactFilter)
-	}
+	if records {
+		if err := writer.Close(); err != nil && writeErr == nil {
+			writeErr = err
+		}
 
-	if onlyNonCompliant {
-		differences = filterNonCompliant(differences)
+		if writeErr != nil {
+			return fmt.Errorf("failed to write differences: %w", writeErr)
+		}
+
+		return nil
 	}
 
 	// If no differences found, return early
-	if len(differences) == 0 {
+	if summary.total == 0 {
 		if impactFilter != "" || onlyNonCompliant {
 			fmt.Println("✅ No differences match the specified filters")
 		} else {
@@ -185,28 +267,35 @@ func runDiffCommand(flags GlobalFlags, filter, format string, showValues bool, i
 		return nil
 	}
 
-	switch format {
-	case "table":
-		if groupByImpact {
+	if !streaming {
+		switch format {
+		case "table":
 			displayDiffTableByImpact(differences, showValues, detailed)
-		} else {
-			displayDiffTable(differences, showValues)
+		case "json":
+			displayDiffJSON(differences)
 		}
-	case "json":
-		displayDiffJSON(differences)
-	case "unified":
-		displayDiffUnified(differences)
-	default:
-		return fmt.Errorf("unsupported format: %s", format)
 	}
 
 	// Summary
 	fmt.Println()
-	displayDiffSummary(differences)
+	summary.display()
 
 	return nil
 }
 
+// diffColumns are the CSV columns of a difference.
+var diffColumns = cli.StreamColumns{
+	Headers: []string{"repository", "setting", "currentValue", "targetValue", "changeType", "impact", "template", "compliant"},
+	Row: func(record any) []string {
+		diff := record.(ConfigurationDifference)
+
+		return []string{
+			diff.Repository, diff.Setting, diff.CurrentValue, diff.TargetValue,
+			diff.ChangeType, diff.Impact, diff.Template, strconv.FormatBool(diff.Compliant),
+		}
+	},
+}
+
 // ConfigurationDifference represents a difference between current and target config.
 type ConfigurationDifference struct {
 	Repository   string `json:"repository"`
@@ -221,6 +310,18 @@ type ConfigurationDifference struct {
 
 // displayDiffTable displays differences in table format.
 func displayDiffTable(differences []ConfigurationDifference, showValues bool) {
+	displayDiffTableHeader(showValues)
+
+	// Group differences by repository for better readability
+	groupedDiffs := groupDifferencesByRepository(differences)
+
+	for _, repoName := range getSortedRepositoryNames(groupedDiffs) {
+		displayRepositoryDiffs(repoName, groupedDiffs[repoName], showValues)
+	}
+}
+
+// displayDiffTableHeader prints the column header of the diff table.
+func displayDiffTableHeader(showValues bool) {
 	if showValues {
 		fmt.Printf("%-20s %-30s %-15s %-15s %-12s %s\n",
 			"REPOSITORY", "SETTING", "CURRENT", "TARGET", "IMPACT", "ACTION")
@@ -230,44 +331,40 @@ func displayDiffTable(differences []ConfigurationDifference, showValues bool) {
 	}
 
 	fmt.Println("────────────────────────────────────────────────────────────────────────────────")
+}
 
-	// Group differences by repository for better readability
-	groupedDiffs := groupDifferencesByRepository(differences)
-
-	for _, repoName := range getSortedRepositoryNames(groupedDiffs) {
-		repoDiffs := groupedDiffs[repoName]
-
-		// Print repository header
-		fmt.Printf("\n📁 %s\n", repoName)
-		fmt.Println(strings.Repeat("─", 80))
-
-		for _, diff := range repoDiffs {
-			actionSymbol := getActionSymbolWithText(diff.ChangeType)
-			impactSymbol := getImpactSymbol(diff.Impact)
+// displayRepositoryDiffs prints the table rows of a single repository.
+func displayRepositoryDiffs(repoName string, repoDiffs []ConfigurationDifference, showValues bool) {
+	// Print repository header
+	fmt.Printf("\n📁 %s\n", repoName)
+	fmt.Println(strings.Repeat("─", 80))
 
-			if showValues {
-				currentDisplay := truncateString(diff.CurrentValue, 15)
-				if currentDisplay == "" {
-					currentDisplay = colorize("-", "dim")
-				}
+	for _, diff := range repoDiffs {
+		actionSymbol := getActionSymbolWithText(diff.ChangeType)
+		impactSymbol := getImpactSymbol(diff.Impact)
 
-				fmt.Printf(
-					"  %-28s %-15s %-15s %-12s %s\n",
-					truncateString(diff.Setting, 28),
-					colorizeValue(currentDisplay, diff.ChangeType == changeTypeDelete),
-					colorizeValue(truncateString(diff.TargetValue, 15), diff.ChangeType == changeTypeCreate),
-					impactSymbol,
-					actionSymbol,
-				)
-			} else {
-				fmt.Printf(
-					"  %-28s %-12s %-15s %s\n",
-					truncateString(diff.Setting, 28),
-					impactSymbol,
-					actionSymbol,
-					colorize(diff.Template, "dim"),
-				)
+		if showValues {
+			currentDisplay := truncateString(diff.CurrentValue, 15)
+			if currentDisplay == "" {
+				currentDisplay = colorize("-", "dim")
 			}
+
+			fmt.Printf(
+				"  %-28s %-15s %-15s %-12s %s\n",
+				truncateString(diff.Setting, 28),
+				colorizeValue(currentDisplay, diff.ChangeType == changeTypeDelete),
+				colorizeValue(truncateString(diff.TargetValue, 15), diff.ChangeType == changeTypeCreate),
+				impactSymbol,
+				actionSymbol,
+			)
+		} else {
+			fmt.Printf(
+				"  %-28s %-12s %-15s %s\n",
+				truncateString(diff.Setting, 28),
+				impactSymbol,
+				actionSymbol,
+				colorize(diff.Template, "dim"),
+			)
 		}
 	}
 }
@@ -310,30 +407,40 @@ func displayDiffUnified(differences []ConfigurationDifference) {
 	}
 }
 
-// displayDiffSummary displays a summary of differences.
-func displayDiffSummary(differences []ConfigurationDifference) {
-	repoCount := len(getAffectedRepositories(differences))
-
-	impactCounts := map[string]int{
-		"low":    0,
-		"medium": 0,
-		"high":   0,
-	}
+// diffSummary counts differences as they are compared, so that streamed
+// output need not keep them.
+type diffSummary struct {
+	repositories map[string]struct{}
+	total        int
+	impactCounts map[string]int
+	actionCounts map[string]int
+}
 
-	actionCounts := map[string]int{
-		changeTypeCreate: 0,
-		"update":         0,
-		changeTypeDelete: 0,
+func newDiffSummary() *diffSummary {
+	return &diffSummary{
+		repositories: make(map[string]struct{}),
+		impactCounts: make(map[string]int),
+		actionCounts: make(map[string]int),
 	}
+}
 
+// add counts differences.
+func (s *diffSummary) add(differences []ConfigurationDifference) {
 	for _, diff := range differences {
-		impactCounts[diff.Impact]++
-		actionCounts[diff.ChangeType]++
+		s.repositories[diff.Repository] = struct{}{}
+		s.total++
+		s.impactCounts[diff.Impact]++
+		s.actionCounts[diff.ChangeType]++
 	}
+}
+
+// display displays a summary of the differences.
+func (s *diffSummary) display() {
+	impactCounts, actionCounts := s.impactCounts, s.actionCounts
 
 	fmt.Printf("📊 Summary\n")
-	fmt.Printf("Repositories affected: %d\n", repoCount)
-	fmt.Printf("Total changes: %d\n", len(differences))
+	fmt.Printf("Repositories affected: %d\n", len(s.repositories))
+	fmt.Printf("Total changes: %d\n", s.total)
 	fmt.Println()
 
 	fmt.Printf("Impact distribution:\n")
@@ -591,53 +698,6 @@ func getChangeType(current, target string) string {
 	return "update"
 }
 
-// findAppliedTemplate finds which template applies to a repository.
-func findAppliedTemplate(repoConfig *config.RepoConfig, repoName string) string {
-	if repoConfig.Repositories != nil {
-		// Check specific repositories
-		for _, specific := range repoConfig.Repositories.Specific {
-			if specific.Name == repoName && specific.Template != "" {
-				return specific.Template
-			}
-		}
-
-		// Check patterns
-		for _, pattern := range repoConfig.Repositories.Patterns {
-			if matched, _ := matchRepoPattern(repoName, pattern.Match); matched && pattern.Template != "" {
-				return pattern.Template
-			}
-		}
-
-		// Check default
-		if repoConfig.Repositories.Default != nil && repoConfig.Repositories.Default.Template != "" {
-			return repoConfig.Repositories.Default.Template
-		}
-	}
-
-	// Check global defaults
-	if repoConfig.Defaults != nil && repoConfig.Defaults.Template != "" {
-		return repoConfig.Defaults.Template
-	}
-
-	return "none"
-}
-
-// matchRepoPattern checks if a repository name matches a pattern.
-func matchRepoPattern(name, pattern string) (bool, error) {
-	// Convert simple glob patterns to regex
-	if strings.Contains(pattern, "*") {
-		// Escape special regex characters except *
-		pattern = regexp.QuoteMeta(pattern)
-		// Replace escaped \* back to .*
-		pattern = strings.ReplaceAll(pattern, "\\*", ".*")
-		pattern = "^" + pattern + "$"
-
-		return regexp.MatchString(pattern, name)
-	}
-
-	return name == pattern, nil
-}
-
 // applyPolicyExceptions applies policy exceptions to differences.
 func applyPolicyExceptions(differences []ConfigurationDifference, exceptions []config.PolicyException) []ConfigurationDifference {
 	// For now, just return differences as-is
@@ -647,7 +707,11 @@ func applyPolicyExceptions(differences []ConfigurationDifference, exceptions []c
 }
 
 // getConfigurationDifferences retrieves configuration differences for an organization.
-func getConfigurationDifferences(organization, filter, token, configPath string) ([]ConfigurationDifference, error) {
+//
+// Repositories are listed, fetched in GraphQL batches by up to parallel
+// concurrent workers and compared as they arrive; emit is called once per repository with its
+// differences, in completion order.
+func getConfigurationDifferences(organization, filter, token, configPath string, parallel int, emit func(repoName string, diffs []ConfigurationDifference)) error {
 	// Create a context
 	ctx := context.Background()
 
@@ -657,11 +721,14 @@ func getConfigurationDifferences(organization, filter, token, configPath string)
 	}
 
 	if token == "" {
-		return nil, fmt.Errorf("GitHub token not found. Set GITHUB_TOKEN environment variable or use --token flag")
+		return fmt.Errorf("GitHub token not found. Set GITHUB_TOKEN environment variable or use --token flag")
 	}
 
 	// Create GitHub client
-	client := github.NewRepoConfigClient(token)
+	client, err := github.NewPooledRepoConfigClient(token)
+	if err != nil {
+		return err
+	}
 
 	// Load repo config file
 	if configPath == "" {
@@ -670,75 +737,78 @@ func getConfigurationDifferences(organization, filter, token, configPath string)
 
 	repoConfig, err := config.LoadRepoConfig(configPath)
 	if err != nil {
-		return nil, fmt.Errorf("failed to load repo config: %w", err)
+		return fmt.Errorf("failed to load repo config: %w", err)
 	}
 
 	// Validate that the organization matches
 	if repoConfig.Organization != organization {
-		return nil, fmt.Errorf("organization mismatch: config file is for '%s', but diff requested for '%s'", repoConfig.Organization, organization)
+		return fmt.Errorf("organization mismatch: config file is for '%s', but diff requested for '%s'", repoConfig.Organization, organization)
 	}
 
-	// List all repositories in the organization
-	listOpts := &github.ListOptions{
-		PerPage: 100,
-	}
-
-	repos, err := client.ListRepositories(ctx, organization, listOpts)
-	if err != nil {
-		return nil, fmt.Errorf("failed to list repositories: %w", err)
-	}
-
-	// Apply filter if specified
-	var filteredRepos []*github.Repository
+	var filterRegex *regexp.Regexp
 
 	if filter != "" {
-		filterRegex, err := regexp.Compile(filter)
+		filterRegex, err = regexp.Compile(filter)
 		if err != nil {
-			return nil, fmt.Errorf("invalid filter regex: %w", err)
+			return fmt.Errorf("invalid filter regex: %w", err)
 		}
+	}
 
-		for _, repo := range repos {
-			if filterRegex.MatchString(repo.Name) {
-				filteredRepos = append(filteredRepos, repo)
+	opts := github.PipelineOptions{
+		Concurrency:      parallel,
+		ListOptions:      &github.ListOptions{PerPage: 100},
+		GraphQLBatchSize: github.DefaultGraphQLBatchSize,
+		Filter: func(repo *github.Repository) bool {
+			// Skip archived repositories
+			if repo.Archived {
+				return false
 			}
-		}
-	} else {
-		filteredRepos = repos
+
+			return filterRegex == nil || filterRegex.MatchString(repo.Name)
+		},
 	}
 
-	// Compare configurations
-	var differences []ConfigurationDifference
+	resolver := config.NewRepoConfigResolver(repoConfig)
 
-	for _, repo := range filteredRepos {
-		// Skip archived repositories
-		if repo.Archived {
-			continue
-		}
+	// Resolve repositories with one GraphQL query per batch, falling back to
+	// REST for repositories a batch could not resolve
+	fetcher := github.NewGraphQLBatchFetcher(client, opts.GraphQLBatchSize)
 
-		// Get current configuration from GitHub
-		currentConfig, err := client.GetRepositoryConfiguration(ctx, organization, repo.Name)
-		if err != nil {
+	fetchBatch := func(ctx context.Context, batch []*github.Repository) (map[string]*github.RepositoryConfig, error) {
+		return fetcher.FetchConfigs(ctx, organization, batch)
+	}
+
+	fetch := func(ctx context.Context, repo *github.Repository) (*github.RepositoryConfig, error) {
+		return client.GetRepositoryConfiguration(ctx, organization, repo.Name)
+	}
+
+	// Compare configurations as the fetch stage produces them
+	return github.RunRepositoryBatchPipeline(ctx, client, organization, opts, fetchBatch, fetch, func(result github.PipelineResult[*github.RepositoryConfig]) error {
+		repoName := result.Repository.Name
+
+		if result.Err != nil {
 			// Log error but continue with other repos
-			fmt.Printf("Warning: Failed to get configuration for %s: %v\n", repo.Name, err)
-			continue
+			fmt.Fprintf(os.Stderr, "Warning: Failed to get configuration for %s: %v\n", repoName, result.Err)
+			return nil
 		}
 
-		// Get target configuration from repo config
-		targetSettings, targetSecurity, targetPermissions, exceptions, err := repoConfig.GetEffectiveConfig(repo.Name)
+		// Get target configuration and the template it came from
+		target, err := resolver.Resolve(repoName)
 		if err != nil {
-			fmt.Printf("Warning: Failed to get target configuration for %s: %v\n", repo.Name, err)
-			continue
+			fmt.Fprintf(os.Stderr, "Warning: Failed to get target configuration for %s: %v\n", repoName, err)
+			return nil
 		}
 
-		// Find which template applies to this repository
-		templateName := findAppliedTemplate(repoConfig, repo.Name)
+		templateName := target.Template
+		if templateName == "" {
+			templateName = "none"
+		}
 
 		// Compare settings
-		repoDiffs := compareRepositoryConfigurations(repo.Name, currentConfig, targetSettings, targetSecurity, targetPermissions, templateName, exceptions)
-		differences = append(differences, repoDiffs...)
-	}
+		emit(repoName, compareRepositoryConfigurations(repoName, result.Value, target.Settings, target.Security, target.Permissions, templateName, target.Exceptions))
 
-	return differences, nil
+		return nil
+	})
 }
 
 // compareBasicSettings compares basic repository settings.
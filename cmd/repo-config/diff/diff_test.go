@@ -186,70 +186,6 @@ func TestGetChangeType(t *testing.T) {
 	}
 }
 
-func TestFindAppliedTemplate(t *testing.T) {
-	repoConfig := &config.RepoConfig{
-		Defaults: &config.RepoDefaults{
-			Template: "base",
-		},
-		Repositories: &config.RepoTargets{
-			Specific: []config.RepoSpecificConfig{
-				{Name: "api-service", Template: "microservice"},
-				{Name: "web-app", Template: "frontend"},
-			},
-			Patterns: []config.RepoPatternConfig{
-				{Match: "*-service", Template: "backend"},
-				{Match: "test-*", Template: "testing"},
-			},
-			Default: &config.RepoDefaultConfig{
-				Template: "standard",
-			},
-		},
-	}
-
-	tests := []struct {
-		repoName string
-		expected string
-	}{
-		{"api-service", "microservice"}, // specific match
-		{"web-app", "frontend"},         // specific match
-		{"auth-service", "backend"},     // pattern match
-		{"test-integration", "testing"}, // pattern match
-		{"random-repo", "standard"},     // default match
-		{"another-service", "backend"},  // pattern match
-	}
-
-	for _, tt := range tests {
-		t.Run(tt.repoName, func(t *testing.T) {
-			result := findAppliedTemplate(repoConfig, tt.repoName)
-			assert.Equal(t, tt.expected, result)
-		})
-	}
-}
-
-func TestMatchRepoPattern(t *testing.T) {
-	tests := []struct {
-		name     string
-		pattern  string
-		expected bool
-	}{
-		{"api-service", "*-service", true},
-		{"service-api", "*-service", false},
-		{"test-repo", "test-*", true},
-		{"repo-test", "test-*", false},
-		{"exact-match", "exact-match", true},
-		{"no-match", "exact-match", false},
-		{"api-complex-service", "api-*-service", true},
-	}
-
-	for _, tt := range tests {
-		t.Run(tt.name+"-"+tt.pattern, func(t *testing.T) {
-			matched, err := matchRepoPattern(tt.name, tt.pattern)
-			assert.NoError(t, err)
-			assert.Equal(t, tt.expected, matched)
-		})
-	}
-}
-
 // Helper functions for creating pointers.
 func strPtr(s string) *string {
 	return &s
@@ -304,6 +240,38 @@ func TestGroupDifferencesByRepository(t *testing.T) {
 	assert.Equal(t, 1, len(grouped["repo2"]))
 }
 
+func TestDiffSummary(t *testing.T) {
+	summary := newDiffSummary()
+	summary.add([]ConfigurationDifference{
+		{Repository: "repo1", Impact: "high", ChangeType: changeTypeUpdate},
+		{Repository: "repo1", Impact: "low", ChangeType: changeTypeCreate},
+	})
+	summary.add([]ConfigurationDifference{
+		{Repository: "repo2", Impact: "high", ChangeType: changeTypeUpdate},
+	})
+
+	assert.Equal(t, 3, summary.total)
+	assert.Len(t, summary.repositories, 2)
+	assert.Equal(t, 2, summary.impactCounts["high"])
+	assert.Equal(t, 2, summary.actionCounts[changeTypeUpdate])
+}
+
+func TestDiffColumns(t *testing.T) {
+	row := diffColumns.Row(ConfigurationDifference{
+		Repository:   "repo1",
+		Setting:      "has_wiki",
+		CurrentValue: "true",
+		TargetValue:  "false",
+		ChangeType:   changeTypeUpdate,
+		Impact:       "low",
+		Template:     "standard",
+		Compliant:    false,
+	})
+
+	assert.Len(t, row, len(diffColumns.Headers))
+	assert.Equal(t, []string{"repo1", "has_wiki", "true", "false", "update", "low", "standard", "false"}, row)
+}
+
 func TestGetSortedRepositoryNames(t *testing.T) {
 	grouped := map[string][]ConfigurationDifference{
 		"zebra": {},
@@ -28,6 +28,7 @@ func (p repoConfigCmdProvider) Metadata() registry.CommandMetadata {
 		Dependencies: []string{},
 		Tags:         []string{"repository", "config", "github", "settings", "template"},
 		Lifecycle:    registry.LifecycleStable,
+		Short:        "GitHub repository configuration management",
 	}
 }
 
@@ -28,7 +28,9 @@ import (
 	"github.com/gizzahub/gzh-cli/internal/app"
 	"github.com/gizzahub/gzh-cli/internal/config"
 	"github.com/gizzahub/gzh-cli/internal/extensions"
+	"github.com/gizzahub/gzh-cli/internal/httpclient"
 	"github.com/gizzahub/gzh-cli/internal/logger"
+	"github.com/gizzahub/gzh-cli/internal/simpleprof"
 )
 
 var (
@@ -60,6 +62,11 @@ Utility Commands: doctor, version`,
 				_ = os.Unsetenv("GZH_VERBOSE")
 			}
 		},
+		PersistentPostRun: func(_ *cobra.Command, _ []string) {
+			if debug {
+				printTransportStats()
+			}
+		},
 		RunE: func(cmd *cobra.Command, _ []string) error {
 			return cmd.Help()
 		},
@@ -86,37 +93,19 @@ Utility Commands: doctor, version`,
 	}
 	filteredProviders := lifecycleManager.FilterCommands(registry.List())
 
-	// Add all registered commands to root with lifecycle checks
+	// Add all registered commands to root with lifecycle checks. Commands
+	// whose metadata describes them are added as stubs and only built when
+	// dispatched (see Execute).
 	for _, provider := range filteredProviders {
-		providerCmd := provider.Command()
-
-		// Wrap the command execution with lifecycle validation
-		if registry.HasMetadata(provider) {
-			meta := registry.GetMetadata(provider)
-			originalRunE := providerCmd.RunE
-			originalRun := providerCmd.Run
-
-			// Wrap RunE if exists
-			if originalRunE != nil {
-				providerCmd.RunE = func(cmd *cobra.Command, args []string) error {
-					if err := lifecycleManager.CheckCommand(meta); err != nil {
-						return err
-					}
-					return originalRunE(cmd, args)
-				}
-			} else if originalRun != nil {
-				// Wrap Run if exists
-				providerCmd.Run = func(cmd *cobra.Command, args []string) {
-					if err := lifecycleManager.CheckCommand(meta); err != nil {
-						fmt.Fprintf(os.Stderr, "Error: %v\n", err)
-						os.Exit(1)
-					}
-					originalRun(cmd, args)
-				}
-			}
+		if registry.HasMetadata(provider) && registry.IsLazy(registry.GetMetadata(provider)) {
+			cmd.AddCommand(registry.NewLazyCommand(registry.GetMetadata(provider), func() *cobra.Command {
+				return withLifecycleCheck(lifecycleManager, provider)
+			}))
+
+			continue
 		}
 
-		cmd.AddCommand(providerCmd)
+		cmd.AddCommand(withLifecycleCheck(lifecycleManager, provider))
 	}
 
 	// Load user extensions (aliases and external commands)
@@ -155,6 +144,41 @@ Utility Commands: doctor, version`,
 	return cmd
 }
 
+// withLifecycleCheck builds the command of provider and wraps its execution
+// with lifecycle validation.
+func withLifecycleCheck(lifecycleManager *registry.LifecycleManager, provider registry.CommandProvider) *cobra.Command {
+	providerCmd := provider.Command()
+
+	if !registry.HasMetadata(provider) {
+		return providerCmd
+	}
+
+	meta := registry.GetMetadata(provider)
+	originalRunE := providerCmd.RunE
+	originalRun := providerCmd.Run
+
+	// Wrap RunE if exists
+	if originalRunE != nil {
+		providerCmd.RunE = func(cmd *cobra.Command, args []string) error {
+			if err := lifecycleManager.CheckCommand(meta); err != nil {
+				return err
+			}
+			return originalRunE(cmd, args)
+		}
+	} else if originalRun != nil {
+		// Wrap Run if exists
+		providerCmd.Run = func(cmd *cobra.Command, args []string) {
+			if err := lifecycleManager.CheckCommand(meta); err != nil {
+				fmt.Fprintf(os.Stderr, "Error: %v\n", err)
+				os.Exit(1)
+			}
+			originalRun(cmd, args)
+		}
+	}
+
+	return providerCmd
+}
+
 // Execute invokes the command.
 func Execute(ctx context.Context, version string) error {
 	// Check if debug shell should be started immediately
@@ -164,6 +188,20 @@ func Execute(ctx context.Context, version string) error {
 		return nil
 	}
 
+	// Keep a flight recorder for long runs, dumping to the given directory
+	if dir := os.Getenv("GZH_FLIGHT_RECORDER"); dir != "" {
+		recorderConfig := simpleprof.DefaultFlightRecorderConfig()
+		recorderConfig.OutputDir = dir
+
+		recorder := simpleprof.NewFlightRecorder(recorderConfig)
+		if err := recorder.Start(ctx); err != nil {
+			fmt.Fprintf(os.Stderr, "⚠️  Failed to start flight recorder: %v\n", err)
+		} else {
+			simpleprof.SetDefaultFlightRecorder(recorder)
+			defer recorder.Stop()
+		}
+	}
+
 	cfg, err := config.LoadGlobalConfig()
 	if err != nil {
 		cfg = config.DefaultGlobalConfig()
@@ -184,9 +222,31 @@ func Execute(ctx context.Context, version string) error {
 		return nil
 	}
 
+	// Build only the command subtree this invocation dispatches to
+	registry.Expand(rootCmd, os.Args[1:])
+
 	if err := rootCmd.Execute(); err != nil {
 		return fmt.Errorf("error executing root command: %w", err)
 	}
 
 	return nil
 }
+
+// printTransportStats reports connection reuse and request coalescing of the
+// shared provider transports used during the command.
+func printTransportStats() {
+	stats := httpclient.GetGlobalTransportStats()
+
+	clientTypes := make([]string, 0, len(stats))
+	for clientType := range stats {
+		clientTypes = append(clientTypes, clientType)
+	}
+
+	slices.Sort(clientTypes)
+
+	for _, clientType := range clientTypes {
+		s := stats[clientType]
+		fmt.Fprintf(os.Stderr, "[http] %s: %d requests, %d upstream, %.0f%% coalesced, %.0f%% connection reuse\n",
+			clientType, s.Requests, s.Upstream, s.CoalesceRate()*100, s.ReuseRate()*100)
+	}
+}
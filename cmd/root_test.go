@@ -4,10 +4,13 @@ package cmd
 import (
 	"bytes"
 	"context"
+	"strings"
 	"testing"
 
+	"github.com/stretchr/testify/assert"
 	"github.com/stretchr/testify/require"
 
+	"github.com/gizzahub/gzh-cli/cmd/registry"
 	"github.com/gizzahub/gzh-cli/internal/app"
 )
 
@@ -21,3 +24,57 @@ func TestRootCommandOutput(t *testing.T) {
 	cmdErr := cmd.RunE(cmd, nil)
 	require.NoError(t, cmdErr)
 }
+
+// TestLazyCommandMetadata keeps the stubs shown in the root help in line with
+// the commands they stand for.
+func TestLazyCommandMetadata(t *testing.T) {
+	NewRootCmd(context.Background(), "", app.NewTestAppContext())
+
+	for _, provider := range registry.List() {
+		meta := registry.GetMetadata(provider)
+		if !registry.IsLazy(meta) {
+			continue
+		}
+
+		t.Run(meta.Name, func(t *testing.T) {
+			cmd := provider.Command()
+			assert.Equal(t, meta.Name, cmd.Name())
+			assert.Equal(t, meta.Short, cmd.Short)
+			assert.ElementsMatch(t, meta.Aliases, cmd.Aliases)
+		})
+	}
+}
+
+func TestRootCommandBuildsDispatchedCommandOnly(t *testing.T) {
+	cmd := NewRootCmd(context.Background(), "", app.NewTestAppContext())
+	registry.Expand(cmd, []string{"git", "repo", "list"})
+
+	found, _, err := cmd.Find([]string{"git", "repo", "list"})
+	require.NoError(t, err)
+	assert.Equal(t, "list", found.Name())
+
+	synclone, _, err := cmd.Find([]string{"synclone"})
+	require.NoError(t, err)
+	assert.False(t, synclone.HasSubCommands(), "commands that were not dispatched stay stubs")
+}
+
+// BenchmarkRootStartup measures the command construction a gz invocation pays
+// before running: building the root and expanding the dispatched command.
+func BenchmarkRootStartup(b *testing.B) {
+	appCtx := app.NewTestAppContext()
+
+	for _, args := range [][]string{
+		{"--help"},
+		{"__complete", "git", "repo", ""},
+		{"git", "repo", "list"},
+	} {
+		b.Run(strings.Join(args, " "), func(b *testing.B) {
+			b.ReportAllocs()
+
+			for range b.N {
+				cmd := NewRootCmd(context.Background(), "", appCtx)
+				registry.Expand(cmd, args)
+			}
+		})
+	}
+}
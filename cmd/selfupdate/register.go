@@ -28,6 +28,7 @@ func (p selfUpdateCmdProvider) Metadata() registry.CommandMetadata {
 		Dependencies: []string{},
 		Tags:         []string{"update", "upgrade", "self-update", "version"},
 		Lifecycle:    registry.LifecycleStable,
+		Short:        "Update gz binary to the latest version",
 	}
 }
 
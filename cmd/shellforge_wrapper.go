@@ -77,6 +77,7 @@ func (p shellforgeCmdProvider) Metadata() registry.CommandMetadata {
 		Dependencies: []string{},
 		Tags:         []string{"shell", "config", "bash", "zsh", "modules", "build"},
 		Lifecycle:    registry.LifecycleStable,
+		Short:        "Build tool for modular shell configurations",
 	}
 }
 
@@ -26,6 +26,8 @@ func newConfigGenerateDiscoverCmd() *cobra.Command {
 		maxDepth       int
 		ignorePatterns []string
 		followSymlinks bool
+		computeSize    bool
+		noCache        bool
 	)
 
 	cmd := &cobra.Command{
@@ -52,9 +54,12 @@ Examples:
   gz synclone config generate discover --path ~/workspace --recursive --depth 3
 
   # Merge with existing configuration
-  gz synclone config generate discover --path ~/repos --merge-existing`,
+  gz synclone config generate discover --path ~/repos --merge-existing
+
+  # Include repository sizes (runs git count-objects per repository)
+  gz synclone config generate discover --path ~/repos --size`,
 		RunE: func(cmd *cobra.Command, args []string) error {
-			return runConfigGenerateDiscover(basePath, outputFile, mergeExisting, recursive, maxDepth, ignorePatterns, followSymlinks)
+			return runConfigGenerateDiscover(basePath, outputFile, mergeExisting, recursive, maxDepth, ignorePatterns, followSymlinks, computeSize, noCache)
 		},
 	}
 
@@ -65,12 +70,14 @@ Examples:
 	cmd.Flags().IntVar(&maxDepth, "depth", 3, "Maximum directory depth for recursive scan")
 	cmd.Flags().StringSliceVar(&ignorePatterns, "ignore", []string{".git", "node_modules", ".venv", "target", "build"}, "Patterns to ignore during discovery")
 	cmd.Flags().BoolVar(&followSymlinks, "follow-symlinks", false, "Follow symbolic links during discovery")
+	cmd.Flags().BoolVar(&computeSize, "size", false, "Compute repository object store sizes")
+	cmd.Flags().BoolVar(&noCache, "no-cache", false, "Rescan every directory instead of reusing the discovery cache")
 
 	return cmd
 }
 
 // runConfigGenerateDiscover executes the discover command.
-func runConfigGenerateDiscover(basePath, outputFile string, mergeExisting, _ bool, maxDepth int, ignorePatterns []string, followSymlinks bool) error {
+func runConfigGenerateDiscover(basePath, outputFile string, mergeExisting, _ bool, maxDepth int, ignorePatterns []string, followSymlinks, computeSize, noCache bool) error {
 	fmt.Printf("🔍 Discovering repositories in %s...\n", basePath)
 
 	// Create repository discoverer
@@ -78,6 +85,11 @@ func runConfigGenerateDiscover(basePath, outputFile string, mergeExisting, _ boo
 	discoverer.SetMaxDepth(maxDepth)
 	discoverer.SetIgnorePatterns(ignorePatterns)
 	discoverer.SetFollowSymlinks(followSymlinks)
+	discoverer.SetComputeSize(computeSize)
+
+	if noCache {
+		discoverer.SetCacheDir("")
+	}
 
 	// Discover repositories
 	repos, err := discoverer.DiscoverRepos()
@@ -114,7 +126,7 @@ func runConfigGenerateDiscover(basePath, outputFile string, mergeExisting, _ boo
 	fmt.Printf("📁 Configuration saved to %s\n", outputFile)
 
 	// Display summary
-	displayDiscoverySummary(groupedRepos, repos)
+	displayDiscoverySummary(groupedRepos, repos, computeSize)
 
 	return nil
 }
@@ -469,7 +481,7 @@ func saveConfiguration(config map[string]any, filename string) error {
 }
 
 // displayDiscoverySummary displays a summary of the discovery results.
-func displayDiscoverySummary(groupedRepos map[string]map[string][]discovery.DiscoveredRepo, allRepos []discovery.DiscoveredRepo) {
+func displayDiscoverySummary(groupedRepos map[string]map[string][]discovery.DiscoveredRepo, allRepos []discovery.DiscoveredRepo, withSize bool) {
 	fmt.Printf("\n📊 Discovery Summary:\n")
 	fmt.Printf("   Total repositories: %d\n", len(allRepos))
 
@@ -492,6 +504,10 @@ func displayDiscoverySummary(groupedRepos map[string]map[string][]discovery.Disc
 		fmt.Printf("   %s: %d organizations, %d repositories\n", provider, orgCount, repoCount)
 	}
 
+	if !withSize {
+		return
+	}
+
 	// Calculate total size
 	var totalSize int64
 	for _, repo := range allRepos {
@@ -30,6 +30,7 @@ func (p syncCloneCmdProvider) Metadata() registry.CommandMetadata {
 		Dependencies: []string{"git"},
 		Tags:         []string{"sync", "clone", "multi-platform", "github", "gitlab", "gitea"},
 		Lifecycle:    registry.LifecycleStable,
+		Short:        "Synchronize and clone repositories from multiple Git hosting services",
 	}
 }
 
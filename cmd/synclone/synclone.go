@@ -13,6 +13,7 @@ import (
 	"github.com/gizzahub/gzh-cli/internal/app"
 	"github.com/gizzahub/gzh-cli/internal/config"
 	gerrors "github.com/gizzahub/gzh-cli/internal/errors"
+	"github.com/gizzahub/gzh-cli/internal/git/objectcache"
 	pkgconfig "github.com/gizzahub/gzh-cli/pkg/config"
 	"github.com/gizzahub/gzh-cli/pkg/github"
 	"github.com/gizzahub/gzh-cli/pkg/gitlab"
@@ -29,6 +30,8 @@ type syncCloneOptions struct {
 	resume         bool
 	progressMode   string
 	cleanupOrphans bool
+	cloneFilter    string
+	objectCache    string
 }
 
 func defaultSyncCloneOptions() *syncCloneOptions {
@@ -67,6 +70,9 @@ When targeting an organization, a gzh.yaml file will be created in the target di
 containing the repository list for future reference and synchronization.
 
 For provider-specific operations, use the subcommands (github, gitlab, etc.).`,
+		PersistentPreRunE: func(cmd *cobra.Command, args []string) error {
+			return o.applyCloneStrategy()
+		},
 		RunE: func(cmd *cobra.Command, args []string) error {
 			return o.run(ctx, cmd, args)
 		},
@@ -83,6 +89,10 @@ For provider-specific operations, use the subcommands (github, gitlab, etc.).`,
 	cmd.Flags().StringVar(&o.progressMode, "progress-mode", o.progressMode, "Progress display mode: bar, dots, spinner, quiet")
 	cmd.Flags().BoolVar(&o.cleanupOrphans, "cleanup-orphans", o.cleanupOrphans, "Remove directories not present in the organization's repositories")
 
+	// Clone strategy flags shared by every provider subcommand
+	cmd.PersistentFlags().StringVar(&o.cloneFilter, "filter", "", "Partial clone filter for new clones (blob:none, tree:0); defaults to $GZH_CLONE_FILTER")
+	cmd.PersistentFlags().StringVar(&o.objectCache, "object-cache", "", "Shared object cache directory reused across clones; defaults to $GZH_OBJECT_CACHE")
+
 	// Mark flags as mutually exclusive
 	cmd.MarkFlagsMutuallyExclusive("config", "use-config", "use-gzh-config")
 
@@ -97,6 +107,33 @@ For provider-specific operations, use the subcommands (github, gitlab, etc.).`,
 	return cmd
 }
 
+// applyCloneStrategy overrides the environment-configured clone strategy with
+// the --filter and --object-cache flags.
+func (o *syncCloneOptions) applyCloneStrategy() error {
+	if o.cloneFilter == "" && o.objectCache == "" {
+		return nil
+	}
+
+	strategy := *objectcache.DefaultStrategy()
+
+	if o.cloneFilter != "" {
+		filter, err := objectcache.ParseFilter(o.cloneFilter)
+		if err != nil {
+			return err
+		}
+
+		strategy.Filter = filter
+	}
+
+	if o.objectCache != "" {
+		strategy.Cache = objectcache.NewCache(o.objectCache)
+	}
+
+	objectcache.SetDefaultStrategy(&strategy)
+
+	return nil
+}
+
 func (o *syncCloneOptions) run(ctx context.Context, _ *cobra.Command, _ []string) error {
 	// Use central configuration service for unified configuration management
 	return o.runWithCentralConfigService(ctx)
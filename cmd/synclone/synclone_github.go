@@ -135,6 +135,7 @@ type syncCloneGithubOptions struct {
 	parallel      int
 	maxRetries    int
 	resume        bool
+	incremental   bool
 	optimized     bool
 	token         string
 	memoryLimit   string
@@ -194,6 +195,7 @@ func newSyncCloneGithubCmd(appCtx *app.AppContext) *cobra.Command {
 	cmd.Flags().IntVarP(&o.parallel, "parallel", "p", o.parallel, "Number of parallel workers for cloning")
 	cmd.Flags().IntVar(&o.maxRetries, "max-retries", o.maxRetries, "Maximum retry attempts for failed operations")
 	cmd.Flags().BoolVar(&o.resume, "resume", false, "Resume interrupted clone operation from saved state")
+	cmd.Flags().BoolVar(&o.incremental, "incremental", false, "Only sync repositories pushed since the last incremental run")
 
 	// New optimization flags
 	cmd.Flags().BoolVar(&o.optimized, "optimized", o.optimized, "Use optimized streaming API for large-scale operations (recommended for >1000 repos)")
@@ -404,7 +406,12 @@ func (o *syncCloneGithubOptions) run(cmd *cobra.Command, args []string, appCtx *
 	}
 
 	// Step 4: Clone/sync repositories using appropriate method
-	if o.enableCache { //nolint:gocritic // Complex boolean conditions not suitable for switch
+	if o.incremental { //nolint:gocritic // Complex boolean conditions not suitable for switch
+		log.Info("Using incremental sync", "progress_mode", o.progressMode)
+		fmt.Printf("⏩ Using incremental sync: only repositories pushed since the last run are processed\n")
+
+		err = github.RefreshAllIncremental(ctx, o.targetPath, o.orgName, o.strategy, o.parallel, o.maxRetries, o.progressMode)
+	} else if o.enableCache {
 		// Use cached approach (Redis cache disabled, using local cache only)
 		log.Info("Using cached API calls for improved performance")
 		fmt.Printf("🔄 Using cached API calls for improved performance\n")
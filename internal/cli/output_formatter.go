@@ -4,10 +4,12 @@
 package cli
 
 import (
+	"encoding/csv"
 	"encoding/json"
 	"fmt"
 	"io"
 	"os"
+	"reflect"
 	"strings"
 
 	"gopkg.in/yaml.v3"
@@ -51,6 +53,8 @@ func (f *OutputFormatter) FormatOutput(data any) error {
 		return f.outputJSON(data)
 	case FormatYAML:
 		return f.outputYAML(data)
+	case FormatNDJSON:
+		return f.outputNDJSON(data)
 	case FormatTable:
 		return f.outputTable(data)
 	default:
@@ -65,6 +69,24 @@ func (f *OutputFormatter) outputJSON(data any) error {
 	return encoder.Encode(data)
 }
 
+// outputNDJSON outputs a slice one element per line, other data on a single line.
+func (f *OutputFormatter) outputNDJSON(data any) error {
+	encoder := json.NewEncoder(f.writer)
+
+	value := reflect.ValueOf(data)
+	if value.Kind() != reflect.Slice && value.Kind() != reflect.Array {
+		return encoder.Encode(data)
+	}
+
+	for i := range value.Len() {
+		if err := encoder.Encode(value.Index(i).Interface()); err != nil {
+			return err
+		}
+	}
+
+	return nil
+}
+
 // outputYAML outputs data in YAML format.
 func (f *OutputFormatter) outputYAML(data any) error {
 	encoder := yaml.NewEncoder(f.writer)
@@ -86,6 +108,10 @@ type TableData interface {
 
 // FormatTable formats table data with consistent styling.
 func (f *OutputFormatter) FormatTable(data TableData) error {
+	if f.format == FormatCSV {
+		return f.outputCSV(data)
+	}
+
 	if f.format != FormatTable {
 		return f.FormatOutput(data)
 	}
@@ -119,6 +145,21 @@ func (f *OutputFormatter) FormatTable(data TableData) error {
 	return nil
 }
 
+// outputCSV outputs table data as CSV.
+func (f *OutputFormatter) outputCSV(data TableData) error {
+	writer := csv.NewWriter(f.writer)
+
+	if err := writer.Write(data.GetHeaders()); err != nil {
+		return fmt.Errorf("failed to write CSV header: %w", err)
+	}
+
+	if err := writer.WriteAll(data.GetRows()); err != nil {
+		return fmt.Errorf("failed to write CSV records: %w", err)
+	}
+
+	return nil
+}
+
 // printRow prints a table row with proper spacing.
 func (f *OutputFormatter) printRow(cells []string, colWidths []int) {
 	var parts []string
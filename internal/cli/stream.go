@@ -0,0 +1,322 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package cli
+
+import (
+	"encoding/csv"
+	"encoding/json"
+	"fmt"
+)
+
+const (
+	// FormatNDJSON represents newline-delimited JSON output format, one record per line.
+	FormatNDJSON = "ndjson"
+	// FormatCSV represents CSV output format.
+	FormatCSV = "csv"
+)
+
+// defaultSampleRows is the number of rows buffered to size table columns
+// whose width is not fixed.
+const defaultSampleRows = 100
+
+// RecordIterator pulls the records of a result set one at a time.
+//
+//	for it.Next() {
+//		record := it.Record()
+//		...
+//	}
+//	if err := it.Err(); err != nil {
+//		...
+//	}
+type RecordIterator interface {
+	// Next advances to the next record and reports whether there is one.
+	Next() bool
+	// Record returns the current record.
+	Record() any
+	// Err returns the error that stopped the iteration, if any.
+	Err() error
+}
+
+// StreamColumns describes the CSV and table columns of streamed records.
+// NDJSON and JSON write the records themselves and ignore it.
+type StreamColumns struct {
+	Headers []string
+	// Row returns the cells of a record, in the order of Headers.
+	Row func(record any) []string
+	// Widths fixes the table width of each column. Columns without a
+	// positive width are sized from the first SampleRows rows; longer cells
+	// of later rows are truncated.
+	Widths []int
+	// SampleRows is the number of rows sampled for column widths, 100 if
+	// not positive.
+	SampleRows int
+	// NoHeader omits the CSV and table header.
+	NoHeader bool
+}
+
+// StreamWriter writes records as they are produced, holding at most the
+// sampled rows of a table in memory.
+type StreamWriter struct {
+	formatter *OutputFormatter
+	columns   StreamColumns
+
+	started bool
+	count   int
+	json    *json.Encoder
+	csv     *csv.Writer
+	widths  []int
+	sample  [][]string
+}
+
+// NewStreamWriter creates a stream writer for the format of the formatter:
+// json, ndjson, csv or table. YAML documents cannot be streamed.
+func (f *OutputFormatter) NewStreamWriter(columns StreamColumns) (*StreamWriter, error) {
+	switch f.format {
+	case FormatJSON, FormatNDJSON, FormatCSV, FormatTable:
+	default:
+		return nil, fmt.Errorf("unsupported streaming output format: %s", f.format)
+	}
+
+	if f.format == FormatCSV || f.format == FormatTable {
+		if columns.Row == nil {
+			return nil, fmt.Errorf("%s output requires a row function", f.format)
+		}
+	}
+
+	if columns.SampleRows <= 0 {
+		columns.SampleRows = defaultSampleRows
+	}
+
+	return &StreamWriter{formatter: f, columns: columns}, nil
+}
+
+// Write outputs a record.
+func (w *StreamWriter) Write(record any) error {
+	var err error
+
+	switch w.formatter.format {
+	case FormatNDJSON:
+		if w.json == nil {
+			w.json = json.NewEncoder(w.formatter.writer)
+		}
+
+		err = w.json.Encode(record)
+	case FormatJSON:
+		err = w.writeJSONElement(record)
+	case FormatCSV:
+		err = w.writeCSV(w.columns.Row(record))
+	default:
+		w.writeTableRow(w.columns.Row(record))
+	}
+
+	if err != nil {
+		return err
+	}
+
+	w.count++
+
+	return nil
+}
+
+// Close completes the output: it closes the JSON array, flushes CSV, and
+// prints a table whose rows all fit in the width sample.
+func (w *StreamWriter) Close() error {
+	f := w.formatter
+
+	switch f.format {
+	case FormatJSON:
+		if !w.started {
+			_, err := fmt.Fprintln(f.writer, "[]")
+			return err
+		}
+
+		_, err := fmt.Fprintln(f.writer, "\n]")
+
+		return err
+	case FormatCSV:
+		if !w.started {
+			if err := w.writeCSV(nil); err != nil {
+				return err
+			}
+		}
+
+		w.csv.Flush()
+
+		return w.csv.Error()
+	case FormatTable:
+		w.flushSample()
+	}
+
+	return nil
+}
+
+// Count returns the number of records written.
+func (w *StreamWriter) Count() int {
+	return w.count
+}
+
+// writeJSONElement writes a record as the next element of a JSON array
+// indented like FormatOutput.
+func (w *StreamWriter) writeJSONElement(record any) error {
+	data, err := json.MarshalIndent(record, "  ", "  ")
+	if err != nil {
+		return fmt.Errorf("failed to encode record as JSON: %w", err)
+	}
+
+	separator := ",\n  "
+	if !w.started {
+		separator = "[\n  "
+		w.started = true
+	}
+
+	_, err = fmt.Fprintf(w.formatter.writer, "%s%s", separator, data)
+
+	return err
+}
+
+// writeCSV writes the header on first use, then cells if not nil.
+func (w *StreamWriter) writeCSV(cells []string) error {
+	if !w.started {
+		w.csv = csv.NewWriter(w.formatter.writer)
+		w.started = true
+
+		if !w.columns.NoHeader {
+			if err := w.csv.Write(w.columns.Headers); err != nil {
+				return fmt.Errorf("failed to write CSV header: %w", err)
+			}
+		}
+	}
+
+	if cells == nil {
+		return nil
+	}
+
+	if err := w.csv.Write(cells); err != nil {
+		return fmt.Errorf("failed to write CSV record: %w", err)
+	}
+
+	// Rows go out as they are produced rather than when the buffer fills
+	w.csv.Flush()
+
+	return w.csv.Error()
+}
+
+// writeTableRow buffers the row while sampling column widths and prints it
+// directly once they are fixed.
+func (w *StreamWriter) writeTableRow(cells []string) {
+	if w.widths != nil {
+		w.formatter.printRow(truncateCells(cells, w.widths), w.widths)
+		return
+	}
+
+	w.sample = append(w.sample, cells)
+	if len(w.sample) >= w.columns.SampleRows {
+		w.flushSample()
+	}
+}
+
+// flushSample fixes the column widths from the sampled rows and prints the
+// header and the sampled rows.
+func (w *StreamWriter) flushSample() {
+	if w.widths != nil {
+		return
+	}
+
+	headers := w.columns.Headers
+
+	w.widths = make([]int, len(headers))
+	for i, header := range headers {
+		if i < len(w.columns.Widths) && w.columns.Widths[i] > 0 {
+			w.widths[i] = w.columns.Widths[i]
+			continue
+		}
+
+		w.widths[i] = len(header)
+
+		for _, row := range w.sample {
+			if i < len(row) && len(row[i]) > w.widths[i] {
+				w.widths[i] = len(row[i])
+			}
+		}
+	}
+
+	if !w.columns.NoHeader {
+		w.formatter.printRow(headers, w.widths)
+		w.formatter.printSeparator(w.widths)
+	}
+
+	for _, row := range w.sample {
+		w.formatter.printRow(truncateCells(row, w.widths), w.widths)
+	}
+
+	w.sample = nil
+}
+
+// truncateCells shortens the cells that do not fit their column.
+func truncateCells(cells []string, widths []int) []string {
+	truncated := cells
+	copied := false
+
+	for i, cell := range cells {
+		if i >= len(widths) || len(cell) <= widths[i] {
+			continue
+		}
+
+		if !copied {
+			truncated = append([]string(nil), cells...)
+			copied = true
+		}
+
+		if widths[i] <= 3 {
+			truncated[i] = cell[:widths[i]]
+		} else {
+			truncated[i] = cell[:widths[i]-3] + "..."
+		}
+	}
+
+	return truncated
+}
+
+// FormatStream writes the records of the iterator as they are produced.
+func (f *OutputFormatter) FormatStream(records RecordIterator, columns StreamColumns) error {
+	w, err := f.NewStreamWriter(columns)
+	if err != nil {
+		return err
+	}
+
+	for records.Next() {
+		if err := w.Write(records.Record()); err != nil {
+			return err
+		}
+	}
+
+	if err := w.Close(); err != nil {
+		return err
+	}
+
+	return records.Err()
+}
+
+// SliceRecords returns an iterator over the items of a slice.
+func SliceRecords[T any](items []T) RecordIterator {
+	return &sliceIterator[T]{items: items, index: -1}
+}
+
+type sliceIterator[T any] struct {
+	items []T
+	index int
+}
+
+func (it *sliceIterator[T]) Next() bool {
+	it.index++
+	return it.index < len(it.items)
+}
+
+func (it *sliceIterator[T]) Record() any {
+	return it.items[it.index]
+}
+
+func (it *sliceIterator[T]) Err() error {
+	return nil
+}
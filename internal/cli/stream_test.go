@@ -0,0 +1,201 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package cli
+
+import (
+	"bytes"
+	"encoding/json"
+	"errors"
+	"strings"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+type streamRecord struct {
+	Name  string `json:"name"`
+	Stars int    `json:"stars"`
+}
+
+var streamColumns = StreamColumns{
+	Headers: []string{"NAME", "STARS"},
+	Row: func(record any) []string {
+		r := record.(streamRecord)
+		return []string{r.Name, strings.Repeat("*", r.Stars)}
+	},
+}
+
+// observingIterator records the output written before each record is pulled.
+type observingIterator struct {
+	RecordIterator
+	output   *bytes.Buffer
+	observed []string
+	err      error
+}
+
+func (it *observingIterator) Next() bool {
+	it.observed = append(it.observed, it.output.String())
+	return it.RecordIterator.Next()
+}
+
+func (it *observingIterator) Err() error {
+	return it.err
+}
+
+func TestOutputFormatter_FormatStream_NDJSON(t *testing.T) {
+	buffer := &bytes.Buffer{}
+	formatter := NewOutputFormatterWithWriter(FormatNDJSON, buffer)
+
+	records := &observingIterator{
+		RecordIterator: SliceRecords([]streamRecord{{"alpha", 1}, {"beta", 2}}),
+		output:         buffer,
+	}
+
+	require.NoError(t, formatter.FormatStream(records, StreamColumns{}))
+
+	assert.Equal(t, "{\"name\":\"alpha\",\"stars\":1}\n{\"name\":\"beta\",\"stars\":2}\n", buffer.String())
+	assert.Equal(t, "{\"name\":\"alpha\",\"stars\":1}\n", records.observed[1], "records are written as they are pulled")
+}
+
+func TestOutputFormatter_FormatStream_JSON(t *testing.T) {
+	for _, records := range [][]streamRecord{nil, {{"alpha", 1}, {"beta", 2}}} {
+		buffer := &bytes.Buffer{}
+		formatter := NewOutputFormatterWithWriter(FormatJSON, buffer)
+
+		require.NoError(t, formatter.FormatStream(SliceRecords(records), StreamColumns{}))
+
+		var decoded []streamRecord
+		require.NoError(t, json.Unmarshal(buffer.Bytes(), &decoded), buffer.String())
+		assert.Equal(t, len(records), len(decoded))
+
+		if len(records) > 0 {
+			assert.Equal(t, records, decoded)
+			assert.Contains(t, buffer.String(), "\n    \"name\": \"alpha\"")
+		}
+	}
+}
+
+func TestOutputFormatter_FormatStream_CSV(t *testing.T) {
+	buffer := &bytes.Buffer{}
+	formatter := NewOutputFormatterWithWriter(FormatCSV, buffer)
+
+	records := &observingIterator{
+		RecordIterator: SliceRecords([]streamRecord{{"alpha, inc", 1}, {"beta", 2}}),
+		output:         buffer,
+	}
+
+	require.NoError(t, formatter.FormatStream(records, streamColumns))
+
+	assert.Equal(t, "NAME,STARS\n\"alpha, inc\",*\nbeta,**\n", buffer.String())
+	assert.Equal(t, "NAME,STARS\n\"alpha, inc\",*\n", records.observed[1])
+
+	// An empty result still has its header
+	buffer.Reset()
+	require.NoError(t, formatter.FormatStream(SliceRecords([]streamRecord{}), streamColumns))
+	assert.Equal(t, "NAME,STARS\n", buffer.String())
+}
+
+func TestOutputFormatter_FormatStream_TableSampledWidths(t *testing.T) {
+	buffer := &bytes.Buffer{}
+	formatter := NewOutputFormatterWithWriter(FormatTable, buffer)
+
+	columns := streamColumns
+	columns.SampleRows = 2
+
+	records := &observingIterator{
+		RecordIterator: SliceRecords([]streamRecord{{"alpha", 1}, {"beta", 2}, {"a-much-longer-name", 9}}),
+		output:         buffer,
+	}
+
+	require.NoError(t, formatter.FormatStream(records, columns))
+
+	lines := strings.Split(strings.TrimSpace(buffer.String()), "\n")
+	require.Len(t, lines, 5)
+	assert.Equal(t, "NAME   STARS", lines[0])
+	assert.Equal(t, "-----  -----", lines[1])
+	assert.Equal(t, "alpha  *    ", lines[2])
+	assert.Equal(t, "beta   **   ", lines[3])
+	assert.Equal(t, "a-...  **...", lines[4], "rows after the sample are truncated to its widths")
+
+	assert.Empty(t, records.observed[1], "the sample is buffered")
+	assert.Len(t, strings.Split(strings.TrimSpace(records.observed[2]), "\n"), 4, "the sample is printed once full")
+}
+
+func TestOutputFormatter_FormatStream_TableFixedWidths(t *testing.T) {
+	buffer := &bytes.Buffer{}
+	formatter := NewOutputFormatterWithWriter(FormatTable, buffer)
+
+	columns := streamColumns
+	columns.Widths = []int{8}
+
+	require.NoError(t, formatter.FormatStream(SliceRecords([]streamRecord{{"a-much-longer-name", 3}}), columns))
+
+	lines := strings.Split(strings.TrimSpace(buffer.String()), "\n")
+	require.Len(t, lines, 3)
+	assert.Equal(t, "NAME      STARS", lines[0])
+	assert.Equal(t, "a-muc...  ***", lines[2])
+
+	buffer.Reset()
+	columns.NoHeader = true
+	require.NoError(t, formatter.FormatStream(SliceRecords([]streamRecord{{"alpha", 1}}), columns))
+	assert.Equal(t, "alpha     *    \n", buffer.String())
+}
+
+func TestOutputFormatter_FormatStream_Errors(t *testing.T) {
+	buffer := &bytes.Buffer{}
+
+	err := NewOutputFormatterWithWriter(FormatYAML, buffer).FormatStream(SliceRecords([]int{1}), streamColumns)
+	assert.EqualError(t, err, "unsupported streaming output format: yaml")
+
+	err = NewOutputFormatterWithWriter(FormatCSV, buffer).FormatStream(SliceRecords([]int{1}), StreamColumns{})
+	assert.EqualError(t, err, "csv output requires a row function")
+
+	failure := errors.New("page 3 failed")
+	records := &observingIterator{
+		RecordIterator: SliceRecords([]streamRecord{{"alpha", 1}}),
+		output:         buffer,
+		err:            failure,
+	}
+
+	err = NewOutputFormatterWithWriter(FormatNDJSON, buffer).FormatStream(records, StreamColumns{})
+	assert.ErrorIs(t, err, failure)
+	assert.Contains(t, buffer.String(), "alpha", "records before the failure are kept")
+}
+
+func TestStreamWriter_Count(t *testing.T) {
+	writer, err := NewOutputFormatterWithWriter(FormatTable, &bytes.Buffer{}).NewStreamWriter(streamColumns)
+	require.NoError(t, err)
+
+	for _, record := range []streamRecord{{"alpha", 1}, {"beta", 2}} {
+		require.NoError(t, writer.Write(record))
+	}
+
+	require.NoError(t, writer.Close())
+	assert.Equal(t, 2, writer.Count())
+}
+
+func TestOutputFormatter_FormatOutput_NDJSON(t *testing.T) {
+	buffer := &bytes.Buffer{}
+	formatter := NewOutputFormatterWithWriter(FormatNDJSON, buffer)
+
+	require.NoError(t, formatter.FormatOutput([]streamRecord{{"alpha", 1}, {"beta", 2}}))
+	assert.Equal(t, "{\"name\":\"alpha\",\"stars\":1}\n{\"name\":\"beta\",\"stars\":2}\n", buffer.String())
+
+	buffer.Reset()
+	require.NoError(t, formatter.FormatOutput(streamRecord{"alpha", 1}))
+	assert.Equal(t, "{\"name\":\"alpha\",\"stars\":1}\n", buffer.String())
+}
+
+func TestOutputFormatter_FormatTable_CSV(t *testing.T) {
+	buffer := &bytes.Buffer{}
+	formatter := NewOutputFormatterWithWriter(FormatCSV, buffer)
+
+	err := formatter.FormatTable(&TestTableData{
+		headers: []string{"Name", "Version"},
+		rows:    [][]string{{"app1", "1.0.0"}},
+	})
+	require.NoError(t, err)
+	assert.Equal(t, "Name,Version\napp1,1.0.0\n", buffer.String())
+}
@@ -78,14 +78,17 @@ const (
 	// MaxConnectionsPerHost is the maximum connections per host.
 	MaxConnectionsPerHost = 50
 
-	// GitHubMaxIdleConnectionsPerHost is optimized for GitHub API.
-	GitHubMaxIdleConnectionsPerHost = 20
+	// GitHubMaxIdleConnectionsPerHost is optimized for GitHub API. Every
+	// subsystem shares one transport per provider, so the idle limit matches
+	// the connection limit; a lower one closes connections after each burst
+	// and pays the TLS handshake again on the next.
+	GitHubMaxIdleConnectionsPerHost = MaxConnectionsPerHost
 
 	// GitLabMaxIdleConnectionsPerHost is optimized for GitLab API.
-	GitLabMaxIdleConnectionsPerHost = 15
+	GitLabMaxIdleConnectionsPerHost = MaxConnectionsPerHost
 
 	// GiteaMaxIdleConnectionsPerHost is optimized for Gitea API.
-	GiteaMaxIdleConnectionsPerHost = 10
+	GiteaMaxIdleConnectionsPerHost = 20
 
 	// DefaultMaxIdleConns is the default maximum idle connections.
 	DefaultMaxIdleConns = 100
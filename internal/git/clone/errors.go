@@ -19,6 +19,7 @@ var (
 	ErrInvalidVisibility       = errors.New("invalid visibility, must be 'all', 'public', or 'private'")
 	ErrInvalidMatchPattern     = errors.New("invalid match pattern")
 	ErrInvalidExcludePattern   = errors.New("invalid exclude pattern")
+	ErrInvalidFilter           = errors.New("invalid clone filter, must be 'blob:none', 'tree:0' or 'blob:limit=<n>'")
 	ErrSessionNotFound         = errors.New("session not found")
 	ErrSessionInvalid          = errors.New("session is invalid")
 	ErrCloneInProgress         = errors.New("clone operation already in progress")
@@ -9,9 +9,11 @@ import (
 	"os"
 	"os/exec"
 	"path/filepath"
-	"sync"
 	"time"
 
+	"github.com/gizzahub/gzh-cli/internal/git/objectcache"
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
+	"github.com/gizzahub/gzh-cli/internal/workerpool"
 	"github.com/gizzahub/gzh-cli/pkg/git/provider"
 )
 
@@ -21,6 +23,7 @@ type CloneExecutor struct {
 	options  *CloneOptions
 	session  *Session
 	progress *ProgressReporter
+	strategy *objectcache.Strategy
 }
 
 // NewCloneExecutor creates a new clone executor with the given provider and options.
@@ -37,11 +40,37 @@ func NewCloneExecutor(p provider.GitProvider, opts *CloneOptions) (*CloneExecuto
 		options:  opts,
 		session:  session,
 		progress: progress,
+		strategy: cloneStrategy(opts),
 	}, nil
 }
 
+// Session returns the session recording the progress of Execute.
+func (e *CloneExecutor) Session() *Session {
+	return e.session
+}
+
+// cloneStrategy returns the clone strategy for the options, falling back to
+// the process-wide default when neither a filter nor a cache is set.
+func cloneStrategy(opts *CloneOptions) *objectcache.Strategy {
+	if opts.Filter == "" && opts.ObjectCache == "" {
+		return objectcache.DefaultStrategy()
+	}
+
+	// Validate has already checked the filter
+	filter, _ := objectcache.ParseFilter(opts.Filter)
+	strategy := &objectcache.Strategy{Filter: filter}
+
+	if opts.ObjectCache != "" {
+		strategy.Cache = objectcache.NewCache(opts.ObjectCache)
+	}
+
+	return strategy
+}
+
 // Execute performs the clone operation based on the configured options.
 func (e *CloneExecutor) Execute(ctx context.Context) error {
+	ctx = phase.WithOperation(ctx, "repo_clone")
+
 	// 1. Initialize or restore session
 	if e.options.Resume != "" {
 		if err := e.session.Load(e.options.Resume); err != nil {
@@ -54,43 +83,64 @@ func (e *CloneExecutor) Execute(ctx context.Context) error {
 		}
 	}
 
-	// 2. List repositories from provider
-	repos, err := e.listRepositories(ctx)
-	if err != nil {
-		return fmt.Errorf("failed to list repositories: %w", err)
-	}
+	// 2. List repositories from provider; further pages are fetched as the
+	// clones consume them
+	repos := e.listRepositories(ctx)
+	defer func() { _ = repos.Close() }()
 
-	// 3. Apply filtering
-	filtered := e.filterRepositories(repos)
-	if len(filtered) == 0 {
-		e.progress.Info("No repositories match the specified filters")
-		return nil
+	// 3. Handle dry run
+	if e.options.DryRun {
+		return e.dryRun(repos)
 	}
 
-	// 4. Initialize progress tracking
-	e.progress.Start(len(filtered))
+	// 4. Clone repositories while the listing is still being paged in
+	e.progress.StartStreaming()
 	defer e.progress.Finish()
 
-	// 5. Handle dry run
-	if e.options.DryRun {
-		return e.printDryRun(filtered)
+	summary, err := e.cloneRepositories(ctx, repos)
+	if summary.Total == 0 && err == nil {
+		e.progress.Info("No repositories match the specified filters")
+		return nil
 	}
 
-	// 6. Execute clone operations
-	summary, err := e.cloneRepositories(ctx, filtered)
+	// 5. Print summary
+	e.printSummary(summary)
+
 	if err != nil {
 		e.progress.Error("Clone operation failed: %v", err)
-		return err
+		return fmt.Errorf("failed to list repositories: %w", err)
 	}
 
-	// 7. Print summary
-	e.printSummary(summary)
-
 	return nil
 }
 
-// listRepositories retrieves repositories from the provider.
-func (e *CloneExecutor) listRepositories(ctx context.Context) ([]provider.Repository, error) {
+// dryRun lists every matching repository without cloning.
+func (e *CloneExecutor) dryRun(repos provider.RepositoryIterator) error {
+	var filtered []RepositoryInfo
+
+	for repos.Next() {
+		if repo, ok := e.filterRepository(repos.Repository()); ok {
+			filtered = append(filtered, repo)
+		}
+	}
+
+	if err := repos.Err(); err != nil {
+		return fmt.Errorf("failed to list repositories: %w", WrapNetworkError("", "list_repositories", err))
+	}
+
+	if len(filtered) == 0 {
+		e.progress.Info("No repositories match the specified filters")
+		return nil
+	}
+
+	e.progress.Start(len(filtered))
+	defer e.progress.Finish()
+
+	return e.printDryRun(filtered)
+}
+
+// listRepositories returns an iterator over the provider's repositories.
+func (e *CloneExecutor) listRepositories(ctx context.Context) provider.RepositoryIterator {
 	// Convert visibility string to VisibilityType
 	var visibility provider.VisibilityType
 	switch e.options.Visibility {
@@ -117,42 +167,31 @@ func (e *CloneExecutor) listRepositories(ctx context.Context) ([]provider.Reposi
 		listOpts.Archived = &archived
 	}
 
-	repositoryList, err := e.provider.ListRepositories(ctx, listOpts)
-	if err != nil {
-		return nil, WrapNetworkError("", "list_repositories", err)
-	}
-
-	return repositoryList.Repositories, nil
+	return provider.IterateRepositories(ctx, e.provider, listOpts)
 }
 
-// filterRepositories applies filtering options to the repository list.
-func (e *CloneExecutor) filterRepositories(repos []provider.Repository) []RepositoryInfo {
-	var filtered []RepositoryInfo
-
-	for _, repo := range repos {
-		repoInfo := RepositoryInfo{
-			ID:            repo.ID,
-			Name:          repo.Name,
-			FullName:      repo.FullName,
-			CloneURL:      repo.CloneURL,
-			SSHURL:        repo.SSHURL,
-			Private:       repo.Private,
-			Archived:      repo.Archived,
-			Fork:          repo.Fork,
-			Language:      repo.Language,
-			Topics:        repo.Topics,
-			Stars:         repo.Stars,
-			Forks:         repo.Forks,
-			UpdatedAt:     repo.UpdatedAt,
-			DefaultBranch: repo.DefaultBranch,
-		}
-
-		if repoInfo.Matches(e.options) {
-			filtered = append(filtered, repoInfo)
-		}
-	}
-
-	return filtered
+// filterRepository converts a listed repository and reports whether it
+// matches the filtering options.
+func (e *CloneExecutor) filterRepository(repo provider.Repository) (RepositoryInfo, bool) {
+	repoInfo := RepositoryInfo{
+		ID:            repo.ID,
+		Name:          repo.Name,
+		FullName:      repo.FullName,
+		CloneURL:      repo.CloneURL,
+		SSHURL:        repo.SSHURL,
+		Private:       repo.Private,
+		Archived:      repo.Archived,
+		Fork:          repo.Fork,
+		Language:      repo.Language,
+		Topics:        repo.Topics,
+		Stars:         repo.Stars,
+		Forks:         repo.Forks,
+		Size:          repo.Size,
+		UpdatedAt:     repo.UpdatedAt,
+		DefaultBranch: repo.DefaultBranch,
+	}
+
+	return repoInfo, repoInfo.Matches(e.options)
 }
 
 // printDryRun prints what would be cloned without actually cloning.
@@ -166,85 +205,118 @@ func (e *CloneExecutor) printDryRun(repos []RepositoryInfo) error {
 	return nil
 }
 
-// cloneRepositories performs the actual cloning with parallel execution.
-func (e *CloneExecutor) cloneRepositories(ctx context.Context, repos []RepositoryInfo) (*CloneSummary, error) {
+// cloneRepositories clones the repositories in parallel as they are listed.
+// Each matching repository is queued as soon as the iterator yields it, so
+// the first clones run while later pages are still being fetched. It returns
+// the listing error, if any, after the queued clones have finished.
+func (e *CloneExecutor) cloneRepositories(ctx context.Context, repos provider.RepositoryIterator) (*CloneSummary, error) {
 	// Initialize summary
 	summary := &CloneSummary{
-		Total:     len(repos),
 		StartTime: time.Now(),
 	}
 
-	// Create worker pool
-	sem := make(chan struct{}, e.options.Parallel)
-	resultChan := make(chan CloneResult, len(repos))
-	var wg sync.WaitGroup
-
-	// Process repositories
-	for _, repo := range repos {
-		// Skip if already completed in this session
-		if e.session.IsCompleted(repo.FullName) {
-			summary.Skipped++
-			e.progress.Skip(repo.FullName, "already completed")
-			continue
+	// Session transitions are journaled; the snapshot is rewritten only on compaction and here at the end
+	defer func() {
+		if err := e.session.Close(); err != nil {
+			e.progress.Warning("Failed to save session: %v", err)
 		}
+	}()
+
+	tasks := make(chan workerpool.Task[RepositoryInfo])
+
+	var (
+		listed, skipped int
+		listErr         error
+	)
+
+	// Queue repositories not yet completed in this session
+	go func() {
+		defer close(tasks)
 
-		wg.Add(1)
-		go func(r RepositoryInfo) {
-			defer wg.Done()
-
-			// Acquire semaphore
-			sem <- struct{}{}
-			defer func() { <-sem }()
-
-			// Create clone request
-			request := &CloneRequest{
-				Repository: r,
-				TargetPath: filepath.Join(e.options.Target, r.FullName),
-				Options:    e.options,
-				SessionID:  e.session.ID,
-				StartedAt:  time.Now(),
+		for repos.Next() {
+			repo, ok := e.filterRepository(repos.Repository())
+			if !ok {
+				continue
 			}
 
-			// Execute clone with retries
-			result := e.cloneWithRetries(ctx, request)
-			resultChan <- result
+			listed++
+			e.progress.AddTotal(1)
 
-			// Update session
-			if result.Error != nil {
-				e.session.MarkFailed(r.FullName, result.Error)
-			} else {
-				e.session.MarkCompleted(r.FullName)
+			// Skip if already completed in this session
+			if e.session.IsCompleted(repo.FullName) {
+				skipped++
+				e.progress.Skip(repo.FullName, "already completed")
+				continue
 			}
 
-			// Save session progress
-			if err := e.session.Save(); err != nil {
-				e.progress.Warning("Failed to save session: %v", err)
+			e.recordSession(ctx, func() error { return e.session.AddRepository(repo.FullName) })
+
+			select {
+			case tasks <- workerpool.Task[RepositoryInfo]{Data: repo, Size: repo.Size, Resource: workerpool.ResourceGit}:
+			case <-ctx.Done():
+				return
 			}
-		}(repo)
-	}
+		}
 
-	// Wait for all workers to complete
-	go func() {
-		wg.Wait()
-		close(resultChan)
+		if err := repos.Err(); err != nil {
+			listErr = WrapNetworkError("", "list_repositories", err)
+		}
 	}()
 
-	// Collect results
-	for result := range resultChan {
+	cloneFn := func(ctx context.Context, r RepositoryInfo) error {
+		// Create clone request
+		request := &CloneRequest{
+			Repository: r,
+			TargetPath: filepath.Join(e.options.Target, r.FullName),
+			Options:    e.options,
+			SessionID:  e.session.ID,
+			StartedAt:  time.Now(),
+		}
+
+		e.recordSession(ctx, func() error { return e.session.MarkStarted(r.FullName) })
+
+		// Execute clone with retries
+		result := e.cloneWithRetries(ctx, request)
+
+		// Update session
+		e.recordSession(ctx, func() error {
+			if result.Error != nil {
+				return e.session.MarkFailed(r.FullName, result.Error)
+			}
+
+			return e.session.MarkCompleted(r.FullName)
+		})
+
+		return result.Error
+	}
+
+	// Collect results; clones start in listing order as workers free up
+	for result := range workerpool.ScheduleStream(ctx, workerpool.SchedulerConfig{Workers: e.options.Parallel}, tasks, cloneFn) {
 		if result.Error != nil {
 			summary.Failed++
 			summary.Errors = append(summary.Errors, result.Error)
-			e.progress.Fail(result.Repository.FullName, result.Error)
+			e.progress.Fail(result.Data.FullName, result.Error)
 		} else {
 			summary.Succeeded++
-			e.progress.Success(result.Repository.FullName)
+			e.progress.Success(result.Data.FullName)
 		}
 	}
 
+	// The listing goroutine has finished once the results are drained
+	summary.Total = listed
+	summary.Skipped = skipped
 	summary.EndTime = time.Now()
 	summary.Duration = summary.EndTime.Sub(summary.StartTime)
 
-	return summary, nil
+	return summary, listErr
+}
+
+// recordSession applies a session update as a state_save phase, warning
+// instead of failing the clone when it cannot be recorded.
+func (e *CloneExecutor) recordSession(ctx context.Context, update func() error) {
+	if err := phase.Track(ctx, phase.StateSave, update); err != nil {
+		e.progress.Warning("Failed to record session progress: %v", err)
+	}
 }
 
 // cloneWithRetries performs clone operation with retry logic.
@@ -336,11 +408,19 @@ func (e *CloneExecutor) cloneNewRepository(ctx context.Context, targetPath strin
 		args = append(args, "--branch", e.options.Branch)
 	}
 
+	if e.options.Depth > 0 {
+		args = append(args, e.strategy.FilterArgs()...)
+	} else {
+		args = append(args, e.strategy.CloneArgs(ctx, cloneURL)...)
+	}
 	args = append(args, cloneURL, targetPath)
 
 	// Execute git clone
+	span := phase.Start(ctx, phase.Clone)
 	cmd := exec.CommandContext(ctx, "git", args...)
 	output, err := cmd.CombinedOutput()
+	span.End(err)
+
 	if err != nil {
 		// Clean up partially cloned directory
 		os.RemoveAll(targetPath)
@@ -371,32 +451,15 @@ func (e *CloneExecutor) handleExistingRepository(ctx context.Context, targetPath
 	}
 }
 
-// resetAndPull performs git reset --hard and git pull.
+// resetAndPull performs git reset --hard and git pull. The commands run in
+// targetPath rather than changing the process working directory, which
+// parallel workers share.
 func (e *CloneExecutor) resetAndPull(ctx context.Context, targetPath string, repo RepositoryInfo) error {
-	// Change to repository directory
-	originalDir, err := os.Getwd()
-	if err != nil {
-		return NewCloneError(repo.FullName, "getwd", "failed to get working directory", err)
-	}
-	defer os.Chdir(originalDir)
-
-	if err := os.Chdir(targetPath); err != nil {
-		return NewCloneError(repo.FullName, "chdir", "failed to change to repository directory", err)
-	}
-
-	// Git reset --hard
-	cmd := exec.CommandContext(ctx, "git", "reset", "--hard")
-	if output, err := cmd.CombinedOutput(); err != nil {
-		return WrapGitError(repo.FullName, "reset", err, output)
-	}
-
-	// Git pull
-	cmd = exec.CommandContext(ctx, "git", "pull")
-	if output, err := cmd.CombinedOutput(); err != nil {
-		return WrapGitError(repo.FullName, "pull", err, output)
+	if err := e.runGitCommand(ctx, targetPath, repo, "reset", []string{"reset", "--hard"}); err != nil {
+		return err
 	}
 
-	return nil
+	return e.runGitCommand(ctx, targetPath, repo, "pull", []string{"pull"})
 }
 
 // pull performs git pull.
@@ -409,12 +472,16 @@ func (e *CloneExecutor) fetch(ctx context.Context, targetPath string, repo Repos
 	return e.runGitCommand(ctx, targetPath, repo, "fetch", []string{"fetch"})
 }
 
-// runGitCommand runs a git command in the specified directory.
+// runGitCommand runs a git command in the specified directory, recording it
+// as the phase named by operation.
 func (e *CloneExecutor) runGitCommand(ctx context.Context, targetPath string, repo RepositoryInfo, operation string, args []string) error {
 	cmd := exec.CommandContext(ctx, "git", args...)
 	cmd.Dir = targetPath
 
+	span := phase.Start(ctx, phase.Name(operation))
 	output, err := cmd.CombinedOutput()
+	span.End(err)
+
 	if err != nil {
 		return WrapGitError(repo.FullName, operation, err, output)
 	}
@@ -7,6 +7,8 @@ import (
 	"regexp"
 	"slices"
 	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/git/objectcache"
 )
 
 // CloneOptions represents options for repository cloning operations.
@@ -55,6 +57,8 @@ type CloneOptions struct {
 	Depth        int    `json:"depth"`
 	SingleBranch bool   `json:"single_branch"`
 	Branch       string `json:"branch,omitempty"`
+	Filter       string `json:"filter,omitempty"`       // partial clone filter (blob:none, tree:0)
+	ObjectCache  string `json:"object_cache,omitempty"` // shared object cache root
 
 	// Compiled patterns (internal use)
 	matchPattern   *regexp.Regexp `json:"-"`
@@ -157,6 +161,11 @@ func (opts *CloneOptions) Validate() error {
 		return ErrInvalidVisibility
 	}
 
+	// Validate partial clone filter
+	if _, err := objectcache.ParseFilter(opts.Filter); err != nil {
+		return ErrInvalidFilter
+	}
+
 	// Compile regex patterns
 	if opts.Match != "" {
 		pattern, err := regexp.Compile(opts.Match)
@@ -259,6 +268,7 @@ type RepositoryInfo struct {
 	Topics        []string  `json:"topics,omitempty"`
 	Stars         int       `json:"stars"`
 	Forks         int       `json:"forks"`
+	Size          int64     `json:"size,omitempty"`
 	UpdatedAt     time.Time `json:"updated_at"`
 	DefaultBranch string    `json:"default_branch"`
 }
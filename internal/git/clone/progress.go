@@ -7,11 +7,14 @@ import (
 	"encoding/json"
 	"fmt"
 	"os"
+	"sync"
 	"time"
 )
 
 // ProgressReporter handles progress reporting for clone operations.
+// Counters may be updated from the listing and the clone workers concurrently.
 type ProgressReporter struct {
+	mu        sync.Mutex
 	format    OutputFormat
 	quiet     bool
 	verbose   bool
@@ -34,11 +37,7 @@ func NewProgressReporter(format string, quiet, verbose bool) *ProgressReporter {
 
 // Start initializes the progress tracking.
 func (p *ProgressReporter) Start(total int) {
-	p.total = total
-	p.completed = 0
-	p.failed = 0
-	p.skipped = 0
-	p.startTime = time.Now()
+	p.reset(total)
 
 	if !p.quiet {
 		switch p.format {
@@ -53,8 +52,46 @@ func (p *ProgressReporter) Start(total int) {
 	}
 }
 
+// StartStreaming starts progress reporting before the number of repositories
+// is known; AddTotal raises the total as repositories are listed.
+func (p *ProgressReporter) StartStreaming() {
+	p.reset(0)
+
+	if !p.quiet {
+		switch p.format {
+		case FormatProgress:
+			p.Info("Starting clone operation; repositories are cloned as they are listed...")
+		case FormatJSON:
+			p.printJSONEvent("start", map[string]any{
+				"started_at": p.startTime.Format(time.RFC3339),
+			})
+		}
+	}
+}
+
+// AddTotal adds n repositories to the total.
+func (p *ProgressReporter) AddTotal(n int) {
+	p.mu.Lock()
+	p.total += n
+	p.mu.Unlock()
+}
+
+func (p *ProgressReporter) reset(total int) {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
+	p.total = total
+	p.completed = 0
+	p.failed = 0
+	p.skipped = 0
+	p.startTime = time.Now()
+}
+
 // Success reports a successful clone operation.
 func (p *ProgressReporter) Success(repoName string) {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
 	p.completed++
 
 	if !p.quiet {
@@ -75,6 +112,9 @@ func (p *ProgressReporter) Success(repoName string) {
 
 // Fail reports a failed clone operation.
 func (p *ProgressReporter) Fail(repoName string, err error) {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
 	p.failed++
 
 	if !p.quiet {
@@ -104,6 +144,9 @@ func (p *ProgressReporter) Fail(repoName string, err error) {
 
 // Skip reports a skipped repository.
 func (p *ProgressReporter) Skip(repoName, reason string) {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
 	p.skipped++
 
 	if !p.quiet && p.verbose {
@@ -125,6 +168,9 @@ func (p *ProgressReporter) Skip(repoName, reason string) {
 
 // Retry reports a retry attempt.
 func (p *ProgressReporter) Retry(repoName string, attempt int, err error) {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
 	if !p.quiet && p.verbose {
 		switch p.format {
 		case FormatProgress:
@@ -287,6 +333,9 @@ type ProgressStats struct {
 
 // GetStats returns current progress statistics.
 func (p *ProgressReporter) GetStats() ProgressStats {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
 	var progress float64
 	if p.total > 0 {
 		progress = float64(p.completed+p.failed+p.skipped) / float64(p.total) * 100
@@ -7,13 +7,25 @@ import (
 	"crypto/rand"
 	"encoding/hex"
 	"encoding/json"
+	"errors"
 	"fmt"
 	"os"
 	"path/filepath"
+	"sync"
 	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/journal"
 )
 
+// sessionCompactEvery is the number of journal records after which the
+// session snapshot is rewritten and the journal truncated.
+const sessionCompactEvery = 500
+
 // Session represents a clone operation session for resumability.
+//
+// Its state lives in two files: a JSON snapshot (<id>.json) and an append-only
+// journal (<id>.journal) holding one record per repository state transition
+// since the snapshot was written. Load replays the journal over the snapshot.
 type Session struct {
 	ID           string                       `json:"id"`
 	StartedAt    time.Time                    `json:"started_at"`
@@ -21,6 +33,19 @@ type Session struct {
 	Options      *CloneOptions                `json:"options"`
 	Repositories map[string]*RepositoryStatus `json:"repositories"`
 	Statistics   *SessionStatistics           `json:"statistics"`
+
+	mu      sync.Mutex
+	journal *journal.Writer
+}
+
+// sessionRecord is one journaled state transition. Records carry absolute
+// values so that replaying a record already contained in the snapshot is harmless.
+type sessionRecord struct {
+	Op       string    `json:"op"` // add, start, complete, fail
+	Repo     string    `json:"repo"`
+	Error    string    `json:"error,omitempty"`
+	Attempts int       `json:"attempts,omitempty"`
+	At       time.Time `json:"at"`
 }
 
 // RepositoryStatus represents the status of a repository in a session.
@@ -73,8 +98,11 @@ func (s *Session) Initialize() error {
 	return s.Save()
 }
 
-// Load loads a session from disk.
+// Load loads a session from disk by reading its snapshot and replaying its journal.
 func (s *Session) Load(sessionID string) error {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
 	sessionFile := getSessionFile(sessionID)
 	data, err := os.ReadFile(sessionFile)
 	if err != nil {
@@ -85,70 +113,173 @@ func (s *Session) Load(sessionID string) error {
 		return fmt.Errorf("failed to unmarshal session data: %w", err)
 	}
 
+	_, err = journal.Replay(getSessionJournalFile(sessionID), func(raw json.RawMessage) error {
+		var record sessionRecord
+		if err := json.Unmarshal(raw, &record); err != nil {
+			return fmt.Errorf("failed to unmarshal session journal record: %w", err)
+		}
+
+		s.apply(record)
+
+		return nil
+	})
+	if err != nil {
+		return fmt.Errorf("failed to replay session journal: %w", err)
+	}
+
+	s.updateStatistics()
+
 	return nil
 }
 
-// Save saves the session to disk.
+// Save writes a full snapshot of the session and truncates its journal.
 func (s *Session) Save() error {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	return s.compactLocked()
+}
+
+// Close writes a final snapshot and releases the journal file.
+func (s *Session) Close() error {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	err := s.compactLocked()
+
+	if s.journal != nil {
+		err = errors.Join(err, s.journal.Close())
+		s.journal = nil
+	}
+
+	return err
+}
+
+// compactLocked writes the snapshot and then empties the journal. Caller must hold s.mu.
+func (s *Session) compactLocked() error {
 	s.UpdatedAt = time.Now()
 	s.updateStatistics()
 
-	data, err := json.MarshalIndent(s, "", "  ")
-	if err != nil {
-		return fmt.Errorf("failed to marshal session data: %w", err)
+	if err := journal.WriteSnapshot(getSessionFile(s.ID), s, 0o644); err != nil {
+		return fmt.Errorf("failed to write session file: %w", err)
 	}
 
-	sessionFile := getSessionFile(s.ID)
-	if err := os.WriteFile(sessionFile, data, 0o644); err != nil {
-		return fmt.Errorf("failed to write session file: %w", err)
+	if s.journal != nil {
+		if err := s.journal.Truncate(); err != nil {
+			return fmt.Errorf("failed to truncate session journal: %w", err)
+		}
+	}
+
+	return nil
+}
+
+// record applies a state transition and appends it to the journal, opening
+// the journal on first use and compacting it once it grows large.
+func (s *Session) record(record sessionRecord) error {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	return s.recordLocked(record)
+}
+
+// recordLocked is record for callers that already hold s.mu.
+func (s *Session) recordLocked(record sessionRecord) error {
+	record.At = time.Now()
+
+	s.apply(record)
+
+	if s.journal == nil {
+		w, err := journal.Open(getSessionJournalFile(s.ID), journal.Options{})
+		if err != nil {
+			return err
+		}
+
+		s.journal = w
+	}
+
+	if err := s.journal.Append(record); err != nil {
+		return err
+	}
+
+	if s.journal.Records() >= sessionCompactEvery {
+		return s.compactLocked()
 	}
 
 	return nil
 }
 
-// AddRepository adds a repository to the session.
-func (s *Session) AddRepository(repoName string) {
+// apply updates the in-memory state for a journal record. Caller must hold s.mu.
+func (s *Session) apply(record sessionRecord) {
 	if s.Repositories == nil {
 		s.Repositories = make(map[string]*RepositoryStatus)
 	}
 
-	s.Repositories[repoName] = &RepositoryStatus{
-		Status:    "pending",
-		StartedAt: time.Time{},
-		Attempts:  0,
+	status, exists := s.Repositories[record.Repo]
+	if record.Op == "add" {
+		if !exists {
+			s.Repositories[record.Repo] = &RepositoryStatus{Status: "pending"}
+		}
+
+		return
+	}
+
+	if !exists {
+		return
 	}
+
+	switch record.Op {
+	case "start":
+		status.Status = "cloning"
+		status.StartedAt = record.At
+		status.Attempts = record.Attempts
+		status.LastAttempt = record.At
+	case "complete":
+		status.Status = "completed"
+		status.CompletedAt = record.At
+		status.Error = ""
+	case "fail":
+		status.Status = "failed"
+		status.Error = record.Error
+		status.CompletedAt = record.At
+	}
+}
+
+// AddRepository adds a repository to the session as pending. Repositories
+// already tracked by the session keep their status.
+func (s *Session) AddRepository(repoName string) error {
+	return s.record(sessionRecord{Op: "add", Repo: repoName})
 }
 
 // MarkStarted marks a repository as started.
-func (s *Session) MarkStarted(repoName string) {
+func (s *Session) MarkStarted(repoName string) error {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	// Read and journal the attempt count under one lock so concurrent starts
+	// of the same repository cannot both record the same attempt
+	attempts := 1
 	if status, exists := s.Repositories[repoName]; exists {
-		status.Status = "cloning"
-		status.StartedAt = time.Now()
-		status.Attempts++
-		status.LastAttempt = time.Now()
+		attempts = status.Attempts + 1
 	}
+
+	return s.recordLocked(sessionRecord{Op: "start", Repo: repoName, Attempts: attempts})
 }
 
 // MarkCompleted marks a repository as completed.
-func (s *Session) MarkCompleted(repoName string) {
-	if status, exists := s.Repositories[repoName]; exists {
-		status.Status = "completed"
-		status.CompletedAt = time.Now()
-		status.Error = ""
-	}
+func (s *Session) MarkCompleted(repoName string) error {
+	return s.record(sessionRecord{Op: "complete", Repo: repoName})
 }
 
 // MarkFailed marks a repository as failed.
-func (s *Session) MarkFailed(repoName string, err error) {
-	if status, exists := s.Repositories[repoName]; exists {
-		status.Status = "failed"
-		status.Error = err.Error()
-		status.CompletedAt = time.Now()
-	}
+func (s *Session) MarkFailed(repoName string, err error) error {
+	return s.record(sessionRecord{Op: "fail", Repo: repoName, Error: err.Error()})
 }
 
 // IsCompleted checks if a repository is completed.
 func (s *Session) IsCompleted(repoName string) bool {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
 	if status, exists := s.Repositories[repoName]; exists {
 		return status.Status == "completed"
 	}
@@ -157,6 +288,9 @@ func (s *Session) IsCompleted(repoName string) bool {
 
 // IsFailed checks if a repository is failed.
 func (s *Session) IsFailed(repoName string) bool {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
 	if status, exists := s.Repositories[repoName]; exists {
 		return status.Status == "failed"
 	}
@@ -165,6 +299,9 @@ func (s *Session) IsFailed(repoName string) bool {
 
 // GetStatus returns the status of a repository.
 func (s *Session) GetStatus(repoName string) *RepositoryStatus {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
 	if status, exists := s.Repositories[repoName]; exists {
 		return status
 	}
@@ -173,6 +310,9 @@ func (s *Session) GetStatus(repoName string) *RepositoryStatus {
 
 // GetCompletedRepositories returns a list of completed repositories.
 func (s *Session) GetCompletedRepositories() []string {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
 	var completed []string
 	for repoName, status := range s.Repositories {
 		if status.Status == "completed" {
@@ -184,6 +324,9 @@ func (s *Session) GetCompletedRepositories() []string {
 
 // GetFailedRepositories returns a list of failed repositories.
 func (s *Session) GetFailedRepositories() []string {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
 	var failed []string
 	for repoName, status := range s.Repositories {
 		if status.Status == "failed" {
@@ -195,6 +338,9 @@ func (s *Session) GetFailedRepositories() []string {
 
 // GetPendingRepositories returns a list of pending repositories.
 func (s *Session) GetPendingRepositories() []string {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
 	var pending []string
 	for repoName, status := range s.Repositories {
 		if status.Status == "pending" {
@@ -206,6 +352,9 @@ func (s *Session) GetPendingRepositories() []string {
 
 // GetProgress returns the current progress as a percentage.
 func (s *Session) GetProgress() float64 {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
 	if s.Statistics.TotalRepositories == 0 {
 		return 0.0
 	}
@@ -235,8 +384,20 @@ func (s *Session) updateStatistics() {
 	}
 }
 
-// Delete removes the session file from disk.
+// Delete removes the session snapshot and journal from disk.
 func (s *Session) Delete() error {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	if s.journal != nil {
+		_ = s.journal.Close()
+		s.journal = nil
+	}
+
+	if err := os.Remove(getSessionJournalFile(s.ID)); err != nil && !os.IsNotExist(err) {
+		return err
+	}
+
 	sessionFile := getSessionFile(s.ID)
 	return os.Remove(sessionFile)
 }
@@ -248,6 +409,9 @@ func (s *Session) GetDuration() time.Duration {
 
 // IsActive checks if the session is active (has pending or in-progress repositories).
 func (s *Session) IsActive() bool {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
 	s.updateStatistics()
 	return s.Statistics.PendingCount > 0 || s.Statistics.InProgressCount > 0
 }
@@ -262,7 +426,8 @@ func CleanupOldSessions(olderThan time.Duration) error {
 
 	cutoff := time.Now().Add(-olderThan)
 	for _, entry := range entries {
-		if !entry.IsDir() && filepath.Ext(entry.Name()) == ".json" {
+		ext := filepath.Ext(entry.Name())
+		if !entry.IsDir() && (ext == ".json" || ext == ".journal") {
 			info, err := entry.Info()
 			if err != nil {
 				continue
@@ -324,6 +489,11 @@ func getSessionFile(sessionID string) string {
 	return filepath.Join(getSessionDir(), sessionID+".json")
 }
 
+// getSessionJournalFile returns the journal file path for a given session ID.
+func getSessionJournalFile(sessionID string) string {
+	return filepath.Join(getSessionDir(), sessionID+".journal")
+}
+
 // SessionExists checks if a session file exists.
 func SessionExists(sessionID string) bool {
 	sessionFile := getSessionFile(sessionID)
@@ -333,15 +503,9 @@ func SessionExists(sessionID string) bool {
 
 // LoadSessionInfo loads basic session information without full session data.
 func LoadSessionInfo(sessionID string) (*SessionInfo, error) {
-	sessionFile := getSessionFile(sessionID)
-	data, err := os.ReadFile(sessionFile)
-	if err != nil {
-		return nil, fmt.Errorf("failed to read session file: %w", err)
-	}
-
 	var session Session
-	if err := json.Unmarshal(data, &session); err != nil {
-		return nil, fmt.Errorf("failed to unmarshal session data: %w", err)
+	if err := session.Load(sessionID); err != nil {
+		return nil, err
 	}
 
 	session.updateStatistics()
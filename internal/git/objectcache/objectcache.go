@@ -0,0 +1,374 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+// Package objectcache provides the clone strategy shared by the bulk clone
+// engines: optional partial clone filters and a shared bare object cache that
+// new clones borrow objects from through git alternates.
+//
+// The cache keeps one bare repository per host. Before a repository is
+// cloned, its branches are fetched into the host's cache repository under
+// refs/gzh/<path>/heads/*, so forks and templates of repositories already in
+// the cache only transfer the objects they do not share. The clone then uses
+// --reference-if-able, reading existing objects from the cache instead of the
+// network.
+//
+// Clones made with the cache depend on it: removing the cache root breaks
+// them. The cache therefore never prunes objects; its maintenance pass only
+// repacks and writes commit-graphs.
+package objectcache
+
+import (
+	"context"
+	"fmt"
+	"net/url"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"regexp"
+	"strings"
+	"sync"
+	"time"
+)
+
+// Filter is a partial clone filter spec passed to git clone --filter.
+type Filter string
+
+// Supported partial clone filters.
+const (
+	// FilterNone performs a full clone.
+	FilterNone Filter = ""
+	// FilterBlobless omits blobs until they are checked out (--filter=blob:none).
+	FilterBlobless Filter = "blob:none"
+	// FilterTreeless omits trees and blobs until needed (--filter=tree:0).
+	FilterTreeless Filter = "tree:0"
+)
+
+// Environment variables configuring the default strategy.
+const (
+	// EnvCloneFilter selects the partial clone filter ("blob:none", "tree:0").
+	EnvCloneFilter = "GZH_CLONE_FILTER"
+	// EnvObjectCache sets the shared object cache root. Unset or empty disables it.
+	EnvObjectCache = "GZH_OBJECT_CACHE"
+)
+
+// maintenanceInterval is how often the background maintenance pass runs.
+const maintenanceInterval = 24 * time.Hour
+
+var filterPattern = regexp.MustCompile(`^(blob:none|tree:0|blob:limit=[0-9]+[kmg]?)$`)
+
+// ParseFilter validates a filter spec. Besides the named filters,
+// blob:limit=<n>[kmg] is accepted.
+func ParseFilter(spec string) (Filter, error) {
+	switch spec {
+	case "", "none":
+		return FilterNone, nil
+	case "blobless":
+		return FilterBlobless, nil
+	case "treeless":
+		return FilterTreeless, nil
+	}
+
+	if !filterPattern.MatchString(spec) {
+		return FilterNone, fmt.Errorf("unsupported clone filter: %s", spec)
+	}
+
+	return Filter(spec), nil
+}
+
+// Strategy decides the extra git clone arguments for bulk clones.
+type Strategy struct {
+	// Filter is the partial clone filter, FilterNone for full clones.
+	Filter Filter
+	// Cache is the shared object cache, nil to disable it.
+	Cache *Cache
+}
+
+var (
+	defaultStrategyMu sync.Mutex
+	defaultStrategy   *Strategy
+)
+
+// DefaultStrategy returns the process-wide strategy used by the bulk clone
+// engines, configured from GZH_CLONE_FILTER and GZH_OBJECT_CACHE. Invalid
+// values fall back to full clones without a cache.
+func DefaultStrategy() *Strategy {
+	defaultStrategyMu.Lock()
+	defer defaultStrategyMu.Unlock()
+
+	if defaultStrategy == nil {
+		strategy := &Strategy{}
+
+		if filter, err := ParseFilter(os.Getenv(EnvCloneFilter)); err == nil {
+			strategy.Filter = filter
+		}
+
+		if root := os.Getenv(EnvObjectCache); root != "" {
+			strategy.Cache = NewCache(root)
+		}
+
+		defaultStrategy = strategy
+	}
+
+	return defaultStrategy
+}
+
+// SetDefaultStrategy replaces the process-wide strategy.
+func SetDefaultStrategy(s *Strategy) {
+	defaultStrategyMu.Lock()
+	defaultStrategy = s
+	defaultStrategyMu.Unlock()
+}
+
+// CloneArgs returns the options to add to `git clone` for cloneURL. When the
+// cache is enabled the repository is first fetched into it; a failed cache
+// fetch is not an error, the clone then simply transfers everything itself.
+//
+// The cache holds complete histories, so it is skipped when a filter is set:
+// filling it would download everything the partial clone means to leave out.
+// Shallow clones should use FilterArgs for the same reason.
+func (s *Strategy) CloneArgs(ctx context.Context, cloneURL string) []string {
+	args := s.FilterArgs()
+
+	if s != nil && s.Cache != nil && s.Filter == FilterNone {
+		if ref, err := s.Cache.Prepare(ctx, cloneURL); err == nil {
+			args = append(args, "--reference-if-able="+ref)
+		}
+	}
+
+	return args
+}
+
+// FilterArgs returns the partial clone options without using the cache.
+func (s *Strategy) FilterArgs() []string {
+	if s == nil || s.Filter == FilterNone {
+		return nil
+	}
+
+	return []string{"--filter=" + string(s.Filter)}
+}
+
+// Cache is a shared bare object cache rooted at a directory.
+type Cache struct {
+	root string
+
+	mu          sync.Mutex
+	initialized map[string]*repoInit
+	maintenance sync.Once
+}
+
+// repoInit guards the one-time initialization of a host's cache repository.
+type repoInit struct {
+	once sync.Once
+	err  error
+}
+
+// NewCache creates a cache rooted at root. Nothing is created on disk until
+// the first repository is prepared.
+func NewCache(root string) *Cache {
+	return &Cache{
+		root:        root,
+		initialized: make(map[string]*repoInit),
+	}
+}
+
+// Root returns the cache root directory.
+func (c *Cache) Root() string {
+	return c.root
+}
+
+// Prepare fetches the branches of cloneURL into the cache and returns the
+// cache repository to clone with --reference-if-able.
+func (c *Cache) Prepare(ctx context.Context, cloneURL string) (string, error) {
+	host, repoPath, err := splitCloneURL(cloneURL)
+	if err != nil {
+		return "", err
+	}
+
+	cacheRepo, err := c.ensureRepo(ctx, host)
+	if err != nil {
+		return "", err
+	}
+
+	c.maintenance.Do(c.scheduleMaintenance)
+
+	refspec := fmt.Sprintf("+refs/heads/*:refs/gzh/%s/heads/*", repoPath)
+
+	// Auto gc is disabled so concurrent fetches never race a repack; the
+	// maintenance pass takes care of it.
+	cmd := exec.CommandContext(ctx, "git", "-C", cacheRepo, "-c", "gc.auto=0",
+		"fetch", "--quiet", "--no-tags", "--no-write-fetch-head", cloneURL, refspec)
+	if output, err := cmd.CombinedOutput(); err != nil {
+		return "", fmt.Errorf("failed to fetch %s into object cache: %w: %s", repoPath, err, strings.TrimSpace(string(output)))
+	}
+
+	return cacheRepo, nil
+}
+
+// ensureRepo creates the bare cache repository for host once per process.
+func (c *Cache) ensureRepo(ctx context.Context, host string) (string, error) {
+	cacheRepo := filepath.Join(c.root, host+".git")
+
+	c.mu.Lock()
+	state, ok := c.initialized[host]
+	if !ok {
+		state = &repoInit{}
+		c.initialized[host] = state
+	}
+	c.mu.Unlock()
+
+	state.once.Do(func() {
+		state.err = initCacheRepo(ctx, cacheRepo)
+	})
+
+	if state.err != nil {
+		// Allow a later clone to retry the initialization
+		c.mu.Lock()
+		if c.initialized[host] == state {
+			delete(c.initialized, host)
+		}
+		c.mu.Unlock()
+
+		return "", state.err
+	}
+
+	return cacheRepo, nil
+}
+
+func initCacheRepo(ctx context.Context, cacheRepo string) error {
+	if _, err := os.Stat(filepath.Join(cacheRepo, "HEAD")); err == nil {
+		return nil
+	}
+
+	if err := os.MkdirAll(filepath.Dir(cacheRepo), 0o755); err != nil {
+		return fmt.Errorf("failed to create object cache directory: %w", err)
+	}
+
+	commands := [][]string{
+		{"init", "--bare", "--quiet", cacheRepo},
+		// Clones borrow objects from the cache, so nothing may ever be pruned
+		{"-C", cacheRepo, "config", "gc.auto", "0"},
+		{"-C", cacheRepo, "config", "gc.pruneExpire", "never"},
+		{"-C", cacheRepo, "config", "maintenance.auto", "false"},
+	}
+
+	for _, args := range commands {
+		if output, err := exec.CommandContext(ctx, "git", args...).CombinedOutput(); err != nil {
+			return fmt.Errorf("failed to initialize object cache %s: %w: %s", cacheRepo, err, strings.TrimSpace(string(output)))
+		}
+	}
+
+	return nil
+}
+
+// maintenanceTasks are run one at a time, because git orders the tasks of a
+// single run itself and incremental-repack fails on a repository that has no
+// packs until loose-objects has created one. None of the tasks prune:
+// loose-objects only removes loose objects that are already packed, and
+// incremental-repack only expires packs whose objects have all been repacked.
+var maintenanceTasks = []string{"loose-objects", "incremental-repack", "commit-graph"}
+
+// maintenanceScript chains maintenanceTasks for a detached POSIX shell.
+const maintenanceScript = `git maintenance run --quiet --task=loose-objects &&
+git maintenance run --quiet --task=incremental-repack &&
+git maintenance run --quiet --task=commit-graph`
+
+// Maintain runs git maintenance on every cache repository.
+func (c *Cache) Maintain(ctx context.Context) error {
+	repos, err := filepath.Glob(filepath.Join(c.root, "*.git"))
+	if err != nil {
+		return err
+	}
+
+	for _, repo := range repos {
+		if err := maintainRepo(ctx, repo); err != nil {
+			return err
+		}
+	}
+
+	return nil
+}
+
+func maintainRepo(ctx context.Context, repo string) error {
+	for _, task := range maintenanceTasks {
+		cmd := exec.CommandContext(ctx, "git", "-C", repo, "maintenance", "run", "--quiet", "--task="+task)
+		if output, err := cmd.CombinedOutput(); err != nil {
+			return fmt.Errorf("git maintenance failed for %s: %w: %s", repo, err, strings.TrimSpace(string(output)))
+		}
+	}
+
+	return nil
+}
+
+// scheduleMaintenance starts a detached git maintenance process for each cache
+// repository when the last pass is older than maintenanceInterval. The
+// processes are not tied to this one, so a short CLI run does not cut them off.
+// Without a POSIX shell (Windows) the pass runs in the background of this
+// process instead and may be cut off, which only delays it.
+func (c *Cache) scheduleMaintenance() {
+	stamp := filepath.Join(c.root, ".last-maintenance")
+
+	if info, err := os.Stat(stamp); err == nil && time.Since(info.ModTime()) < maintenanceInterval {
+		return
+	}
+
+	if err := os.MkdirAll(c.root, 0o755); err != nil {
+		return
+	}
+
+	if err := os.WriteFile(stamp, []byte(time.Now().Format(time.RFC3339)+"\n"), 0o644); err != nil {
+		return
+	}
+
+	repos, err := filepath.Glob(filepath.Join(c.root, "*.git"))
+	if err != nil {
+		return
+	}
+
+	if _, err := exec.LookPath("sh"); err != nil {
+		go func() {
+			for _, repo := range repos {
+				_ = maintainRepo(context.Background(), repo)
+			}
+		}()
+
+		return
+	}
+
+	for _, repo := range repos {
+		cmd := exec.Command("sh", "-c", maintenanceScript) //nolint:noctx // Detached on purpose to outlive the command
+		cmd.Dir = repo
+
+		if err := cmd.Start(); err != nil {
+			continue
+		}
+
+		go func() { _ = cmd.Wait() }()
+	}
+}
+
+var scpLikeURL = regexp.MustCompile(`^(?:[^@/]+@)?([^:/]+):(.+)$`)
+
+// splitCloneURL returns the host and the repository path (without .git) of an
+// HTTPS, SSH, file or scp-like clone URL.
+func splitCloneURL(cloneURL string) (host, repoPath string, err error) {
+	if strings.Contains(cloneURL, "://") {
+		u, parseErr := url.Parse(cloneURL)
+		if parseErr != nil {
+			return "", "", fmt.Errorf("invalid clone URL: %w", parseErr)
+		}
+
+		host, repoPath = u.Hostname(), u.Path
+		if u.Scheme == "file" {
+			host = "local"
+		}
+	} else if m := scpLikeURL.FindStringSubmatch(cloneURL); m != nil {
+		host, repoPath = m[1], m[2]
+	}
+
+	repoPath = strings.TrimSuffix(strings.Trim(repoPath, "/"), ".git")
+	if host == "" || repoPath == "" || strings.Contains(repoPath, "..") {
+		return "", "", fmt.Errorf("invalid clone URL: %s", cloneURL)
+	}
+
+	return host, repoPath, nil
+}
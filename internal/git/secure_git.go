@@ -10,6 +10,8 @@ import (
 	"path/filepath"
 	"regexp"
 	"strings"
+
+	"github.com/gizzahub/gzh-cli/internal/git/objectcache"
 )
 
 // AllowedGitCommands defines the whitelist of safe git commands
@@ -45,6 +47,13 @@ var AllowedGitOptions = map[string]bool{
 	"--single-branch":  true,
 }
 
+// AllowedGitValueOptions defines safe --option=value options and the
+// validation applied to their values
+var AllowedGitValueOptions = map[string]func(string) bool{
+	"--filter":            isValidFilterSpec,
+	"--reference-if-able": isValidPathArg,
+}
+
 // SecureGitExecutor provides safe git command execution with input validation
 type SecureGitExecutor struct {
 	gitPath string
@@ -172,6 +181,11 @@ func (e *SecureGitExecutor) validateArgs(args []string) (validArgs, validOptions
 		if strings.HasPrefix(arg, "-") {
 			if AllowedGitOptions[arg] {
 				validOptions = append(validOptions, arg)
+			} else if name, value, ok := strings.Cut(arg, "="); ok && AllowedGitValueOptions[name] != nil {
+				if !AllowedGitValueOptions[name](value) {
+					return nil, nil, fmt.Errorf("value of git option '%s' contains invalid characters", name)
+				}
+				validOptions = append(validOptions, arg)
 			} else {
 				return nil, nil, fmt.Errorf("git option '%s' is not allowed", arg)
 			}
@@ -203,6 +217,13 @@ func isValidPathArg(arg string) bool {
 	return pathRegex.MatchString(arg) && !strings.Contains(arg, "..")
 }
 
+// isValidFilterSpec validates partial clone filter specs. Only git's own
+// syntax is accepted, not the aliases objectcache.ParseFilter also understands.
+func isValidFilterSpec(spec string) bool {
+	filter, err := objectcache.ParseFilter(spec)
+	return err == nil && filter != objectcache.FilterNone && string(filter) == spec
+}
+
 // GetGitVersion returns the git version for diagnostics
 func (e *SecureGitExecutor) GetGitVersion(ctx context.Context) (string, error) {
 	cmd := exec.CommandContext(ctx, e.gitPath, "--version")
@@ -11,6 +11,7 @@ import (
 	"path/filepath"
 	"strings"
 
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
 	"github.com/gizzahub/gzh-cli/pkg/git/provider"
 )
 
@@ -27,6 +28,10 @@ func (c *CodeSyncer) Sync(ctx context.Context) error {
 		return fmt.Errorf("destination repository is required for code sync")
 	}
 
+	if c.options.Mirror {
+		return c.syncMirror(ctx)
+	}
+
 	// Create temporary directory for git operations
 	tempDir, err := os.MkdirTemp("", "gzh-sync-*")
 	if err != nil {
@@ -35,7 +40,7 @@ func (c *CodeSyncer) Sync(ctx context.Context) error {
 	defer os.RemoveAll(tempDir)
 
 	// Clone source repository
-	if err := c.cloneSource(ctx, tempDir); err != nil {
+	if err := phase.Track(ctx, phase.Clone, func() error { return c.cloneSource(ctx, tempDir) }); err != nil {
 		return fmt.Errorf("failed to clone source: %w", err)
 	}
 
@@ -45,7 +50,7 @@ func (c *CodeSyncer) Sync(ctx context.Context) error {
 	}
 
 	// Push to destination
-	if err := c.pushToDestination(ctx, tempDir); err != nil {
+	if err := phase.Track(ctx, phase.Push, func() error { return c.pushToDestination(ctx, tempDir) }); err != nil {
 		return fmt.Errorf("failed to push to destination: %w", err)
 	}
 
@@ -8,6 +8,9 @@ import (
 	"fmt"
 	"path/filepath"
 
+	"golang.org/x/sync/semaphore"
+
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
 	"github.com/gizzahub/gzh-cli/pkg/git/provider"
 )
 
@@ -16,20 +19,50 @@ type SyncEngine struct {
 	source      provider.GitProvider
 	destination provider.GitProvider
 	options     SyncOptions
+
+	// componentSlots bounds the concurrent API components across repositories
+	componentSlots *semaphore.Weighted
+	tracker        *SyncTracker
 }
 
 // NewSyncEngine creates a new sync engine.
 func NewSyncEngine(src, dst provider.GitProvider, opts SyncOptions) *SyncEngine {
+	if opts.ComponentParallel < 1 {
+		opts.ComponentParallel = DefaultComponentParallel
+	}
+
 	return &SyncEngine{
-		source:      src,
-		destination: dst,
-		options:     opts,
+		source:         src,
+		destination:    dst,
+		options:        opts,
+		componentSlots: semaphore.NewWeighted(int64(opts.ComponentParallel)),
 	}
 }
 
+// Tracker returns the tracker of the last executed sync, or nil before one
+// has run.
+func (e *SyncEngine) Tracker() *SyncTracker {
+	return e.tracker
+}
+
 // Sync executes the synchronization process.
 func (e *SyncEngine) Sync(ctx context.Context) error {
-	// 1. Analyze source repositories
+	ctx = phase.WithOperation(ctx, "git_sync")
+
+	// 1. Analyze destination repositories while the source is being listed
+	type destAnalysis struct {
+		repos map[string]provider.Repository
+		err   error
+	}
+
+	destDone := make(chan destAnalysis, 1)
+
+	go func() {
+		repos, err := e.analyzeDestination(ctx)
+		destDone <- destAnalysis{repos: repos, err: err}
+	}()
+
+	// 2. Analyze source repositories
 	sourceRepos, err := e.analyzeSource(ctx)
 	if err != nil {
 		return fmt.Errorf("failed to analyze source: %w", err)
@@ -40,12 +73,13 @@ func (e *SyncEngine) Sync(ctx context.Context) error {
 		return nil
 	}
 
-	// 2. Analyze destination repositories
-	destRepos, err := e.analyzeDestination(ctx)
-	if err != nil {
-		return fmt.Errorf("failed to analyze destination: %w", err)
+	dest := <-destDone
+	if dest.err != nil {
+		return fmt.Errorf("failed to analyze destination: %w", dest.err)
 	}
 
+	destRepos := dest.repos
+
 	// 3. Create synchronization plan
 	plan := e.createSyncPlan(sourceRepos, destRepos)
 
@@ -55,7 +89,25 @@ func (e *SyncEngine) Sync(ctx context.Context) error {
 	}
 
 	// 5. Execute synchronization plan
-	return e.executeSyncPlan(ctx, plan)
+	e.tracker = NewSyncTracker(generateTrackerID(), e.options.From, e.options.To, e.options)
+	e.tracker.SetStatus(StatusInProgress)
+
+	err = e.executeSyncPlan(ctx, plan)
+
+	switch {
+	case ctx.Err() != nil:
+		e.tracker.SetStatus(StatusCancelled)
+	case err != nil:
+		e.tracker.SetStatus(StatusFailed)
+	default:
+		e.tracker.SetStatus(StatusCompleted)
+	}
+
+	if e.options.Verbose {
+		e.tracker.PrintComponentTimings()
+	}
+
+	return err
 }
 
 // analyzeSource analyzes the source to get repositories to sync.
@@ -82,13 +134,23 @@ func (e *SyncEngine) analyzeSource(ctx context.Context) ([]provider.Repository,
 		Direction:    "asc",
 	}
 
-	result, err := e.source.ListRepositories(ctx, listOpts)
-	if err != nil {
+	// Filter while paging so only matching repositories are kept
+	repos := provider.IterateRepositories(ctx, e.source, listOpts)
+	defer func() { _ = repos.Close() }()
+
+	var filtered []provider.Repository
+
+	for repos.Next() {
+		if repo := repos.Repository(); e.matchRepository(repo) {
+			filtered = append(filtered, repo)
+		}
+	}
+
+	if err := repos.Err(); err != nil {
 		return nil, fmt.Errorf("failed to list repositories: %w", err)
 	}
 
-	// Apply filtering
-	return e.filterRepositories(result.Repositories), nil
+	return filtered, nil
 }
 
 // analyzeDestination analyzes the destination to get existing repositories.
@@ -118,45 +180,39 @@ func (e *SyncEngine) analyzeDestination(ctx context.Context) (map[string]provide
 		Direction:    "asc",
 	}
 
-	result, err := e.destination.ListRepositories(ctx, listOpts)
-	if err != nil {
-		// If organization doesn't exist, that's fine
-		return destRepos, nil
-	}
+	repos := provider.IterateRepositories(ctx, e.destination, listOpts)
+	defer func() { _ = repos.Close() }()
 
 	// Index by repository name
-	for _, repo := range result.Repositories {
+	for repos.Next() {
+		repo := repos.Repository()
 		destRepos[repo.Name] = repo
 	}
 
+	// If organization doesn't exist, that's fine
 	return destRepos, nil
 }
 
-// filterRepositories applies filtering options to repositories.
-func (e *SyncEngine) filterRepositories(repos []provider.Repository) []provider.Repository {
-	var filtered []provider.Repository
-
-	for _, repo := range repos {
-		// Apply match pattern
-		if e.options.Match != "" {
-			matched, err := filepath.Match(e.options.Match, repo.Name)
-			if err != nil || !matched {
-				continue
-			}
+// matchRepository reports whether a repository passes the match and exclude
+// patterns.
+func (e *SyncEngine) matchRepository(repo provider.Repository) bool {
+	// Apply match pattern
+	if e.options.Match != "" {
+		matched, err := filepath.Match(e.options.Match, repo.Name)
+		if err != nil || !matched {
+			return false
 		}
+	}
 
-		// Apply exclude pattern
-		if e.options.Exclude != "" {
-			matched, err := filepath.Match(e.options.Exclude, repo.Name)
-			if err == nil && matched {
-				continue
-			}
+	// Apply exclude pattern
+	if e.options.Exclude != "" {
+		matched, err := filepath.Match(e.options.Exclude, repo.Name)
+		if err == nil && matched {
+			return false
 		}
-
-		filtered = append(filtered, repo)
 	}
 
-	return filtered
+	return true
 }
 
 // createSyncPlan creates a synchronization plan based on source and destination analysis.
@@ -210,9 +266,14 @@ func (e *SyncEngine) createSyncActions(source provider.Repository, destination *
 
 	// Code synchronization
 	if e.options.IncludeCode {
+		description := "Sync repository code and branches"
+		if e.options.Mirror {
+			description = "Push changed branches and tags from the persistent mirror"
+		}
+
 		actions = append(actions, SyncAction{
 			Type:        "code",
-			Description: "Sync repository code and branches",
+			Description: description,
 			Handler: func(ctx context.Context) error {
 				syncer := &CodeSyncer{
 					source:      source,
@@ -228,6 +289,7 @@ func (e *SyncEngine) createSyncActions(source provider.Repository, destination *
 	if e.options.IncludeIssues {
 		actions = append(actions, SyncAction{
 			Type:        "issues",
+			Concurrent:  true,
 			Description: "Sync issues and comments",
 			Handler: func(ctx context.Context) error {
 				if destination == nil {
@@ -247,6 +309,7 @@ func (e *SyncEngine) createSyncActions(source provider.Repository, destination *
 	if e.options.IncludeWiki {
 		actions = append(actions, SyncAction{
 			Type:        "wiki",
+			Concurrent:  true,
 			Description: "Sync wiki content",
 			Handler: func(ctx context.Context) error {
 				if destination == nil {
@@ -266,6 +329,7 @@ func (e *SyncEngine) createSyncActions(source provider.Repository, destination *
 	if e.options.IncludeReleases {
 		actions = append(actions, SyncAction{
 			Type:        "releases",
+			Concurrent:  true,
 			Description: "Sync releases and tags",
 			Handler: func(ctx context.Context) error {
 				if destination == nil {
@@ -360,4 +424,7 @@ type SyncAction struct {
 	Type        string // code, issues, wiki, etc.
 	Description string
 	Handler     func(context.Context) error
+	// Concurrent actions only use the provider APIs and run alongside the
+	// other concurrent actions of the repository once the ordered ones finish
+	Concurrent bool
 }
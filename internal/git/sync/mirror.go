@@ -0,0 +1,134 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package sync
+
+import (
+	"context"
+	"fmt"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"strings"
+
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
+)
+
+// mirrorRefspecs limits the mirrors and the pushes from them to branches and
+// tags. Provider-internal refs such as GitHub's refs/pull/* are read-only and
+// would be rejected by the destination.
+var mirrorRefspecs = []string{
+	"+refs/heads/*:refs/heads/*",
+	"+refs/tags/*:refs/tags/*",
+}
+
+// syncMirror updates the persistent bare mirror of the source repository and
+// pushes it to the destination. Unlike the temporary clone, the mirror
+// survives between runs, so both the fetch and the push only transfer refs
+// that changed since the previous sync.
+func (c *CodeSyncer) syncMirror(ctx context.Context) error {
+	mirrorDir, err := c.mirrorPath()
+	if err != nil {
+		return err
+	}
+
+	if err := phase.Track(ctx, phase.Fetch, func() error { return c.updateMirror(ctx, mirrorDir) }); err != nil {
+		return fmt.Errorf("failed to update mirror: %w", err)
+	}
+
+	// Push only branches and tags, pruning those deleted at the source. Unlike
+	// --mirror this leaves destination-only refs such as refs/pull/* alone,
+	// which providers refuse to delete.
+	args := append([]string{"push", "--prune", c.destination.CloneURL}, mirrorRefspecs...)
+	if c.options.Verbose {
+		fmt.Printf("Pushing mirror: git %s\n", joinArgs(args))
+	}
+
+	if err := phase.Track(ctx, phase.Push, func() error { return runGit(ctx, mirrorDir, args...) }); err != nil {
+		return fmt.Errorf("failed to push to destination: %w", err)
+	}
+
+	return nil
+}
+
+// mirrorPath returns the mirror location of the source repository:
+// <MirrorDir>/<source provider>/<owner>/<repo>.git.
+func (c *CodeSyncer) mirrorPath() (string, error) {
+	if c.options.MirrorDir == "" {
+		return "", fmt.Errorf("mirror directory is not configured")
+	}
+
+	sourceTarget, err := c.options.GetSourceTarget()
+	if err != nil {
+		return "", err
+	}
+
+	name := strings.Trim(c.source.FullName, "/")
+	if name == "" || strings.Contains(name, "..") {
+		return "", fmt.Errorf("invalid source repository name: %q", c.source.FullName)
+	}
+
+	return filepath.Join(c.options.MirrorDir, sourceTarget.Provider, filepath.FromSlash(name)+".git"), nil
+}
+
+// updateMirror creates the bare mirror on first use and fetches the source
+// refs into it, pruning refs deleted at the source.
+func (c *CodeSyncer) updateMirror(ctx context.Context, mirrorDir string) error {
+	if _, err := os.Stat(filepath.Join(mirrorDir, "HEAD")); os.IsNotExist(err) {
+		if err := initMirror(ctx, mirrorDir, c.source.CloneURL); err != nil {
+			_ = os.RemoveAll(mirrorDir)
+			return err
+		}
+	} else if err := runGit(ctx, mirrorDir, "remote", "set-url", "origin", c.source.CloneURL); err != nil {
+		// The source may have moved since the mirror was created
+		return err
+	}
+
+	args := []string{"fetch", "--prune", "--no-tags", "origin"}
+	if c.options.Verbose {
+		fmt.Printf("Fetching source: git %s\n", joinArgs(args))
+	}
+
+	return runGit(ctx, mirrorDir, args...)
+}
+
+// initMirror creates an empty bare repository fetching branches and tags from
+// cloneURL.
+func initMirror(ctx context.Context, mirrorDir, cloneURL string) error {
+	if err := os.MkdirAll(filepath.Dir(mirrorDir), 0o755); err != nil {
+		return fmt.Errorf("failed to create mirror directory: %w", err)
+	}
+
+	if err := runGit(ctx, "", "init", "--bare", mirrorDir); err != nil {
+		return err
+	}
+
+	if err := runGit(ctx, mirrorDir, "remote", "add", "origin", cloneURL); err != nil {
+		return err
+	}
+
+	for i, refspec := range mirrorRefspecs {
+		args := []string{"config", "--add", "remote.origin.fetch", refspec}
+		if i == 0 {
+			args = []string{"config", "--replace-all", "remote.origin.fetch", refspec}
+		}
+
+		if err := runGit(ctx, mirrorDir, args...); err != nil {
+			return err
+		}
+	}
+
+	return nil
+}
+
+// runGit runs a git command in dir and includes its output in the error.
+func runGit(ctx context.Context, dir string, args ...string) error {
+	cmd := exec.CommandContext(ctx, "git", args...)
+	cmd.Dir = dir
+
+	if output, err := cmd.CombinedOutput(); err != nil {
+		return fmt.Errorf("git %s failed: %w\nOutput: %s", args[0], err, output)
+	}
+
+	return nil
+}
@@ -0,0 +1,114 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+//nolint:testpackage // White-box testing needed for internal function access
+package sync
+
+import (
+	"context"
+	"errors"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"strings"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+
+	"github.com/gizzahub/gzh-cli/pkg/git/provider"
+)
+
+func git(t *testing.T, dir string, args ...string) string {
+	t.Helper()
+
+	cmd := exec.Command("git", append([]string{"-c", "user.name=test", "-c", "user.email=test@example.com"}, args...)...)
+	cmd.Dir = dir
+
+	output, err := cmd.CombinedOutput()
+	require.NoError(t, err, "git %v: %s", args, output)
+
+	return strings.TrimSpace(string(output))
+}
+
+func TestCodeSyncer_Mirror(t *testing.T) {
+	if _, err := exec.LookPath("git"); err != nil {
+		t.Skip("git not available")
+	}
+
+	root := t.TempDir()
+	src := filepath.Join(root, "src")
+	dst := filepath.Join(root, "dst.git")
+
+	require.NoError(t, os.MkdirAll(src, 0o755))
+	git(t, src, "init", "-b", "main")
+	git(t, src, "commit", "--allow-empty", "-m", "initial")
+	git(t, src, "branch", "feature")
+	git(t, src, "tag", "v1.0.0")
+	git(t, root, "init", "--bare", dst)
+
+	syncer := &CodeSyncer{
+		source:      provider.Repository{FullName: "org/repo", CloneURL: src},
+		destination: &provider.Repository{FullName: "org/repo", CloneURL: dst},
+		options:     SyncOptions{From: "local:org", Mirror: true, MirrorDir: filepath.Join(root, "mirrors")},
+	}
+
+	require.NoError(t, syncer.Sync(context.Background()))
+	assert.Equal(t, git(t, src, "rev-parse", "main"), git(t, dst, "rev-parse", "main"))
+	assert.Equal(t, "v1.0.0", git(t, dst, "tag", "--list"))
+	assert.DirExists(t, filepath.Join(root, "mirrors", "local", "org", "repo.git"))
+
+	// The second sync reuses the mirror and propagates updates and deletions,
+	// but leaves destination-only refs such as pull request heads alone
+	git(t, src, "commit", "--allow-empty", "-m", "second")
+	git(t, src, "branch", "-D", "feature")
+	git(t, dst, "update-ref", "refs/pull/1/head", "main")
+
+	require.NoError(t, syncer.Sync(context.Background()))
+	assert.Equal(t, git(t, src, "rev-parse", "main"), git(t, dst, "rev-parse", "main"))
+	assert.Equal(t, "main", git(t, dst, "for-each-ref", "--format=%(refname:short)", "refs/heads"))
+	assert.Equal(t, "refs/pull/1/head", git(t, dst, "for-each-ref", "--format=%(refname)", "refs/pull"))
+}
+
+func TestSyncEngine_RunConcurrentActions(t *testing.T) {
+	engine := NewSyncEngine(nil, nil, SyncOptions{ComponentParallel: 2})
+	engine.tracker = NewSyncTracker("test", "a", "b", engine.options)
+
+	var running, peak atomic.Int32
+
+	action := func(name string, err error) SyncAction {
+		return SyncAction{Type: name, Concurrent: true, Handler: func(context.Context) error {
+			n := running.Add(1)
+			defer running.Add(-1)
+
+			for {
+				p := peak.Load()
+				if n <= p || peak.CompareAndSwap(p, n) {
+					break
+				}
+			}
+
+			time.Sleep(20 * time.Millisecond)
+
+			return err
+		}}
+	}
+
+	err := engine.runConcurrentActions(context.Background(), "org/repo", []SyncAction{
+		action("issues", nil),
+		action("wiki", errors.New("wiki disabled")),
+		action("releases", nil),
+	})
+
+	require.Error(t, err)
+	assert.Contains(t, err.Error(), "action wiki failed")
+	assert.Equal(t, int32(2), peak.Load())
+
+	require.Len(t, engine.tracker.Components, 3)
+	assert.Equal(t, 1, engine.tracker.Components["wiki"].Failed)
+	assert.Equal(t, "org/repo", engine.tracker.Components["issues"].MaxRepository)
+	assert.GreaterOrEqual(t, engine.tracker.Components["releases"].TotalDuration, 20*time.Millisecond)
+	assert.Len(t, engine.tracker.Errors, 1)
+}
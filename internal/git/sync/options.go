@@ -5,9 +5,15 @@ package sync
 
 import (
 	"fmt"
+	"os"
+	"path/filepath"
 	"strings"
 )
 
+// DefaultComponentParallel is the default number of issue, wiki and release
+// components that may call the provider APIs at the same time.
+const DefaultComponentParallel = 4
+
 // SyncOptions contains options for repository synchronization.
 type SyncOptions struct {
 	// Source and destination
@@ -31,10 +37,17 @@ type SyncOptions struct {
 	Match   string
 	Exclude string
 
+	// Mirror keeps a persistent bare mirror of each source repository under
+	// MirrorDir and pushes it with git push --mirror, so repeated syncs only
+	// transfer the refs that changed.
+	Mirror    bool
+	MirrorDir string
+
 	// Execution options
-	Parallel int
-	DryRun   bool
-	Verbose  bool
+	Parallel          int
+	ComponentParallel int // Concurrent issue/wiki/release components across all repositories
+	DryRun            bool
+	Verbose           bool
 }
 
 // SyncTarget represents a parsed sync target (provider:org/repo or provider:org).
@@ -152,6 +165,14 @@ func (opts *SyncOptions) Validate() error {
 		return fmt.Errorf("parallel workers cannot exceed 20")
 	}
 
+	if opts.ComponentParallel < 1 {
+		opts.ComponentParallel = DefaultComponentParallel
+	}
+
+	if opts.Mirror && opts.MirrorDir == "" {
+		opts.MirrorDir = defaultMirrorDir()
+	}
+
 	// Validate that at least one sync feature is enabled
 	if !opts.IncludeCode && !opts.IncludeIssues && !opts.IncludePRs &&
 		!opts.IncludeWiki && !opts.IncludeReleases && !opts.IncludeSettings {
@@ -170,3 +191,13 @@ func (opts *SyncOptions) GetSourceTarget() (*SyncTarget, error) {
 func (opts *SyncOptions) GetDestinationTarget() (*SyncTarget, error) {
 	return ParseTarget(opts.To)
 }
+
+// defaultMirrorDir returns the directory holding the persistent bare mirrors.
+func defaultMirrorDir() string {
+	cacheDir, err := os.UserCacheDir()
+	if err != nil {
+		return filepath.Join(os.TempDir(), "gzh-sync-mirrors")
+	}
+
+	return filepath.Join(cacheDir, "gzh-manager", "sync-mirrors")
+}
@@ -5,10 +5,13 @@ package sync
 
 import (
 	"context"
+	"errors"
 	"fmt"
 	"sync"
 	"time"
 
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
+	"github.com/gizzahub/gzh-cli/internal/workerpool"
 	"github.com/gizzahub/gzh-cli/pkg/git/provider"
 )
 
@@ -57,6 +60,8 @@ func (e *SyncEngine) executeSequential(ctx context.Context, plan SyncPlan) error
 		fmt.Println()
 	}
 
+	e.trackRepositories(totalTasks, len(errors))
+
 	if len(errors) > 0 {
 		fmt.Printf("❌ Synchronization completed with %d errors\n", len(errors))
 		for _, err := range errors {
@@ -80,40 +85,40 @@ func (e *SyncEngine) executeParallel(ctx context.Context, plan SyncPlan) error {
 	fmt.Printf("🔄 Executing synchronization plan (%d repositories, %d workers)...\n\n",
 		totalTasks, e.options.Parallel)
 
-	// Create task queue
-	tasks := make(chan RepoSync, totalTasks)
-	results := make(chan SyncResult, totalTasks)
-
-	// Add all tasks to queue
-	for _, repoSync := range plan.Create {
-		tasks <- repoSync
+	// Queue all tasks on the shared scheduler, largest repositories first
+	tasks := make([]workerpool.Task[*syncTask], 0, totalTasks)
+	for _, repoSync := range append(append([]RepoSync{}, plan.Create...), plan.Update...) {
+		tasks = append(tasks, workerpool.Task[*syncTask]{
+			Data:     &syncTask{repoSync: repoSync, result: SyncResult{Repository: repoSync.Source.FullName}},
+			Size:     repoSync.Source.Size,
+			Resource: workerpool.ResourceGit,
+		})
 	}
-	for _, repoSync := range plan.Update {
-		tasks <- repoSync
-	}
-	close(tasks)
 
-	// Start workers
-	var wg sync.WaitGroup
-	for i := 0; i < e.options.Parallel; i++ {
-		wg.Add(1)
-		go func(workerID int) {
-			defer wg.Done()
-			e.worker(ctx, workerID, tasks, results)
-		}(i)
+	syncFn := func(ctx context.Context, task *syncTask) error {
+		start := time.Now()
+
+		if e.options.Verbose {
+			fmt.Printf("🔧 Starting %s\n", task.result.Repository)
+		}
+
+		err := e.syncRepository(ctx, task.repoSync)
+		task.result.Duration = time.Since(start)
+
+		return err
 	}
 
-	// Wait for workers to finish
-	go func() {
-		wg.Wait()
-		close(results)
-	}()
+	results := workerpool.Schedule(ctx, workerpool.SchedulerConfig{Workers: e.options.Parallel}, tasks, syncFn)
 
 	// Collect results
 	var errors []error
 	completed := 0
-	for result := range results {
+	for scheduled := range results {
 		completed++
+
+		result := scheduled.Data.result
+		result.Error = scheduled.Error
+
 		if result.Error != nil {
 			fmt.Printf("❌ [%d/%d] %s: %v\n", completed, totalTasks, result.Repository, result.Error)
 			errors = append(errors, fmt.Errorf("%s: %w", result.Repository, result.Error))
@@ -123,6 +128,8 @@ func (e *SyncEngine) executeParallel(ctx context.Context, plan SyncPlan) error {
 		}
 	}
 
+	e.trackRepositories(totalTasks, len(errors))
+
 	if len(errors) > 0 {
 		fmt.Printf("\n❌ Synchronization completed with %d errors\n", len(errors))
 		for _, err := range errors {
@@ -135,27 +142,6 @@ func (e *SyncEngine) executeParallel(ctx context.Context, plan SyncPlan) error {
 	return nil
 }
 
-// worker processes synchronization tasks from the queue.
-func (e *SyncEngine) worker(ctx context.Context, workerID int, tasks <-chan RepoSync, results chan<- SyncResult) {
-	for repoSync := range tasks {
-		start := time.Now()
-
-		if e.options.Verbose {
-			fmt.Printf("🔧 Worker %d: Starting %s\n", workerID, repoSync.Source.FullName)
-		}
-
-		err := e.syncRepository(ctx, repoSync)
-		duration := time.Since(start)
-
-		results <- SyncResult{
-			Repository: repoSync.Source.FullName,
-			Duration:   duration,
-			Error:      err,
-			WorkerID:   workerID,
-		}
-	}
-}
-
 // syncRepository synchronizes a single repository.
 func (e *SyncEngine) syncRepository(ctx context.Context, repoSync RepoSync) error {
 	// If creating a new repository, create it first
@@ -186,18 +172,82 @@ func (e *SyncEngine) syncRepository(ctx context.Context, repoSync RepoSync) erro
 		}
 	}
 
-	// Execute all sync actions
+	// Run the ordered actions (code, settings) first; releases need the pushed tags
+	var concurrent []SyncAction
+
 	for _, action := range repoSync.Actions {
-		if e.options.Verbose {
-			fmt.Printf("  Executing %s: %s\n", action.Type, action.Description)
+		if action.Concurrent {
+			concurrent = append(concurrent, action)
+			continue
 		}
 
-		if err := action.Handler(ctx); err != nil {
+		if err := e.runAction(ctx, repoSync.Source.FullName, action); err != nil {
 			return fmt.Errorf("action %s failed: %w", action.Type, err)
 		}
 	}
 
-	return nil
+	return e.runConcurrentActions(ctx, repoSync.Source.FullName, concurrent)
+}
+
+// runConcurrentActions runs the API-only actions of a repository at the same
+// time, each holding one of the engine's component slots. All of them run to
+// completion; their errors are joined.
+func (e *SyncEngine) runConcurrentActions(ctx context.Context, repository string, actions []SyncAction) error {
+	errs := make([]error, len(actions))
+
+	var wg sync.WaitGroup
+
+	for i, action := range actions {
+		wg.Add(1)
+
+		go func() {
+			defer wg.Done()
+
+			if err := e.componentSlots.Acquire(ctx, 1); err != nil {
+				errs[i] = fmt.Errorf("action %s failed: %w", action.Type, err)
+				return
+			}
+			defer e.componentSlots.Release(1)
+
+			if err := e.runAction(ctx, repository, action); err != nil {
+				errs[i] = fmt.Errorf("action %s failed: %w", action.Type, err)
+			}
+		}()
+	}
+
+	wg.Wait()
+
+	return errors.Join(errs...)
+}
+
+// runAction executes one sync action and records its timing.
+func (e *SyncEngine) runAction(ctx context.Context, repository string, action SyncAction) error {
+	if e.options.Verbose {
+		fmt.Printf("  Executing %s: %s\n", action.Type, action.Description)
+	}
+
+	span := phase.Start(ctx, phase.Name(action.Type))
+	err := action.Handler(ctx)
+	duration := span.End(err)
+
+	if e.tracker != nil {
+		e.tracker.RecordComponent(repository, action.Type, duration, err)
+	}
+
+	return err
+}
+
+// trackRepositories records the repository totals of an executed plan.
+func (e *SyncEngine) trackRepositories(total, failed int) {
+	if e.tracker != nil {
+		e.tracker.UpdateRepositories(total, total-failed, failed)
+	}
+}
+
+// syncTask carries a repository through the scheduler together with its result.
+type syncTask struct {
+	repoSync RepoSync
+	result   SyncResult
 }
 
 // SyncResult represents the result of a synchronization task.
@@ -205,7 +255,6 @@ type SyncResult struct {
 	Repository string
 	Duration   time.Duration
 	Error      error
-	WorkerID   int
 }
 
 // ParallelSyncStats tracks statistics for parallel synchronization.
@@ -4,12 +4,18 @@
 package sync
 
 import (
+	"crypto/rand"
+	"encoding/hex"
 	"encoding/json"
 	"fmt"
 	"os"
 	"path/filepath"
+	"sort"
 	"strings"
+	"sync"
 	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
 )
 
 // SyncTracker tracks synchronization progress and state.
@@ -24,6 +30,13 @@ type SyncTracker struct {
 	Statistics  SyncStatistics          `json:"statistics"`
 	SyncOptions SyncOptions             `json:"options"`
 	Errors      []SyncError             `json:"errors,omitempty"`
+
+	// Components holds the timings of each sync component (code, issues,
+	// wiki, ...) summed over all repositories.
+	Components map[string]ComponentStats `json:"components,omitempty"`
+
+	// mu guards the tracker; components of a repository report concurrently
+	mu sync.Mutex
 }
 
 // SyncStatus represents the overall status of a sync operation.
@@ -56,6 +69,16 @@ type SyncError struct {
 	Timestamp  time.Time `json:"timestamp"`
 }
 
+// ComponentStats contains the timings of one sync component.
+type ComponentStats struct {
+	Runs            int           `json:"runs"`
+	Failed          int           `json:"failed"`
+	TotalDuration   time.Duration `json:"total_duration"`
+	AverageDuration time.Duration `json:"average_duration"`
+	MaxDuration     time.Duration `json:"max_duration"`
+	MaxRepository   string        `json:"max_repository,omitempty"`
+}
+
 // NewSyncTracker creates a new sync tracker.
 func NewSyncTracker(id, source, destination string, opts SyncOptions) *SyncTracker {
 	return &SyncTracker{
@@ -72,6 +95,9 @@ func NewSyncTracker(id, source, destination string, opts SyncOptions) *SyncTrack
 
 // UpdateProgress updates the progress for a specific component.
 func (t *SyncTracker) UpdateProgress(component string, completed, failed int) {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
 	if t.Progress == nil {
 		t.Progress = make(map[string]SyncProgress)
 	}
@@ -93,6 +119,9 @@ func (t *SyncTracker) UpdateProgress(component string, completed, failed int) {
 
 // SetStatus updates the sync status.
 func (t *SyncTracker) SetStatus(status SyncStatus) {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
 	t.Status = status
 	if status == StatusCompleted || status == StatusFailed || status == StatusCancelled {
 		now := time.Now()
@@ -107,19 +136,106 @@ func (t *SyncTracker) SetStatus(status SyncStatus) {
 
 // AddError adds an error to the tracker.
 func (t *SyncTracker) AddError(repository, component, message string) {
-	error := SyncError{
-		Repository: repository,
-		Component:  component,
-		Message:    message,
-		Timestamp:  time.Now(),
-	}
-	t.Errors = append(t.Errors, error)
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
+	t.addError(repository, component, message)
 
 	if err := t.save(); err != nil {
 		fmt.Printf("Warning: Failed to save sync error: %v\n", err)
 	}
 }
 
+// RecordComponent records one run of a sync component for a repository. It
+// is safe for concurrent use and does not save the tracker; the next status
+// or progress update does.
+func (t *SyncTracker) RecordComponent(repository, component string, duration time.Duration, err error) {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
+	if t.Components == nil {
+		t.Components = make(map[string]ComponentStats)
+	}
+
+	stats := t.Components[component]
+	stats.Runs++
+	stats.TotalDuration += duration
+	stats.AverageDuration = stats.TotalDuration / time.Duration(stats.Runs)
+
+	if duration > stats.MaxDuration {
+		stats.MaxDuration = duration
+		stats.MaxRepository = repository
+	}
+
+	if err != nil {
+		stats.Failed++
+		t.addError(repository, component, err.Error())
+	}
+
+	t.Components[component] = stats
+}
+
+// UpdateRepositories records the repository totals of the sync and saves the
+// tracker.
+func (t *SyncTracker) UpdateRepositories(total, completed, failed int) {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
+	if t.Progress == nil {
+		t.Progress = make(map[string]SyncProgress)
+	}
+
+	progress := SyncProgress{Total: total, UpdatedAt: time.Now()}
+	progress.UpdateProgress(completed, failed)
+	t.Progress["repositories"] = progress
+
+	t.updateStatistics()
+
+	if err := t.save(); err != nil {
+		fmt.Printf("Warning: Failed to save sync progress: %v\n", err)
+	}
+}
+
+// PrintComponentTimings prints the per-component timings, slowest first.
+func (t *SyncTracker) PrintComponentTimings() {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
+	if len(t.Components) == 0 {
+		return
+	}
+
+	components := make([]string, 0, len(t.Components))
+	for component := range t.Components {
+		components = append(components, component)
+	}
+
+	sort.Slice(components, func(i, j int) bool {
+		return t.Components[components[i]].TotalDuration > t.Components[components[j]].TotalDuration
+	})
+
+	fmt.Printf("\n⏱️  Component timings:\n")
+
+	for _, component := range components {
+		stats := t.Components[component]
+		fmt.Printf("  %-10s %4d runs  %3d failed  total %-10v avg %-10v max %v (%s)\n",
+			component, stats.Runs, stats.Failed,
+			stats.TotalDuration.Truncate(time.Millisecond),
+			stats.AverageDuration.Truncate(time.Millisecond),
+			stats.MaxDuration.Truncate(time.Millisecond), stats.MaxRepository)
+	}
+}
+
+// addError appends an error; the caller holds t.mu.
+func (t *SyncTracker) addError(repository, component, message string) {
+	t.Errors = append(t.Errors, SyncError{
+		Repository: repository,
+		Component:  component,
+		Message:    message,
+		Timestamp:  time.Now(),
+	})
+}
+
 // updateStatistics updates the overall statistics based on progress.
 func (t *SyncTracker) updateStatistics() {
 	totalCompleted := 0
@@ -185,7 +301,11 @@ func (t *SyncTracker) GetSummary() SyncSummary {
 }
 
 // save saves the tracker state to disk.
-func (t *SyncTracker) save() error {
+func (t *SyncTracker) save() (err error) {
+	defer func(start time.Time) {
+		phase.Default.Observe("git_sync", phase.StateSave, time.Since(start), err)
+	}(time.Now())
+
 	data, err := json.MarshalIndent(t, "", "  ")
 	if err != nil {
 		return fmt.Errorf("failed to marshal tracker: %w", err)
@@ -283,6 +403,14 @@ func CleanupOldTrackers(maxAge time.Duration) error {
 	return nil
 }
 
+// generateTrackerID generates a random sync tracker ID.
+func generateTrackerID() string {
+	bytes := make([]byte, 8)
+	_, _ = rand.Read(bytes)
+
+	return hex.EncodeToString(bytes)
+}
+
 // getSyncDir returns the directory for storing sync tracking files.
 func getSyncDir() string {
 	homeDir, err := os.UserHomeDir()
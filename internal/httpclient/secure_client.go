@@ -8,6 +8,7 @@ import (
 	"fmt"
 	"net"
 	"net/http"
+	"sync"
 	"time"
 
 	"github.com/gizzahub/gzh-cli/internal/constants"
@@ -225,51 +226,104 @@ func (rt *SecureRoundTripper) RoundTrip(req *http.Request) (*http.Response, erro
 	return nil, fmt.Errorf("request failed after %d retries: %w", rt.retries, lastErr)
 }
 
-// ClientPool manages HTTP client instances for connection reusing.
+// ClientPool manages HTTP client instances for connection reusing. Every
+// client type has one SharedTransport, so all clients of a provider share its
+// connections and coalesce identical in-flight requests.
 type ClientPool struct {
-	clients map[string]*http.Client
-	factory *SecureHTTPClientFactory
+	mu         sync.Mutex
+	clients    map[string]*http.Client
+	transports map[string]*SharedTransport
+	factory    *SecureHTTPClientFactory
 }
 
 // NewClientPool creates a new client pool.
 func NewClientPool() *ClientPool {
 	return &ClientPool{
-		clients: make(map[string]*http.Client),
-		factory: NewSecureHTTPClientFactory(DefaultSecureClientConfig()),
+		clients:    make(map[string]*http.Client),
+		transports: make(map[string]*SharedTransport),
+		factory:    NewSecureHTTPClientFactory(DefaultSecureClientConfig()),
 	}
 }
 
-// GetClient returns a cached client or creates a new one.
-func (p *ClientPool) GetClient(clientType string) *http.Client {
-	if client, exists := p.clients[clientType]; exists {
-		return client
-	}
-
-	var config *SecureClientConfig
+// clientConfig returns the configuration for a client type.
+func clientConfig(clientType string) *SecureClientConfig {
 	switch clientType {
 	case "github":
-		config = GitHubClientConfig()
+		return GitHubClientConfig()
 	case "gitlab":
-		config = GitLabClientConfig()
+		return GitLabClientConfig()
 	case "gitea":
-		config = GiteaClientConfig()
+		return GiteaClientConfig()
 	default:
-		config = DefaultSecureClientConfig()
+		return DefaultSecureClientConfig()
 	}
+}
 
-	factory := NewSecureHTTPClientFactory(config)
-	client := factory.CreateClient()
+// GetClient returns a cached client or creates a new one.
+func (p *ClientPool) GetClient(clientType string) *http.Client {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
+	if client, exists := p.clients[clientType]; exists {
+		return client
+	}
+
+	client := NewSecureHTTPClientFactory(clientConfig(clientType)).
+		CreateClientWithRoundTripper(p.transportLocked(clientType))
 	p.clients[clientType] = client
 
 	return client
 }
 
+// GetClientWithTimeout returns a new client with its own timeout that shares
+// the transport of the client type.
+func (p *ClientPool) GetClientWithTimeout(clientType string, timeout time.Duration) *http.Client {
+	client := *p.GetClient(clientType)
+	client.Timeout = timeout
+
+	return &client
+}
+
+// GetTransport returns the shared transport of a client type.
+func (p *ClientPool) GetTransport(clientType string) *SharedTransport {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
+	return p.transportLocked(clientType)
+}
+
+func (p *ClientPool) transportLocked(clientType string) *SharedTransport {
+	if transport, exists := p.transports[clientType]; exists {
+		return transport
+	}
+
+	base := NewSecureHTTPClientFactory(clientConfig(clientType)).CreateClient().Transport
+	transport := NewSharedTransport(base)
+	p.transports[clientType] = transport
+
+	return transport
+}
+
+// Stats returns the transport statistics of every client type in use.
+func (p *ClientPool) Stats() map[string]TransportStats {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
+	stats := make(map[string]TransportStats, len(p.transports))
+	for clientType, transport := range p.transports {
+		stats[clientType] = transport.Stats()
+	}
+
+	return stats
+}
+
 // CloseIdleConnections closes idle connections for all clients.
 func (p *ClientPool) CloseIdleConnections() {
-	for _, client := range p.clients {
-		if transport, ok := client.Transport.(*http.Transport); ok {
-			transport.CloseIdleConnections()
-		}
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
+	for _, transport := range p.transports {
+		transport.CloseIdleConnections()
 	}
 }
 
@@ -281,6 +335,17 @@ func GetGlobalClient(clientType string) *http.Client {
 	return globalClientPool.GetClient(clientType)
 }
 
+// GetGlobalClientWithTimeout returns a client with its own timeout sharing the
+// global pool's transport for the client type.
+func GetGlobalClientWithTimeout(clientType string, timeout time.Duration) *http.Client {
+	return globalClientPool.GetClientWithTimeout(clientType, timeout)
+}
+
+// GetGlobalTransportStats returns the transport statistics of the global pool.
+func GetGlobalTransportStats() map[string]TransportStats {
+	return globalClientPool.Stats()
+}
+
 // CloseGlobalIdleConnections closes idle connections in global pool.
 func CloseGlobalIdleConnections() {
 	globalClientPool.CloseIdleConnections()
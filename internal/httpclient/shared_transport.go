@@ -0,0 +1,302 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package httpclient
+
+import (
+	"bytes"
+	"io"
+	"net/http"
+	"net/http/httptrace"
+	"sort"
+	"strings"
+	"sync"
+	"sync/atomic"
+)
+
+// DefaultMaxCoalescedBody is the largest response body that is buffered and
+// shared between coalesced requests. Larger responses are streamed to the
+// request that fetched them, and the requests waiting on it go upstream
+// themselves.
+const DefaultMaxCoalescedBody = 8 << 20
+
+// TransportStats reports connection reuse and request coalescing of a
+// SharedTransport.
+type TransportStats struct {
+	// Requests is the number of requests made through the transport.
+	Requests int64 `json:"requests"`
+	// Upstream is the number of requests sent to the server.
+	Upstream int64 `json:"upstream"`
+	// Coalesced is the number of requests answered by an identical request
+	// that was already in flight.
+	Coalesced int64 `json:"coalesced"`
+	// NewConns and ReusedConns count the connections requests were sent on.
+	NewConns    int64 `json:"newConns"`
+	ReusedConns int64 `json:"reusedConns"`
+}
+
+// ReuseRate returns the fraction of upstream requests sent on a reused connection.
+func (s TransportStats) ReuseRate() float64 {
+	total := s.NewConns + s.ReusedConns
+	if total == 0 {
+		return 0
+	}
+
+	return float64(s.ReusedConns) / float64(total)
+}
+
+// CoalesceRate returns the fraction of requests that did not go upstream.
+func (s TransportStats) CoalesceRate() float64 {
+	if s.Requests == 0 {
+		return 0
+	}
+
+	return float64(s.Coalesced) / float64(s.Requests)
+}
+
+// SharedTransport is an http.RoundTripper shared by every client of a
+// provider. Concurrent identical GET and HEAD requests are coalesced: the
+// first one goes upstream and the others receive a copy of its response.
+// Requests are identical when their method, URL and headers match, so
+// requests made with different tokens are never merged. Nothing is cached;
+// a request arriving after the response headers goes upstream again.
+//
+// A response is only buffered when requests joined it before its headers
+// arrived; otherwise its body is passed through as it streams in.
+type SharedTransport struct {
+	base    http.RoundTripper
+	maxBody int64
+
+	mu       sync.Mutex
+	inflight map[string]*inflightRequest
+
+	requests    atomic.Int64
+	upstream    atomic.Int64
+	coalesced   atomic.Int64
+	newConns    atomic.Int64
+	reusedConns atomic.Int64
+}
+
+// inflightRequest is an upstream request other requests wait on.
+type inflightRequest struct {
+	done chan struct{}
+
+	// waiters is the number of requests waiting on this one (guarded by the
+	// transport mutex)
+	waiters int
+
+	// resp is the response template, with its body in body. When shared is
+	// false, the waiting requests have to go upstream themselves.
+	resp   *http.Response
+	body   []byte
+	err    error
+	shared bool
+}
+
+// NewSharedTransport wraps base with request coalescing and statistics.
+func NewSharedTransport(base http.RoundTripper) *SharedTransport {
+	if base == nil {
+		base = http.DefaultTransport
+	}
+
+	return &SharedTransport{
+		base:     base,
+		maxBody:  DefaultMaxCoalescedBody,
+		inflight: make(map[string]*inflightRequest),
+	}
+}
+
+// Stats returns a snapshot of the transport counters.
+func (t *SharedTransport) Stats() TransportStats {
+	return TransportStats{
+		Requests:    t.requests.Load(),
+		Upstream:    t.upstream.Load(),
+		Coalesced:   t.coalesced.Load(),
+		NewConns:    t.newConns.Load(),
+		ReusedConns: t.reusedConns.Load(),
+	}
+}
+
+// CloseIdleConnections closes the idle connections of the underlying transport.
+func (t *SharedTransport) CloseIdleConnections() {
+	if closer, ok := t.base.(interface{ CloseIdleConnections() }); ok {
+		closer.CloseIdleConnections()
+	}
+}
+
+// RoundTrip implements http.RoundTripper.
+func (t *SharedTransport) RoundTrip(req *http.Request) (*http.Response, error) {
+	t.requests.Add(1)
+
+	if !coalescible(req) {
+		return t.send(req)
+	}
+
+	key := coalesceKey(req)
+
+	t.mu.Lock()
+	if call, ok := t.inflight[key]; ok {
+		call.waiters++
+		t.mu.Unlock()
+
+		return t.wait(req, call)
+	}
+
+	call := &inflightRequest{done: make(chan struct{})}
+	t.inflight[key] = call
+	t.mu.Unlock()
+
+	resp, err := t.lead(req, key, call)
+
+	// Remove the call before releasing the waiters, so later requests go
+	// upstream instead of reusing a completed response
+	t.release(key, call)
+	close(call.done)
+
+	return resp, err
+}
+
+// release removes call from the in-flight requests unless it is gone already,
+// possibly replaced by a later request.
+func (t *SharedTransport) release(key string, call *inflightRequest) {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
+	if t.inflight[key] == call {
+		delete(t.inflight, key)
+	}
+}
+
+// lead sends the request and prepares its response for the waiting requests.
+func (t *SharedTransport) lead(req *http.Request, key string, call *inflightRequest) (*http.Response, error) {
+	resp, err := t.send(req)
+	if err != nil {
+		// A canceled request says nothing about the requests waiting on it
+		call.err = err
+		call.shared = req.Context().Err() == nil
+
+		return nil, err
+	}
+
+	// Without waiters the body streams through; requests arriving from now
+	// on go upstream themselves
+	t.mu.Lock()
+	waiters := call.waiters
+	if waiters == 0 {
+		delete(t.inflight, key)
+	}
+	t.mu.Unlock()
+
+	if waiters == 0 {
+		return resp, nil
+	}
+
+	body, err := io.ReadAll(io.LimitReader(resp.Body, t.maxBody+1))
+	if err != nil {
+		_ = resp.Body.Close()
+		return nil, err
+	}
+
+	if int64(len(body)) > t.maxBody {
+		resp.Body = &prefixedBody{Reader: io.MultiReader(bytes.NewReader(body), resp.Body), Closer: resp.Body}
+		return resp, nil
+	}
+
+	_ = resp.Body.Close()
+
+	call.resp = resp
+	call.body = body
+	call.shared = true
+
+	return copyResponse(resp, body, req), nil
+}
+
+// wait returns the response of the in-flight request, or sends req itself
+// when that response cannot be shared.
+func (t *SharedTransport) wait(req *http.Request, call *inflightRequest) (*http.Response, error) {
+	select {
+	case <-call.done:
+	case <-req.Context().Done():
+		return nil, req.Context().Err()
+	}
+
+	if !call.shared {
+		return t.send(req)
+	}
+
+	t.coalesced.Add(1)
+
+	if call.err != nil {
+		return nil, call.err
+	}
+
+	return copyResponse(call.resp, call.body, req), nil
+}
+
+// send sends req upstream, counting the connection it is sent on.
+func (t *SharedTransport) send(req *http.Request) (*http.Response, error) {
+	t.upstream.Add(1)
+
+	trace := &httptrace.ClientTrace{
+		GotConn: func(info httptrace.GotConnInfo) {
+			if info.Reused {
+				t.reusedConns.Add(1)
+			} else {
+				t.newConns.Add(1)
+			}
+		},
+	}
+
+	return t.base.RoundTrip(req.WithContext(httptrace.WithClientTrace(req.Context(), trace)))
+}
+
+// coalescible reports whether req may share the response of an identical request.
+func coalescible(req *http.Request) bool {
+	if req.Method != http.MethodGet && req.Method != http.MethodHead {
+		return false
+	}
+
+	return req.Body == nil || req.Body == http.NoBody
+}
+
+// coalesceKey identifies a request by its method, URL and headers.
+func coalesceKey(req *http.Request) string {
+	names := make([]string, 0, len(req.Header))
+	for name := range req.Header {
+		names = append(names, name)
+	}
+
+	sort.Strings(names)
+
+	var b strings.Builder
+
+	b.WriteString(req.Method)
+	b.WriteByte(' ')
+	b.WriteString(req.URL.String())
+
+	for _, name := range names {
+		b.WriteByte('\n')
+		b.WriteString(name)
+		b.WriteByte(':')
+		b.WriteString(strings.Join(req.Header[name], "\x00"))
+	}
+
+	return b.String()
+}
+
+// copyResponse returns a copy of resp with its own header and body for req.
+func copyResponse(resp *http.Response, body []byte, req *http.Request) *http.Response {
+	clone := *resp
+	clone.Header = resp.Header.Clone()
+	clone.Trailer = resp.Trailer.Clone()
+	clone.Body = io.NopCloser(bytes.NewReader(body))
+	clone.Request = req
+
+	return &clone
+}
+
+// prefixedBody is a response body whose beginning was already read.
+type prefixedBody struct {
+	io.Reader
+	io.Closer
+}
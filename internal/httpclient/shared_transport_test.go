@@ -0,0 +1,220 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package httpclient
+
+import (
+	"context"
+	"io"
+	"net/http"
+	"net/http/httptest"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+// blockingServer answers every request with the request path once release is
+// closed, counting the requests it received.
+func blockingServer(t *testing.T, release <-chan struct{}, hits *atomic.Int64) *httptest.Server {
+	t.Helper()
+
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		hits.Add(1)
+		<-release
+		_, _ = io.WriteString(w, r.URL.Path+" "+r.Header.Get("Authorization"))
+	}))
+	t.Cleanup(server.Close)
+
+	return server
+}
+
+func getBody(t *testing.T, client *http.Client, url, token string) string {
+	t.Helper()
+
+	req, err := http.NewRequestWithContext(context.Background(), http.MethodGet, url, nil)
+	require.NoError(t, err)
+	req.Header.Set("Authorization", token)
+
+	resp, err := client.Do(req)
+	require.NoError(t, err)
+	defer resp.Body.Close()
+
+	body, err := io.ReadAll(resp.Body)
+	require.NoError(t, err)
+
+	return string(body)
+}
+
+func TestSharedTransport_CoalescesIdenticalRequests(t *testing.T) {
+	release := make(chan struct{})
+
+	var hits atomic.Int64
+
+	server := blockingServer(t, release, &hits)
+	transport := NewSharedTransport(http.DefaultTransport)
+	client := &http.Client{Transport: transport}
+
+	const callers = 8
+
+	var wg sync.WaitGroup
+
+	bodies := make([]string, callers)
+
+	for i := range callers {
+		wg.Add(1)
+
+		go func() {
+			defer wg.Done()
+			bodies[i] = getBody(t, client, server.URL+"/orgs/test/repos", "token a")
+		}()
+	}
+
+	// Wait until the first request reached the server and the others queued behind it
+	assert.Eventually(t, func() bool {
+		return hits.Load() == 1 && transport.requests.Load() == callers
+	}, 5*time.Second, 5*time.Millisecond)
+
+	close(release)
+	wg.Wait()
+
+	for _, body := range bodies {
+		assert.Equal(t, "/orgs/test/repos token a", body)
+	}
+
+	stats := transport.Stats()
+	assert.Equal(t, int64(1), hits.Load())
+	assert.Equal(t, int64(callers), stats.Requests)
+	assert.Equal(t, int64(1), stats.Upstream)
+	assert.Equal(t, int64(callers-1), stats.Coalesced)
+
+	// A completed response is not reused
+	assert.Equal(t, "/orgs/test/repos token a", getBody(t, client, server.URL+"/orgs/test/repos", "token a"))
+	assert.Equal(t, int64(2), hits.Load())
+	assert.Equal(t, int64(1), transport.Stats().ReusedConns)
+}
+
+func TestSharedTransport_DifferentHeadersNotCoalesced(t *testing.T) {
+	release := make(chan struct{})
+	close(release)
+
+	var hits atomic.Int64
+
+	server := blockingServer(t, release, &hits)
+	client := &http.Client{Transport: NewSharedTransport(http.DefaultTransport)}
+
+	var wg sync.WaitGroup
+
+	for _, token := range []string{"token a", "token b"} {
+		wg.Add(1)
+
+		go func() {
+			defer wg.Done()
+			assert.Equal(t, "/repo "+token, getBody(t, client, server.URL+"/repo", token))
+		}()
+	}
+
+	wg.Wait()
+	assert.Equal(t, int64(2), hits.Load())
+}
+
+func TestSharedTransport_LargeBodyNotShared(t *testing.T) {
+	release := make(chan struct{})
+
+	var hits atomic.Int64
+
+	payload := strings.Repeat("x", 64)
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, _ *http.Request) {
+		hits.Add(1)
+		<-release
+		_, _ = io.WriteString(w, payload)
+	}))
+	t.Cleanup(server.Close)
+
+	transport := NewSharedTransport(http.DefaultTransport)
+	transport.maxBody = 16
+	client := &http.Client{Transport: transport}
+
+	var wg sync.WaitGroup
+
+	for range 2 {
+		wg.Add(1)
+
+		go func() {
+			defer wg.Done()
+			assert.Equal(t, payload, getBody(t, client, server.URL, ""))
+		}()
+	}
+
+	assert.Eventually(t, func() bool { return transport.requests.Load() == 2 }, 5*time.Second, 5*time.Millisecond)
+	close(release)
+	wg.Wait()
+
+	// The waiting request went upstream itself
+	assert.Equal(t, int64(2), hits.Load())
+	assert.Zero(t, transport.Stats().Coalesced)
+}
+
+func TestSharedTransport_StreamsWithoutWaiters(t *testing.T) {
+	release := make(chan struct{})
+
+	var hits atomic.Int64
+
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, _ *http.Request) {
+		hits.Add(1)
+		_, _ = io.WriteString(w, "first ")
+		w.(http.Flusher).Flush()
+		<-release
+		_, _ = io.WriteString(w, "second")
+	}))
+	t.Cleanup(server.Close)
+
+	transport := NewSharedTransport(http.DefaultTransport)
+	client := &http.Client{Transport: transport}
+
+	resp, err := client.Get(server.URL)
+	require.NoError(t, err)
+	defer resp.Body.Close()
+
+	// The body is readable before the server finished it
+	first := make([]byte, len("first "))
+	_, err = io.ReadFull(resp.Body, first)
+	require.NoError(t, err)
+	assert.Equal(t, "first ", string(first))
+
+	// A request after the headers arrived goes upstream itself
+	done := make(chan string)
+	go func() { done <- getBody(t, client, server.URL, "") }()
+
+	assert.Eventually(t, func() bool { return hits.Load() == 2 }, 5*time.Second, 5*time.Millisecond)
+	close(release)
+
+	rest, err := io.ReadAll(resp.Body)
+	require.NoError(t, err)
+	assert.Equal(t, "second", string(rest))
+	assert.Equal(t, "first second", <-done)
+	assert.Zero(t, transport.Stats().Coalesced)
+}
+
+func TestSharedTransport_PostNotCoalesced(t *testing.T) {
+	req := httptest.NewRequest(http.MethodPost, "https://api.github.com/repos", strings.NewReader("{}"))
+	assert.False(t, coalescible(req))
+
+	req = httptest.NewRequest(http.MethodGet, "https://api.github.com/repos", nil)
+	assert.True(t, coalescible(req))
+}
+
+func TestClientPool_SharesTransport(t *testing.T) {
+	pool := NewClientPool()
+
+	client := pool.GetClient("github")
+	withTimeout := pool.GetClientWithTimeout("github", time.Second)
+
+	assert.Same(t, client, pool.GetClient("github"))
+	assert.Equal(t, time.Second, withTimeout.Timeout)
+	assert.Equal(t, client.Transport, withTimeout.Transport)
+	assert.NotEqual(t, client.Transport, pool.GetClient("gitlab").Transport)
+	assert.Len(t, pool.Stats(), 2)
+}
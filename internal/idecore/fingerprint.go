@@ -0,0 +1,37 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package idecore
+
+import (
+	"os"
+	"time"
+)
+
+// Fingerprint identifies the on-disk state of an executable. IDE updates
+// replace or rewrite the executable, which changes at least one field.
+type Fingerprint struct {
+	ModTime time.Time `json:"mod_time"`
+	Size    int64     `json:"size"`
+	Inode   uint64    `json:"inode,omitempty"`
+}
+
+// FingerprintOf returns the fingerprint of the file at path, following
+// symlinks so that a launcher link reflects the installation it points to.
+func FingerprintOf(path string) (Fingerprint, error) {
+	info, err := os.Stat(path)
+	if err != nil {
+		return Fingerprint{}, err
+	}
+
+	return Fingerprint{
+		ModTime: info.ModTime().UTC(),
+		Size:    info.Size(),
+		Inode:   inode(info),
+	}, nil
+}
+
+// Equal reports whether both fingerprints describe the same file state.
+func (f Fingerprint) Equal(other Fingerprint) bool {
+	return f.ModTime.Equal(other.ModTime) && f.Size == other.Size && f.Inode == other.Inode
+}
@@ -0,0 +1,14 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+//go:build !unix
+
+package idecore
+
+import "os"
+
+// inode is not available from os.FileInfo on this platform; the modification
+// time and size still identify updates.
+func inode(os.FileInfo) uint64 {
+	return 0
+}
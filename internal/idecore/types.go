@@ -22,6 +22,19 @@ type IDE struct {
 type IDECache struct {
 	Timestamp time.Time `json:"timestamp"`
 	IDEs      []IDE     `json:"ides"`
+
+	// Installs holds the probe result of each installation keyed by its
+	// executable path. An entry stays valid for a day while the installation
+	// keeps the recorded fingerprint, so only updated installations are
+	// probed again.
+	Installs map[string]CachedInstall `json:"installs,omitempty"`
+}
+
+// CachedInstall is the cached probe result of one installation.
+type CachedInstall struct {
+	Fingerprint Fingerprint `json:"fingerprint"`
+	ProbedAt    time.Time   `json:"probed_at"`
+	IDE         IDE         `json:"ide"`
 }
 
 // IDEDetectorInterface defines the interface for IDE detection.
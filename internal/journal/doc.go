@@ -0,0 +1,11 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+// Package journal provides an append-only, newline-delimited JSON write-ahead
+// log with batched fsyncs, plus atomic snapshot helpers used to compact it.
+//
+// State owners append one record per state transition instead of rewriting
+// their whole state file, periodically write a snapshot and truncate the
+// journal, and on restore load the snapshot and replay the journal on top.
+// Replayed records must therefore be idempotent.
+package journal
@@ -0,0 +1,322 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package journal
+
+import (
+	"bufio"
+	"bytes"
+	"encoding/json"
+	"errors"
+	"fmt"
+	"io"
+	"os"
+	"path/filepath"
+	"sync"
+	"time"
+)
+
+const (
+	// DefaultSyncEvery is the number of appended records after which the journal is fsynced.
+	DefaultSyncEvery = 64
+
+	// DefaultSyncInterval bounds how long an appended record may stay unsynced.
+	DefaultSyncInterval = time.Second
+)
+
+// Options configures a journal Writer.
+type Options struct {
+	// SyncEvery fsyncs after this many records. 0 selects DefaultSyncEvery; 1 syncs every record.
+	SyncEvery int
+
+	// SyncInterval fsyncs on the next append once this much time has passed since the last sync.
+	// 0 selects DefaultSyncInterval.
+	SyncInterval time.Duration
+}
+
+// Writer appends JSON records to a journal file. It is safe for concurrent use.
+//
+// Records are buffered and written with a single fsync per batch, so a crash
+// can lose at most the last unsynced batch; everything before it is durable.
+type Writer struct {
+	mu       sync.Mutex
+	file     *os.File
+	buf      *bufio.Writer
+	opts     Options
+	pending  int
+	records  int
+	lastSync time.Time
+}
+
+// Open opens path for appending, creating it and its directory if necessary.
+// A torn final line left by a crash is cut off first, so that the next record
+// starts on a line of its own instead of extending the partial one.
+func Open(path string, opts Options) (*Writer, error) {
+	if opts.SyncEvery <= 0 {
+		opts.SyncEvery = DefaultSyncEvery
+	}
+
+	if opts.SyncInterval <= 0 {
+		opts.SyncInterval = DefaultSyncInterval
+	}
+
+	if err := os.MkdirAll(filepath.Dir(path), 0o750); err != nil {
+		return nil, fmt.Errorf("failed to create journal directory: %w", err)
+	}
+
+	file, err := os.OpenFile(path, os.O_CREATE|os.O_RDWR|os.O_APPEND, 0o600)
+	if err != nil {
+		return nil, fmt.Errorf("failed to open journal: %w", err)
+	}
+
+	if err := trimTornTail(file); err != nil {
+		_ = file.Close()
+		return nil, err
+	}
+
+	return &Writer{
+		file:     file,
+		buf:      bufio.NewWriter(file),
+		opts:     opts,
+		lastSync: time.Now(),
+	}, nil
+}
+
+// Append writes record as one JSON line and fsyncs when the current batch is full or old enough.
+func (w *Writer) Append(record any) error {
+	line, err := json.Marshal(record)
+	if err != nil {
+		return fmt.Errorf("failed to marshal journal record: %w", err)
+	}
+
+	w.mu.Lock()
+	defer w.mu.Unlock()
+
+	if w.file == nil {
+		return os.ErrClosed
+	}
+
+	if _, err := w.buf.Write(append(line, '\n')); err != nil {
+		return fmt.Errorf("failed to append journal record: %w", err)
+	}
+
+	w.pending++
+	w.records++
+
+	if w.pending >= w.opts.SyncEvery || time.Since(w.lastSync) >= w.opts.SyncInterval {
+		return w.syncLocked()
+	}
+
+	return nil
+}
+
+// Records returns the number of records appended since the writer was opened or last truncated.
+func (w *Writer) Records() int {
+	w.mu.Lock()
+	defer w.mu.Unlock()
+
+	return w.records
+}
+
+// Sync flushes buffered records and fsyncs the journal file.
+func (w *Writer) Sync() error {
+	w.mu.Lock()
+	defer w.mu.Unlock()
+
+	if w.file == nil {
+		return nil
+	}
+
+	return w.syncLocked()
+}
+
+func (w *Writer) syncLocked() error {
+	if err := w.buf.Flush(); err != nil {
+		return fmt.Errorf("failed to flush journal: %w", err)
+	}
+
+	if err := w.file.Sync(); err != nil {
+		return fmt.Errorf("failed to sync journal: %w", err)
+	}
+
+	w.pending = 0
+	w.lastSync = time.Now()
+
+	return nil
+}
+
+// Truncate discards every record in the journal. Call it only after a snapshot
+// containing those records has been written durably.
+func (w *Writer) Truncate() error {
+	w.mu.Lock()
+	defer w.mu.Unlock()
+
+	if w.file == nil {
+		return os.ErrClosed
+	}
+
+	w.buf.Reset(w.file)
+
+	if err := w.file.Truncate(0); err != nil {
+		return fmt.Errorf("failed to truncate journal: %w", err)
+	}
+
+	if err := w.file.Sync(); err != nil {
+		return fmt.Errorf("failed to sync journal: %w", err)
+	}
+
+	w.pending = 0
+	w.records = 0
+	w.lastSync = time.Now()
+
+	return nil
+}
+
+// Close syncs and closes the journal. Closing a closed writer is a no-op.
+func (w *Writer) Close() error {
+	w.mu.Lock()
+	defer w.mu.Unlock()
+
+	if w.file == nil {
+		return nil
+	}
+
+	syncErr := w.syncLocked()
+	closeErr := w.file.Close()
+	w.file = nil
+
+	return errors.Join(syncErr, closeErr)
+}
+
+// trimTornTail truncates file just past its last newline, discarding a final
+// record that a crash left incomplete.
+func trimTornTail(file *os.File) error {
+	info, err := file.Stat()
+	if err != nil {
+		return fmt.Errorf("failed to stat journal: %w", err)
+	}
+
+	size := info.Size()
+	end := size
+	chunk := make([]byte, 4096)
+
+	for end > 0 {
+		start := max(end-int64(len(chunk)), 0)
+
+		n, err := file.ReadAt(chunk[:end-start], start)
+		if err != nil && !errors.Is(err, io.EOF) {
+			return fmt.Errorf("failed to read journal: %w", err)
+		}
+
+		if i := bytes.LastIndexByte(chunk[:n], '\n'); i >= 0 {
+			end = start + int64(i) + 1
+			break
+		}
+
+		end = start
+	}
+
+	if end == size {
+		return nil
+	}
+
+	if err := file.Truncate(end); err != nil {
+		return fmt.Errorf("failed to truncate torn journal record: %w", err)
+	}
+
+	return nil
+}
+
+// Replay calls fn with each record in the journal at path, in append order,
+// and returns the offset just past the last complete record. A missing journal
+// replays nothing. A torn final line, left by a crash in the middle of a
+// write, is ignored; corruption anywhere else is an error.
+func Replay(path string, fn func(record json.RawMessage) error) (int64, error) {
+	file, err := os.Open(path)
+	if errors.Is(err, os.ErrNotExist) {
+		return 0, nil
+	}
+
+	if err != nil {
+		return 0, fmt.Errorf("failed to open journal: %w", err)
+	}
+	defer func() { _ = file.Close() }()
+
+	reader := bufio.NewReader(file)
+
+	var offset int64
+
+	for lineNo := 1; ; lineNo++ {
+		line, err := reader.ReadBytes('\n')
+		if errors.Is(err, io.EOF) {
+			// Without a trailing newline the last record was never completely written
+			return offset, nil
+		}
+
+		if err != nil {
+			return offset, fmt.Errorf("failed to read journal: %w", err)
+		}
+
+		next := offset + int64(len(line))
+
+		line = bytes.TrimSpace(line)
+		if len(line) == 0 {
+			offset = next
+			continue
+		}
+
+		if !json.Valid(line) {
+			return offset, fmt.Errorf("corrupt journal record at %s:%d", path, lineNo)
+		}
+
+		if err := fn(line); err != nil {
+			return offset, err
+		}
+
+		offset = next
+	}
+}
+
+// WriteSnapshot atomically replaces path with the indented JSON encoding of v.
+// The data is fsynced before the rename so that a crash leaves either the old
+// or the new snapshot, never a partial one.
+func WriteSnapshot(path string, v any, perm os.FileMode) error {
+	data, err := json.MarshalIndent(v, "", "  ")
+	if err != nil {
+		return fmt.Errorf("failed to marshal snapshot: %w", err)
+	}
+
+	dir := filepath.Dir(path)
+	if err := os.MkdirAll(dir, 0o750); err != nil {
+		return fmt.Errorf("failed to create snapshot directory: %w", err)
+	}
+
+	tmp, err := os.CreateTemp(dir, "."+filepath.Base(path)+".*")
+	if err != nil {
+		return fmt.Errorf("failed to create snapshot: %w", err)
+	}
+
+	tmpName := tmp.Name()
+
+	_, writeErr := tmp.Write(data)
+	if writeErr == nil {
+		writeErr = tmp.Sync()
+	}
+
+	if err := errors.Join(writeErr, tmp.Close()); err != nil {
+		_ = os.Remove(tmpName)
+		return fmt.Errorf("failed to write snapshot: %w", err)
+	}
+
+	if err := os.Chmod(tmpName, perm); err != nil {
+		_ = os.Remove(tmpName)
+		return fmt.Errorf("failed to set snapshot permissions: %w", err)
+	}
+
+	if err := os.Rename(tmpName, path); err != nil {
+		_ = os.Remove(tmpName)
+		return fmt.Errorf("failed to replace snapshot: %w", err)
+	}
+
+	return nil
+}
@@ -0,0 +1,123 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package journal
+
+import (
+	"encoding/json"
+	"os"
+	"path/filepath"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+type testRecord struct {
+	N int `json:"n"`
+}
+
+func replayAll(t *testing.T, path string) []int {
+	t.Helper()
+
+	var got []int
+
+	_, err := Replay(path, func(raw json.RawMessage) error {
+		var record testRecord
+		require.NoError(t, json.Unmarshal(raw, &record))
+		got = append(got, record.N)
+
+		return nil
+	})
+	require.NoError(t, err)
+
+	return got
+}
+
+func TestWriter_AppendReplay(t *testing.T) {
+	path := filepath.Join(t.TempDir(), "test.journal")
+
+	w, err := Open(path, Options{SyncEvery: 2})
+	require.NoError(t, err)
+
+	for i := range 5 {
+		require.NoError(t, w.Append(testRecord{N: i}))
+	}
+
+	// Two full batches are on disk; the fifth record is still buffered
+	assert.Equal(t, []int{0, 1, 2, 3}, replayAll(t, path))
+
+	require.NoError(t, w.Close())
+	assert.Equal(t, []int{0, 1, 2, 3, 4}, replayAll(t, path))
+	assert.ErrorIs(t, w.Append(testRecord{}), os.ErrClosed)
+}
+
+func TestWriter_Truncate(t *testing.T) {
+	path := filepath.Join(t.TempDir(), "test.journal")
+
+	w, err := Open(path, Options{SyncEvery: 1})
+	require.NoError(t, err)
+	defer func() { _ = w.Close() }()
+
+	require.NoError(t, w.Append(testRecord{N: 1}))
+	require.NoError(t, w.Truncate())
+	assert.Equal(t, 0, w.Records())
+
+	require.NoError(t, w.Append(testRecord{N: 2}))
+	assert.Equal(t, []int{2}, replayAll(t, path))
+}
+
+func TestReplay_TornTailAndMissingFile(t *testing.T) {
+	dir := t.TempDir()
+	assert.Empty(t, replayAll(t, filepath.Join(dir, "missing.journal")))
+
+	path := filepath.Join(dir, "torn.journal")
+	require.NoError(t, os.WriteFile(path, []byte("{\"n\":1}\n{\"n\":2}\n{\"n\":"), 0o600))
+	assert.Equal(t, []int{1, 2}, replayAll(t, path))
+
+	offset, err := Replay(path, func(json.RawMessage) error { return nil })
+	require.NoError(t, err)
+	assert.Equal(t, int64(len("{\"n\":1}\n{\"n\":2}\n")), offset)
+
+	require.NoError(t, os.WriteFile(path, []byte("{\"n\":1}\ngarbage\n{\"n\":2}\n"), 0o600))
+	_, err = Replay(path, func(json.RawMessage) error { return nil })
+	assert.Error(t, err)
+}
+
+func TestOpen_TrimsTornTail(t *testing.T) {
+	path := filepath.Join(t.TempDir(), "torn.journal")
+	require.NoError(t, os.WriteFile(path, []byte("{\"n\":1}\n{\"n\":2}\n{\"n\":"), 0o600))
+
+	w, err := Open(path, Options{SyncEvery: 1})
+	require.NoError(t, err)
+	require.NoError(t, w.Append(testRecord{N: 3}))
+	require.NoError(t, w.Close())
+
+	assert.Equal(t, []int{1, 2, 3}, replayAll(t, path))
+
+	// A journal holding only a torn record reopens empty
+	require.NoError(t, os.WriteFile(path, []byte("{\"n\":"), 0o600))
+
+	w, err = Open(path, Options{SyncEvery: 1})
+	require.NoError(t, err)
+	require.NoError(t, w.Append(testRecord{N: 4}))
+	require.NoError(t, w.Close())
+
+	assert.Equal(t, []int{4}, replayAll(t, path))
+}
+
+func TestWriteSnapshot(t *testing.T) {
+	path := filepath.Join(t.TempDir(), "state.json")
+
+	require.NoError(t, WriteSnapshot(path, testRecord{N: 1}, 0o600))
+	require.NoError(t, WriteSnapshot(path, testRecord{N: 2}, 0o600))
+
+	data, err := os.ReadFile(path)
+	require.NoError(t, err)
+
+	var record testRecord
+	require.NoError(t, json.Unmarshal(data, &record))
+	assert.Equal(t, 2, record.N)
+
+	entries, err := os.ReadDir(filepath.Dir(path))
+	require.NoError(t, err)
+	assert.Len(t, entries, 1) // no temp files left behind
+}
@@ -10,7 +10,9 @@ import (
 	"os"
 	"os/exec"
 	"runtime"
+	"slices"
 	"strings"
+	"sync"
 	"time"
 )
 
@@ -23,13 +25,28 @@ const (
 // NetworkDetector handles automatic network environment detection.
 type NetworkDetector struct {
 	profiles []NetworkProfile
+	matcher  *profileMatcher
+
+	// subscribe and probe are replaced in tests
+	subscribe func(ctx context.Context) (<-chan networkChange, error)
+	probe     func(ctx context.Context, base *NetworkInfo, changes networkChange) *NetworkInfo
+
+	mu sync.Mutex
+	// info is kept current by Watch and nil while nothing watches
+	info *NetworkInfo
 }
 
-// NewNetworkDetector creates a new network detector.
+// NewNetworkDetector creates a new network detector. Profile conditions are
+// compiled once; conditions with invalid patterns never match.
 func NewNetworkDetector(profiles []NetworkProfile) *NetworkDetector {
-	return &NetworkDetector{
-		profiles: profiles,
+	nd := &NetworkDetector{
+		profiles:  profiles,
+		matcher:   newProfileMatcher(profiles),
+		subscribe: subscribeNetworkChanges,
 	}
+	nd.probe = nd.probeNetworkInfo
+
+	return nd
 }
 
 // DetectEnvironment automatically detects the current network environment.
@@ -46,38 +63,66 @@ func (nd *NetworkDetector) DetectEnvironment(ctx context.Context) (*NetworkProfi
 	return bestProfile, nil
 }
 
-// getCurrentNetworkInfo gathers current network environment information.
+// getCurrentNetworkInfo returns the network information kept by Watch, or
+// gathers it when nothing watches the network.
 func (nd *NetworkDetector) getCurrentNetworkInfo(ctx context.Context) (*NetworkInfo, error) {
-	info := &NetworkInfo{
-		Timestamp: time.Now(),
+	nd.mu.Lock()
+	cached := nd.info
+	nd.mu.Unlock()
+
+	if cached != nil {
+		return cached.clone(), nil
 	}
 
-	// Get WiFi SSID
-	if ssid, err := nd.getWiFiSSID(ctx); err == nil {
-		info.WiFiSSID = ssid
+	return nd.probe(ctx, nil, changeAll), nil
+}
+
+// probeNetworkInfo gathers the attributes affected by changes concurrently,
+// copying the others from base.
+func (nd *NetworkDetector) probeNetworkInfo(ctx context.Context, base *NetworkInfo, changes networkChange) *NetworkInfo {
+	info := &NetworkInfo{}
+	if base != nil {
+		info = base.clone()
 	}
 
-	// Get IP addresses
-	if ips, err := nd.getLocalIPs(); err == nil {
-		info.LocalIPs = ips
+	info.Timestamp = time.Now()
+
+	var wg sync.WaitGroup
+
+	run := func(change networkChange, fn func()) {
+		if changes&change == 0 {
+			return
+		}
+
+		wg.Add(1)
+
+		go func() {
+			defer wg.Done()
+			fn()
+		}()
 	}
 
-	// Get hostname
+	// Each probe writes only its own field; failed probes clear it
+	run(changeLink, func() {
+		info.WiFiSSID, _ = nd.getWiFiSSID(ctx)
+	})
+	run(changeAddr|changeLink, func() {
+		info.LocalIPs, _ = nd.getLocalIPs()
+	})
+	run(changeRoute|changeLink, func() {
+		info.DefaultGateway, _ = nd.getDefaultGateway(ctx)
+	})
+	run(changeDNS|changeLink, func() {
+		info.DNSServers, _ = nd.getDNSServers()
+	})
+
 	if hostname, err := os.Hostname(); err == nil {
 		info.Hostname = hostname
 	}
 
-	// Get default gateway
-	if gateway, err := nd.getDefaultGateway(ctx); err == nil {
-		info.DefaultGateway = gateway
-	}
-
-	// Get DNS servers
-	if dns, err := nd.getDNSServers(); err == nil {
-		info.DNSServers = dns
-	}
+	wg.Wait()
 
-	return info, nil
+	return info
 }
 
 // getWiFiSSID gets the current WiFi SSID.
@@ -290,82 +335,7 @@ func (nd *NetworkDetector) getDNSServersWindows() ([]string, error) {
 
 // findBestMatchingProfile finds the profile that best matches current conditions.
 func (nd *NetworkDetector) findBestMatchingProfile(networkInfo *NetworkInfo) *NetworkProfile {
-	var bestProfile *NetworkProfile
-	bestScore := 0
-
-	for _, profile := range nd.profiles {
-		score := nd.scoreProfile(&profile, networkInfo)
-		if score > bestScore {
-			bestScore = score
-			bestProfile = &profile
-		}
-	}
-
-	return bestProfile
-}
-
-// scoreProfile calculates how well a profile matches current network conditions.
-func (nd *NetworkDetector) scoreProfile(profile *NetworkProfile, networkInfo *NetworkInfo) int {
-	score := 0
-
-	for _, condition := range profile.Conditions {
-		switch condition.Type {
-		case "wifi_ssid":
-			if nd.matchCondition(condition, networkInfo.WiFiSSID) {
-				score += 100
-			}
-		case "ip_range":
-			for _, ip := range networkInfo.LocalIPs {
-				if nd.matchIPRange(condition.Value, ip) {
-					score += 50
-				}
-			}
-		case "hostname":
-			if nd.matchCondition(condition, networkInfo.Hostname) {
-				score += 30
-			}
-		case "gateway":
-			if nd.matchCondition(condition, networkInfo.DefaultGateway) {
-				score += 70
-			}
-		}
-	}
-
-	// Add priority bonus
-	score += profile.Priority
-
-	return score
-}
-
-// matchCondition checks if a condition matches a value.
-func (nd *NetworkDetector) matchCondition(condition NetworkCondition, value string) bool {
-	switch condition.Operator {
-	case "contains":
-		return strings.Contains(value, condition.Value)
-	case "matches":
-		// Could implement regex matching here
-		return value == condition.Value
-	case "equals", "":
-		return value == condition.Value
-	default:
-		return false
-	}
-}
-
-// matchIPRange checks if an IP address is within a specified range.
-func (nd *NetworkDetector) matchIPRange(cidr, ip string) bool {
-	_, network, err := net.ParseCIDR(cidr)
-	if err != nil {
-		// If not CIDR, try exact match
-		return cidr == ip
-	}
-
-	ipAddr := net.ParseIP(ip)
-	if ipAddr == nil {
-		return false
-	}
-
-	return network.Contains(ipAddr)
+	return nd.matcher.best(networkInfo)
 }
 
 // NetworkInfo contains current network environment information.
@@ -377,3 +347,21 @@ type NetworkInfo struct {
 	DNSServers     []string  `json:"dnsServers,omitempty"`
 	Timestamp      time.Time `json:"timestamp"`
 }
+
+func (i *NetworkInfo) clone() *NetworkInfo {
+	c := *i
+	c.LocalIPs = slices.Clone(i.LocalIPs)
+	c.DNSServers = slices.Clone(i.DNSServers)
+
+	return &c
+}
+
+// sameNetwork reports whether two snapshots describe the same network,
+// ignoring when they were taken.
+func (i *NetworkInfo) sameNetwork(other *NetworkInfo) bool {
+	return i.WiFiSSID == other.WiFiSSID &&
+		i.Hostname == other.Hostname &&
+		i.DefaultGateway == other.DefaultGateway &&
+		slices.Equal(i.LocalIPs, other.LocalIPs) &&
+		slices.Equal(i.DNSServers, other.DNSServers)
+}
@@ -0,0 +1,204 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package netenv
+
+import (
+	"context"
+	"sync"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func TestProfileMatcher_Best(t *testing.T) {
+	profiles := []NetworkProfile{
+		{
+			Name: "office",
+			Conditions: []NetworkCondition{
+				{Type: "wifi_ssid", Value: "^Corp-(5G|2G)$", Operator: "matches"},
+				{Type: "ip_range", Value: "10.20.0.0/16"},
+			},
+		},
+		{
+			Name: "home",
+			Conditions: []NetworkCondition{
+				{Type: "wifi_ssid", Value: "Home"},
+				{Type: "gateway", Value: "192.168.1.1"},
+			},
+		},
+		{
+			Name:     "fallback",
+			Priority: 10,
+			Conditions: []NetworkCondition{
+				{Type: "hostname", Value: "laptop", Operator: "contains"},
+				{Type: "wifi_ssid", Value: "([", Operator: "matches"},
+			},
+		},
+		{
+			Name:       "exact-ip",
+			Conditions: []NetworkCondition{{Type: "ip_range", Value: "172.16.5.9"}},
+		},
+	}
+
+	matcher := newProfileMatcher(profiles)
+
+	tests := []struct {
+		name     string
+		info     NetworkInfo
+		expected string
+	}{
+		{
+			name:     "regex ssid and cidr",
+			info:     NetworkInfo{WiFiSSID: "Corp-5G", LocalIPs: []string{"10.20.3.4", "fe80::1"}},
+			expected: "office",
+		},
+		{
+			name:     "regex does not match as equality",
+			info:     NetworkInfo{WiFiSSID: "^Corp-(5G|2G)$", Hostname: "my-laptop"},
+			expected: "fallback",
+		},
+		{
+			name:     "ssid and gateway",
+			info:     NetworkInfo{WiFiSSID: "Home", DefaultGateway: "192.168.1.1", Hostname: "my-laptop"},
+			expected: "home",
+		},
+		{
+			name:     "non-cidr range matches exactly",
+			info:     NetworkInfo{LocalIPs: []string{"172.16.5.9"}},
+			expected: "exact-ip",
+		},
+		{
+			name:     "priority alone scores",
+			info:     NetworkInfo{},
+			expected: "fallback",
+		},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			profile := matcher.best(&tt.info)
+			require.NotNil(t, profile)
+			assert.Equal(t, tt.expected, profile.Name)
+		})
+	}
+}
+
+func TestValidateProfile_InvalidPattern(t *testing.T) {
+	pm := NewProfileManager(t.TempDir())
+
+	err := pm.validateProfile(&NetworkProfile{
+		Name:       "broken",
+		Conditions: []NetworkCondition{{Type: "wifi_ssid", Value: "([", Operator: "matches"}},
+	})
+	assert.ErrorContains(t, err, "condition 0: invalid pattern")
+}
+
+// fakeNetwork serves network information set by the test and records the
+// changes each probe was asked for.
+type fakeNetwork struct {
+	mu      sync.Mutex
+	ssid    string
+	gateway string
+	probes  []networkChange
+	events  chan networkChange
+}
+
+func (f *fakeNetwork) set(ssid, gateway string) {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+
+	f.ssid, f.gateway = ssid, gateway
+}
+
+func (f *fakeNetwork) probe(_ context.Context, base *NetworkInfo, changes networkChange) *NetworkInfo {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+
+	f.probes = append(f.probes, changes)
+
+	info := &NetworkInfo{}
+	if base != nil {
+		info = base.clone()
+	}
+
+	if changes&changeLink != 0 {
+		info.WiFiSSID = f.ssid
+	}
+
+	if changes&changeRoute != 0 {
+		info.DefaultGateway = f.gateway
+	}
+
+	return info
+}
+
+func newWatchedDetector(t *testing.T, profiles []NetworkProfile) (*NetworkDetector, *fakeNetwork) {
+	t.Helper()
+
+	network := &fakeNetwork{ssid: "Home", events: make(chan networkChange, 8)}
+	detector := NewNetworkDetector(profiles)
+	detector.probe = network.probe
+	detector.subscribe = func(context.Context) (<-chan networkChange, error) {
+		return network.events, nil
+	}
+
+	return detector, network
+}
+
+func TestNetworkDetector_Watch(t *testing.T) {
+	profiles := []NetworkProfile{
+		{Name: "home", Conditions: []NetworkCondition{{Type: "wifi_ssid", Value: "Home"}}},
+		{Name: "office", Conditions: []NetworkCondition{{Type: "gateway", Value: "10.0.0.1"}}},
+	}
+
+	ctx, cancel := context.WithCancel(context.Background())
+	defer cancel()
+
+	detector, network := newWatchedDetector(t, profiles)
+	changes := detector.Watch(ctx)
+
+	initial := <-changes
+	require.NotNil(t, initial.Profile)
+	assert.Equal(t, "home", initial.Profile.Name)
+
+	// Detection is answered from the watched state
+	profile, err := detector.DetectEnvironment(ctx)
+	require.NoError(t, err)
+	assert.Equal(t, "home", profile.Name)
+
+	// A burst of notifications is probed once, for the attributes concerned
+	network.set("", "10.0.0.1")
+	network.events <- changeRoute
+	network.events <- changeLink
+
+	select {
+	case change := <-changes:
+		require.NotNil(t, change.Profile)
+		assert.Equal(t, "office", change.Profile.Name)
+	case <-time.After(5 * time.Second):
+		t.Fatal("no change reported")
+	}
+
+	network.mu.Lock()
+	assert.Equal(t, []networkChange{changeAll, changeRoute | changeLink}, network.probes)
+	network.mu.Unlock()
+
+	// Notifications that do not change the network are not reported
+	network.events <- changeAddr
+
+	select {
+	case change := <-changes:
+		t.Fatalf("unexpected change: %+v", change.Info)
+	case <-time.After(2 * watchDebounce):
+	}
+
+	cancel()
+
+	for range changes {
+	}
+
+	detector.mu.Lock()
+	assert.Nil(t, detector.info, "detection probes again once the watch ends")
+	detector.mu.Unlock()
+}
@@ -0,0 +1,262 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package netenv
+
+import (
+	"context"
+	"errors"
+	"fmt"
+	"net"
+	"path/filepath"
+	"strings"
+	"time"
+
+	"github.com/fsnotify/fsnotify"
+)
+
+// networkChange is a set of network attributes that may have changed.
+type networkChange uint8
+
+const (
+	changeLink  networkChange = 1 << iota // interface state or wireless association
+	changeAddr                            // interface addresses
+	changeRoute                           // routing table, and so the default gateway
+	changeDNS                             // resolver configuration
+
+	changeAll = changeLink | changeAddr | changeRoute | changeDNS
+)
+
+const (
+	// watchDebounce coalesces the burst of notifications a network switch
+	// produces into one probe.
+	watchDebounce = 300 * time.Millisecond
+	// watchPollInterval is how often interfaces are compared on platforms
+	// without network change notifications.
+	watchPollInterval = 5 * time.Second
+)
+
+// resolvConfPath is where Unix systems keep the resolver configuration.
+const resolvConfPath = "/etc/resolv.conf"
+
+// errNetworkWatchUnsupported is returned by subscribeNetworkChanges on
+// platforms without network change notifications.
+var errNetworkWatchUnsupported = errors.New("network change notifications are not supported on this platform")
+
+// NetworkChange is sent by Watch when the network environment changed.
+type NetworkChange struct {
+	Info *NetworkInfo
+	// Profile is the best matching profile, nil if none matches.
+	Profile *NetworkProfile
+}
+
+// Watch keeps the detector's network information current until ctx ends, so
+// that DetectEnvironment answers without probing. It subscribes to the OS
+// network change notifications (netlink on Linux, the routing socket on
+// macOS and BSDs), falling back to comparing interfaces periodically, and
+// re-probes only the attributes a notification concerns.
+//
+// The returned channel receives the initial state and then every change of
+// network; a slow receiver only sees the latest one. It is closed when ctx
+// ends. Only one Watch should run per detector at a time.
+func (nd *NetworkDetector) Watch(ctx context.Context) <-chan NetworkChange {
+	events, err := nd.subscribe(ctx)
+	if err != nil {
+		events = pollNetworkChanges(ctx, watchPollInterval)
+	}
+
+	dnsEvents := watchResolvConf(ctx)
+
+	info := nd.probe(ctx, nil, changeAll)
+	nd.setInfo(info)
+
+	out := make(chan NetworkChange, 1)
+	nd.publish(out, info)
+
+	go func() {
+		defer close(out)
+		defer nd.setInfo(nil)
+
+		var (
+			pending networkChange
+			timer   <-chan time.Time
+		)
+
+		for {
+			select {
+			case <-ctx.Done():
+				return
+			case change, ok := <-events:
+				if !ok {
+					// The subscription failed; keep watching by polling
+					events = pollNetworkChanges(ctx, watchPollInterval)
+					change = changeAll
+				}
+
+				pending |= change
+			case <-dnsEvents:
+				pending |= changeDNS
+			case <-timer:
+				timer = nil
+
+				next := nd.probe(ctx, info, pending)
+				pending = 0
+
+				if ctx.Err() != nil {
+					return
+				}
+
+				nd.setInfo(next)
+
+				if !next.sameNetwork(info) {
+					nd.publish(out, next)
+				}
+
+				info = next
+
+				continue
+			}
+
+			if timer == nil {
+				timer = time.After(watchDebounce)
+			}
+		}
+	}()
+
+	return out
+}
+
+func (nd *NetworkDetector) setInfo(info *NetworkInfo) {
+	nd.mu.Lock()
+	nd.info = info
+	nd.mu.Unlock()
+}
+
+// publish sends the change for info to out, replacing a change the receiver
+// has not taken yet. Watch is the only sender, so the send cannot block.
+func (nd *NetworkDetector) publish(out chan NetworkChange, info *NetworkInfo) {
+	change := NetworkChange{Info: info.clone(), Profile: nd.findBestMatchingProfile(info)}
+
+	select {
+	case out <- change:
+	default:
+		select {
+		case <-out:
+		default:
+		}
+
+		out <- change
+	}
+}
+
+// pollNetworkChanges reports a change whenever the interfaces or their
+// addresses differ from the previous poll. It does not fork any process.
+func pollNetworkChanges(ctx context.Context, interval time.Duration) <-chan networkChange {
+	events := make(chan networkChange, 1)
+
+	go func() {
+		ticker := time.NewTicker(interval)
+		defer ticker.Stop()
+
+		last := interfaceSnapshot()
+
+		for {
+			select {
+			case <-ctx.Done():
+				return
+			case <-ticker.C:
+			}
+
+			if current := interfaceSnapshot(); current != last {
+				last = current
+
+				select {
+				case events <- changeAll:
+				default: // a change is already pending
+				}
+			}
+		}
+	}()
+
+	return events
+}
+
+// interfaceSnapshot describes the state and addresses of every interface.
+func interfaceSnapshot() string {
+	interfaces, err := net.Interfaces()
+	if err != nil {
+		return ""
+	}
+
+	var b strings.Builder
+
+	for _, iface := range interfaces {
+		fmt.Fprintf(&b, "%s:%v", iface.Name, iface.Flags)
+
+		if addrs, err := iface.Addrs(); err == nil {
+			for _, addr := range addrs {
+				b.WriteString("," + addr.String())
+			}
+		}
+
+		b.WriteString(";")
+	}
+
+	return b.String()
+}
+
+// watchResolvConf reports changes to the resolver configuration, following
+// a symlinked resolv.conf (as managed by systemd-resolved) to its target.
+// It returns a nil channel, which never fires, where there is none to watch.
+func watchResolvConf(ctx context.Context) <-chan struct{} {
+	target, err := filepath.EvalSymlinks(resolvConfPath)
+	if err != nil {
+		return nil
+	}
+
+	watcher, err := fsnotify.NewWatcher()
+	if err != nil {
+		return nil
+	}
+
+	// Directories are watched as the file is usually replaced, not written
+	names := map[string]bool{resolvConfPath: true, target: true}
+	for name := range names {
+		if err := watcher.Add(filepath.Dir(name)); err != nil {
+			_ = watcher.Close()
+			return nil
+		}
+	}
+
+	events := make(chan struct{}, 1)
+
+	go func() {
+		defer watcher.Close()
+
+		for {
+			select {
+			case <-ctx.Done():
+				return
+			case event, ok := <-watcher.Events:
+				if !ok {
+					return
+				}
+
+				if !names[event.Name] {
+					continue
+				}
+
+				select {
+				case events <- struct{}{}:
+				default: // a change is already pending
+				}
+			case _, ok := <-watcher.Errors:
+				if !ok {
+					return
+				}
+			}
+		}
+	}()
+
+	return events
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+//go:build darwin || dragonfly || freebsd || netbsd || openbsd
+
+package netenv
+
+import (
+	"context"
+	"encoding/binary"
+	"fmt"
+	"os"
+	"syscall"
+)
+
+// subscribeNetworkChanges listens for interface, address and route changes
+// on a routing socket, which is what SCNetworkReachability is built on.
+func subscribeNetworkChanges(ctx context.Context) (<-chan networkChange, error) {
+	fd, err := syscall.Socket(syscall.AF_ROUTE, syscall.SOCK_RAW, syscall.AF_UNSPEC)
+	if err != nil {
+		return nil, fmt.Errorf("failed to open routing socket: %w", err)
+	}
+
+	syscall.CloseOnExec(fd)
+
+	if err := syscall.SetNonblock(fd, true); err != nil {
+		_ = syscall.Close(fd)
+		return nil, fmt.Errorf("failed to open routing socket: %w", err)
+	}
+
+	// A non-blocking descriptor is served by the runtime poller, so closing
+	// the file interrupts a pending read
+	socket := os.NewFile(uintptr(fd), "route")
+
+	go func() {
+		<-ctx.Done()
+		_ = socket.Close()
+	}()
+
+	return readNetworkChanges(ctx, socket.Read, parseRoutingMessages, func(error) bool { return false }), nil
+}
+
+// parseRoutingMessages classifies the routing messages in buf. Every message
+// starts with its length (u_short) followed by the version and type bytes.
+func parseRoutingMessages(buf []byte) networkChange {
+	var change networkChange
+
+	for len(buf) >= 4 {
+		length := int(binary.NativeEndian.Uint16(buf))
+		if length < 4 || length > len(buf) {
+			return changeAll
+		}
+
+		switch buf[3] {
+		case syscall.RTM_IFINFO:
+			change |= changeLink
+		case syscall.RTM_NEWADDR, syscall.RTM_DELADDR:
+			change |= changeAddr
+		case syscall.RTM_ADD, syscall.RTM_DELETE, syscall.RTM_CHANGE:
+			change |= changeRoute
+		}
+
+		buf = buf[length:]
+	}
+
+	return change
+}
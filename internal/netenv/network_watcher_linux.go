@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+//go:build linux
+
+package netenv
+
+import (
+	"context"
+	"errors"
+	"fmt"
+	"os"
+	"syscall"
+)
+
+// Netlink route multicast groups, from linux/rtnetlink.h.
+const (
+	rtmgrpLink       = 0x1
+	rtmgrpIPv4IfAddr = 0x10
+	rtmgrpIPv4Route  = 0x40
+	rtmgrpIPv6IfAddr = 0x100
+	rtmgrpIPv6Route  = 0x400
+)
+
+// subscribeNetworkChanges listens for link, address and route changes on a
+// netlink route socket.
+func subscribeNetworkChanges(ctx context.Context) (<-chan networkChange, error) {
+	fd, err := syscall.Socket(syscall.AF_NETLINK, syscall.SOCK_RAW|syscall.SOCK_CLOEXEC|syscall.SOCK_NONBLOCK, syscall.NETLINK_ROUTE)
+	if err != nil {
+		return nil, fmt.Errorf("failed to open netlink socket: %w", err)
+	}
+
+	groups := uint32(rtmgrpLink | rtmgrpIPv4IfAddr | rtmgrpIPv6IfAddr | rtmgrpIPv4Route | rtmgrpIPv6Route)
+
+	if err := syscall.Bind(fd, &syscall.SockaddrNetlink{Family: syscall.AF_NETLINK, Groups: groups}); err != nil {
+		_ = syscall.Close(fd)
+		return nil, fmt.Errorf("failed to subscribe to netlink: %w", err)
+	}
+
+	// A non-blocking descriptor is served by the runtime poller, so closing
+	// the file interrupts a pending read
+	socket := os.NewFile(uintptr(fd), "netlink-route")
+
+	go func() {
+		<-ctx.Done()
+		_ = socket.Close()
+	}()
+
+	return readNetworkChanges(ctx, socket.Read, func(buf []byte) networkChange {
+		messages, err := syscall.ParseNetlinkMessage(buf)
+		if err != nil {
+			return changeAll
+		}
+
+		var change networkChange
+
+		for _, message := range messages {
+			switch message.Header.Type {
+			case syscall.RTM_NEWLINK, syscall.RTM_DELLINK:
+				change |= changeLink
+			case syscall.RTM_NEWADDR, syscall.RTM_DELADDR:
+				change |= changeAddr
+			case syscall.RTM_NEWROUTE, syscall.RTM_DELROUTE:
+				change |= changeRoute
+			}
+		}
+
+		return change
+	}, func(err error) bool {
+		// The kernel drops notifications when the socket buffer overflows
+		return errors.Is(err, syscall.ENOBUFS)
+	}), nil
+}
@@ -0,0 +1,14 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+//go:build !linux && !darwin && !dragonfly && !freebsd && !netbsd && !openbsd
+
+package netenv
+
+import "context"
+
+// subscribeNetworkChanges is not implemented on this platform, where Watch
+// polls the interfaces instead.
+func subscribeNetworkChanges(context.Context) (<-chan networkChange, error) {
+	return nil, errNetworkWatchUnsupported
+}
@@ -0,0 +1,49 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+//go:build linux || darwin || dragonfly || freebsd || netbsd || openbsd
+
+package netenv
+
+import "context"
+
+// readNetworkChanges reads notification batches from a socket until it
+// fails, classifying each with parse. Errors for which overflow reports true
+// mean notifications were lost and are reported as changeAll. The channel is
+// closed when reading stops.
+func readNetworkChanges(ctx context.Context, read func([]byte) (int, error), parse func([]byte) networkChange, overflow func(error) bool) <-chan networkChange {
+	events := make(chan networkChange, 16)
+
+	go func() {
+		defer close(events)
+
+		buf := make([]byte, 64*1024)
+
+		for {
+			n, err := read(buf)
+
+			var change networkChange
+
+			switch {
+			case err == nil:
+				change = parse(buf[:n])
+			case overflow(err):
+				change = changeAll
+			default:
+				return
+			}
+
+			if change == 0 {
+				continue
+			}
+
+			select {
+			case events <- change:
+			case <-ctx.Done():
+				return
+			}
+		}
+	}()
+
+	return events
+}
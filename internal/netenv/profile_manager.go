@@ -332,6 +332,11 @@ func (pm *ProfileManager) validateProfile(profile *NetworkProfile) error {
 		if condition.Value == "" {
 			return fmt.Errorf("condition %d: value is required", i)
 		}
+		if condition.Operator == "matches" {
+			if _, err := compileCondition(condition); err != nil {
+				return fmt.Errorf("condition %d: %w", i, err)
+			}
+		}
 	}
 
 	return nil
@@ -0,0 +1,181 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package netenv
+
+import (
+	"fmt"
+	"net/netip"
+	"regexp"
+	"strings"
+)
+
+// Condition scores added when a condition holds.
+const (
+	scoreWiFiSSID = 100
+	scoreGateway  = 70
+	scoreIPRange  = 50 // per matching local address
+	scoreHostname = 30
+)
+
+// profileMatcher scores network information against profiles whose
+// conditions were parsed once: IP ranges into prefixes and "matches"
+// operators into regular expressions.
+type profileMatcher struct {
+	profiles []compiledProfile
+}
+
+type compiledProfile struct {
+	profile    *NetworkProfile
+	conditions []compiledCondition
+}
+
+// compiledCondition is a NetworkCondition ready to be evaluated. A condition
+// that failed to compile never matches.
+type compiledCondition struct {
+	kind     string
+	operator string
+	value    string
+	pattern  *regexp.Regexp
+	// prefix holds ip_range values; ranges that are not CIDRs match an
+	// address of the same text exactly.
+	prefix netip.Prefix
+	valid  bool
+}
+
+// newProfileMatcher compiles the conditions of profiles.
+func newProfileMatcher(profiles []NetworkProfile) *profileMatcher {
+	m := &profileMatcher{profiles: make([]compiledProfile, len(profiles))}
+
+	for i := range profiles {
+		compiled := compiledProfile{
+			profile:    &profiles[i],
+			conditions: make([]compiledCondition, len(profiles[i].Conditions)),
+		}
+
+		for j, condition := range profiles[i].Conditions {
+			compiled.conditions[j], _ = compileCondition(condition)
+		}
+
+		m.profiles[i] = compiled
+	}
+
+	return m
+}
+
+// compileCondition parses a condition's value for its type and operator.
+func compileCondition(condition NetworkCondition) (compiledCondition, error) {
+	c := compiledCondition{
+		kind:     condition.Type,
+		operator: condition.Operator,
+		value:    condition.Value,
+	}
+
+	if c.kind == "ip_range" {
+		if prefix, err := netip.ParsePrefix(c.value); err == nil {
+			c.prefix = prefix.Masked()
+		}
+
+		c.valid = true
+
+		return c, nil
+	}
+
+	switch c.operator {
+	case "equals", "", "contains":
+	case "matches":
+		pattern, err := regexp.Compile(c.value)
+		if err != nil {
+			return c, fmt.Errorf("invalid pattern %q: %w", c.value, err)
+		}
+
+		c.pattern = pattern
+	default:
+		return c, fmt.Errorf("unknown operator %q", c.operator)
+	}
+
+	c.valid = true
+
+	return c, nil
+}
+
+// best returns the profile with the highest positive score, preferring the
+// first of equally scored profiles, or nil if none scores.
+func (m *profileMatcher) best(info *NetworkInfo) *NetworkProfile {
+	addrs := make([]netip.Addr, 0, len(info.LocalIPs))
+	for _, ip := range info.LocalIPs {
+		if addr, err := netip.ParseAddr(ip); err == nil {
+			addrs = append(addrs, addr)
+		}
+	}
+
+	var bestProfile *NetworkProfile
+
+	bestScore := 0
+
+	for i := range m.profiles {
+		if score := m.profiles[i].score(info, addrs); score > bestScore {
+			bestScore = score
+			bestProfile = m.profiles[i].profile
+		}
+	}
+
+	return bestProfile
+}
+
+// score calculates how well the profile matches current network conditions.
+func (p *compiledProfile) score(info *NetworkInfo, addrs []netip.Addr) int {
+	score := 0
+
+	for i := range p.conditions {
+		c := &p.conditions[i]
+		if !c.valid {
+			continue
+		}
+
+		switch c.kind {
+		case "wifi_ssid":
+			if c.match(info.WiFiSSID) {
+				score += scoreWiFiSSID
+			}
+		case "ip_range":
+			for _, addr := range addrs {
+				if c.matchAddr(addr) {
+					score += scoreIPRange
+				}
+			}
+		case "hostname":
+			if c.match(info.Hostname) {
+				score += scoreHostname
+			}
+		case "gateway":
+			if c.match(info.DefaultGateway) {
+				score += scoreGateway
+			}
+		}
+	}
+
+	// Add priority bonus
+	return score + p.profile.Priority
+}
+
+// match checks the condition against a value with its operator.
+func (c *compiledCondition) match(value string) bool {
+	switch c.operator {
+	case "contains":
+		return strings.Contains(value, c.value)
+	case "matches":
+		return c.pattern.MatchString(value)
+	default:
+		return value == c.value
+	}
+}
+
+// matchAddr checks whether addr is within the condition's IP range.
+func (c *compiledCondition) matchAddr(addr netip.Addr) bool {
+	if c.prefix.IsValid() {
+		return c.prefix.Contains(addr.Unmap())
+	}
+
+	return addr.String() == c.value
+}
@@ -180,7 +180,7 @@ func (a *AsdfBootstrapper) installViaBrew(ctx context.Context) error {
 	cmd.Stdout = os.Stdout
 	cmd.Stderr = os.Stderr
 
-	if err := cmd.Run(); err != nil {
+	if err := runBrew(cmd); err != nil {
 		return fmt.Errorf("failed to install asdf via brew: %w", err)
 	}
 
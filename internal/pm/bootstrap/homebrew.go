@@ -10,10 +10,24 @@ import (
 	"os/exec"
 	"runtime"
 	"strings"
+	"sync"
 
 	"github.com/gizzahub/gzh-cli/internal/logger"
 )
 
+// brewMu serializes brew commands. Managers installed through Homebrew run in
+// parallel once it is ready, but concurrent brew invocations contend for its
+// locks and each may trigger an auto-update.
+var brewMu sync.Mutex
+
+// runBrew runs a brew command once no other brew command of this process is running.
+func runBrew(cmd *exec.Cmd) error {
+	brewMu.Lock()
+	defer brewMu.Unlock()
+
+	return cmd.Run()
+}
+
 // HomebrewBootstrapper handles Homebrew installation and configuration.
 type HomebrewBootstrapper struct {
 	logger logger.CommonLogger
@@ -133,7 +147,7 @@ func (h *HomebrewBootstrapper) Configure(ctx context.Context) error {
 	// Update Homebrew
 	h.logger.Info("Updating Homebrew")
 	cmd := exec.CommandContext(ctx, "brew", "update")
-	if err := cmd.Run(); err != nil {
+	if err := runBrew(cmd); err != nil {
 		h.logger.Warn("Failed to update Homebrew", "error", err)
 		// Don't fail configuration for update issues
 	}
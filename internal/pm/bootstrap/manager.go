@@ -12,6 +12,7 @@ import (
 	"time"
 
 	"github.com/gizzahub/gzh-cli/internal/logger"
+	"github.com/gizzahub/gzh-cli/internal/pm/dag"
 )
 
 // BootstrapManager manages the installation and configuration of package managers.
@@ -101,7 +102,10 @@ func (bm *BootstrapManager) CheckAll(ctx context.Context) (*BootstrapReport, err
 	return report, nil
 }
 
-// InstallManagers installs the specified package managers.
+// InstallManagers installs the specified package managers, each after the
+// managers it depends on, and independent ones in parallel. opts.Timeout
+// bounds the installation of each manager; managers whose dependency failed
+// are not installed.
 func (bm *BootstrapManager) InstallManagers(ctx context.Context, managerNames []string, opts BootstrapOptions) (*BootstrapReport, error) {
 	startTime := time.Now()
 
@@ -133,23 +137,61 @@ func (bm *BootstrapManager) InstallManagers(ctx context.Context, managerNames []
 		Managers:  make([]BootstrapStatus, 0),
 	}
 
-	// Install each manager in dependency order
-	for _, managerName := range installOrder {
+	// Install each manager once its dependencies are, independent ones in parallel
+	statuses := make([]*BootstrapStatus, len(installOrder))
+	tasks := make([]dag.Task, 0, len(installOrder))
+	taskIndex := make([]int, 0, len(installOrder))
+
+	for i, managerName := range installOrder {
 		bootstrapper, exists := bm.bootstrappers[managerName]
 		if !exists {
 			bm.logger.Warn("Unknown manager requested", "name", managerName)
 			continue
 		}
 
-		bm.logger.Info("Installing manager", "name", managerName)
+		tasks = append(tasks, dag.Task{
+			Name:      managerName,
+			DependsOn: bm.resolver.GetDependencies(managerName),
+			Run: func(ctx context.Context) error {
+				bm.logger.Info("Installing manager", "name", managerName)
 
-		status, err := bm.installSingleManager(ctx, bootstrapper, opts)
-		if err != nil {
-			bm.logger.Error("Failed to install manager", "name", managerName, "error", err)
-			status.Issues = append(status.Issues, fmt.Sprintf("Installation failed: %v", err))
+				status, err := bm.installSingleManager(ctx, bootstrapper, opts)
+				if status == nil {
+					status = &BootstrapStatus{Manager: managerName}
+				}
+
+				if err != nil {
+					bm.logger.Error("Failed to install manager", "name", managerName, "error", err)
+					status.Issues = append(status.Issues, fmt.Sprintf("Installation failed: %v", err))
+				}
+
+				statuses[i] = status
+
+				return err
+			},
+		})
+		taskIndex = append(taskIndex, i)
+	}
+
+	results, err := dag.Run(ctx, tasks, dag.Options{MaxParallel: opts.MaxParallel, Timeout: opts.Timeout.Duration})
+	if err != nil {
+		return nil, fmt.Errorf("failed to schedule installation: %w", err)
+	}
+
+	for j, result := range results {
+		if result.Skipped {
+			bm.logger.Warn("Skipped manager", "name", result.Name, "reason", result.Err)
+			statuses[taskIndex[j]] = &BootstrapStatus{
+				Manager: result.Name,
+				Issues:  []string{fmt.Sprintf("Installation skipped: %v", result.Err)},
+			}
 		}
+	}
 
-		report.Managers = append(report.Managers, *status)
+	for _, status := range statuses {
+		if status != nil {
+			report.Managers = append(report.Managers, *status)
+		}
 	}
 
 	// Calculate final summary
@@ -5,6 +5,7 @@ package bootstrap
 
 import (
 	"context"
+	"errors"
 	"testing"
 	"time"
 
@@ -147,6 +148,38 @@ func TestBootstrapManager_InstallManagers(t *testing.T) {
 	assert.True(t, asdfStatus.Installed)
 }
 
+func TestBootstrapManager_InstallManagers_FailedDependency(t *testing.T) {
+	logger := logger.NewSimpleLogger("test")
+	manager := &BootstrapManager{
+		bootstrappers: make(map[string]PackageManagerBootstrapper),
+		logger:        logger,
+		resolver:      NewDependencyResolver(),
+	}
+
+	brewMock := &mockBootstrapper{name: "brew", isSupported: true, installError: errors.New("network unreachable")}
+	asdfMock := &mockBootstrapper{name: "asdf", isSupported: true, dependencies: []string{"brew"}}
+	nvmMock := &mockBootstrapper{name: "nvm", isSupported: true}
+
+	for _, mock := range []*mockBootstrapper{brewMock, asdfMock, nvmMock} {
+		manager.bootstrappers[mock.name] = mock
+	}
+
+	manager.resolver.AddDependency("asdf", []string{"brew"})
+
+	report, err := manager.InstallManagers(context.Background(), []string{"asdf", "brew", "nvm"}, BootstrapOptions{MaxParallel: 2})
+	require.NoError(t, err)
+	require.Len(t, report.Managers, 3)
+
+	// Reported in installation order
+	assert.Equal(t, "brew", report.Managers[0].Manager)
+	assert.Contains(t, report.Managers[0].Issues[0], "network unreachable")
+	assert.Equal(t, "asdf", report.Managers[1].Manager)
+	assert.False(t, asdfMock.isInstalled)
+	assert.Equal(t, []string{"Installation skipped: dependency failed: brew"}, report.Managers[1].Issues)
+	assert.True(t, nvmMock.isInstalled)
+	assert.Equal(t, 2, report.Summary.Failed)
+}
+
 func TestBootstrapManager_GetInstallationOrder(t *testing.T) {
 	logger := logger.NewSimpleLogger("test")
 	manager := &BootstrapManager{
@@ -68,12 +68,13 @@ type PackageManagerBootstrapper interface {
 
 // BootstrapOptions configures bootstrap behavior.
 type BootstrapOptions struct {
-	Managers          []string `json:"managers,omitempty"` // Specific managers to process (empty = all)
-	Force             bool     `json:"force"`              // Force reinstall even if already installed
-	SkipConfiguration bool     `json:"skipConfiguration"`  // Skip post-install configuration
-	DryRun            bool     `json:"dryRun"`             // Only simulate, don't actually install
-	Timeout           Duration `json:"timeout"`            // Timeout for installation operations
-	Verbose           bool     `json:"verbose"`            // Enable verbose output
+	Managers          []string `json:"managers,omitempty"`    // Specific managers to process (empty = all)
+	Force             bool     `json:"force"`                 // Force reinstall even if already installed
+	SkipConfiguration bool     `json:"skipConfiguration"`     // Skip post-install configuration
+	DryRun            bool     `json:"dryRun"`                // Only simulate, don't actually install
+	Timeout           Duration `json:"timeout"`               // Timeout for installation operations
+	Verbose           bool     `json:"verbose"`               // Enable verbose output
+	MaxParallel       int      `json:"maxParallel,omitempty"` // Managers installed at once (0 = default)
 }
 
 // Duration is a wrapper for time.Duration to support JSON marshaling.
@@ -163,7 +163,7 @@ func (r *RbenvBootstrapper) Install(ctx context.Context, _ bool) error {
 		cmd := exec.CommandContext(ctx, "brew", "install", "rbenv")
 		cmd.Stdout = os.Stdout
 		cmd.Stderr = os.Stderr
-		return cmd.Run()
+		return runBrew(cmd)
 	case linuxPlatform:
 		// Install via Git
 		rbenvDir := filepath.Join(os.Getenv("HOME"), ".rbenv")
@@ -263,7 +263,7 @@ func (p *PyenvBootstrapper) Install(ctx context.Context, _ bool) error {
 		cmd := exec.CommandContext(ctx, "brew", "install", "pyenv")
 		cmd.Stdout = os.Stdout
 		cmd.Stderr = os.Stderr
-		return cmd.Run()
+		return runBrew(cmd)
 	case linuxPlatform:
 		script := `curl https://pyenv.run | bash`
 		cmd := exec.CommandContext(ctx, "bash", "-c", script)
@@ -0,0 +1,203 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+// Package dag runs package manager operations in dependency order, running
+// operations that do not depend on each other in parallel.
+package dag
+
+import (
+	"context"
+	"errors"
+	"fmt"
+	"sort"
+	"strings"
+	"time"
+)
+
+// DefaultMaxParallel is the number of tasks run at once when Options does not
+// set one. Package manager operations mostly wait on downloads, but some
+// build from source, so the cap is kept modest.
+const DefaultMaxParallel = 4
+
+// ErrDependencyFailed is wrapped by the error of a task that was not run
+// because a task it depends on failed.
+var ErrDependencyFailed = errors.New("dependency failed")
+
+// Task is an operation on one package manager.
+type Task struct {
+	Name string
+	// DependsOn names the tasks that must succeed before this one starts.
+	// Names that are not part of the run are ignored.
+	DependsOn []string
+	Run       func(ctx context.Context) error
+}
+
+// Options configures a run.
+type Options struct {
+	// MaxParallel caps the number of tasks running at once, DefaultMaxParallel
+	// if not positive.
+	MaxParallel int
+	// Timeout bounds each task, none if zero.
+	Timeout time.Duration
+}
+
+// Result is the outcome of a task.
+type Result struct {
+	Name string
+	Err  error
+	// Skipped is set when the task was not run, because a dependency failed
+	// or the run was canceled.
+	Skipped bool
+	// Wait is the time from the start of the run until the task started,
+	// spent on dependencies and waiting for a free slot.
+	Wait     time.Duration
+	Duration time.Duration
+}
+
+// Run executes tasks, each once all the tasks it depends on succeeded, with at
+// most opts.MaxParallel at a time. It returns a result per task in the order
+// of tasks. The error is only set when the tasks cannot be scheduled, for
+// names that are not unique or circular dependencies; failures of tasks are
+// reported in their results.
+func Run(ctx context.Context, tasks []Task, opts Options) ([]Result, error) {
+	index := make(map[string]int, len(tasks))
+	for i, task := range tasks {
+		if _, exists := index[task.Name]; exists {
+			return nil, fmt.Errorf("duplicate task: %s", task.Name)
+		}
+
+		index[task.Name] = i
+	}
+
+	deps := make([][]int, len(tasks))
+	for i, task := range tasks {
+		for _, name := range task.DependsOn {
+			if j, exists := index[name]; exists && j != i {
+				deps[i] = append(deps[i], j)
+			}
+		}
+	}
+
+	if err := checkCycles(tasks, deps); err != nil {
+		return nil, err
+	}
+
+	maxParallel := opts.MaxParallel
+	if maxParallel <= 0 {
+		maxParallel = DefaultMaxParallel
+	}
+
+	var (
+		start   = time.Now()
+		results = make([]Result, len(tasks))
+		done    = make([]chan struct{}, len(tasks))
+		slots   = make(chan struct{}, maxParallel)
+	)
+
+	for i := range done {
+		done[i] = make(chan struct{})
+	}
+
+	// Every task waits on its own goroutine; a task's result is written
+	// before its done channel is closed, so dependents may read it after.
+	for i := range tasks {
+		go func(i int) {
+			defer close(done[i])
+
+			result := &results[i]
+			result.Name = tasks[i].Name
+
+			for _, j := range deps[i] {
+				<-done[j]
+
+				if results[j].Err != nil {
+					result.Skipped = true
+					result.Err = fmt.Errorf("%w: %s", ErrDependencyFailed, tasks[j].Name)
+
+					return
+				}
+			}
+
+			select {
+			case slots <- struct{}{}:
+			case <-ctx.Done():
+				result.Skipped = true
+				result.Err = ctx.Err()
+
+				return
+			}
+			defer func() { <-slots }()
+
+			result.Wait = time.Since(start)
+			result.Err = runTask(ctx, tasks[i], opts.Timeout)
+			result.Duration = time.Since(start) - result.Wait
+		}(i)
+	}
+
+	for i := range done {
+		<-done[i]
+	}
+
+	return results, nil
+}
+
+func runTask(ctx context.Context, task Task, timeout time.Duration) error {
+	if timeout > 0 {
+		var cancel context.CancelFunc
+
+		ctx, cancel = context.WithTimeout(ctx, timeout)
+		defer cancel()
+	}
+
+	return task.Run(ctx)
+}
+
+// checkCycles reports the tasks on or behind a dependency cycle, found with
+// Kahn's algorithm.
+func checkCycles(tasks []Task, deps [][]int) error {
+	remaining := make([]int, len(tasks))
+	dependents := make([][]int, len(tasks))
+
+	for i := range deps {
+		remaining[i] = len(deps[i])
+		for _, j := range deps[i] {
+			dependents[j] = append(dependents[j], i)
+		}
+	}
+
+	queue := make([]int, 0, len(tasks))
+
+	for i := range remaining {
+		if remaining[i] == 0 {
+			queue = append(queue, i)
+		}
+	}
+
+	for len(queue) > 0 {
+		current := queue[0]
+		queue = queue[1:]
+
+		for _, i := range dependents[current] {
+			remaining[i]--
+			if remaining[i] == 0 {
+				queue = append(queue, i)
+			}
+		}
+	}
+
+	var blocked []string
+
+	for i := range remaining {
+		if remaining[i] > 0 {
+			blocked = append(blocked, tasks[i].Name)
+		}
+	}
+
+	if len(blocked) == 0 {
+		return nil
+	}
+
+	sort.Strings(blocked)
+
+	return fmt.Errorf("circular dependency detected among: %s", strings.Join(blocked, ", "))
+}
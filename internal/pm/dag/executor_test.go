@@ -0,0 +1,128 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package dag
+
+import (
+	"context"
+	"errors"
+	"sync"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+// recorder records the order in which tasks ran and how many ran at once.
+type recorder struct {
+	mu      sync.Mutex
+	order   []string
+	running atomic.Int32
+	peak    atomic.Int32
+}
+
+func (r *recorder) task(name string, err error, deps ...string) Task {
+	return Task{
+		Name:      name,
+		DependsOn: deps,
+		Run: func(context.Context) error {
+			n := r.running.Add(1)
+			for peak := r.peak.Load(); n > peak && !r.peak.CompareAndSwap(peak, n); peak = r.peak.Load() {
+			}
+			defer r.running.Add(-1)
+
+			time.Sleep(20 * time.Millisecond)
+
+			r.mu.Lock()
+			r.order = append(r.order, name)
+			r.mu.Unlock()
+
+			return err
+		},
+	}
+}
+
+func TestRun_DependencyOrder(t *testing.T) {
+	rec := &recorder{}
+	tasks := []Task{
+		rec.task("asdf", nil, "brew"),
+		rec.task("brew", nil),
+		rec.task("nvm", nil),
+		rec.task("npm", nil, "nvm", "not-in-run"),
+	}
+
+	results, err := Run(context.Background(), tasks, Options{MaxParallel: 2})
+	require.NoError(t, err)
+	require.Len(t, results, 4)
+
+	for i, result := range results {
+		assert.Equal(t, tasks[i].Name, result.Name)
+		assert.NoError(t, result.Err)
+		assert.False(t, result.Skipped)
+		assert.Positive(t, result.Duration)
+	}
+
+	position := map[string]int{}
+	for i, name := range rec.order {
+		position[name] = i
+	}
+
+	assert.Less(t, position["brew"], position["asdf"])
+	assert.Less(t, position["nvm"], position["npm"])
+	assert.Equal(t, int32(2), rec.peak.Load(), "independent tasks run in parallel up to the cap")
+	assert.GreaterOrEqual(t, results[0].Wait, results[1].Duration)
+}
+
+func TestRun_FailedDependencySkipsDependents(t *testing.T) {
+	rec := &recorder{}
+	failure := errors.New("download failed")
+
+	results, err := Run(context.Background(), []Task{
+		rec.task("brew", failure),
+		rec.task("asdf", nil, "brew"),
+		rec.task("asdf-plugins", nil, "asdf"),
+		rec.task("sdkman", nil),
+	}, Options{})
+	require.NoError(t, err)
+
+	assert.ErrorIs(t, results[0].Err, failure)
+	assert.False(t, results[0].Skipped)
+
+	for _, result := range results[1:3] {
+		assert.True(t, result.Skipped)
+		assert.ErrorIs(t, result.Err, ErrDependencyFailed)
+	}
+
+	assert.NoError(t, results[3].Err)
+	assert.ElementsMatch(t, []string{"brew", "sdkman"}, rec.order)
+}
+
+func TestRun_Timeout(t *testing.T) {
+	results, err := Run(context.Background(), []Task{{
+		Name: "slow",
+		Run: func(ctx context.Context) error {
+			<-ctx.Done()
+			return ctx.Err()
+		},
+	}}, Options{Timeout: 10 * time.Millisecond})
+	require.NoError(t, err)
+	assert.ErrorIs(t, results[0].Err, context.DeadlineExceeded)
+}
+
+func TestRun_InvalidGraph(t *testing.T) {
+	rec := &recorder{}
+
+	_, err := Run(context.Background(), []Task{
+		rec.task("a", nil, "b"),
+		rec.task("b", nil, "a"),
+		rec.task("c", nil, "b"),
+		rec.task("d", nil),
+	}, Options{})
+	assert.EqualError(t, err, "circular dependency detected among: a, b, c")
+
+	_, err = Run(context.Background(), []Task{rec.task("a", nil), rec.task("a", nil)}, Options{})
+	assert.EqualError(t, err, "duplicate task: a")
+	assert.Empty(t, rec.order)
+}
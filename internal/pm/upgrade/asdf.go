@@ -10,6 +10,7 @@ import (
 	"os/exec"
 	"path/filepath"
 	"regexp"
+	"runtime"
 	"strings"
 	"time"
 
@@ -150,6 +151,16 @@ func (a *AsdfUpgrader) Rollback(ctx context.Context, backupPath string) error {
 	return nil
 }
 
+// GetDependencies returns Homebrew on macOS, where asdf is usually installed
+// through it.
+func (a *AsdfUpgrader) GetDependencies() []string {
+	if runtime.GOOS == "darwin" { //nolint:goconst // OS constant used locally
+		return []string{"homebrew"}
+	}
+
+	return nil
+}
+
 // GetUpdateMethod returns the update method used.
 func (a *AsdfUpgrader) GetUpdateMethod() string {
 	return "asdf update"
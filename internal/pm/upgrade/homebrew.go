@@ -10,11 +10,25 @@ import (
 	"os/exec"
 	"regexp"
 	"strings"
+	"sync"
 	"time"
 
 	"github.com/gizzahub/gzh-cli/internal/logger"
 )
 
+// brewMu serializes brew commands. Managers installed through Homebrew run in
+// parallel once it is ready, but concurrent brew invocations contend for its
+// locks and each may trigger an auto-update.
+var brewMu sync.Mutex
+
+// runBrew runs a brew command once no other brew command of this process is running.
+func runBrew(cmd *exec.Cmd) error {
+	brewMu.Lock()
+	defer brewMu.Unlock()
+
+	return cmd.Run()
+}
+
 // HomebrewUpgrader implements PackageManagerUpgrader for Homebrew.
 type HomebrewUpgrader struct {
 	logger logger.CommonLogger
@@ -209,7 +223,7 @@ func (h *HomebrewUpgrader) executeUpdate(ctx context.Context, options UpgradeOpt
 	// Update Homebrew itself
 	h.logger.Info("Updating Homebrew...")
 	cmd := exec.CommandContext(ctx, "brew", "update")
-	if err := cmd.Run(); err != nil {
+	if err := runBrew(cmd); err != nil {
 		return fmt.Errorf("brew update failed: %w", err)
 	}
 
@@ -217,7 +231,7 @@ func (h *HomebrewUpgrader) executeUpdate(ctx context.Context, options UpgradeOpt
 	if options.Force {
 		h.logger.Info("Force upgrading Homebrew...")
 		cmd = exec.CommandContext(ctx, "brew", "upgrade")
-		if err := cmd.Run(); err != nil {
+		if err := runBrew(cmd); err != nil {
 			h.logger.Warn("brew upgrade failed, but continuing: %v", err)
 		}
 	}
@@ -11,6 +11,7 @@ import (
 	"time"
 
 	"github.com/gizzahub/gzh-cli/internal/logger"
+	"github.com/gizzahub/gzh-cli/internal/pm/dag"
 )
 
 // UpgradeCoordinator coordinates upgrades across multiple package managers.
@@ -37,8 +38,9 @@ func NewUpgradeCoordinator(logger logger.CommonLogger, backupDir string) *Upgrad
 
 // registerDefaultUpgraders registers all available upgraders.
 func (uc *UpgradeCoordinator) registerDefaultUpgraders() {
-	uc.RegisterUpgrader("homebrew", NewHomebrewUpgrader(uc.logger))
-	uc.RegisterUpgrader("brew", NewHomebrewUpgrader(uc.logger)) // Alias
+	homebrew := NewHomebrewUpgrader(uc.logger)
+	uc.RegisterUpgrader("homebrew", homebrew)
+	uc.RegisterUpgrader("brew", homebrew) // Alias, upgraded once when both are requested
 	uc.RegisterUpgrader("asdf", NewAsdfUpgrader(uc.logger))
 	uc.RegisterUpgrader("nvm", NewNvmUpgrader(uc.logger))
 	uc.RegisterUpgrader("rbenv", NewRbenvUpgrader(uc.logger))
@@ -77,38 +79,12 @@ func (uc *UpgradeCoordinator) ListUpgraders() []string {
 func (uc *UpgradeCoordinator) CheckAll(ctx context.Context) (*UpgradeReport, error) {
 	uc.logger.Info("Checking upgrade status for all package managers")
 
-	uc.mu.RLock()
-	defer uc.mu.RUnlock()
-
-	statuses := make([]UpgradeStatus, 0, len(uc.upgraders))
-	updatesNeeded := 0
-
-	for name, upgrader := range uc.upgraders {
-		uc.logger.Debug("Checking upgrade status for: %s", name)
-
-		status, err := upgrader.CheckUpdate(ctx)
-		if err != nil {
-			uc.logger.Warn("Failed to check update for %s: %v", name, err)
-			// Create a status with error information
-			status = &UpgradeStatus{
-				Manager:         name,
-				CurrentVersion:  "unknown",
-				LatestVersion:   "unknown",
-				UpdateAvailable: false,
-				UpdateMethod:    upgrader.GetUpdateMethod(),
-			}
-		}
-
-		statuses = append(statuses, *status)
-		if status.UpdateAvailable {
-			updatesNeeded++
-		}
-	}
+	statuses := uc.checkUpgraders(ctx, uc.ListUpgraders())
 
 	return &UpgradeReport{
 		Platform:      detectPlatform(),
-		TotalManagers: len(uc.upgraders),
-		UpdatesNeeded: updatesNeeded,
+		TotalManagers: len(statuses),
+		UpdatesNeeded: countUpdatesNeeded(statuses),
 		Managers:      statuses,
 		Timestamp:     time.Now(),
 	}, nil
@@ -118,132 +94,156 @@ func (uc *UpgradeCoordinator) CheckAll(ctx context.Context) (*UpgradeReport, err
 func (uc *UpgradeCoordinator) CheckManagers(ctx context.Context, names []string) (*UpgradeReport, error) {
 	uc.logger.Info("Checking upgrade status for managers: %v", names)
 
-	statuses := make([]UpgradeStatus, 0, len(names))
-	updatesNeeded := 0
+	statuses := uc.checkUpgraders(ctx, names)
+
+	return &UpgradeReport{
+		Platform:      detectPlatform(),
+		TotalManagers: len(names),
+		UpdatesNeeded: countUpdatesNeeded(statuses),
+		Managers:      statuses,
+		Timestamp:     time.Now(),
+	}, nil
+}
 
-	for _, name := range names {
+// checkUpgraders checks the named package managers concurrently, as checks
+// only read their state. Statuses are returned in the order of names.
+func (uc *UpgradeCoordinator) checkUpgraders(ctx context.Context, names []string) []UpgradeStatus {
+	statuses := make([]UpgradeStatus, len(names))
+	semaphore := make(chan struct{}, dag.DefaultMaxParallel)
+
+	var wg sync.WaitGroup
+
+	for i, name := range names {
 		upgrader, exists := uc.GetUpgrader(name)
 		if !exists {
 			uc.logger.Warn("Unknown package manager: %s", name)
-			status := UpgradeStatus{
-				Manager:         name,
-				CurrentVersion:  "unknown",
-				LatestVersion:   "unknown",
-				UpdateAvailable: false,
-				UpdateMethod:    "unknown",
-			}
-			statuses = append(statuses, status)
+			statuses[i] = *unknownStatus(name, "unknown", false)
 			continue
 		}
 
-		uc.logger.Debug("Checking upgrade status for: %s", name)
-		status, err := upgrader.CheckUpdate(ctx)
-		if err != nil {
-			uc.logger.Warn("Failed to check update for %s: %v", name, err)
-			status = &UpgradeStatus{
-				Manager:         name,
-				CurrentVersion:  "unknown",
-				LatestVersion:   "unknown",
-				UpdateAvailable: false,
-				UpdateMethod:    upgrader.GetUpdateMethod(),
+		wg.Add(1)
+		go func(i int, name string, upgrader PackageManagerUpgrader) {
+			defer wg.Done()
+
+			semaphore <- struct{}{}
+			defer func() { <-semaphore }()
+
+			uc.logger.Debug("Checking upgrade status for: %s", name)
+
+			status, err := upgrader.CheckUpdate(ctx)
+			if err != nil {
+				uc.logger.Warn("Failed to check update for %s: %v", name, err)
+				status = unknownStatus(name, upgrader.GetUpdateMethod(), false)
 			}
-		}
 
-		statuses = append(statuses, *status)
-		if status.UpdateAvailable {
-			updatesNeeded++
-		}
+			statuses[i] = *status
+		}(i, name, upgrader)
 	}
 
-	return &UpgradeReport{
-		Platform:      detectPlatform(),
-		TotalManagers: len(names),
-		UpdatesNeeded: updatesNeeded,
-		Managers:      statuses,
-		Timestamp:     time.Now(),
-	}, nil
+	wg.Wait()
+
+	return statuses
 }
 
 // UpgradeAll upgrades all package managers.
 func (uc *UpgradeCoordinator) UpgradeAll(ctx context.Context, options UpgradeOptions) (*UpgradeReport, error) {
 	uc.logger.Info("Starting upgrade for all package managers")
 
-	uc.mu.RLock()
-	names := make([]string, 0, len(uc.upgraders))
-	for name := range uc.upgraders {
-		names = append(names, name)
-	}
-	uc.mu.RUnlock()
-
-	return uc.UpgradeManagers(ctx, names, options)
+	return uc.UpgradeManagers(ctx, uc.ListUpgraders(), options)
 }
 
-// UpgradeManagers upgrades specific package managers.
+// UpgradeManagers upgrades specific package managers. Managers are upgraded
+// after those they depend on (see DependentUpgrader), and independent ones in
+// parallel, at most options.MaxParallel at a time. options.Timeout bounds the
+// upgrade of each manager. Managers whose dependency failed are not upgraded.
 func (uc *UpgradeCoordinator) UpgradeManagers(ctx context.Context, names []string, options UpgradeOptions) (*UpgradeReport, error) {
 	uc.logger.Info("Starting upgrade for managers: %v", names)
 
 	startTime := time.Now()
-	statuses := make([]UpgradeStatus, 0, len(names))
-	successCount := 0
-	failureCount := 0
+	statuses := make([]UpgradeStatus, len(names))
+	timings := make([]UpgradeTiming, len(names))
+	failed := make([]bool, len(names))
+
+	// Names of the same upgrader, such as brew and homebrew, upgrade it once
+	upgraders := make([]PackageManagerUpgrader, len(names))
+	scheduled := make(map[PackageManagerUpgrader]int)
+	aliasOf := make(map[int]int)
 
-	for _, name := range names {
+	for i, name := range names {
 		upgrader, exists := uc.GetUpgrader(name)
 		if !exists {
 			uc.logger.Error("Unknown package manager: %s", name)
-			status := UpgradeStatus{
-				Manager:         name,
-				CurrentVersion:  "unknown",
-				LatestVersion:   "unknown",
-				UpdateAvailable: false,
-				UpdateMethod:    "unknown",
-			}
-			statuses = append(statuses, status)
-			failureCount++
+			statuses[i] = *unknownStatus(name, "unknown", false)
+			timings[i] = UpgradeTiming{Manager: name, Error: "unknown package manager"}
+			failed[i] = true
+
 			continue
 		}
 
-		uc.logger.Info("Upgrading %s...", name)
-
-		// Check current status before upgrade
-		preStatus, err := upgrader.CheckUpdate(ctx)
-		if err != nil {
-			uc.logger.Warn("Failed to check pre-upgrade status for %s: %v", name, err)
-			preStatus = &UpgradeStatus{
-				Manager:         name,
-				CurrentVersion:  "unknown",
-				LatestVersion:   "unknown",
-				UpdateAvailable: true,
-				UpdateMethod:    upgrader.GetUpdateMethod(),
-			}
+		if first, exists := scheduled[upgrader]; exists {
+			aliasOf[i] = first
+			continue
 		}
 
-		// Perform upgrade
-		if err := upgrader.Upgrade(ctx, options); err != nil {
-			uc.logger.Error("Failed to upgrade %s: %v", name, err)
-			failureCount++
+		scheduled[upgrader] = i
+		upgraders[i] = upgrader
+	}
+
+	tasks := make([]dag.Task, 0, len(scheduled))
+	taskIndex := make([]int, 0, len(scheduled))
 
-			// Add failed status
-			failedStatus := *preStatus
-			failedStatus.UpdateAvailable = false // Mark as failed
-			statuses = append(statuses, failedStatus)
+	for i, upgrader := range upgraders {
+		if upgrader == nil {
 			continue
 		}
 
-		// Check post-upgrade status
-		postStatus, err := upgrader.CheckUpdate(ctx)
-		if err != nil {
-			uc.logger.Warn("Failed to check post-upgrade status for %s: %v", name, err)
-			postStatus = preStatus
+		name := names[i]
+		tasks = append(tasks, dag.Task{
+			Name:      name,
+			DependsOn: uc.dependencyNames(upgrader, names, scheduled),
+			Run: func(ctx context.Context) error {
+				status, timing, err := uc.upgradeManager(ctx, name, upgraders[i], options)
+				statuses[i], timings[i] = *status, timing
+
+				return err
+			},
+		})
+		taskIndex = append(taskIndex, i)
+	}
+
+	results, err := dag.Run(ctx, tasks, dag.Options{MaxParallel: options.MaxParallel, Timeout: options.Timeout})
+	if err != nil {
+		return nil, fmt.Errorf("failed to schedule upgrades: %w", err)
+	}
+
+	for j, result := range results {
+		i := taskIndex[j]
+
+		if result.Skipped {
+			uc.logger.Error("Skipped upgrade of %s: %v", names[i], result.Err)
+			statuses[i] = *unknownStatus(names[i], upgraders[i].GetUpdateMethod(), false)
+			timings[i] = UpgradeTiming{Manager: names[i], Error: result.Err.Error()}
 		}
 
-		statuses = append(statuses, *postStatus)
-		successCount++
-		uc.logger.Info("Successfully upgraded %s", name)
+		timings[i].Queued = result.Wait
+		failed[i] = result.Err != nil
+	}
+
+	for i, first := range aliasOf {
+		statuses[i], timings[i], failed[i] = statuses[first], timings[first], failed[first]
+		timings[i].Manager = names[i]
+	}
+
+	failureCount := 0
+
+	for _, f := range failed {
+		if f {
+			failureCount++
+		}
 	}
 
 	duration := time.Since(startTime)
-	uc.logger.Info("Upgrade completed in %v. Success: %d, Failed: %d", duration, successCount, failureCount)
+	uc.logger.Info("Upgrade completed in %v. Success: %d, Failed: %d", duration, len(names)-failureCount, failureCount)
 
 	return &UpgradeReport{
 		Platform:      detectPlatform(),
@@ -251,9 +251,103 @@ func (uc *UpgradeCoordinator) UpgradeManagers(ctx context.Context, names []strin
 		UpdatesNeeded: failureCount, // Reuse field to indicate failures
 		Managers:      statuses,
 		Timestamp:     time.Now(),
+		Duration:      duration,
+		Timings:       timings,
 	}, nil
 }
 
+// dependencyNames returns the names under which the dependencies of upgrader
+// are scheduled, so that a dependency requested through an alias still runs
+// first.
+func (uc *UpgradeCoordinator) dependencyNames(upgrader PackageManagerUpgrader, names []string, scheduled map[PackageManagerUpgrader]int) []string {
+	dependent, ok := upgrader.(DependentUpgrader)
+	if !ok {
+		return nil
+	}
+
+	var deps []string
+
+	for _, dep := range dependent.GetDependencies() {
+		if depUpgrader, exists := uc.GetUpgrader(dep); exists {
+			if i, exists := scheduled[depUpgrader]; exists {
+				deps = append(deps, names[i])
+			}
+		}
+	}
+
+	return deps
+}
+
+// upgradeManager upgrades one package manager, checking its status before
+// and after.
+func (uc *UpgradeCoordinator) upgradeManager(ctx context.Context, name string, upgrader PackageManagerUpgrader, options UpgradeOptions) (*UpgradeStatus, UpgradeTiming, error) {
+	uc.logger.Info("Upgrading %s...", name)
+
+	timing := UpgradeTiming{Manager: name}
+	checkStart := time.Now()
+
+	// Check current status before upgrade
+	preStatus, err := upgrader.CheckUpdate(ctx)
+	if err != nil {
+		uc.logger.Warn("Failed to check pre-upgrade status for %s: %v", name, err)
+		preStatus = unknownStatus(name, upgrader.GetUpdateMethod(), true)
+	}
+
+	timing.Check = time.Since(checkStart)
+	upgradeStart := time.Now()
+
+	// Perform upgrade
+	if err := upgrader.Upgrade(ctx, options); err != nil {
+		timing.Upgrade = time.Since(upgradeStart)
+		timing.Error = err.Error()
+		uc.logger.Error("Failed to upgrade %s: %v", name, err)
+
+		// Add failed status
+		failedStatus := *preStatus
+		failedStatus.UpdateAvailable = false // Mark as failed
+
+		return &failedStatus, timing, fmt.Errorf("failed to upgrade %s: %w", name, err)
+	}
+
+	timing.Upgrade = time.Since(upgradeStart)
+	checkStart = time.Now()
+
+	// Check post-upgrade status
+	postStatus, err := upgrader.CheckUpdate(ctx)
+	if err != nil {
+		uc.logger.Warn("Failed to check post-upgrade status for %s: %v", name, err)
+		postStatus = preStatus
+	}
+
+	timing.Check += time.Since(checkStart)
+	uc.logger.Info("Successfully upgraded %s", name)
+
+	return postStatus, timing, nil
+}
+
+// unknownStatus is the status reported for a manager that could not be checked.
+func unknownStatus(name, updateMethod string, updateAvailable bool) *UpgradeStatus {
+	return &UpgradeStatus{
+		Manager:         name,
+		CurrentVersion:  "unknown",
+		LatestVersion:   "unknown",
+		UpdateAvailable: updateAvailable,
+		UpdateMethod:    updateMethod,
+	}
+}
+
+func countUpdatesNeeded(statuses []UpgradeStatus) int {
+	updatesNeeded := 0
+
+	for _, status := range statuses {
+		if status.UpdateAvailable {
+			updatesNeeded++
+		}
+	}
+
+	return updatesNeeded
+}
+
 // GetAvailableManagers returns a list of all available package managers.
 func (uc *UpgradeCoordinator) GetAvailableManagers() []string {
 	return uc.ListUpgraders()
@@ -297,5 +391,21 @@ func (uc *UpgradeCoordinator) FormatReport(report *UpgradeReport, verbose bool)
 		result.WriteString("\n")
 	}
 
+	if verbose && len(report.Timings) > 0 {
+		result.WriteString(fmt.Sprintf("\nTimings (total %s):\n", report.Duration.Round(time.Millisecond)))
+
+		for _, timing := range report.Timings {
+			result.WriteString(fmt.Sprintf("  %-10s queued %-8s check %-8s upgrade %s",
+				timing.Manager, timing.Queued.Round(time.Millisecond),
+				timing.Check.Round(time.Millisecond), timing.Upgrade.Round(time.Millisecond)))
+
+			if timing.Error != "" {
+				result.WriteString(fmt.Sprintf("  (%s)", timing.Error))
+			}
+
+			result.WriteString("\n")
+		}
+	}
+
 	return result.String()
 }
@@ -2,11 +2,15 @@ package upgrade
 
 import (
 	"context"
+	"errors"
+	"slices"
+	"sync"
 	"testing"
 	"time"
 
 	"github.com/stretchr/testify/assert"
 	"github.com/stretchr/testify/mock"
+	"github.com/stretchr/testify/require"
 )
 
 // MockLogger implements logger.CommonLogger for testing.
@@ -258,6 +262,89 @@ func TestUpgradeCoordinator_UpgradeManagers_Success(t *testing.T) {
 	mockUpgrader.AssertExpectations(t)
 }
 
+// orderedUpgrader records the order of upgrades in a log shared by upgraders.
+type orderedUpgrader struct {
+	name string
+	deps []string
+	err  error
+	mu   *sync.Mutex
+	log  *[]string
+}
+
+func (o *orderedUpgrader) CheckUpdate(context.Context) (*UpgradeStatus, error) {
+	return &UpgradeStatus{Manager: o.name, CurrentVersion: "1.0.0", UpdateMethod: "test"}, nil
+}
+
+func (o *orderedUpgrader) Upgrade(context.Context, UpgradeOptions) error {
+	time.Sleep(10 * time.Millisecond)
+
+	o.mu.Lock()
+	*o.log = append(*o.log, o.name)
+	o.mu.Unlock()
+
+	return o.err
+}
+
+func (o *orderedUpgrader) Backup(context.Context) (string, error)    { return "", nil }
+func (o *orderedUpgrader) Rollback(context.Context, string) error    { return nil }
+func (o *orderedUpgrader) GetUpdateMethod() string                   { return "test" }
+func (o *orderedUpgrader) ValidateUpgrade(ctx context.Context) error { return nil }
+func (o *orderedUpgrader) GetDependencies() []string                 { return o.deps }
+
+func TestUpgradeCoordinator_UpgradeManagers_Dependencies(t *testing.T) {
+	mockLogger := &MockLogger{}
+	mockLogger.On("Info", mock.AnythingOfType("string"), mock.Anything).Return()
+	mockLogger.On("Error", mock.AnythingOfType("string"), mock.Anything).Return()
+
+	coordinator := NewUpgradeCoordinator(mockLogger, "/tmp")
+	coordinator.upgraders = make(map[string]PackageManagerUpgrader)
+
+	var (
+		mu  sync.Mutex
+		log []string
+	)
+
+	newUpgrader := func(name string, err error, deps ...string) *orderedUpgrader {
+		return &orderedUpgrader{name: name, deps: deps, err: err, mu: &mu, log: &log}
+	}
+
+	homebrew := newUpgrader("homebrew", nil)
+	coordinator.RegisterUpgrader("homebrew", homebrew)
+	coordinator.RegisterUpgrader("brew", homebrew)
+	coordinator.RegisterUpgrader("rbenv", newUpgrader("rbenv", nil, "homebrew"))
+	coordinator.RegisterUpgrader("nvm", newUpgrader("nvm", errors.New("download failed")))
+	coordinator.RegisterUpgrader("npm", newUpgrader("npm", nil, "nvm"))
+
+	names := []string{"rbenv", "npm", "brew", "nvm", "homebrew"}
+	report, err := coordinator.UpgradeManagers(context.Background(), names, UpgradeOptions{MaxParallel: 2})
+	require.NoError(t, err)
+
+	// The alias is upgraded once, before its dependent; npm is skipped
+	mu.Lock()
+	assert.ElementsMatch(t, []string{"homebrew", "rbenv", "nvm"}, log)
+	assert.Less(t, slices.Index(log, "homebrew"), slices.Index(log, "rbenv"))
+	mu.Unlock()
+
+	assert.Equal(t, 5, report.TotalManagers)
+	assert.Equal(t, 2, report.UpdatesNeeded, "nvm failed and npm was skipped")
+	require.Len(t, report.Managers, len(names))
+	require.Len(t, report.Timings, len(names))
+
+	for i, name := range names {
+		assert.Equal(t, name, report.Timings[i].Manager)
+	}
+
+	assert.Equal(t, "homebrew", report.Managers[4].Manager)
+	assert.Empty(t, report.Timings[2].Error)
+	assert.Contains(t, report.Timings[1].Error, "dependency failed: nvm")
+	assert.Equal(t, "unknown", report.Managers[1].CurrentVersion)
+	assert.Equal(t, "download failed", report.Timings[3].Error)
+	assert.GreaterOrEqual(t, report.Timings[0].Queued, report.Timings[2].Upgrade)
+
+	output := coordinator.FormatReport(report, true)
+	assert.Contains(t, output, "Timings (total ")
+}
+
 func TestUpgradeCoordinator_FormatReport(t *testing.T) {
 	mockLogger := &MockLogger{}
 	coordinator := NewUpgradeCoordinator(mockLogger, "/tmp")
@@ -29,6 +29,18 @@ type UpgradeReport struct {
 	UpdatesNeeded int             `json:"updates_needed"`
 	Managers      []UpgradeStatus `json:"managers"`
 	Timestamp     time.Time       `json:"timestamp"`
+	Duration      time.Duration   `json:"duration,omitempty"`
+	Timings       []UpgradeTiming `json:"timings,omitempty"`
+}
+
+// UpgradeTiming breaks down where the time upgrading a package manager went.
+type UpgradeTiming struct {
+	Manager string `json:"manager"`
+	// Queued is the time spent waiting for dependencies and a free slot.
+	Queued  time.Duration `json:"queued"`
+	Check   time.Duration `json:"check"`
+	Upgrade time.Duration `json:"upgrade"`
+	Error   string        `json:"error,omitempty"`
 }
 
 // UpgradeOptions configures how an upgrade should be performed.
@@ -38,6 +50,8 @@ type UpgradeOptions struct {
 	BackupEnabled  bool          `json:"backup_enabled"`
 	SkipValidation bool          `json:"skip_validation"`
 	Timeout        time.Duration `json:"timeout"`
+	// MaxParallel caps the number of managers upgraded at once.
+	MaxParallel int `json:"max_parallel,omitempty"`
 }
 
 // PackageManagerUpgrader defines the interface that all package manager upgraders must implement.
@@ -61,6 +75,13 @@ type PackageManagerUpgrader interface {
 	ValidateUpgrade(ctx context.Context) error
 }
 
+// DependentUpgrader is implemented by upgraders that must run after other
+// package managers are upgraded, such as those installed through Homebrew.
+type DependentUpgrader interface {
+	// GetDependencies returns the names of the upgraders to run first
+	GetDependencies() []string
+}
+
 // UpgradeManager coordinates upgrades across multiple package managers.
 type UpgradeManager struct {
 	upgraders map[string]PackageManagerUpgrader
@@ -130,7 +130,7 @@ func (r *RbenvUpgrader) Upgrade(ctx context.Context, options UpgradeOptions) err
 	if runtime.GOOS == "darwin" { //nolint:goconst // OS constant used locally
 		// macOS: Use Homebrew
 		cmd := exec.CommandContext(ctx, "brew", "upgrade", "rbenv")
-		if err := cmd.Run(); err != nil {
+		if err := runBrew(cmd); err != nil {
 			return fmt.Errorf("rbenv upgrade via brew failed: %w", err)
 		}
 	} else {
@@ -178,6 +178,15 @@ func (r *RbenvUpgrader) Rollback(ctx context.Context, backupPath string) error {
 	return nil
 }
 
+// GetDependencies returns Homebrew on macOS, where rbenv is upgraded through it.
+func (r *RbenvUpgrader) GetDependencies() []string {
+	if runtime.GOOS == "darwin" { //nolint:goconst // OS constant used locally
+		return []string{"homebrew"}
+	}
+
+	return nil
+}
+
 func (r *RbenvUpgrader) GetUpdateMethod() string {
 	if runtime.GOOS == "darwin" {
 		return "brew upgrade rbenv"
@@ -252,7 +261,7 @@ func (p *PyenvUpgrader) Upgrade(ctx context.Context, options UpgradeOptions) err
 	if runtime.GOOS == "darwin" {
 		// macOS: Use Homebrew
 		cmd := exec.CommandContext(ctx, "brew", "upgrade", "pyenv")
-		if err := cmd.Run(); err != nil {
+		if err := runBrew(cmd); err != nil {
 			return fmt.Errorf("pyenv upgrade via brew failed: %w", err)
 		}
 	} else {
@@ -310,6 +319,15 @@ func (p *PyenvUpgrader) Rollback(ctx context.Context, backupPath string) error {
 	return nil
 }
 
+// GetDependencies returns Homebrew on macOS, where pyenv is upgraded through it.
+func (p *PyenvUpgrader) GetDependencies() []string {
+	if runtime.GOOS == "darwin" { //nolint:goconst // OS constant used locally
+		return []string{"homebrew"}
+	}
+
+	return nil
+}
+
 func (p *PyenvUpgrader) GetUpdateMethod() string {
 	if runtime.GOOS == "darwin" {
 		return "brew upgrade pyenv"
@@ -29,6 +29,10 @@ type BenchmarkResult struct {
 	GoroutinesAfter  int                      `json:"goroutines_after"`
 	Percentiles      map[string]time.Duration `json:"percentiles"`
 	Timestamp        time.Time                `json:"timestamp"`
+
+	// Metrics holds benchmark-specific figures, such as the per-repository
+	// API calls of the macro-benchmarks.
+	Metrics map[string]float64 `json:"metrics,omitempty"`
 }
 
 // BenchmarkSuite manages and runs performance benchmarks.
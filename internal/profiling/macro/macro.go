@@ -0,0 +1,318 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+// Package macro runs end-to-end macro-benchmarks of the bulk repository
+// engines against an in-process fake forge.
+//
+// A Harness creates synthetic repositories with testlib.LargeRepoCreator and
+// serves them from a testlib.FakeForge with optional latency and rate-limit
+// injection. Each Scenario drives a real engine (bulk clone, git sync,
+// repo-config diff) against it. Results are profiling.BenchmarkResult values
+// whose Metrics carry the per-repository figures (throughput, allocations and
+// API calls), so they can be stored and compared by the doctor benchmark
+// snapshots like any other benchmark.
+package macro
+
+import (
+	"context"
+	"fmt"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"regexp"
+	"strings"
+	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/profiling"
+	"github.com/gizzahub/gzh-cli/internal/testlib"
+)
+
+// Metric names reported in profiling.BenchmarkResult.Metrics.
+const (
+	MetricRepos            = "repos"
+	MetricReposPerSec      = "repos_per_sec"
+	MetricAPICallsPerRepo  = "api_calls_per_repo"
+	MetricAllocBytesPerRep = "alloc_bytes_per_repo"
+	MetricRateLimited      = "rate_limited_per_pass"
+	MetricFailedPasses     = "failed_passes"
+)
+
+// Organizations served by the fake forge.
+const (
+	SourceOrg      = "bench-src"
+	DestinationOrg = "bench-dst"
+)
+
+// Config sizes the synthetic workload and the injected forge behaviour.
+type Config struct {
+	Repos           int           // Synthetic repositories in the source organization
+	FileSizeMB      int64         // Size of the large file committed to each repository
+	Parallel        int           // Workers used by the engines
+	Iterations      int           // Measured passes per scenario
+	Latency         time.Duration // Added to every API response
+	RateLimit       int           // API requests per RateLimitWindow; 0 disables the limit
+	RateLimitWindow time.Duration
+	WorkDir         string // Root for repositories and clones; a temporary directory when empty
+}
+
+// DefaultConfig returns a workload small enough for CI yet large enough to
+// exercise paging (more than one listing page) and the worker pools.
+func DefaultConfig() Config {
+	return Config{
+		Repos:           120,
+		FileSizeMB:      1,
+		Parallel:        8,
+		Iterations:      3,
+		Latency:         20 * time.Millisecond,
+		RateLimitWindow: time.Minute,
+	}
+}
+
+// Harness owns the fake forge and the synthetic repositories shared by the
+// scenarios of one benchmark run.
+type Harness struct {
+	Forge  *testlib.FakeForge
+	Config Config
+
+	root        string
+	ownsRoot    bool
+	sourceNames []string
+}
+
+// NewHarness creates the synthetic repositories and starts the fake forge.
+// Close removes everything it created.
+func NewHarness(ctx context.Context, cfg Config) (*Harness, error) {
+	defaults := DefaultConfig()
+	if cfg.Repos <= 0 {
+		cfg.Repos = defaults.Repos
+	}
+
+	if cfg.FileSizeMB <= 0 {
+		cfg.FileSizeMB = defaults.FileSizeMB
+	}
+
+	if cfg.Parallel <= 0 {
+		cfg.Parallel = defaults.Parallel
+	}
+
+	if cfg.Iterations <= 0 {
+		cfg.Iterations = defaults.Iterations
+	}
+
+	h := &Harness{Config: cfg, root: cfg.WorkDir}
+
+	if h.root == "" {
+		root, err := os.MkdirTemp("", "gzh-macro-bench-*")
+		if err != nil {
+			return nil, fmt.Errorf("failed to create work directory: %w", err)
+		}
+
+		h.root, h.ownsRoot = root, true
+	}
+
+	h.Forge = testlib.NewFakeForge(testlib.FakeForgeOptions{
+		Latency:         cfg.Latency,
+		RateLimit:       cfg.RateLimit,
+		RateLimitWindow: cfg.RateLimitWindow,
+	})
+
+	if err := h.createSources(ctx); err != nil {
+		h.Close()
+		return nil, err
+	}
+
+	return h, nil
+}
+
+// Close stops the forge and removes the work directory if the harness
+// created it.
+func (h *Harness) Close() {
+	h.Forge.Close()
+
+	if h.ownsRoot {
+		_ = os.RemoveAll(h.root)
+	}
+}
+
+// createSources creates the synthetic source repositories and registers them
+// with the forge.
+func (h *Harness) createSources(ctx context.Context) error {
+	creator := testlib.NewLargeRepoCreator()
+
+	for i := range h.Config.Repos {
+		name := fmt.Sprintf("repo-%04d", i)
+		repoPath := filepath.Join(h.root, "sources", name)
+
+		if err := creator.CreateLargeRepo(ctx, testlib.LargeRepoOptions{
+			RepoPath:      repoPath,
+			LargeFileSize: h.Config.FileSizeMB,
+			FileCount:     1,
+			ChunkSize:     256,
+		}); err != nil {
+			return fmt.Errorf("failed to create synthetic repository %s: %w", name, err)
+		}
+
+		branch, err := currentBranch(ctx, repoPath)
+		if err != nil {
+			return err
+		}
+
+		h.Forge.AddRepository(SourceOrg, testlib.FakeRepo{
+			Name:          name,
+			CloneURL:      repoPath,
+			DefaultBranch: branch,
+			SizeKB:        int(h.Config.FileSizeMB * 1024),
+		})
+
+		h.sourceNames = append(h.sourceNames, name)
+	}
+
+	return nil
+}
+
+// Scenario is one end-to-end workload.
+type Scenario struct {
+	Name        string
+	Description string
+
+	// prepare runs once before the warm-up pass.
+	prepare func(ctx context.Context, h *Harness) error
+	// pass runs the workload once; dir is an empty directory removed afterwards.
+	pass func(ctx context.Context, h *Harness, dir string) error
+}
+
+// Scenarios returns the registered scenarios.
+func Scenarios() []Scenario {
+	return []Scenario{synclone(), gitSync(), repoConfigDiff()}
+}
+
+// Match returns the scenarios whose benchmark name matches filter (a regular
+// expression; empty matches all).
+func Match(filter string) ([]Scenario, error) {
+	scenarios := Scenarios()
+	if filter == "" {
+		return scenarios, nil
+	}
+
+	re, err := regexp.Compile(filter)
+	if err != nil {
+		return nil, fmt.Errorf("invalid benchmark filter: %w", err)
+	}
+
+	var matched []Scenario
+
+	for _, s := range scenarios {
+		if re.MatchString(s.BenchmarkName()) {
+			matched = append(matched, s)
+		}
+	}
+
+	return matched, nil
+}
+
+// BenchmarkName returns the name the scenario is reported under.
+func (s Scenario) BenchmarkName() string {
+	return "BenchmarkMacro/" + s.Name
+}
+
+// Run benchmarks a scenario: prepare, one unmeasured warm-up pass that also
+// establishes the steady state (mirrors, caches), then the measured passes.
+// Forge counters are reset after the warm-up so the API metrics only cover
+// measured passes.
+func (h *Harness) Run(ctx context.Context, suite *profiling.BenchmarkSuite, s Scenario) (*profiling.BenchmarkResult, error) {
+	if s.prepare != nil {
+		if err := s.prepare(ctx, h); err != nil {
+			return nil, fmt.Errorf("%s: prepare failed: %w", s.Name, err)
+		}
+	}
+
+	var (
+		attempts, failed int
+		lastErr          error
+	)
+
+	runPass := func(ctx context.Context) error {
+		attempts++
+
+		dir, err := os.MkdirTemp(h.root, s.Name+"-*")
+		if err != nil {
+			return err
+		}
+		defer func() { _ = os.RemoveAll(dir) }()
+
+		if err := s.pass(ctx, h, dir); err != nil {
+			failed++
+			lastErr = err
+
+			return err
+		}
+
+		return nil
+	}
+
+	if err := runPass(ctx); err != nil {
+		return nil, fmt.Errorf("%s: warm-up pass failed: %w", s.Name, err)
+	}
+
+	attempts, failed = 0, 0
+	h.Forge.ResetStats()
+
+	result, err := suite.RunBenchmark(ctx, s.BenchmarkName(), runPass, &profiling.BenchmarkOptions{
+		Iterations:  h.Config.Iterations,
+		Concurrency: 1,
+	})
+	if err != nil {
+		return nil, err
+	}
+
+	if result.Operations == 0 {
+		return nil, fmt.Errorf("%s: all %d passes failed: %w", s.Name, attempts, lastErr)
+	}
+
+	stats := h.Forge.Stats()
+	repos := float64(h.Config.Repos)
+
+	result.Metrics = map[string]float64{
+		MetricRepos:            repos,
+		MetricReposPerSec:      result.OpsPerSec * repos,
+		MetricAPICallsPerRepo:  float64(stats.Requests) / float64(attempts) / repos,
+		MetricAllocBytesPerRep: float64(result.AllocBytesPerOp) / repos,
+		MetricRateLimited:      float64(stats.RateLimited) / float64(attempts),
+		MetricFailedPasses:     float64(failed),
+	}
+
+	return result, nil
+}
+
+// requireClones checks that every source repository was cloned under dir.
+func (h *Harness) requireClones(dir string) error {
+	for _, name := range h.sourceNames {
+		if _, err := os.Stat(filepath.Join(dir, name, ".git")); err != nil {
+			return fmt.Errorf("repository %s was not cloned: %w", name, err)
+		}
+	}
+
+	return nil
+}
+
+func currentBranch(ctx context.Context, repoPath string) (string, error) {
+	output, err := runGit(ctx, repoPath, "symbolic-ref", "--short", "HEAD")
+	if err != nil {
+		return "", fmt.Errorf("failed to read branch of %s: %w", repoPath, err)
+	}
+
+	return output, nil
+}
+
+// runGit runs a git command in dir and returns its trimmed output.
+func runGit(ctx context.Context, dir string, args ...string) (string, error) {
+	cmd := exec.CommandContext(ctx, "git", args...)
+	cmd.Dir = dir
+
+	output, err := cmd.CombinedOutput()
+	if err != nil {
+		return "", fmt.Errorf("git %s failed: %w\nOutput: %s", args[0], err, output)
+	}
+
+	return strings.TrimSpace(string(output)), nil
+}
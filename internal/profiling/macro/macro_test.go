@@ -0,0 +1,67 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package macro
+
+import (
+	"context"
+	"os/exec"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+
+	"github.com/gizzahub/gzh-cli/internal/profiling"
+)
+
+func TestMatch(t *testing.T) {
+	all, err := Match("")
+	require.NoError(t, err)
+	assert.Len(t, all, 3)
+
+	matched, err := Match("Macro/(Synclone|GitSync)$")
+	require.NoError(t, err)
+	require.Len(t, matched, 2)
+	assert.Equal(t, "BenchmarkMacro/Synclone", matched[0].BenchmarkName())
+
+	_, err = Match("(")
+	require.Error(t, err)
+}
+
+func TestHarness_Scenarios(t *testing.T) {
+	if testing.Short() {
+		t.Skip("macro-benchmarks create git repositories")
+	}
+
+	if _, err := exec.LookPath("git"); err != nil {
+		t.Skip("git not available")
+	}
+
+	t.Setenv("HOME", t.TempDir()) // Clone sessions and sync trackers
+
+	ctx := context.Background()
+
+	h, err := NewHarness(ctx, Config{
+		Repos:      3,
+		FileSizeMB: 1,
+		Parallel:   2,
+		Iterations: 1,
+		WorkDir:    t.TempDir(),
+	})
+	require.NoError(t, err)
+	defer h.Close()
+
+	suite := profiling.NewBenchmarkSuite(nil)
+
+	for _, scenario := range Scenarios() {
+		t.Run(scenario.Name, func(t *testing.T) {
+			result, err := h.Run(ctx, suite, scenario)
+			require.NoError(t, err)
+
+			assert.Equal(t, 1, result.Operations)
+			assert.InDelta(t, 3, result.Metrics[MetricRepos], 0)
+			assert.Positive(t, result.Metrics[MetricAPICallsPerRepo])
+			assert.Zero(t, result.Metrics[MetricFailedPasses])
+		})
+	}
+}
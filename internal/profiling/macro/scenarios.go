@@ -0,0 +1,215 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package macro
+
+import (
+	"context"
+	"fmt"
+	"os"
+	"path/filepath"
+
+	"github.com/gizzahub/gzh-cli/internal/git/clone"
+	gitsync "github.com/gizzahub/gzh-cli/internal/git/sync"
+	"github.com/gizzahub/gzh-cli/internal/testlib"
+	"github.com/gizzahub/gzh-cli/pkg/config"
+	"github.com/gizzahub/gzh-cli/pkg/github"
+)
+
+// newGitHubProvider returns a GitHub provider whose organization listings are
+// served by the fake forge.
+func (h *Harness) newGitHubProvider() *github.GitHubProvider {
+	streaming := github.NewStreamingClient("", github.DefaultStreamingConfig())
+	streaming.SetBaseURL(h.Forge.URL())
+
+	p := github.NewGitHubProvider(nil, &github.SimpleCloneService{})
+	p.SetStreamingClient(streaming)
+
+	return p
+}
+
+// synclone clones the whole source organization into an empty directory with
+// the bulk clone engine.
+func synclone() Scenario {
+	return Scenario{
+		Name:        "Synclone",
+		Description: "bulk clone of an organization into an empty directory",
+		pass: func(ctx context.Context, h *Harness, dir string) error {
+			executor, err := clone.NewCloneExecutor(h.newGitHubProvider(), &clone.CloneOptions{
+				Provider: "github",
+				Org:      SourceOrg,
+				Target:   dir,
+				Parallel: h.Config.Parallel,
+				Format:   string(clone.FormatQuiet),
+				Quiet:    true,
+			})
+			if err != nil {
+				return err
+			}
+
+			err = executor.Execute(ctx)
+			_ = executor.Session().Delete()
+
+			if err != nil {
+				return err
+			}
+
+			return h.requireClones(dir)
+		},
+	}
+}
+
+// gitSync mirrors the source organization into an organization of bare
+// repositories. The warm-up pass creates the mirrors, so measured passes are
+// the incremental syncs that dominate scheduled runs.
+func gitSync() Scenario {
+	var mirrorDir string
+
+	return Scenario{
+		Name:        "GitSync",
+		Description: "incremental mirror sync between two organizations",
+		prepare: func(ctx context.Context, h *Harness) error {
+			mirrorDir = filepath.Join(h.root, "mirrors")
+
+			for _, name := range h.sourceNames {
+				dest := filepath.Join(h.root, "destinations", name+".git")
+				if _, err := os.Stat(dest); err == nil {
+					continue
+				}
+
+				if err := os.MkdirAll(filepath.Dir(dest), 0o755); err != nil {
+					return err
+				}
+
+				if _, err := runGit(ctx, "", "init", "--bare", dest); err != nil {
+					return err
+				}
+
+				h.Forge.AddRepository(DestinationOrg, testlib.FakeRepo{Name: name, CloneURL: dest})
+			}
+
+			return nil
+		},
+		pass: func(ctx context.Context, h *Harness, _ string) error {
+			engine := gitsync.NewSyncEngine(h.newGitHubProvider(), h.newGitHubProvider(), gitsync.SyncOptions{
+				From:           "github:" + SourceOrg,
+				To:             "github:" + DestinationOrg,
+				UpdateExisting: true,
+				IncludeCode:    true,
+				Mirror:         true,
+				MirrorDir:      mirrorDir,
+				Parallel:       h.Config.Parallel,
+			})
+
+			err := engine.Sync(ctx)
+
+			if tracker := engine.Tracker(); tracker != nil {
+				_ = gitsync.DeleteSyncTracker(tracker.ID)
+
+				if err == nil && tracker.HasErrors() {
+					err = fmt.Errorf("%d repository components failed", len(tracker.Errors))
+				}
+			}
+
+			return err
+		},
+	}
+}
+
+// benchRepoConfig is the desired configuration every repository is compared
+// against.
+var benchRepoConfig = &config.RepoConfig{
+	Version:      "1.0.0",
+	Organization: SourceOrg,
+	Defaults: &config.RepoDefaults{
+		Settings: &config.RepoSettings{
+			HasIssues: boolPtr(true),
+			HasWiki:   boolPtr(false),
+		},
+	},
+}
+
+// repoConfigDiff fetches the live configuration of every repository and
+// compares it with the effective desired configuration, the work done by
+// `gz repo-config diff`.
+func repoConfigDiff() Scenario {
+	return Scenario{
+		Name:        "RepoConfigDiff",
+		Description: "fetch and compare the configuration of every repository",
+		pass: func(ctx context.Context, h *Harness, _ string) error {
+			client := github.NewRepoConfigClient("bench")
+			client.SetBaseURL(h.Forge.URL())
+
+			var compared, differences int
+
+			resolver := config.NewRepoConfigResolver(benchRepoConfig)
+
+			err := github.RunRepositoryPipeline(ctx, client, SourceOrg, github.PipelineOptions{
+				Concurrency: h.Config.Parallel,
+				ListOptions: &github.ListOptions{PerPage: 100},
+			}, func(ctx context.Context, repo *github.Repository) (*github.RepositoryConfig, error) {
+				return client.GetRepositoryConfiguration(ctx, SourceOrg, repo.Name)
+			}, func(result github.PipelineResult[*github.RepositoryConfig]) error {
+				if result.Err != nil {
+					return result.Err
+				}
+
+				target, err := resolver.Resolve(result.Repository.Name)
+				if err != nil {
+					return err
+				}
+
+				differences += countSettingDifferences(result.Value, target.Settings)
+				compared++
+
+				return nil
+			})
+			if err != nil {
+				return err
+			}
+
+			if compared != len(h.sourceNames) {
+				return fmt.Errorf("compared %d of %d repositories", compared, len(h.sourceNames))
+			}
+
+			// Every fake repository has a wiki the desired configuration disables
+			if differences != compared {
+				return fmt.Errorf("found %d differences in %d repositories", differences, compared)
+			}
+
+			return nil
+		},
+	}
+}
+
+// countSettingDifferences counts the desired feature settings the live
+// configuration does not match.
+func countSettingDifferences(current *github.RepositoryConfig, desired *config.RepoSettings) int {
+	if desired == nil {
+		return 0
+	}
+
+	var n int
+
+	for _, c := range []struct {
+		want *bool
+		got  bool
+	}{
+		{desired.HasIssues, current.Settings.HasIssues},
+		{desired.HasProjects, current.Settings.HasProjects},
+		{desired.HasWiki, current.Settings.HasWiki},
+		{desired.HasDownloads, current.Settings.HasDownloads},
+		{desired.Private, current.Private},
+		{desired.Archived, current.Archived},
+	} {
+		if c.want != nil && *c.want != c.got {
+			n++
+		}
+	}
+
+	return n
+}
+
+func boolPtr(b bool) *bool {
+	return &b
+}
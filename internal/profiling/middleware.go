@@ -8,6 +8,7 @@ import (
 	"time"
 
 	"github.com/gizzahub/gzh-cli/internal/logger"
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
 )
 
 // PerformanceMiddleware provides performance monitoring capabilities.
@@ -40,7 +41,8 @@ type OperationMetrics struct {
 	Error            error
 }
 
-// TrackOperation wraps an operation with performance tracking.
+// TrackOperation wraps an operation with performance tracking. The duration
+// is also recorded as the total phase of operationName on phase.Default.
 func (pm *PerformanceMiddleware) TrackOperation(_ context.Context, operationName string, operation func() error) error {
 	if !pm.enabled {
 		return operation()
@@ -72,6 +74,8 @@ func (pm *PerformanceMiddleware) TrackOperation(_ context.Context, operationName
 	metrics.Success = err == nil
 	metrics.Error = err
 
+	phase.Default.Observe(operationName, phase.Total, metrics.Duration, err)
+
 	// Capture final runtime stats
 	if pm.profiler != nil {
 		stats := pm.profiler.GetRuntimeStats()
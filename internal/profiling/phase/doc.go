@@ -0,0 +1,15 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+// Package phase records where long-running operations spend their time.
+//
+// Engines tag their context with an operation name (WithOperation) and wrap
+// each unit of work in a span for its phase: listing repositories, waiting
+// for the rate limit, cloning, fetching, resetting, saving state. Spans feed
+// per operation and phase histograms in a Recorder, which the profiler HTTP
+// server exports in the Prometheus text format on /metrics and which
+// WriteSummary prints as a table at the end of a run.
+//
+// The package only depends on the standard library so that API clients,
+// rate limiters and git engines at any layer can report to it.
+package phase
@@ -0,0 +1,75 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package phase
+
+import (
+	"bufio"
+	"io"
+	"net/http"
+	"strconv"
+	"strings"
+)
+
+const (
+	durationMetric = "gzh_phase_duration_seconds"
+	errorsMetric   = "gzh_phase_errors_total"
+)
+
+// WritePrometheus writes the recorded series in the Prometheus text
+// exposition format (version 0.0.4), which Prometheus and the OpenTelemetry
+// collector's Prometheus receiver can scrape.
+func (r *Recorder) WritePrometheus(w io.Writer) error {
+	stats := r.Snapshot()
+	bw := bufio.NewWriter(w)
+
+	bw.WriteString("# HELP " + durationMetric + " Time spent in each phase of long-running operations.\n")
+	bw.WriteString("# TYPE " + durationMetric + " histogram\n")
+
+	for _, st := range stats {
+		labels := `operation="` + escapeLabel(st.Operation) + `",phase="` + escapeLabel(string(st.Phase)) + `"`
+
+		for i, bound := range r.buckets {
+			writeSample(bw, durationMetric+"_bucket", labels+`,le="`+formatFloat(bound)+`"`, strconv.FormatInt(st.Buckets[i], 10))
+		}
+
+		writeSample(bw, durationMetric+"_bucket", labels+`,le="+Inf"`, strconv.FormatInt(st.Count, 10))
+		writeSample(bw, durationMetric+"_sum", labels, formatFloat(st.Total.Seconds()))
+		writeSample(bw, durationMetric+"_count", labels, strconv.FormatInt(st.Count, 10))
+	}
+
+	bw.WriteString("# HELP " + errorsMetric + " Phases of long-running operations that ended with an error.\n")
+	bw.WriteString("# TYPE " + errorsMetric + " counter\n")
+
+	for _, st := range stats {
+		labels := `operation="` + escapeLabel(st.Operation) + `",phase="` + escapeLabel(string(st.Phase)) + `"`
+		writeSample(bw, errorsMetric, labels, strconv.FormatInt(st.Errors, 10))
+	}
+
+	return bw.Flush()
+}
+
+// ServeHTTP serves WritePrometheus, so a Recorder can be mounted on /metrics.
+func (r *Recorder) ServeHTTP(w http.ResponseWriter, _ *http.Request) {
+	w.Header().Set("Content-Type", "text/plain; version=0.0.4; charset=utf-8")
+	_ = r.WritePrometheus(w)
+}
+
+func writeSample(w *bufio.Writer, name, labels, value string) {
+	w.WriteString(name)
+	w.WriteByte('{')
+	w.WriteString(labels)
+	w.WriteString("} ")
+	w.WriteString(value)
+	w.WriteByte('\n')
+}
+
+var labelEscaper = strings.NewReplacer(`\`, `\\`, `"`, `\"`, "\n", `\n`)
+
+func escapeLabel(value string) string {
+	return labelEscaper.Replace(value)
+}
+
+func formatFloat(f float64) string {
+	return strconv.FormatFloat(f, 'g', -1, 64)
+}
@@ -0,0 +1,273 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package phase
+
+import (
+	"context"
+	"fmt"
+	"io"
+	"slices"
+	"sort"
+	"sync"
+	"sync/atomic"
+	"text/tabwriter"
+	"time"
+)
+
+// Name identifies a phase of an operation.
+type Name string
+
+// Phases reported by the bulk repository engines.
+const (
+	APIList       Name = "api_list"
+	RateLimitWait Name = "rate_limit_wait"
+	Clone         Name = "clone"
+	Fetch         Name = "fetch"
+	Pull          Name = "pull"
+	Reset         Name = "reset"
+	Checkout      Name = "checkout"
+	Push          Name = "push"
+	StateSave     Name = "state_save"
+	Total         Name = "total"
+)
+
+// DefaultBuckets are the histogram upper bounds in seconds. They span
+// sub-millisecond state saves up to clones of very large repositories.
+var DefaultBuckets = []float64{0.001, 0.005, 0.025, 0.1, 0.25, 0.5, 1, 2.5, 5, 10, 30, 60, 120, 300, 600}
+
+// Default is the process-wide recorder exported by the profiler HTTP server.
+var Default = NewRecorder(DefaultBuckets)
+
+// Recorder aggregates phase durations into histograms keyed by operation and
+// phase. It is safe for concurrent use; observing an existing series only
+// takes a read lock.
+type Recorder struct {
+	buckets []float64
+
+	mu     sync.RWMutex
+	series map[seriesKey]*series
+}
+
+type seriesKey struct {
+	operation string
+	phase     Name
+}
+
+type series struct {
+	count  atomic.Int64
+	errors atomic.Int64
+	sumNs  atomic.Int64
+	maxNs  atomic.Int64
+	counts []atomic.Int64 // per bucket, non-cumulative; the last one is +Inf
+}
+
+// NewRecorder returns a recorder with the given histogram bucket upper
+// bounds in seconds.
+func NewRecorder(buckets []float64) *Recorder {
+	buckets = slices.Clone(buckets)
+	sort.Float64s(buckets)
+
+	return &Recorder{
+		buckets: buckets,
+		series:  make(map[seriesKey]*series),
+	}
+}
+
+// Observe records one occurrence of a phase.
+func (r *Recorder) Observe(operation string, phase Name, d time.Duration, err error) {
+	s := r.lookup(seriesKey{operation: operation, phase: phase})
+
+	ns := d.Nanoseconds()
+	s.count.Add(1)
+	s.sumNs.Add(ns)
+
+	if err != nil {
+		s.errors.Add(1)
+	}
+
+	for {
+		current := s.maxNs.Load()
+		if ns <= current || s.maxNs.CompareAndSwap(current, ns) {
+			break
+		}
+	}
+
+	seconds := d.Seconds()
+	bucket := sort.SearchFloat64s(r.buckets, seconds)
+	s.counts[bucket].Add(1)
+}
+
+func (r *Recorder) lookup(key seriesKey) *series {
+	r.mu.RLock()
+	s, ok := r.series[key]
+	r.mu.RUnlock()
+
+	if ok {
+		return s
+	}
+
+	r.mu.Lock()
+	defer r.mu.Unlock()
+
+	if s, ok = r.series[key]; !ok {
+		s = &series{counts: make([]atomic.Int64, len(r.buckets)+1)}
+		r.series[key] = s
+	}
+
+	return s
+}
+
+// Reset drops all recorded series.
+func (r *Recorder) Reset() {
+	r.mu.Lock()
+	r.series = make(map[seriesKey]*series)
+	r.mu.Unlock()
+}
+
+// Stats is a point-in-time view of one series.
+type Stats struct {
+	Operation string        `json:"operation"`
+	Phase     Name          `json:"phase"`
+	Count     int64         `json:"count"`
+	Errors    int64         `json:"errors"`
+	Total     time.Duration `json:"total"`
+	Mean      time.Duration `json:"mean"`
+	Max       time.Duration `json:"max"`
+
+	// Buckets holds the cumulative count of observations at or below each
+	// DefaultBuckets bound, followed by the total count (+Inf).
+	Buckets []int64 `json:"buckets"`
+}
+
+// Snapshot returns the series sorted by operation and then by descending
+// total time, so the dominant phase of each operation comes first.
+func (r *Recorder) Snapshot() []Stats {
+	r.mu.RLock()
+	defer r.mu.RUnlock()
+
+	stats := make([]Stats, 0, len(r.series))
+
+	for key, s := range r.series {
+		st := Stats{
+			Operation: key.operation,
+			Phase:     key.phase,
+			Count:     s.count.Load(),
+			Errors:    s.errors.Load(),
+			Total:     time.Duration(s.sumNs.Load()),
+			Max:       time.Duration(s.maxNs.Load()),
+			Buckets:   make([]int64, len(s.counts)),
+		}
+
+		if st.Count > 0 {
+			st.Mean = st.Total / time.Duration(st.Count)
+		}
+
+		var cumulative int64
+		for i := range s.counts {
+			cumulative += s.counts[i].Load()
+			st.Buckets[i] = cumulative
+		}
+
+		stats = append(stats, st)
+	}
+
+	sort.Slice(stats, func(i, j int) bool {
+		if stats[i].Operation != stats[j].Operation {
+			return stats[i].Operation < stats[j].Operation
+		}
+
+		if stats[i].Total != stats[j].Total {
+			return stats[i].Total > stats[j].Total
+		}
+
+		return stats[i].Phase < stats[j].Phase
+	})
+
+	return stats
+}
+
+// WriteSummary prints a table of the phases of operation (all operations when
+// empty) with their share of the summed phase time. Phases of concurrent
+// workers overlap, so shares describe where the work went, not wall time.
+func (r *Recorder) WriteSummary(w io.Writer, operation string) error {
+	var (
+		rows []Stats
+		sum  time.Duration
+	)
+
+	for _, st := range r.Snapshot() {
+		if (operation == "" || st.Operation == operation) && st.Phase != Total {
+			rows = append(rows, st)
+			sum += st.Total
+		}
+	}
+
+	if len(rows) == 0 {
+		return nil
+	}
+
+	tw := tabwriter.NewWriter(w, 0, 0, 2, ' ', 0)
+	fmt.Fprintln(tw, "OPERATION\tPHASE\tCOUNT\tERRORS\tTOTAL\tMEAN\tMAX\tSHARE")
+
+	for _, st := range rows {
+		share := 0.0
+		if sum > 0 {
+			share = float64(st.Total) / float64(sum) * 100
+		}
+
+		fmt.Fprintf(tw, "%s\t%s\t%d\t%d\t%s\t%s\t%s\t%.1f%%\n",
+			st.Operation, st.Phase, st.Count, st.Errors,
+			st.Total.Round(time.Millisecond), st.Mean.Round(time.Microsecond),
+			st.Max.Round(time.Millisecond), share)
+	}
+
+	return tw.Flush()
+}
+
+type operationKey struct{}
+
+// WithOperation tags ctx with the operation its phases are recorded under.
+func WithOperation(ctx context.Context, operation string) context.Context {
+	return context.WithValue(ctx, operationKey{}, operation)
+}
+
+// Operation returns the operation ctx is tagged with, or "unknown".
+func Operation(ctx context.Context) string {
+	if operation, ok := ctx.Value(operationKey{}).(string); ok {
+		return operation
+	}
+
+	return "unknown"
+}
+
+// Span times one occurrence of a phase.
+type Span struct {
+	recorder  *Recorder
+	operation string
+	phase     Name
+	start     time.Time
+}
+
+// Start begins a span of phase for the operation of ctx on the Default
+// recorder.
+func Start(ctx context.Context, phase Name) Span {
+	return Span{recorder: Default, operation: Operation(ctx), phase: phase, start: time.Now()}
+}
+
+// End records the span and returns its duration.
+func (s Span) End(err error) time.Duration {
+	d := time.Since(s.start)
+	s.recorder.Observe(s.operation, s.phase, d, err)
+
+	return d
+}
+
+// Track runs fn as a span of phase.
+func Track(ctx context.Context, phase Name, fn func() error) error {
+	span := Start(ctx, phase)
+	err := fn()
+	span.End(err)
+
+	return err
+}
@@ -0,0 +1,121 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package phase
+
+import (
+	"context"
+	"errors"
+	"net/http/httptest"
+	"strings"
+	"sync"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func TestRecorder_Observe(t *testing.T) {
+	r := NewRecorder([]float64{0.01, 1})
+
+	r.Observe("sync", Clone, 5*time.Millisecond, nil)
+	r.Observe("sync", Clone, 500*time.Millisecond, errors.New("boom"))
+	r.Observe("sync", Clone, 2*time.Second, nil)
+	r.Observe("sync", StateSave, time.Millisecond, nil)
+
+	stats := r.Snapshot()
+	require.Len(t, stats, 2)
+
+	clone := stats[0]
+	assert.Equal(t, Clone, clone.Phase, "phases are ordered by total time")
+	assert.Equal(t, int64(3), clone.Count)
+	assert.Equal(t, int64(1), clone.Errors)
+	assert.Equal(t, 2505*time.Millisecond, clone.Total)
+	assert.Equal(t, 2*time.Second, clone.Max)
+	assert.Equal(t, []int64{1, 2, 3}, clone.Buckets)
+
+	r.Reset()
+	assert.Empty(t, r.Snapshot())
+}
+
+func TestRecorder_Concurrent(t *testing.T) {
+	r := NewRecorder(DefaultBuckets)
+
+	var wg sync.WaitGroup
+
+	for i := 0; i < 8; i++ {
+		wg.Add(1)
+
+		go func() {
+			defer wg.Done()
+
+			for j := 0; j < 1000; j++ {
+				r.Observe("bulk", Fetch, time.Millisecond, nil)
+			}
+		}()
+	}
+
+	wg.Wait()
+
+	stats := r.Snapshot()
+	require.Len(t, stats, 1)
+	assert.Equal(t, int64(8000), stats[0].Count)
+	assert.Equal(t, int64(8000), stats[0].Buckets[len(stats[0].Buckets)-1])
+}
+
+func TestSpan(t *testing.T) {
+	Default.Reset()
+	t.Cleanup(Default.Reset)
+
+	ctx := WithOperation(context.Background(), "synclone")
+	assert.Equal(t, "synclone", Operation(ctx))
+	assert.Equal(t, "unknown", Operation(context.Background()))
+
+	err := Track(ctx, APIList, func() error { return errors.New("rate limited") })
+	require.Error(t, err)
+
+	span := Start(ctx, Clone)
+	time.Sleep(time.Millisecond)
+	assert.GreaterOrEqual(t, span.End(nil), time.Millisecond)
+
+	stats := Default.Snapshot()
+	require.Len(t, stats, 2)
+	assert.Equal(t, Clone, stats[0].Phase)
+	assert.Equal(t, int64(1), stats[1].Errors)
+}
+
+func TestRecorder_WritePrometheus(t *testing.T) {
+	r := NewRecorder([]float64{0.5, 1})
+	r.Observe(`git "sync"`, Fetch, 250*time.Millisecond, nil)
+	r.Observe(`git "sync"`, Fetch, 3*time.Second, errors.New("timeout"))
+
+	rec := httptest.NewRecorder()
+	r.ServeHTTP(rec, httptest.NewRequest("GET", "/metrics", nil))
+
+	body := rec.Body.String()
+	assert.Contains(t, rec.Header().Get("Content-Type"), "version=0.0.4")
+	assert.Contains(t, body, "# TYPE gzh_phase_duration_seconds histogram\n")
+	assert.Contains(t, body, `gzh_phase_duration_seconds_bucket{operation="git \"sync\"",phase="fetch",le="0.5"} 1`)
+	assert.Contains(t, body, `gzh_phase_duration_seconds_bucket{operation="git \"sync\"",phase="fetch",le="1"} 1`)
+	assert.Contains(t, body, `gzh_phase_duration_seconds_bucket{operation="git \"sync\"",phase="fetch",le="+Inf"} 2`)
+	assert.Contains(t, body, `gzh_phase_duration_seconds_sum{operation="git \"sync\"",phase="fetch"} 3.25`)
+	assert.Contains(t, body, `gzh_phase_errors_total{operation="git \"sync\"",phase="fetch"} 1`)
+}
+
+func TestRecorder_WriteSummary(t *testing.T) {
+	r := NewRecorder(DefaultBuckets)
+	r.Observe("sync", Clone, 3*time.Second, nil)
+	r.Observe("sync", StateSave, time.Second, nil)
+	r.Observe("sync", Total, 10*time.Second, nil)
+	r.Observe("other", Clone, time.Second, nil)
+
+	var out strings.Builder
+	require.NoError(t, r.WriteSummary(&out, "sync"))
+
+	lines := strings.Split(strings.TrimSpace(out.String()), "\n")
+	require.Len(t, lines, 3)
+	assert.Contains(t, lines[1], "clone")
+	assert.Contains(t, lines[1], "75.0%")
+	assert.Contains(t, lines[2], "state_save")
+}
@@ -5,6 +5,7 @@ package profiling
 
 import (
 	"context"
+	"encoding/json"
 	"fmt"
 	"net/http"
 	"net/http/pprof"
@@ -16,6 +17,7 @@ import (
 	"time"
 
 	"github.com/gizzahub/gzh-cli/internal/logger"
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
 )
 
 // ProfileType represents different types of profiling.
@@ -343,7 +345,8 @@ func (p *Profiler) GetRuntimeStats() map[string]any {
 	}
 }
 
-// startHTTPServer starts the HTTP server for pprof endpoints.
+// startHTTPServer starts the HTTP server for pprof endpoints and the phase
+// metrics exporter.
 func (p *Profiler) startHTTPServer(_ context.Context) {
 	mux := http.NewServeMux()
 
@@ -354,6 +357,13 @@ func (p *Profiler) startHTTPServer(_ context.Context) {
 	mux.HandleFunc("/debug/pprof/symbol", pprof.Symbol)
 	mux.HandleFunc("/debug/pprof/trace", pprof.Trace)
 
+	// Phase histograms of long-running operations
+	mux.Handle("/metrics", phase.Default)
+	mux.HandleFunc("/debug/phases", func(w http.ResponseWriter, _ *http.Request) {
+		w.Header().Set("Content-Type", "application/json")
+		_ = json.NewEncoder(w).Encode(phase.Default.Snapshot())
+	})
+
 	// Custom endpoint for runtime stats
 	mux.HandleFunc("/debug/stats", func(w http.ResponseWriter, _ *http.Request) {
 		stats := p.GetRuntimeStats()
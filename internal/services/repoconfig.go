@@ -285,8 +285,13 @@ func (s *RepoConfigService) applyFiltersAndLimits(repos []*github.Repository, fi
 func (s *RepoConfigService) convertToRepositoryInfo(ctx context.Context, repos []*github.Repository, opts ListOptions, repoConfig *config.RepoConfig) []RepositoryInfo {
 	repositories := make([]RepositoryInfo, 0, len(repos))
 
+	var resolver *config.RepoConfigResolver
+	if repoConfig != nil {
+		resolver = config.NewRepoConfigResolver(repoConfig)
+	}
+
 	for _, repo := range repos {
-		info := s.createRepositoryInfo(repo, repoConfig)
+		info := s.createRepositoryInfo(repo, resolver)
 
 		if opts.ShowConfig {
 			s.addDetailedConfiguration(ctx, opts.Organization, &info)
@@ -299,18 +304,20 @@ func (s *RepoConfigService) convertToRepositoryInfo(ctx context.Context, repos [
 }
 
 // createRepositoryInfo creates a RepositoryInfo from a GitHub repository.
-func (s *RepoConfigService) createRepositoryInfo(repo *github.Repository, repoConfig *config.RepoConfig) RepositoryInfo {
+func (s *RepoConfigService) createRepositoryInfo(repo *github.Repository, resolver *config.RepoConfigResolver) RepositoryInfo {
 	visibility := "public"
 	if repo.Private {
 		visibility = "private"
 	}
 
+	template := s.detectTemplate(repo, resolver)
+
 	return RepositoryInfo{
 		Name:        repo.Name,
 		Description: repo.Description,
 		Visibility:  visibility,
-		Template:    s.detectTemplate(repo, repoConfig),
-		Compliant:   s.checkCompliance(repo, repoConfig),
+		Template:    template,
+		Compliant:   s.checkCompliance(template),
 		Issues:      0, // Could be calculated based on actual compliance checks
 	}
 }
@@ -324,51 +331,22 @@ func (s *RepoConfigService) addDetailedConfiguration(ctx context.Context, organi
 }
 
 // detectTemplate attempts to detect which template a repository is using.
-func (s *RepoConfigService) detectTemplate(repo *github.Repository, repoConfig *config.RepoConfig) string {
-	if repoConfig == nil || repoConfig.Repositories == nil {
+func (s *RepoConfigService) detectTemplate(repo *github.Repository, resolver *config.RepoConfigResolver) string {
+	if resolver == nil {
 		return templateNone
 	}
 
-	// Check specific repositories
-	for _, specific := range repoConfig.Repositories.Specific {
-		if specific.Name == repo.Name && specific.Template != "" {
-			return specific.Template
-		}
-	}
-
-	// Check patterns
-	for _, pattern := range repoConfig.Repositories.Patterns {
-		if matched, err := s.matchPattern(repo.Name, pattern.Match); err == nil && matched && pattern.Template != "" {
-			return pattern.Template
-		}
-	}
-
-	// Check default
-	if repoConfig.Repositories.Default != nil && repoConfig.Repositories.Default.Template != "" {
-		return repoConfig.Repositories.Default.Template
+	effective, err := resolver.Resolve(repo.Name)
+	if err != nil || effective.Template == "" {
+		return templateNone
 	}
 
-	return templateNone
+	return effective.Template
 }
 
 // checkCompliance checks if a repository is compliant with its template.
-func (s *RepoConfigService) checkCompliance(repo *github.Repository, repoConfig *config.RepoConfig) bool {
+func (s *RepoConfigService) checkCompliance(template string) bool {
 	// Simple compliance check - can be expanded
 	// For now, just check if it has a template assigned
-	template := s.detectTemplate(repo, repoConfig)
-	return template != "none"
-}
-
-// matchPattern checks if a string matches a pattern (simple glob support).
-func (s *RepoConfigService) matchPattern(str, pattern string) (bool, error) {
-	if pattern != "" && pattern[0] == '*' || pattern[len(pattern)-1] == '*' {
-		// Convert simple glob to regex
-		regexPattern := regexp.QuoteMeta(pattern)
-		regexPattern = regexp.MustCompile(`\\\*`).ReplaceAllString(regexPattern, ".*")
-		regexPattern = "^" + regexPattern + "$"
-
-		return regexp.MatchString(regexPattern, str)
-	}
-
-	return str == pattern, nil
+	return template != templateNone
 }
@@ -0,0 +1,464 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package simpleprof
+
+import (
+	"bytes"
+	"context"
+	"fmt"
+	"io"
+	"log"
+	"os"
+	"path/filepath"
+	"runtime"
+	"runtime/pprof"
+	"runtime/trace"
+	"sort"
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+// FlightRecorderConfig configures a FlightRecorder.
+type FlightRecorderConfig struct {
+	// OutputDir receives a directory per dump.
+	OutputDir string
+	// TraceMinAge and TraceMaxBytes bound the execution trace kept in memory.
+	TraceMinAge   time.Duration
+	TraceMaxBytes uint64
+	// ProfileInterval is how often delta profiles are taken; each CPU
+	// profile samples for CPUWindow of it.
+	ProfileInterval time.Duration
+	CPUWindow       time.Duration
+	// Deltas is the number of delta profiles kept.
+	Deltas int
+	// A dump is triggered when the number of goroutines exceeds
+	// GoroutineSpike times its moving average, by at least GoroutineMin.
+	GoroutineSpike float64
+	GoroutineMin   int
+	// StallTimeout is how long an operation begun with Begin may run before
+	// a dump is triggered.
+	StallTimeout time.Duration
+	// CheckInterval is how often goroutines and operations are checked.
+	CheckInterval time.Duration
+	// DumpCooldown is the minimum time between automatic dumps.
+	DumpCooldown time.Duration
+}
+
+// DefaultFlightRecorderConfig returns a configuration cheap enough to leave
+// running for hours.
+func DefaultFlightRecorderConfig() FlightRecorderConfig {
+	return FlightRecorderConfig{
+		OutputDir:       filepath.Join("tmp", "profiles", "flight"),
+		TraceMinAge:     30 * time.Second,
+		TraceMaxBytes:   16 << 20,
+		ProfileInterval: time.Minute,
+		CPUWindow:       5 * time.Second,
+		Deltas:          5,
+		GoroutineSpike:  2,
+		GoroutineMin:    200,
+		StallTimeout:    10 * time.Minute,
+		CheckInterval:   5 * time.Second,
+		DumpCooldown:    5 * time.Minute,
+	}
+}
+
+// DeltaProfile holds the profiles of one profile interval.
+type DeltaProfile struct {
+	Start time.Time
+	End   time.Time
+	// CPU is a pprof CPU profile of the CPU window, nil if the CPU profiler
+	// was in use elsewhere.
+	CPU []byte
+	// Heap is a heap profile in the pprof text format, with the allocations
+	// since the previous delta and the memory in use at its end.
+	Heap []byte
+}
+
+// traceRecorder is the part of trace.FlightRecorder the recorder uses.
+type traceRecorder interface {
+	Start() error
+	Stop()
+	WriteTo(w io.Writer) (int64, error)
+}
+
+func newTraceRecorder(config FlightRecorderConfig) traceRecorder {
+	return trace.NewFlightRecorder(trace.FlightRecorderConfig{
+		MinAge:   config.TraceMinAge,
+		MaxBytes: config.TraceMaxBytes,
+	})
+}
+
+// FlightRecorder keeps the recent past of the process in memory, an
+// execution trace and a few delta CPU and heap profiles, and writes it to
+// disk when something goes wrong: the number of goroutines spikes, an
+// operation stalls, Trigger is called (as the synclone memory monitor does
+// when usage passes its threshold), or the process receives SIGUSR1.
+//
+// Unlike periodic profiling nothing is written while all is well. The
+// methods of a nil *FlightRecorder do nothing, so callers need not check
+// whether one is running.
+type FlightRecorder struct {
+	config FlightRecorderConfig
+	trace  traceRecorder
+
+	triggers chan string
+	cancel   context.CancelFunc
+	wg       sync.WaitGroup
+
+	mu       sync.Mutex
+	deltas   []DeltaProfile // oldest first
+	lastHeap map[[32]uintptr]runtime.MemProfileRecord
+	ops      map[uint64]*operation
+	nextOp   uint64
+	lastDump time.Time
+	dumps    int
+}
+
+type operation struct {
+	name     string
+	start    time.Time
+	reported bool
+}
+
+// NewFlightRecorder creates a flight recorder; zero fields of config take
+// their default.
+func NewFlightRecorder(config FlightRecorderConfig) *FlightRecorder {
+	defaults := DefaultFlightRecorderConfig()
+
+	if config.OutputDir == "" {
+		config.OutputDir = defaults.OutputDir
+	}
+
+	if config.TraceMinAge <= 0 {
+		config.TraceMinAge = defaults.TraceMinAge
+	}
+
+	if config.TraceMaxBytes == 0 {
+		config.TraceMaxBytes = defaults.TraceMaxBytes
+	}
+
+	if config.ProfileInterval <= 0 {
+		config.ProfileInterval = defaults.ProfileInterval
+	}
+
+	if config.CPUWindow <= 0 || config.CPUWindow > config.ProfileInterval {
+		config.CPUWindow = min(defaults.CPUWindow, config.ProfileInterval)
+	}
+
+	if config.Deltas <= 0 {
+		config.Deltas = defaults.Deltas
+	}
+
+	if config.GoroutineSpike <= 1 {
+		config.GoroutineSpike = defaults.GoroutineSpike
+	}
+
+	if config.StallTimeout <= 0 {
+		config.StallTimeout = defaults.StallTimeout
+	}
+
+	if config.GoroutineMin <= 0 {
+		config.GoroutineMin = defaults.GoroutineMin
+	}
+
+	if config.CheckInterval <= 0 {
+		config.CheckInterval = defaults.CheckInterval
+	}
+
+	if config.DumpCooldown <= 0 {
+		config.DumpCooldown = defaults.DumpCooldown
+	}
+
+	return &FlightRecorder{
+		config:   config,
+		trace:    newTraceRecorder(config),
+		triggers: make(chan string, 1),
+		ops:      make(map[uint64]*operation),
+	}
+}
+
+// Start begins recording until ctx ends or Stop is called.
+func (fr *FlightRecorder) Start(ctx context.Context) error {
+	if err := fr.trace.Start(); err != nil {
+		return fmt.Errorf("failed to start trace flight recorder: %w", err)
+	}
+
+	fr.mu.Lock()
+	fr.lastHeap = heapRecords()
+	fr.mu.Unlock()
+
+	ctx, fr.cancel = context.WithCancel(ctx)
+
+	fr.wg.Add(2)
+
+	go fr.sample(ctx)
+	go fr.watch(ctx)
+
+	return nil
+}
+
+// Stop ends recording. Recorded data that was not dumped is discarded.
+func (fr *FlightRecorder) Stop() {
+	if fr == nil || fr.cancel == nil {
+		return
+	}
+
+	fr.cancel()
+	fr.wg.Wait()
+	fr.trace.Stop()
+}
+
+// Trigger requests a dump for reason. Requests during the cooldown after a
+// dump, or while one is pending, are dropped.
+func (fr *FlightRecorder) Trigger(reason string) {
+	if fr == nil {
+		return
+	}
+
+	select {
+	case fr.triggers <- reason:
+	default:
+	}
+}
+
+// Begin records the start of an operation, such as a repository clone, and
+// returns the function to call when it ends. An operation running longer
+// than the stall timeout triggers a dump.
+func (fr *FlightRecorder) Begin(name string) (end func()) {
+	if fr == nil {
+		return func() {}
+	}
+
+	fr.mu.Lock()
+	id := fr.nextOp
+	fr.nextOp++
+	fr.ops[id] = &operation{name: name, start: time.Now()}
+	fr.mu.Unlock()
+
+	return func() {
+		fr.mu.Lock()
+		delete(fr.ops, id)
+		fr.mu.Unlock()
+	}
+}
+
+// sample takes a delta profile every profile interval.
+func (fr *FlightRecorder) sample(ctx context.Context) {
+	defer fr.wg.Done()
+
+	ticker := time.NewTicker(fr.config.ProfileInterval)
+	defer ticker.Stop()
+
+	for {
+		select {
+		case <-ctx.Done():
+			return
+		case <-ticker.C:
+			fr.takeDelta(ctx)
+		}
+	}
+}
+
+// takeDelta profiles the CPU for the CPU window and records the heap
+// allocations since the previous delta.
+func (fr *FlightRecorder) takeDelta(ctx context.Context) {
+	delta := DeltaProfile{Start: time.Now()}
+
+	var cpu bytes.Buffer
+	if err := pprof.StartCPUProfile(&cpu); err == nil {
+		select {
+		case <-ctx.Done():
+		case <-time.After(fr.config.CPUWindow):
+		}
+
+		pprof.StopCPUProfile()
+
+		delta.CPU = cpu.Bytes()
+	}
+
+	current := heapRecords()
+	delta.End = time.Now()
+
+	fr.mu.Lock()
+	defer fr.mu.Unlock()
+
+	delta.Heap = formatHeapDelta(fr.lastHeap, current)
+	fr.lastHeap = current
+
+	fr.deltas = append(fr.deltas, delta)
+	if len(fr.deltas) > fr.config.Deltas {
+		fr.deltas = fr.deltas[len(fr.deltas)-fr.config.Deltas:]
+	}
+}
+
+// watch checks the triggers and dumps when one fires.
+func (fr *FlightRecorder) watch(ctx context.Context) {
+	defer fr.wg.Done()
+
+	signals, stopSignals := dumpSignals()
+	defer stopSignals()
+
+	ticker := time.NewTicker(fr.config.CheckInterval)
+	defer ticker.Stop()
+
+	average := float64(runtime.NumGoroutine())
+
+	for {
+		var (
+			reason string
+			forced bool
+		)
+
+		select {
+		case <-ctx.Done():
+			return
+		case <-signals:
+			reason, forced = "signal", true
+		case reason = <-fr.triggers:
+		case <-ticker.C:
+			reason = fr.checkStalls()
+
+			if n := float64(runtime.NumGoroutine()); n > average*fr.config.GoroutineSpike && n-average >= float64(fr.config.GoroutineMin) {
+				reason = fmt.Sprintf("goroutines spiked to %.0f from an average of %.0f", n, average)
+			} else {
+				// The average only follows normal load, so a slow leak still spikes
+				average += (n - average) / 10
+			}
+		}
+
+		if reason == "" {
+			continue
+		}
+
+		fr.mu.Lock()
+		cooling := !forced && !fr.lastDump.IsZero() && time.Since(fr.lastDump) < fr.config.DumpCooldown
+		fr.mu.Unlock()
+
+		if cooling {
+			continue
+		}
+
+		if dir, err := fr.Dump(reason); err != nil {
+			log.Printf("flight recorder: dump failed: %v", err)
+		} else {
+			log.Printf("flight recorder: %s, dumped to %s", reason, dir)
+		}
+	}
+}
+
+// checkStalls returns a reason if an operation newly passed the stall timeout.
+func (fr *FlightRecorder) checkStalls() string {
+	fr.mu.Lock()
+	defer fr.mu.Unlock()
+
+	var stalled []string
+
+	for _, op := range fr.ops {
+		if !op.reported && time.Since(op.start) > fr.config.StallTimeout {
+			op.reported = true
+			stalled = append(stalled, op.name)
+		}
+	}
+
+	if len(stalled) == 0 {
+		return ""
+	}
+
+	sort.Strings(stalled)
+
+	return fmt.Sprintf("stalled longer than %v: %v", fr.config.StallTimeout, stalled)
+}
+
+// Dump writes the recorded trace and delta profiles, with a goroutine dump
+// and the operations in progress, to a new directory under the output
+// directory, whose path it returns. The files can be read with
+// "go tool trace" and "go tool pprof", and consecutive heap deltas compared
+// with "gz profile compare".
+func (fr *FlightRecorder) Dump(reason string) (string, error) {
+	if fr == nil {
+		return "", fmt.Errorf("flight recorder is not running")
+	}
+
+	fr.mu.Lock()
+	fr.dumps++
+	fr.lastDump = time.Now()
+	dir := filepath.Join(fr.config.OutputDir, fmt.Sprintf("flight_%s_%d", fr.lastDump.Format("20060102_150405"), fr.dumps))
+	deltas := append([]DeltaProfile(nil), fr.deltas...)
+	summary := fr.summary(reason)
+	fr.mu.Unlock()
+
+	if err := os.MkdirAll(dir, 0o750); err != nil {
+		return "", fmt.Errorf("failed to create dump directory: %w", err)
+	}
+
+	files := map[string][]byte{"reason.txt": summary}
+
+	var traceData bytes.Buffer
+	if _, err := fr.trace.WriteTo(&traceData); err == nil {
+		files["trace.out"] = traceData.Bytes()
+	} else {
+		files["reason.txt"] = fmt.Appendf(files["reason.txt"], "trace unavailable: %v\n", err)
+	}
+
+	var goroutines bytes.Buffer
+	if err := pprof.Lookup("goroutine").WriteTo(&goroutines, 2); err == nil {
+		files["goroutines.txt"] = goroutines.Bytes()
+	}
+
+	for i, delta := range deltas {
+		if delta.CPU != nil {
+			files[fmt.Sprintf("cpu_delta_%d.prof", i+1)] = delta.CPU
+		}
+
+		files[fmt.Sprintf("heap_delta_%d.prof", i+1)] = delta.Heap
+	}
+
+	for name, data := range files {
+		if err := os.WriteFile(filepath.Join(dir, name), data, 0o600); err != nil {
+			return dir, fmt.Errorf("failed to write %s: %w", name, err)
+		}
+	}
+
+	return dir, nil
+}
+
+// summary describes the dump and the operations in progress (assumes mutex
+// is held).
+func (fr *FlightRecorder) summary(reason string) []byte {
+	var b bytes.Buffer
+
+	fmt.Fprintf(&b, "reason: %s\ntime: %s\ngoroutines: %d\n", reason, fr.lastDump.Format(time.RFC3339), runtime.NumGoroutine())
+
+	for i, delta := range fr.deltas {
+		fmt.Fprintf(&b, "delta %d: %s - %s\n", i+1, delta.Start.Format(time.TimeOnly), delta.End.Format(time.TimeOnly))
+	}
+
+	ops := make([]*operation, 0, len(fr.ops))
+	for _, op := range fr.ops {
+		ops = append(ops, op)
+	}
+
+	sort.Slice(ops, func(i, j int) bool { return ops[i].start.Before(ops[j].start) })
+
+	for _, op := range ops {
+		fmt.Fprintf(&b, "running %v: %s\n", time.Since(op.start).Round(time.Second), op.name)
+	}
+
+	return b.Bytes()
+}
+
+var defaultFlightRecorder atomic.Pointer[FlightRecorder]
+
+// SetDefaultFlightRecorder makes fr the recorder returned by
+// DefaultFlightRecorder; nil removes it.
+func SetDefaultFlightRecorder(fr *FlightRecorder) {
+	defaultFlightRecorder.Store(fr)
+}
+
+// DefaultFlightRecorder returns the process-wide recorder, nil when none
+// runs.
+func DefaultFlightRecorder() *FlightRecorder {
+	return defaultFlightRecorder.Load()
+}
@@ -0,0 +1,148 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package simpleprof
+
+import (
+	"bytes"
+	"context"
+	"io"
+	"os"
+	"path/filepath"
+	"runtime"
+	"strings"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+// fakeTrace stands in for the runtime trace flight recorder, which only one
+// caller per process may run.
+type fakeTrace struct{}
+
+func (fakeTrace) Start() error { return nil }
+func (fakeTrace) Stop()        {}
+
+func (fakeTrace) WriteTo(w io.Writer) (int64, error) {
+	n, err := io.WriteString(w, "trace")
+	return int64(n), err
+}
+
+func newTestRecorder(t *testing.T, config FlightRecorderConfig) *FlightRecorder {
+	t.Helper()
+
+	config.OutputDir = t.TempDir()
+
+	fr := NewFlightRecorder(config)
+	fr.trace = fakeTrace{}
+
+	return fr
+}
+
+var sink [][]byte
+
+//go:noinline
+func allocateForHeapDelta(n int) {
+	for range n {
+		sink = append(sink, make([]byte, 64<<10))
+	}
+}
+
+func TestHeapDelta_RoundTrip(t *testing.T) {
+	previousRate := runtime.MemProfileRate
+	runtime.MemProfileRate = 1
+	defer func() { runtime.MemProfileRate = previousRate }()
+
+	// Allocation records are published by a GC cycle
+	runtime.GC()
+	before := heapRecords()
+
+	allocateForHeapDelta(16)
+	runtime.GC()
+	runtime.GC()
+
+	data := formatHeapDelta(before, heapRecords())
+	sink = nil
+
+	assert.True(t, bytes.HasPrefix(data, []byte(heapProfileHeader)))
+
+	delta, err := ParseHeapDelta(bytes.NewReader(data))
+	require.NoError(t, err)
+
+	function := "github.com/gizzahub/gzh-cli/internal/simpleprof.allocateForHeapDelta"
+	assert.GreaterOrEqual(t, delta.AllocBytes[function], int64(16*64<<10))
+	assert.GreaterOrEqual(t, delta.TotalAllocBytes, delta.AllocBytes[function])
+
+	_, err = ParseHeapDelta(strings.NewReader("\x1f\x8b binary pprof"))
+	assert.Error(t, err)
+}
+
+func TestFlightRecorder_Dump(t *testing.T) {
+	fr := newTestRecorder(t, FlightRecorderConfig{ProfileInterval: 20 * time.Millisecond, CPUWindow: 10 * time.Millisecond, Deltas: 2})
+
+	fr.takeDelta(context.Background())
+	fr.takeDelta(context.Background())
+	fr.takeDelta(context.Background())
+	require.Len(t, fr.deltas, 2, "only the latest deltas are kept")
+
+	end := fr.Begin("clone org/repo")
+	defer end()
+
+	dir, err := fr.Dump("test")
+	require.NoError(t, err)
+
+	for _, name := range []string{"reason.txt", "trace.out", "goroutines.txt", "heap_delta_1.prof", "heap_delta_2.prof"} {
+		assert.FileExists(t, filepath.Join(dir, name))
+	}
+
+	reason, err := os.ReadFile(filepath.Join(dir, "reason.txt"))
+	require.NoError(t, err)
+	assert.Contains(t, string(reason), "reason: test")
+	assert.Contains(t, string(reason), "clone org/repo")
+}
+
+func TestFlightRecorder_StallTriggersDump(t *testing.T) {
+	fr := newTestRecorder(t, FlightRecorderConfig{
+		ProfileInterval: time.Hour,
+		StallTimeout:    20 * time.Millisecond,
+		CheckInterval:   10 * time.Millisecond,
+		DumpCooldown:    time.Hour,
+	})
+
+	require.NoError(t, fr.Start(context.Background()))
+	defer fr.Stop()
+
+	end := fr.Begin("fetch org/slow")
+	defer end()
+
+	dumps := func() []os.DirEntry {
+		entries, err := os.ReadDir(fr.config.OutputDir)
+		require.NoError(t, err)
+
+		return entries
+	}
+
+	require.Eventually(t, func() bool { return len(dumps()) == 1 }, 5*time.Second, 10*time.Millisecond)
+
+	reason, err := os.ReadFile(filepath.Join(fr.config.OutputDir, dumps()[0].Name(), "reason.txt"))
+	require.NoError(t, err)
+	assert.Contains(t, string(reason), "stalled longer than 20ms: [fetch org/slow]")
+
+	// Further triggers fall within the cooldown
+	fr.Trigger("memory threshold")
+	time.Sleep(50 * time.Millisecond)
+	assert.Len(t, dumps(), 1)
+}
+
+func TestFlightRecorder_Nil(t *testing.T) {
+	var fr *FlightRecorder
+
+	fr.Trigger("ignored")
+	fr.Begin("ignored")()
+	fr.Stop()
+
+	_, err := fr.Dump("ignored")
+	assert.Error(t, err)
+}
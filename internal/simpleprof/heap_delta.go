@@ -0,0 +1,174 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package simpleprof
+
+import (
+	"bufio"
+	"bytes"
+	"fmt"
+	"io"
+	"runtime"
+	"strings"
+)
+
+// heapProfileHeader starts heap profiles in the pprof text format.
+const heapProfileHeader = "heap profile:"
+
+// heapRecords returns the heap profile records of the runtime by stack.
+func heapRecords() map[[32]uintptr]runtime.MemProfileRecord {
+	var records []runtime.MemProfileRecord
+
+	n, _ := runtime.MemProfile(nil, true)
+	for {
+		// Allocate room for a few more records than seen, as they may grow
+		records = make([]runtime.MemProfileRecord, n+50)
+
+		var ok bool
+		if n, ok = runtime.MemProfile(records, true); ok {
+			records = records[:n]
+			break
+		}
+	}
+
+	byStack := make(map[[32]uintptr]runtime.MemProfileRecord, len(records))
+	for _, record := range records {
+		byStack[record.Stack0] = record
+	}
+
+	return byStack
+}
+
+// formatHeapDelta writes the allocations between two sets of heap records
+// and the memory in use in current as a heap profile in the text format of
+// runtime/pprof, which "go tool pprof" reads. Stacks are symbolized, so that
+// ParseHeapDelta can attribute allocations without the binary.
+func formatHeapDelta(previous, current map[[32]uintptr]runtime.MemProfileRecord) []byte {
+	type sample struct {
+		inUseObjects, inUseBytes, allocObjects, allocBytes int64
+		stack                                              []uintptr
+	}
+
+	var (
+		samples []sample
+		total   sample
+	)
+
+	for key, record := range current {
+		prev := previous[key]
+
+		s := sample{
+			inUseObjects: record.InUseObjects(),
+			inUseBytes:   record.InUseBytes(),
+			allocObjects: record.AllocObjects - prev.AllocObjects,
+			allocBytes:   record.AllocBytes - prev.AllocBytes,
+			stack:        record.Stack(),
+		}
+
+		if s.allocBytes == 0 && s.inUseBytes == 0 {
+			continue
+		}
+
+		total.inUseObjects += s.inUseObjects
+		total.inUseBytes += s.inUseBytes
+		total.allocObjects += s.allocObjects
+		total.allocBytes += s.allocBytes
+
+		samples = append(samples, s)
+	}
+
+	var b bytes.Buffer
+
+	fmt.Fprintf(&b, "%s %d: %d [%d: %d] @ heap/%d\n", heapProfileHeader,
+		total.inUseObjects, total.inUseBytes, total.allocObjects, total.allocBytes, 2*runtime.MemProfileRate)
+
+	for _, s := range samples {
+		fmt.Fprintf(&b, "%d: %d [%d: %d] @", s.inUseObjects, s.inUseBytes, s.allocObjects, s.allocBytes)
+
+		for _, pc := range s.stack {
+			fmt.Fprintf(&b, " %#x", pc)
+		}
+
+		b.WriteString("\n")
+
+		frames := runtime.CallersFrames(s.stack)
+		for {
+			frame, more := frames.Next()
+			fmt.Fprintf(&b, "#\t%#x\t%s+%#x\t%s:%d\n", frame.PC, frame.Function, frame.PC-frame.Entry, frame.File, frame.Line)
+
+			if !more {
+				break
+			}
+		}
+
+		b.WriteString("\n")
+	}
+
+	return b.Bytes()
+}
+
+// HeapDelta is the allocated bytes of a heap delta profile, by the function
+// that allocated them.
+type HeapDelta struct {
+	AllocBytes      map[string]int64
+	TotalAllocBytes int64
+}
+
+// ParseHeapDelta reads a heap profile in the text format written by the
+// flight recorder. It fails for other formats, such as binary pprof files.
+func ParseHeapDelta(r io.Reader) (*HeapDelta, error) {
+	scanner := bufio.NewScanner(r)
+	scanner.Buffer(make([]byte, 0, 64*1024), 1024*1024)
+
+	if !scanner.Scan() || !strings.HasPrefix(scanner.Text(), heapProfileHeader) {
+		return nil, fmt.Errorf("not a heap delta profile")
+	}
+
+	delta := &HeapDelta{AllocBytes: make(map[string]int64)}
+
+	var (
+		allocBytes int64
+		attributed = true // whether allocBytes went to a function yet
+	)
+
+	for scanner.Scan() {
+		line := scanner.Text()
+
+		switch {
+		case line == "":
+			continue
+		case strings.HasPrefix(line, "#"):
+			// The first frame of a sample is the allocating function
+			if attributed {
+				continue
+			}
+
+			fields := strings.Split(line, "\t")
+			if len(fields) < 3 {
+				continue
+			}
+
+			function := fields[2]
+			if i := strings.LastIndex(function, "+0x"); i > 0 {
+				function = function[:i]
+			}
+
+			delta.AllocBytes[function] += allocBytes
+			attributed = true
+		default:
+			var inUseObjects, inUseBytes, allocObjects int64
+			if _, err := fmt.Sscanf(line, "%d: %d [%d: %d]", &inUseObjects, &inUseBytes, &allocObjects, &allocBytes); err != nil {
+				return nil, fmt.Errorf("invalid sample %q: %w", line, err)
+			}
+
+			delta.TotalAllocBytes += allocBytes
+			attributed = false
+		}
+	}
+
+	if err := scanner.Err(); err != nil {
+		return nil, fmt.Errorf("failed to read heap delta profile: %w", err)
+	}
+
+	return delta, nil
+}
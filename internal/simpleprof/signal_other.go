@@ -0,0 +1,13 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+//go:build !unix
+
+package simpleprof
+
+import "os"
+
+// dumpSignals returns a nil channel, as there is no SIGUSR1 here.
+func dumpSignals() (<-chan os.Signal, func()) {
+	return nil, func() {}
+}
@@ -0,0 +1,21 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+//go:build unix
+
+package simpleprof
+
+import (
+	"os"
+	"os/signal"
+	"syscall"
+)
+
+// dumpSignals returns the channel receiving SIGUSR1, which requests a flight
+// recorder dump, and the function to stop receiving it.
+func dumpSignals() (<-chan os.Signal, func()) {
+	signals := make(chan os.Signal, 1)
+	signal.Notify(signals, syscall.SIGUSR1)
+
+	return signals, func() { signal.Stop(signals) }
+}
@@ -0,0 +1,198 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package discovery
+
+import (
+	"crypto/sha256"
+	"encoding/hex"
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"strings"
+	"sync"
+	"time"
+)
+
+// discoveryCacheVersion is bumped whenever the cache format changes.
+const discoveryCacheVersion = 1
+
+// cacheMinAge is how old a directory's mtime must be before it is cached, so
+// that changes made within the filesystem's timestamp granularity of a scan
+// are not masked on the next run.
+const cacheMinAge = 2 * time.Second
+
+// discoveryCache remembers, per directory, the subdirectories it contained or
+// the repository it held, keyed on the directory mtime. Adding or removing an
+// entry changes a directory's mtime, so an unchanged mtime means its listing
+// can be reused without reading it again.
+type discoveryCache struct {
+	path string
+
+	mu      sync.Mutex
+	entries map[string]*dirCacheEntry
+	visited map[string]*dirCacheEntry
+}
+
+type dirCacheEntry struct {
+	ModTime int64          `json:"mtime"`
+	Subdirs []cachedSubdir `json:"subdirs,omitempty"`
+	Repo    *cachedRepo    `json:"repo,omitempty"`
+}
+
+type cachedSubdir struct {
+	Name    string `json:"name"`
+	Symlink bool   `json:"symlink,omitempty"`
+}
+
+type cachedRepo struct {
+	// Fingerprint covers the git metadata files the repository info was read from
+	Fingerprint  string         `json:"fingerprint"`
+	SizeComputed bool           `json:"sizeComputed,omitempty"`
+	Info         DiscoveredRepo `json:"info"`
+}
+
+type discoveryCacheFile struct {
+	Version int                       `json:"version"`
+	Entries map[string]*dirCacheEntry `json:"entries"`
+}
+
+// defaultCacheDir returns ~/.gzh/cache/discovery, falling back to the current directory.
+func defaultCacheDir() string {
+	if homeDir, err := os.UserHomeDir(); err == nil {
+		return filepath.Join(homeDir, ".gzh", "cache", "discovery")
+	}
+
+	return filepath.Join(".gzh", "cache", "discovery")
+}
+
+// cacheFileFor returns the cache file used for scans of basePath.
+func cacheFileFor(cacheDir, basePath string) string {
+	if abs, err := filepath.Abs(basePath); err == nil {
+		basePath = abs
+	}
+
+	sum := sha256.Sum256([]byte(basePath))
+
+	return filepath.Join(cacheDir, hex.EncodeToString(sum[:])[:16]+".json")
+}
+
+// loadDiscoveryCache loads the cache file, starting empty if it is missing,
+// unreadable or of another version.
+func loadDiscoveryCache(path string) *discoveryCache {
+	cache := &discoveryCache{
+		path:    path,
+		entries: make(map[string]*dirCacheEntry),
+		visited: make(map[string]*dirCacheEntry),
+	}
+
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return cache
+	}
+
+	var file discoveryCacheFile
+	if err := json.Unmarshal(data, &file); err != nil || file.Version != discoveryCacheVersion {
+		return cache
+	}
+
+	if file.Entries != nil {
+		cache.entries = file.Entries
+	}
+
+	return cache
+}
+
+// lookup returns the cached entry for dir if its mtime is unchanged.
+func (c *discoveryCache) lookup(dir string, modTime time.Time) (*dirCacheEntry, bool) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	entry, exists := c.entries[dir]
+	if !exists || entry.ModTime != modTime.UnixNano() {
+		return nil, false
+	}
+
+	return entry, true
+}
+
+// store records the entry for dir for the next run. Recently modified
+// directories are not stored.
+func (c *discoveryCache) store(dir string, modTime time.Time, entry *dirCacheEntry) {
+	if time.Since(modTime) < cacheMinAge {
+		return
+	}
+
+	entry.ModTime = modTime.UnixNano()
+
+	c.mu.Lock()
+	c.visited[dir] = entry
+	c.mu.Unlock()
+}
+
+// save writes the entries stored during this run, dropping directories that
+// no longer exist or were not reached.
+func (c *discoveryCache) save() error {
+	c.mu.Lock()
+	data, err := json.Marshal(discoveryCacheFile{Version: discoveryCacheVersion, Entries: c.visited})
+	c.mu.Unlock()
+
+	if err != nil {
+		return fmt.Errorf("failed to encode discovery cache: %w", err)
+	}
+
+	if err := os.MkdirAll(filepath.Dir(c.path), 0o755); err != nil {
+		return fmt.Errorf("failed to create discovery cache directory: %w", err)
+	}
+
+	tmp, err := os.CreateTemp(filepath.Dir(c.path), ".discovery-*.tmp")
+	if err != nil {
+		return fmt.Errorf("failed to write discovery cache: %w", err)
+	}
+	defer os.Remove(tmp.Name())
+
+	if _, err := tmp.Write(data); err != nil {
+		_ = tmp.Close()
+		return fmt.Errorf("failed to write discovery cache: %w", err)
+	}
+
+	if err := tmp.Close(); err != nil {
+		return fmt.Errorf("failed to write discovery cache: %w", err)
+	}
+
+	return os.Rename(tmp.Name(), c.path)
+}
+
+// repoFingerprint summarises the mtimes and sizes of the git metadata files a
+// repository's info is read from. When sizes are computed, the object store
+// directories are included as well.
+func repoFingerprint(gitDir, branch string, withSize bool) string {
+	commonDir := gitCommonDir(gitDir)
+
+	files := []string{
+		filepath.Join(gitDir, "HEAD"),
+		filepath.Join(commonDir, "config"),
+		filepath.Join(commonDir, "packed-refs"),
+	}
+
+	if branch != "" {
+		files = append(files, filepath.Join(commonDir, "refs", "heads", filepath.FromSlash(branch)))
+	}
+
+	if withSize {
+		files = append(files, filepath.Join(commonDir, "objects"), filepath.Join(commonDir, "objects", "pack"))
+	}
+
+	var b strings.Builder
+
+	for _, file := range files {
+		if info, err := os.Stat(file); err == nil {
+			fmt.Fprintf(&b, "%d:%d;", info.ModTime().UnixNano(), info.Size())
+		} else {
+			b.WriteString("-;")
+		}
+	}
+
+	return b.String()
+}
@@ -0,0 +1,251 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package discovery
+
+import (
+	"bufio"
+	"bytes"
+	"context"
+	"errors"
+	"fmt"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"strconv"
+	"strings"
+)
+
+// errUnsupportedGitDir is returned when repository metadata cannot be read
+// in-process (e.g. reftable refs), in which case the git CLI is used instead.
+var errUnsupportedGitDir = errors.New("unsupported git directory layout")
+
+// gitMeta holds the repository metadata read directly from the .git directory.
+type gitMeta struct {
+	RemoteURL  string
+	Branch     string
+	LastCommit string
+}
+
+// readGitMeta reads the remote URL, current branch and HEAD commit from
+// .git/config, .git/HEAD, loose refs and packed-refs without forking git.
+func readGitMeta(gitDir string) (*gitMeta, error) {
+	commonDir := gitCommonDir(gitDir)
+
+	if _, err := os.Stat(filepath.Join(commonDir, "reftable")); err == nil {
+		return nil, errUnsupportedGitDir
+	}
+
+	remoteURL, err := readRemoteURL(filepath.Join(commonDir, "config"))
+	if err != nil && !errors.Is(err, os.ErrNotExist) {
+		return nil, err
+	}
+
+	head, err := os.ReadFile(filepath.Join(gitDir, "HEAD"))
+	if err != nil {
+		return nil, fmt.Errorf("failed to read HEAD: %w", err)
+	}
+
+	meta := &gitMeta{RemoteURL: remoteURL}
+
+	value := strings.TrimSpace(string(head))
+	if ref, ok := strings.CutPrefix(value, "ref: "); ok {
+		meta.Branch = strings.TrimPrefix(ref, "refs/heads/")
+		// An unborn branch has no commit yet
+		meta.LastCommit, _ = resolveRef(gitDir, commonDir, ref)
+
+		return meta, nil
+	}
+
+	// Detached HEAD: no current branch, HEAD holds the commit
+	meta.LastCommit = value
+
+	return meta, nil
+}
+
+// gitCommonDir returns the directory holding config and shared refs, which
+// differs from gitDir for linked worktrees.
+func gitCommonDir(gitDir string) string {
+	data, err := os.ReadFile(filepath.Join(gitDir, "commondir"))
+	if err != nil {
+		return gitDir
+	}
+
+	commonDir := strings.TrimSpace(string(data))
+	if !filepath.IsAbs(commonDir) {
+		commonDir = filepath.Join(gitDir, commonDir)
+	}
+
+	return commonDir
+}
+
+// resolveRef resolves a ref to a commit hash through loose refs, following
+// symbolic refs, and falling back to packed-refs.
+func resolveRef(gitDir, commonDir, ref string) (string, error) {
+	for range 5 {
+		data, err := os.ReadFile(filepath.Join(refDir(gitDir, commonDir, ref), filepath.FromSlash(ref)))
+		if err != nil {
+			return resolvePackedRef(commonDir, ref)
+		}
+
+		value := strings.TrimSpace(string(data))
+
+		target, symbolic := strings.CutPrefix(value, "ref: ")
+		if !symbolic {
+			return value, nil
+		}
+
+		ref = target
+	}
+
+	return "", fmt.Errorf("too many levels of symbolic refs: %s", ref)
+}
+
+// refDir returns where a loose ref lives: per-worktree refs stay in gitDir,
+// everything under refs/ is shared through the common directory.
+func refDir(gitDir, commonDir, ref string) string {
+	if strings.HasPrefix(ref, "refs/") {
+		return commonDir
+	}
+
+	return gitDir
+}
+
+func resolvePackedRef(commonDir, ref string) (string, error) {
+	file, err := os.Open(filepath.Join(commonDir, "packed-refs"))
+	if err != nil {
+		return "", fmt.Errorf("ref not found: %s", ref)
+	}
+	defer file.Close()
+
+	scanner := bufio.NewScanner(file)
+	for scanner.Scan() {
+		line := scanner.Text()
+		if line == "" || line[0] == '#' || line[0] == '^' {
+			continue
+		}
+
+		if hash, name, ok := strings.Cut(line, " "); ok && name == ref {
+			return hash, nil
+		}
+	}
+
+	if err := scanner.Err(); err != nil {
+		return "", err
+	}
+
+	return "", fmt.Errorf("ref not found: %s", ref)
+}
+
+// readRemoteURL returns the URL of the "origin" remote, or of the first remote
+// defined in the config file when there is no origin. A repository without
+// remotes yields an empty URL.
+func readRemoteURL(configPath string) (string, error) {
+	file, err := os.Open(configPath)
+	if err != nil {
+		return "", err
+	}
+	defer file.Close()
+
+	var (
+		section  string
+		firstURL string
+	)
+
+	scanner := bufio.NewScanner(file)
+	for scanner.Scan() {
+		line := strings.TrimSpace(scanner.Text())
+		if line == "" || line[0] == '#' || line[0] == ';' {
+			continue
+		}
+
+		if line[0] == '[' {
+			section = parseConfigSection(line)
+			continue
+		}
+
+		remote, isRemote := strings.CutPrefix(section, "remote.")
+		if !isRemote {
+			continue
+		}
+
+		key, value, _ := strings.Cut(line, "=")
+		if !strings.EqualFold(strings.TrimSpace(key), "url") {
+			continue
+		}
+
+		value = unquoteConfigValue(strings.TrimSpace(value))
+		if remote == "origin" {
+			return value, nil
+		}
+
+		if firstURL == "" && isValidRemoteName(remote) {
+			firstURL = value
+		}
+	}
+
+	if err := scanner.Err(); err != nil {
+		return "", err
+	}
+
+	return firstURL, nil
+}
+
+// parseConfigSection turns a section header such as `[remote "origin"]` into
+// "remote.origin". Section names are case-insensitive, subsections are not.
+func parseConfigSection(line string) string {
+	header := strings.TrimSuffix(strings.TrimPrefix(line, "["), "]")
+	if idx := strings.IndexByte(header, ']'); idx >= 0 {
+		header = header[:idx]
+	}
+
+	name, subsection, ok := strings.Cut(header, " ")
+	if !ok {
+		return strings.ToLower(header)
+	}
+
+	return strings.ToLower(name) + "." + strings.Trim(strings.TrimSpace(subsection), `"`)
+}
+
+func unquoteConfigValue(value string) string {
+	// Drop trailing comments outside of quotes
+	inQuotes := false
+	for i, r := range value {
+		switch {
+		case r == '"':
+			inQuotes = !inQuotes
+		case (r == '#' || r == ';') && !inQuotes:
+			value = strings.TrimSpace(value[:i])
+			return strings.ReplaceAll(value, `"`, "")
+		}
+	}
+
+	return strings.ReplaceAll(value, `"`, "")
+}
+
+// countObjectsSize returns the size of a repository's object store in bytes,
+// as reported by `git count-objects -v` (loose objects plus packs).
+func countObjectsSize(ctx context.Context, repoPath string) (int64, error) {
+	output, err := exec.CommandContext(ctx, "git", "-C", repoPath, "count-objects", "-v").Output()
+	if err != nil {
+		return 0, fmt.Errorf("failed to count objects: %w", err)
+	}
+
+	var sizeKiB int64
+
+	for _, line := range bytes.Split(output, []byte("\n")) {
+		key, value, ok := strings.Cut(string(line), ":")
+		if !ok || (key != "size" && key != "size-pack") {
+			continue
+		}
+
+		n, err := strconv.ParseInt(strings.TrimSpace(value), 10, 64)
+		if err != nil {
+			return 0, fmt.Errorf("failed to parse count-objects output: %w", err)
+		}
+
+		sizeKiB += n
+	}
+
+	return sizeKiB * 1024, nil
+}
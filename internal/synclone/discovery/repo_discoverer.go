@@ -10,7 +10,10 @@ import (
 	"os/exec"
 	"path/filepath"
 	"regexp"
+	"runtime"
+	"sort"
 	"strings"
+	"sync"
 )
 
 // RepoDiscoverer handles repository discovery and configuration generation.
@@ -19,6 +22,13 @@ type RepoDiscoverer struct {
 	MaxDepth       int
 	IgnorePatterns []string
 	FollowSymlinks bool
+	// Workers bounds the number of directories read concurrently.
+	Workers int
+	// ComputeSize fills DiscoveredRepo.Size from `git count-objects`. It is off
+	// by default because it forks git once per repository.
+	ComputeSize bool
+	// CacheDir holds the discovery cache; empty disables caching.
+	CacheDir string
 }
 
 // DiscoveredRepo represents a discovered repository with metadata.
@@ -40,101 +50,201 @@ func NewRepoDiscoverer(basePath string) *RepoDiscoverer {
 		MaxDepth:       3,
 		IgnorePatterns: []string{".git", "node_modules", ".venv", "target", "build"},
 		FollowSymlinks: false,
+		Workers:        max(4, runtime.NumCPU()),
+		CacheDir:       defaultCacheDir(),
 	}
 }
 
 // DiscoverRepos discovers all Git repositories in the base path.
+// Directories are walked in parallel and repositories are returned sorted by path.
 func (rd *RepoDiscoverer) DiscoverRepos() ([]DiscoveredRepo, error) {
-	var repos []DiscoveredRepo
+	w := &repoWalker{
+		rd:  rd,
+		sem: make(chan struct{}, max(1, rd.Workers)),
+	}
 
-	err := rd.walkDirectory(rd.BasePath, 0, &repos)
-	if err != nil {
+	if rd.CacheDir != "" {
+		w.cache = loadDiscoveryCache(cacheFileFor(rd.CacheDir, rd.BasePath))
+	}
+
+	if _, err := os.ReadDir(rd.BasePath); err != nil {
 		return nil, fmt.Errorf("failed to discover repositories: %w", err)
 	}
 
-	return repos, nil
+	w.walk(rd.BasePath, 0)
+	w.wg.Wait()
+
+	if w.cache != nil {
+		// The cache only saves work; failing to persist it is not an error
+		_ = w.cache.save()
+	}
+
+	sort.Slice(w.repos, func(i, j int) bool {
+		return w.repos[i].Path < w.repos[j].Path
+	})
+
+	return w.repos, nil
 }
 
-// walkDirectory recursively walks directories to find Git repositories.
-func (rd *RepoDiscoverer) walkDirectory(dir string, depth int, repos *[]DiscoveredRepo) error {
-	if depth > rd.MaxDepth {
-		return nil
+// repoWalker walks a directory tree with bounded parallelism. A subdirectory
+// is handed to a new goroutine when a worker slot is free and walked inline
+// otherwise, so the walk never blocks waiting for slots.
+type repoWalker struct {
+	rd    *RepoDiscoverer
+	cache *discoveryCache
+	sem   chan struct{}
+	wg    sync.WaitGroup
+
+	mu    sync.Mutex
+	repos []DiscoveredRepo
+}
+
+// walk finds Git repositories under dir.
+func (w *repoWalker) walk(dir string, depth int) {
+	if depth > w.rd.MaxDepth {
+		return
 	}
 
-	entries, err := os.ReadDir(dir)
+	info, err := os.Stat(dir)
 	if err != nil {
-		return err
+		return
 	}
 
-	// Check if current directory is a Git repository
-	gitDir := filepath.Join(dir, ".git")
-	if stat, err := os.Stat(gitDir); err == nil && stat.IsDir() {
-		repo, err := rd.analyzeRepository(dir)
-		if err == nil {
-			*repos = append(*repos, *repo)
+	var cached *dirCacheEntry
+	if w.cache != nil {
+		cached, _ = w.cache.lookup(dir, info.ModTime())
+	}
+
+	entry := cached
+	if entry == nil {
+		entry = &dirCacheEntry{}
+
+		// Check if current directory is a Git repository
+		gitDir := filepath.Join(dir, ".git")
+		if stat, err := os.Stat(gitDir); err == nil && stat.IsDir() {
+			entry.Repo = &cachedRepo{}
+		} else if entry.Subdirs, err = readSubdirs(dir); err != nil {
+			return
 		}
-		// Don't recurse into .git directories
-		return nil
+	}
+
+	if entry.Repo != nil {
+		// Don't recurse into repositories
+		repo, err := w.analyzeCached(dir, entry.Repo)
+		if err != nil {
+			return
+		}
+
+		entry = &dirCacheEntry{Repo: repo}
+
+		w.mu.Lock()
+		w.repos = append(w.repos, repo.Info)
+		w.mu.Unlock()
+	}
+
+	if w.cache != nil {
+		w.cache.store(dir, info.ModTime(), entry)
 	}
 
 	// Recurse into subdirectories
-	for _, entry := range entries {
-		if !entry.IsDir() {
+	for _, subdir := range entry.Subdirs {
+		if w.rd.shouldIgnore(subdir.Name) {
 			continue
 		}
 
-		name := entry.Name()
-		if rd.shouldIgnore(name) {
+		if subdir.Symlink && !w.rd.FollowSymlinks {
 			continue
 		}
 
-		subPath := filepath.Join(dir, name)
+		subPath := filepath.Join(dir, subdir.Name)
 
-		// Handle symlinks
-		if !rd.FollowSymlinks {
-			if info, err := entry.Info(); err == nil {
-				if info.Mode()&os.ModeSymlink != 0 {
-					continue
-				}
-			}
+		select {
+		case w.sem <- struct{}{}:
+			w.wg.Add(1)
+
+			go func() {
+				defer func() {
+					<-w.sem
+					w.wg.Done()
+				}()
+
+				w.walk(subPath, depth+1)
+			}()
+		default:
+			w.walk(subPath, depth+1)
 		}
+	}
+}
 
-		if err := rd.walkDirectory(subPath, depth+1, repos); err != nil {
-			// Log error but continue with other directories
-			continue
+// analyzeCached returns the cached repository info if the repository's git
+// metadata is unchanged, analyzing the repository again otherwise.
+func (w *repoWalker) analyzeCached(dir string, cached *cachedRepo) (*cachedRepo, error) {
+	gitDir := filepath.Join(dir, ".git")
+
+	if cached.Fingerprint != "" && (cached.SizeComputed || !w.rd.ComputeSize) &&
+		cached.Fingerprint == repoFingerprint(gitDir, cached.Info.Branch, cached.SizeComputed) {
+		return cached, nil
+	}
+
+	repo, err := w.rd.analyzeRepository(dir)
+	if err != nil {
+		return nil, err
+	}
+
+	return &cachedRepo{
+		Fingerprint:  repoFingerprint(gitDir, repo.Branch, w.rd.ComputeSize),
+		SizeComputed: w.rd.ComputeSize,
+		Info:         *repo,
+	}, nil
+}
+
+// readSubdirs lists the subdirectories of dir, including symlinks that point
+// to directories.
+func readSubdirs(dir string) ([]cachedSubdir, error) {
+	entries, err := os.ReadDir(dir)
+	if err != nil {
+		return nil, err
+	}
+
+	var subdirs []cachedSubdir
+
+	for _, entry := range entries {
+		switch {
+		case entry.IsDir():
+			subdirs = append(subdirs, cachedSubdir{Name: entry.Name()})
+		case entry.Type()&os.ModeSymlink != 0:
+			if info, err := os.Stat(filepath.Join(dir, entry.Name())); err == nil && info.IsDir() {
+				subdirs = append(subdirs, cachedSubdir{Name: entry.Name(), Symlink: true})
+			}
 		}
 	}
 
-	return nil
+	return subdirs, nil
 }
 
 // analyzeRepository analyzes a Git repository and extracts metadata.
+// Metadata is read from the .git directory in-process; the git CLI is only
+// used when the layout is not understood, and for sizes when requested.
 func (rd *RepoDiscoverer) analyzeRepository(repoPath string) (*DiscoveredRepo, error) {
-	// Get remote URL using git command
-	remoteURL, err := rd.getRemoteURL(repoPath)
-	if err != nil {
-		// Continue without remote URL if git command fails
-		remoteURL = ""
+	var remoteURL, branch, lastCommit string
+
+	if meta, err := readGitMeta(filepath.Join(repoPath, ".git")); err == nil {
+		remoteURL, branch, lastCommit = meta.RemoteURL, meta.Branch, meta.LastCommit
+	} else {
+		// Continue without each value if its git command fails
+		remoteURL, _ = rd.getRemoteURL(repoPath)
+		branch, _ = rd.getCurrentBranch(repoPath)
+		lastCommit, _ = rd.getLastCommit(repoPath)
 	}
 
 	// Parse provider, org, and repo name from URL
 	provider, org, repoName := rd.parseRemoteURL(remoteURL)
 
-	// Get current branch
-	branch, err := rd.getCurrentBranch(repoPath)
-	if err != nil {
-		branch = ""
-	}
-
-	// Get last commit
-	lastCommit, err := rd.getLastCommit(repoPath)
-	if err != nil {
-		lastCommit = ""
+	var size int64
+	if rd.ComputeSize {
+		size = rd.calculateRepoSize(repoPath)
 	}
 
-	// Calculate repository size
-	size := rd.calculateRepoSize(repoPath)
-
 	return &DiscoveredRepo{
 		Path:       repoPath,
 		RemoteURL:  remoteURL,
@@ -280,19 +390,10 @@ func (rd *RepoDiscoverer) shouldIgnore(name string) bool {
 	return false
 }
 
-// calculateRepoSize calculates the approximate size of a repository.
+// calculateRepoSize returns the size of a repository's object store as
+// reported by git count-objects, or 0 if it cannot be determined.
 func (rd *RepoDiscoverer) calculateRepoSize(repoPath string) int64 {
-	var size int64
-
-	err := filepath.Walk(repoPath, func(_ string, info os.FileInfo, err error) error {
-		if err != nil {
-			return nil //nolint:nilerr // 접근 불가능한 파일은 건너뜀
-		}
-		if !info.IsDir() {
-			size += info.Size()
-		}
-		return nil
-	})
+	size, err := countObjectsSize(context.Background(), repoPath)
 	if err != nil {
 		return 0
 	}
@@ -315,6 +416,16 @@ func (rd *RepoDiscoverer) SetFollowSymlinks(follow bool) {
 	rd.FollowSymlinks = follow
 }
 
+// SetComputeSize enables or disables repository size computation.
+func (rd *RepoDiscoverer) SetComputeSize(compute bool) {
+	rd.ComputeSize = compute
+}
+
+// SetCacheDir sets the discovery cache directory. An empty path disables caching.
+func (rd *RepoDiscoverer) SetCacheDir(dir string) {
+	rd.CacheDir = dir
+}
+
 // getRemoteURL gets the remote URL for a Git repository.
 func (rd *RepoDiscoverer) getRemoteURL(repoPath string) (string, error) {
 	ctx := context.Background()
@@ -0,0 +1,216 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package discovery
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+const (
+	testCommitMain    = "1111111111111111111111111111111111111111"
+	testCommitPacked  = "2222222222222222222222222222222222222222"
+	testCommitDetach  = "3333333333333333333333333333333333333333"
+	testRemoteGitHub  = "git@github.com:testorg/repo-a.git"
+	testRemoteUpsteam = "https://gitlab.com/upstream/repo-b.git"
+)
+
+func writeTestFile(t *testing.T, path, content string) {
+	t.Helper()
+	require.NoError(t, os.MkdirAll(filepath.Dir(path), 0o755))
+	require.NoError(t, os.WriteFile(path, []byte(content), 0o644))
+}
+
+// createTestRepo creates a minimal .git directory without running git.
+func createTestRepo(t *testing.T, dir string, files map[string]string) {
+	t.Helper()
+
+	for name, content := range files {
+		writeTestFile(t, filepath.Join(dir, ".git", filepath.FromSlash(name)), content)
+	}
+}
+
+func TestReadGitMeta(t *testing.T) {
+	tests := []struct {
+		name     string
+		files    map[string]string
+		expected gitMeta
+	}{
+		{
+			name: "loose ref with origin",
+			files: map[string]string{
+				"HEAD":            "ref: refs/heads/main\n",
+				"refs/heads/main": testCommitMain + "\n",
+				"config": `[core]
+	bare = false
+[remote "upstream"]
+	url = ` + testRemoteUpsteam + `
+[remote "origin"]
+	url = ` + testRemoteGitHub + `
+	fetch = +refs/heads/*:refs/remotes/origin/*
+`,
+			},
+			expected: gitMeta{RemoteURL: testRemoteGitHub, Branch: "main", LastCommit: testCommitMain},
+		},
+		{
+			name: "packed ref without origin",
+			files: map[string]string{
+				"HEAD":        "ref: refs/heads/feature/x\n",
+				"packed-refs": "# pack-refs with: peeled fully-peeled sorted\n" + testCommitPacked + " refs/heads/feature/x\n^" + testCommitMain + "\n",
+				"config":      "[remote \"upstream\"]\n\turl = \"" + testRemoteUpsteam + "\" # mirror\n",
+			},
+			expected: gitMeta{RemoteURL: testRemoteUpsteam, Branch: "feature/x", LastCommit: testCommitPacked},
+		},
+		{
+			name: "detached head",
+			files: map[string]string{
+				"HEAD":   testCommitDetach + "\n",
+				"config": "[core]\n\tbare = false\n",
+			},
+			expected: gitMeta{LastCommit: testCommitDetach},
+		},
+		{
+			name: "unborn branch",
+			files: map[string]string{
+				"HEAD": "ref: refs/heads/main\n",
+			},
+			expected: gitMeta{Branch: "main"},
+		},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			dir := t.TempDir()
+			createTestRepo(t, dir, tt.files)
+
+			meta, err := readGitMeta(filepath.Join(dir, ".git"))
+			require.NoError(t, err)
+			assert.Equal(t, tt.expected, *meta)
+		})
+	}
+}
+
+func TestReadGitMeta_Reftable(t *testing.T) {
+	dir := t.TempDir()
+	createTestRepo(t, dir, map[string]string{
+		"HEAD":                 "ref: refs/heads/.invalid\n",
+		"reftable/tables.list": "",
+	})
+
+	_, err := readGitMeta(filepath.Join(dir, ".git"))
+	assert.ErrorIs(t, err, errUnsupportedGitDir)
+}
+
+func newTestDiscoverer(basePath string) *RepoDiscoverer {
+	rd := NewRepoDiscoverer(basePath)
+	rd.SetCacheDir("")
+
+	return rd
+}
+
+func TestDiscoverRepos(t *testing.T) {
+	base := t.TempDir()
+
+	repoFiles := map[string]string{
+		"HEAD":            "ref: refs/heads/main\n",
+		"refs/heads/main": testCommitMain + "\n",
+		"config":          "[remote \"origin\"]\n\turl = " + testRemoteGitHub + "\n",
+	}
+
+	createTestRepo(t, filepath.Join(base, "github", "repo-a"), repoFiles)
+	createTestRepo(t, filepath.Join(base, "github", "repo-a", "nested"), repoFiles)
+	createTestRepo(t, filepath.Join(base, "alpha"), repoFiles)
+	createTestRepo(t, filepath.Join(base, "node_modules", "dep"), repoFiles)
+	createTestRepo(t, filepath.Join(base, "a", "b", "c", "too-deep"), repoFiles)
+
+	rd := newTestDiscoverer(base)
+	rd.Workers = 2
+
+	repos, err := rd.DiscoverRepos()
+	require.NoError(t, err)
+
+	// Sorted by path, ignored and too deep directories skipped, no nested repositories
+	require.Len(t, repos, 2)
+	assert.Equal(t, filepath.Join(base, "alpha"), repos[0].Path)
+	assert.Equal(t, filepath.Join(base, "github", "repo-a"), repos[1].Path)
+
+	assert.Equal(t, testRemoteGitHub, repos[1].RemoteURL)
+	assert.Equal(t, "github", repos[1].Provider)
+	assert.Equal(t, "testorg", repos[1].Org)
+	assert.Equal(t, "repo-a", repos[1].RepoName)
+	assert.Equal(t, "main", repos[1].Branch)
+	assert.Equal(t, testCommitMain, repos[1].LastCommit)
+	assert.Zero(t, repos[1].Size)
+}
+
+func TestDiscoverRepos_MissingBasePath(t *testing.T) {
+	_, err := newTestDiscoverer(filepath.Join(t.TempDir(), "missing")).DiscoverRepos()
+	assert.Error(t, err)
+}
+
+// ageTree moves the mtimes of every directory under root into the past so
+// they are old enough to be cached.
+func ageTree(t *testing.T, root string) {
+	t.Helper()
+
+	past := time.Now().Add(-time.Hour)
+
+	require.NoError(t, filepath.Walk(root, func(path string, info os.FileInfo, err error) error {
+		if err != nil {
+			return err
+		}
+
+		return os.Chtimes(path, past, past)
+	}))
+}
+
+func TestDiscoverRepos_Cache(t *testing.T) {
+	base := t.TempDir()
+	cacheDir := t.TempDir()
+
+	createTestRepo(t, filepath.Join(base, "org", "repo"), map[string]string{
+		"HEAD":            "ref: refs/heads/main\n",
+		"refs/heads/main": testCommitMain + "\n",
+	})
+	ageTree(t, base)
+
+	rd := NewRepoDiscoverer(base)
+	rd.SetCacheDir(cacheDir)
+
+	repos, err := rd.DiscoverRepos()
+	require.NoError(t, err)
+	require.Len(t, repos, 1)
+
+	// A repository added without changing the parent's mtime stays invisible
+	// to cached runs, proving the listing was not read again
+	orgDir := filepath.Join(base, "org")
+	info, err := os.Stat(orgDir)
+	require.NoError(t, err)
+
+	createTestRepo(t, filepath.Join(orgDir, "hidden"), map[string]string{"HEAD": "ref: refs/heads/main\n"})
+	require.NoError(t, os.Chtimes(orgDir, info.ModTime(), info.ModTime()))
+
+	repos, err = rd.DiscoverRepos()
+	require.NoError(t, err)
+	assert.Len(t, repos, 1)
+
+	// A new commit changes the repository fingerprint
+	refPath := filepath.Join(orgDir, "repo", ".git", "refs", "heads", "main")
+	writeTestFile(t, refPath, testCommitPacked+"\n")
+
+	repos, err = rd.DiscoverRepos()
+	require.NoError(t, err)
+	require.Len(t, repos, 1)
+	assert.Equal(t, testCommitPacked, repos[0].LastCommit)
+
+	// Disabling the cache sees the full tree
+	rd.SetCacheDir("")
+
+	repos, err = rd.DiscoverRepos()
+	require.NoError(t, err)
+	assert.Len(t, repos, 2)
+}
@@ -0,0 +1,429 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package discovery
+
+import (
+	"bufio"
+	"bytes"
+	"context"
+	"encoding/json"
+	"fmt"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"runtime"
+	"sort"
+	"strconv"
+	"strings"
+	"sync"
+	"time"
+)
+
+// statusIndexVersion is bumped whenever the status index format changes.
+const statusIndexVersion = 1
+
+// RepoStatus is the working-tree state of a repository.
+type RepoStatus struct {
+	Path   string `json:"path"`
+	Branch string `json:"branch,omitempty"`
+	// Head is the commit checked out, empty on an unborn branch.
+	Head string `json:"head,omitempty"`
+	// Upstream is the upstream branch, e.g. "origin/main", if one is set.
+	Upstream string `json:"upstream,omitempty"`
+	// UpstreamHead is the commit of the upstream branch, empty if it is gone.
+	UpstreamHead string `json:"upstreamHead,omitempty"`
+	Ahead        int    `json:"ahead,omitempty"`
+	Behind       int    `json:"behind,omitempty"`
+	// Dirty is set when there are staged, unstaged or untracked changes.
+	Dirty bool `json:"dirty"`
+	// IndexModTime is the mtime of .git/index when the status was taken.
+	IndexModTime time.Time `json:"indexMtime"`
+	Err          string    `json:"error,omitempty"`
+}
+
+// StatusStats reports how a status query was answered.
+type StatusStats struct {
+	Cached    int
+	Refreshed int
+	Failed    int
+}
+
+// StatusIndex keeps the working-tree status of a fleet of repositories,
+// keyed on a fingerprint of .git/index, HEAD and the refs and config the
+// status depends on. Repositories whose fingerprint is unchanged are answered
+// from the index without forking git; the others are refreshed with
+// `git status --porcelain=v2`.
+//
+// Editing a tracked file does not touch .git/index until git next looks at
+// the working tree, so such edits surface on the next forced refresh.
+type StatusIndex struct {
+	path string
+
+	// Workers bounds the number of git status processes run at once.
+	Workers int
+	// FSMonitor runs git status with the built-in filesystem monitor. It is
+	// off by default: git starts a long-lived monitor daemon for every
+	// repository it is enabled in, which across a fleet of repositories costs
+	// far more than it saves.
+	FSMonitor bool
+
+	// minAge is how old the fingerprinted files must be for an entry to be
+	// reused, see cacheMinAge.
+	minAge time.Duration
+
+	mu      sync.Mutex
+	entries map[string]*statusEntry
+}
+
+type statusEntry struct {
+	// Fingerprint is empty for entries that must be refreshed on next use
+	Fingerprint string     `json:"fingerprint"`
+	Status      RepoStatus `json:"status"`
+}
+
+type statusIndexFile struct {
+	Version int                     `json:"version"`
+	Entries map[string]*statusEntry `json:"entries"`
+}
+
+// defaultStatusIndexDir returns ~/.gzh/cache/status, falling back to the current directory.
+func defaultStatusIndexDir() string {
+	if homeDir, err := os.UserHomeDir(); err == nil {
+		return filepath.Join(homeDir, ".gzh", "cache", "status")
+	}
+
+	return filepath.Join(".gzh", "cache", "status")
+}
+
+// StatusIndexPath returns the index file used for the repositories under
+// basePath in the default cache directory.
+func StatusIndexPath(basePath string) string {
+	return cacheFileFor(defaultStatusIndexDir(), basePath)
+}
+
+// LoadStatusIndex loads the index persisted at path, starting empty if it is
+// missing, unreadable or of another version. An empty path keeps the index in
+// memory only.
+func LoadStatusIndex(path string) *StatusIndex {
+	index := &StatusIndex{
+		path:      path,
+		Workers: max(4, runtime.NumCPU()),
+		minAge:  cacheMinAge,
+		entries: make(map[string]*statusEntry),
+	}
+
+	if path == "" {
+		return index
+	}
+
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return index
+	}
+
+	var file statusIndexFile
+	if err := json.Unmarshal(data, &file); err != nil || file.Version != statusIndexVersion {
+		return index
+	}
+
+	for repoPath, entry := range file.Entries {
+		if entry != nil {
+			index.entries[repoPath] = entry
+		}
+	}
+
+	return index
+}
+
+// Status returns the status of each repository in repoPaths, sorted by path.
+// Unchanged repositories are served from the index; force refreshes all of
+// them. Repositories whose status cannot be taken are reported with Err set.
+func (ix *StatusIndex) Status(ctx context.Context, repoPaths []string, force bool) ([]RepoStatus, StatusStats, error) {
+	statuses := make([]RepoStatus, len(repoPaths))
+	seen := make(map[string]bool, len(repoPaths))
+
+	var (
+		stats StatusStats
+		stale []int
+	)
+
+	ix.mu.Lock()
+
+	for i, repoPath := range repoPaths {
+		seen[repoPath] = true
+
+		entry, ok := ix.entries[repoPath]
+		if !force && ok && entry.Fingerprint != "" &&
+			entry.Fingerprint == ix.fingerprint(filepath.Join(repoPath, ".git"), entry.Status) {
+			statuses[i] = entry.Status
+			stats.Cached++
+
+			continue
+		}
+
+		stale = append(stale, i)
+	}
+
+	ix.mu.Unlock()
+
+	sem := make(chan struct{}, max(1, ix.Workers))
+
+	var (
+		wg sync.WaitGroup
+		mu sync.Mutex
+	)
+
+	for _, i := range stale {
+		select {
+		case sem <- struct{}{}:
+		case <-ctx.Done():
+			wg.Wait()
+			return nil, stats, ctx.Err()
+		}
+
+		wg.Add(1)
+
+		go func(i int) {
+			defer func() {
+				<-sem
+				wg.Done()
+			}()
+
+			status, err := ix.refresh(ctx, repoPaths[i])
+
+			mu.Lock()
+			defer mu.Unlock()
+
+			if err != nil {
+				statuses[i] = RepoStatus{Path: repoPaths[i], Err: err.Error()}
+				stats.Failed++
+
+				return
+			}
+
+			statuses[i] = status
+			stats.Refreshed++
+		}(i)
+	}
+
+	wg.Wait()
+
+	if err := ctx.Err(); err != nil {
+		return nil, stats, err
+	}
+
+	ix.mu.Lock()
+
+	for _, i := range stale {
+		if statuses[i].Err != "" {
+			delete(ix.entries, repoPaths[i])
+			continue
+		}
+
+		gitDir := filepath.Join(repoPaths[i], ".git")
+		ix.entries[repoPaths[i]] = &statusEntry{Fingerprint: ix.fingerprint(gitDir, statuses[i]), Status: statuses[i]}
+	}
+
+	// Drop repositories that are no longer part of the fleet
+	for repoPath := range ix.entries {
+		if !seen[repoPath] {
+			delete(ix.entries, repoPath)
+		}
+	}
+
+	ix.mu.Unlock()
+
+	sorted := make([]RepoStatus, len(statuses))
+	copy(sorted, statuses)
+	sort.Slice(sorted, func(i, j int) bool {
+		return sorted[i].Path < sorted[j].Path
+	})
+
+	return sorted, stats, nil
+}
+
+// refresh takes the status of a repository with git. The index is written
+// back by git status, so the fingerprint is taken afterwards by the caller.
+func (ix *StatusIndex) refresh(ctx context.Context, repoPath string) (RepoStatus, error) {
+	args := []string{"-C", repoPath, "-c", "core.untrackedCache=true"}
+	if ix.FSMonitor {
+		args = append(args, "-c", "core.fsmonitor=true")
+	}
+
+	args = append(args, "status", "--porcelain=v2", "--branch")
+
+	var stderr bytes.Buffer
+
+	cmd := exec.CommandContext(ctx, "git", args...)
+	cmd.Stderr = &stderr
+
+	output, err := cmd.Output()
+	if err != nil {
+		return RepoStatus{}, fmt.Errorf("git status failed: %w: %s", err, strings.TrimSpace(stderr.String()))
+	}
+
+	status, err := parsePorcelainV2(output)
+	if err != nil {
+		return RepoStatus{}, err
+	}
+
+	status.Path = repoPath
+	gitDir := filepath.Join(repoPath, ".git")
+
+	if status.Upstream != "" {
+		// An upstream without ahead/behind counts no longer exists
+		status.UpstreamHead, _ = resolveUpstream(gitDir, status.Upstream)
+	}
+
+	if info, err := os.Stat(filepath.Join(gitDir, "index")); err == nil {
+		status.IndexModTime = info.ModTime()
+	}
+
+	return status, nil
+}
+
+// parsePorcelainV2 reads the branch headers and change entries of
+// `git status --porcelain=v2 --branch`.
+func parsePorcelainV2(output []byte) (RepoStatus, error) {
+	var status RepoStatus
+
+	scanner := bufio.NewScanner(bytes.NewReader(output))
+	scanner.Buffer(make([]byte, 64*1024), 1024*1024)
+
+	for scanner.Scan() {
+		line := scanner.Text()
+		if line == "" {
+			continue
+		}
+
+		header, ok := strings.CutPrefix(line, "# ")
+		if !ok {
+			// Any changed, unmerged or untracked entry
+			status.Dirty = true
+			continue
+		}
+
+		key, value, _ := strings.Cut(header, " ")
+
+		switch key {
+		case "branch.oid":
+			if value != "(initial)" {
+				status.Head = value
+			}
+		case "branch.head":
+			if value != "(detached)" {
+				status.Branch = value
+			}
+		case "branch.upstream":
+			status.Upstream = value
+		case "branch.ab":
+			ahead, behind, ok := strings.Cut(value, " ")
+			if !ok {
+				return status, fmt.Errorf("malformed branch.ab header: %q", value)
+			}
+
+			var err error
+			if status.Ahead, err = strconv.Atoi(strings.TrimPrefix(ahead, "+")); err != nil {
+				return status, fmt.Errorf("malformed branch.ab header: %q", value)
+			}
+
+			if status.Behind, err = strconv.Atoi(strings.TrimPrefix(behind, "-")); err != nil {
+				return status, fmt.Errorf("malformed branch.ab header: %q", value)
+			}
+		}
+	}
+
+	return status, scanner.Err()
+}
+
+// resolveUpstream resolves an upstream branch as shown by git status:
+// "origin/main" for a remote-tracking branch, "main" for a local one.
+func resolveUpstream(gitDir, upstream string) (string, error) {
+	commonDir := gitCommonDir(gitDir)
+
+	if hash, err := resolveRef(gitDir, commonDir, "refs/remotes/"+upstream); err == nil {
+		return hash, nil
+	}
+
+	return resolveRef(gitDir, commonDir, "refs/heads/"+upstream)
+}
+
+// fingerprint summarises the mtimes and sizes of the files a status depends
+// on: the index, HEAD, config, packed-refs and the loose refs of the branch
+// and its upstream. It is empty while any of them was modified within minAge,
+// as a change within the timestamp granularity would be missed.
+func (ix *StatusIndex) fingerprint(gitDir string, status RepoStatus) string {
+	commonDir := gitCommonDir(gitDir)
+
+	files := []string{
+		filepath.Join(gitDir, "index"),
+		filepath.Join(gitDir, "HEAD"),
+		filepath.Join(commonDir, "config"),
+		filepath.Join(commonDir, "packed-refs"),
+	}
+
+	if status.Branch != "" {
+		files = append(files, filepath.Join(commonDir, "refs", "heads", filepath.FromSlash(status.Branch)))
+	}
+
+	if status.Upstream != "" {
+		files = append(files,
+			filepath.Join(commonDir, "refs", "remotes", filepath.FromSlash(status.Upstream)),
+			filepath.Join(commonDir, "refs", "heads", filepath.FromSlash(status.Upstream)))
+	}
+
+	var b strings.Builder
+
+	for _, file := range files {
+		info, err := os.Stat(file)
+		if err != nil {
+			b.WriteString("-;")
+			continue
+		}
+
+		if time.Since(info.ModTime()) < ix.minAge {
+			return ""
+		}
+
+		fmt.Fprintf(&b, "%d:%d;", info.ModTime().UnixNano(), info.Size())
+	}
+
+	return b.String()
+}
+
+// Save persists the index. It is a no-op for in-memory indexes.
+func (ix *StatusIndex) Save() error {
+	if ix.path == "" {
+		return nil
+	}
+
+	ix.mu.Lock()
+	data, err := json.Marshal(statusIndexFile{Version: statusIndexVersion, Entries: ix.entries})
+	ix.mu.Unlock()
+
+	if err != nil {
+		return fmt.Errorf("failed to encode status index: %w", err)
+	}
+
+	if err := os.MkdirAll(filepath.Dir(ix.path), 0o755); err != nil {
+		return fmt.Errorf("failed to create status index directory: %w", err)
+	}
+
+	tmp, err := os.CreateTemp(filepath.Dir(ix.path), ".status-*.tmp")
+	if err != nil {
+		return fmt.Errorf("failed to write status index: %w", err)
+	}
+	defer os.Remove(tmp.Name())
+
+	if _, err := tmp.Write(data); err != nil {
+		_ = tmp.Close()
+		return fmt.Errorf("failed to write status index: %w", err)
+	}
+
+	if err := tmp.Close(); err != nil {
+		return fmt.Errorf("failed to write status index: %w", err)
+	}
+
+	return os.Rename(tmp.Name(), ix.path)
+}
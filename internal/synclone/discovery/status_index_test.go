@@ -0,0 +1,145 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package discovery
+
+import (
+	"context"
+	"os/exec"
+	"path/filepath"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func TestParsePorcelainV2(t *testing.T) {
+	tests := []struct {
+		name     string
+		output   string
+		expected RepoStatus
+	}{
+		{
+			name: "clean and ahead of upstream",
+			output: "# branch.oid " + testCommitMain + "\n# branch.head main\n" +
+				"# branch.upstream origin/main\n# branch.ab +2 -1\n",
+			expected: RepoStatus{Branch: "main", Head: testCommitMain, Upstream: "origin/main", Ahead: 2, Behind: 1},
+		},
+		{
+			name: "changed and untracked entries",
+			output: "# branch.oid " + testCommitMain + "\n# branch.head feature/x\n" +
+				"1 .M N... 100644 100644 100644 " + testCommitMain + " " + testCommitMain + " main.go\n? notes.txt\n",
+			expected: RepoStatus{Branch: "feature/x", Head: testCommitMain, Dirty: true},
+		},
+		{
+			name:     "unborn branch",
+			output:   "# branch.oid (initial)\n# branch.head main\n? README.md\n",
+			expected: RepoStatus{Branch: "main", Dirty: true},
+		},
+		{
+			name:     "detached head with gone upstream",
+			output:   "# branch.oid " + testCommitDetach + "\n# branch.head (detached)\n# branch.upstream origin/gone\n",
+			expected: RepoStatus{Head: testCommitDetach, Upstream: "origin/gone"},
+		},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			status, err := parsePorcelainV2([]byte(tt.output))
+			require.NoError(t, err)
+			assert.Equal(t, tt.expected, status)
+		})
+	}
+
+	_, err := parsePorcelainV2([]byte("# branch.ab +x -1\n"))
+	assert.Error(t, err)
+}
+
+func runTestGit(t *testing.T, dir string, args ...string) {
+	t.Helper()
+
+	cmd := exec.Command("git", append([]string{"-C", dir, "-c", "user.name=test", "-c", "user.email=test@example.com"}, args...)...)
+	output, err := cmd.CombinedOutput()
+	require.NoError(t, err, string(output))
+}
+
+// loadTestStatusIndex loads an index that reuses entries regardless of how
+// recently the repositories changed, as the tests change them constantly.
+func loadTestStatusIndex(path string) *StatusIndex {
+	index := LoadStatusIndex(path)
+	index.minAge = 0
+
+	return index
+}
+
+func TestStatusIndex(t *testing.T) {
+	if _, err := exec.LookPath("git"); err != nil {
+		t.Skip("git not available")
+	}
+
+	base := t.TempDir()
+	clean := filepath.Join(base, "clean")
+	dirty := filepath.Join(base, "dirty")
+
+	for _, repo := range []string{clean, dirty} {
+		runTestGit(t, base, "init", "-q", "-b", "main", repo)
+		writeTestFile(t, filepath.Join(repo, "README.md"), "hello\n")
+		runTestGit(t, repo, "add", "README.md")
+		runTestGit(t, repo, "commit", "-q", "-m", "initial")
+	}
+
+	writeTestFile(t, filepath.Join(dirty, "notes.txt"), "todo\n")
+
+	indexPath := filepath.Join(t.TempDir(), "status.json")
+	repos := []string{dirty, clean}
+	ctx := context.Background()
+
+	index := loadTestStatusIndex(indexPath)
+
+	_, stats, err := index.Status(ctx, repos, false)
+	require.NoError(t, err)
+	assert.Equal(t, StatusStats{Refreshed: 2}, stats)
+	require.NoError(t, index.Save())
+
+	// A new process answers from the persisted index without running git
+	index = loadTestStatusIndex(indexPath)
+
+	statuses, stats, err := index.Status(ctx, repos, false)
+	require.NoError(t, err)
+	assert.Equal(t, StatusStats{Cached: 2}, stats, "unchanged repositories are answered from the index")
+
+	require.Len(t, statuses, 2)
+	assert.Equal(t, clean, statuses[0].Path)
+	assert.False(t, statuses[0].Dirty)
+	assert.Equal(t, "main", statuses[0].Branch)
+	assert.Len(t, statuses[0].Head, 40)
+	assert.False(t, statuses[0].IndexModTime.IsZero())
+	assert.Equal(t, dirty, statuses[1].Path)
+	assert.True(t, statuses[1].Dirty)
+
+	// Staging a change rewrites the index of that repository only
+	runTestGit(t, dirty, "add", "notes.txt")
+
+	_, stats, err = index.Status(ctx, repos, false)
+	require.NoError(t, err)
+	assert.Equal(t, StatusStats{Cached: 1, Refreshed: 1}, stats)
+
+	// Forced queries refresh everything; missing repositories are reported
+	statuses, stats, err = index.Status(ctx, []string{clean, filepath.Join(base, "missing")}, true)
+	require.NoError(t, err)
+	assert.Equal(t, StatusStats{Refreshed: 1, Failed: 1}, stats)
+	require.Len(t, statuses, 2)
+	assert.NotEmpty(t, statuses[1].Err)
+}
+
+func TestLoadStatusIndex_Invalid(t *testing.T) {
+	dir := t.TempDir()
+
+	outdated := filepath.Join(dir, "outdated.json")
+	writeTestFile(t, outdated, `{"version":0,"entries":{"/repo":{"fingerprint":"x","status":{"path":"/repo"}}}}`)
+	assert.Empty(t, LoadStatusIndex(outdated).entries)
+
+	corrupt := filepath.Join(dir, "corrupt.json")
+	writeTestFile(t, corrupt, "{")
+	assert.Empty(t, LoadStatusIndex(corrupt).entries)
+
+	assert.Empty(t, LoadStatusIndex(filepath.Join(dir, "missing.json")).entries)
+}
@@ -0,0 +1,464 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package testlib
+
+import (
+	"encoding/json"
+	"fmt"
+	"net/http"
+	"net/http/httptest"
+	"net/url"
+	"strconv"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+// FakeForge is an in-process forge API serving GitHub, GitLab and Gitea style
+// repository endpoints for end-to-end tests and macro-benchmarks. Its
+// repositories point at local git repositories, so clones and pushes driven
+// by the listings never leave the machine.
+//
+// Served endpoints:
+//
+//	GitHub  GET /orgs/{org}/repos, /repos/{owner}/{repo},
+//	            /repos/{owner}/{repo}/branches/{branch}/protection,
+//	            /repos/{owner}/{repo}/teams, /repos/{owner}/{repo}/collaborators,
+//	            /rate_limit
+//	GitLab  GET /api/v4/groups/{group}/projects
+//	Gitea   GET /api/v1/orgs/{org}/repos
+//
+// Every response is delayed by the configured latency, and requests beyond
+// the rate limit are rejected the way the real forges do until the window
+// resets.
+type FakeForge struct {
+	server *httptest.Server
+	opts   FakeForgeOptions
+
+	mu    sync.RWMutex
+	orgs  map[string][]FakeRepo
+	repos map[string]FakeRepo // by owner/name
+
+	limitMu     sync.Mutex
+	remaining   int
+	windowStart time.Time
+
+	requests    atomic.Int64
+	rateLimited atomic.Int64
+	routesMu    sync.Mutex
+	routes      map[string]int64
+}
+
+// FakeForgeOptions configures latency and rate-limit injection.
+type FakeForgeOptions struct {
+	// Latency is added to every API response.
+	Latency time.Duration
+	// RateLimit is the number of requests allowed per RateLimitWindow;
+	// 0 disables rate limiting.
+	RateLimit int
+	// RateLimitWindow is the rate-limit reset interval (default: 1 minute).
+	RateLimitWindow time.Duration
+}
+
+// FakeRepo is a repository served by a FakeForge.
+type FakeRepo struct {
+	Name          string
+	CloneURL      string // Usually a local path or file:// URL
+	DefaultBranch string
+	SizeKB        int
+	Private       bool
+	Archived      bool
+}
+
+// FakeForgeStats counts the API requests a FakeForge has served.
+type FakeForgeStats struct {
+	Requests    int64            `json:"requests"`
+	RateLimited int64            `json:"rate_limited"`
+	Routes      map[string]int64 `json:"routes"`
+}
+
+// NewFakeForge starts a fake forge; Close stops it.
+func NewFakeForge(opts FakeForgeOptions) *FakeForge {
+	if opts.RateLimitWindow <= 0 {
+		opts.RateLimitWindow = time.Minute
+	}
+
+	f := &FakeForge{
+		opts:        opts,
+		orgs:        make(map[string][]FakeRepo),
+		repos:       make(map[string]FakeRepo),
+		remaining:   opts.RateLimit,
+		windowStart: time.Now(),
+		routes:      make(map[string]int64),
+	}
+
+	f.server = httptest.NewServer(http.HandlerFunc(f.handle))
+
+	return f
+}
+
+// URL returns the base URL of the GitHub style API.
+func (f *FakeForge) URL() string {
+	return f.server.URL
+}
+
+// GitLabURL returns the base URL of the GitLab style API.
+func (f *FakeForge) GitLabURL() string {
+	return f.server.URL + "/api/v4"
+}
+
+// GiteaURL returns the base URL of the Gitea style API.
+func (f *FakeForge) GiteaURL() string {
+	return f.server.URL + "/api/v1"
+}
+
+// Close shuts the server down.
+func (f *FakeForge) Close() {
+	f.server.Close()
+}
+
+// AddRepository adds a repository to an organization.
+func (f *FakeForge) AddRepository(org string, repo FakeRepo) {
+	if repo.DefaultBranch == "" {
+		repo.DefaultBranch = "main"
+	}
+
+	f.mu.Lock()
+	defer f.mu.Unlock()
+
+	f.orgs[org] = append(f.orgs[org], repo)
+	f.repos[org+"/"+repo.Name] = repo
+}
+
+// Stats returns the request counters.
+func (f *FakeForge) Stats() FakeForgeStats {
+	f.routesMu.Lock()
+	defer f.routesMu.Unlock()
+
+	routes := make(map[string]int64, len(f.routes))
+	for route, n := range f.routes {
+		routes[route] = n
+	}
+
+	return FakeForgeStats{
+		Requests:    f.requests.Load(),
+		RateLimited: f.rateLimited.Load(),
+		Routes:      routes,
+	}
+}
+
+// ResetStats clears the request counters and refills the rate limit.
+func (f *FakeForge) ResetStats() {
+	f.requests.Store(0)
+	f.rateLimited.Store(0)
+
+	f.routesMu.Lock()
+	f.routes = make(map[string]int64)
+	f.routesMu.Unlock()
+
+	f.limitMu.Lock()
+	f.remaining, f.windowStart = f.opts.RateLimit, time.Now()
+	f.limitMu.Unlock()
+}
+
+func (f *FakeForge) handle(w http.ResponseWriter, r *http.Request) {
+	f.requests.Add(1)
+
+	if f.opts.Latency > 0 {
+		select {
+		case <-time.After(f.opts.Latency):
+		case <-r.Context().Done():
+			return
+		}
+	}
+
+	if !f.allow(w) {
+		f.rateLimited.Add(1)
+		return
+	}
+
+	if r.Method != http.MethodGet {
+		f.count("unsupported")
+		writeFakeError(w, http.StatusMethodNotAllowed, "method not allowed")
+
+		return
+	}
+
+	parts := strings.Split(strings.Trim(r.URL.Path, "/"), "/")
+
+	switch {
+	case len(parts) == 3 && parts[0] == "orgs" && parts[2] == "repos":
+		f.count("github.list")
+		f.listGitHub(w, r, parts[1])
+	case len(parts) == 1 && parts[0] == "rate_limit":
+		f.count("github.rate_limit")
+		f.rateLimitStatus(w)
+	case len(parts) >= 3 && parts[0] == "repos":
+		f.repository(w, parts[1], parts[2], parts[3:])
+	case len(parts) == 5 && parts[0] == "api" && parts[1] == "v4" && parts[2] == "groups" && parts[4] == "projects":
+		f.count("gitlab.list")
+		f.listGitLab(w, r, parts[3])
+	case len(parts) == 5 && parts[0] == "api" && parts[1] == "v1" && parts[2] == "orgs" && parts[4] == "repos":
+		f.count("gitea.list")
+		f.listGitea(w, r, parts[3])
+	default:
+		f.count("unknown")
+		writeFakeError(w, http.StatusNotFound, "Not Found")
+	}
+}
+
+// allow applies the rate limit and sets the rate-limit headers.
+func (f *FakeForge) allow(w http.ResponseWriter) bool {
+	if f.opts.RateLimit <= 0 {
+		return true
+	}
+
+	f.limitMu.Lock()
+
+	now := time.Now()
+	if now.Sub(f.windowStart) >= f.opts.RateLimitWindow {
+		f.remaining, f.windowStart = f.opts.RateLimit, now
+	}
+
+	allowed := f.remaining > 0
+	if allowed {
+		f.remaining--
+	}
+
+	remaining := f.remaining
+	reset := f.windowStart.Add(f.opts.RateLimitWindow)
+
+	f.limitMu.Unlock()
+
+	h := w.Header()
+	h.Set("X-RateLimit-Limit", strconv.Itoa(f.opts.RateLimit))
+	h.Set("X-RateLimit-Remaining", strconv.Itoa(remaining))
+	h.Set("X-RateLimit-Reset", strconv.FormatInt(reset.Unix(), 10))
+
+	if !allowed {
+		h.Set("Retry-After", strconv.Itoa(int(time.Until(reset).Seconds())+1))
+		writeFakeError(w, http.StatusForbidden, "API rate limit exceeded")
+	}
+
+	return allowed
+}
+
+func (f *FakeForge) count(route string) {
+	f.routesMu.Lock()
+	f.routes[route]++
+	f.routesMu.Unlock()
+}
+
+// page returns the slice of repos for the page and per_page query
+// parameters along with the total number of pages.
+func (f *FakeForge) page(r *http.Request, org string, perPageParam string) ([]FakeRepo, int, int) {
+	query := r.URL.Query()
+
+	perPage, err := strconv.Atoi(query.Get(perPageParam))
+	if err != nil || perPage <= 0 {
+		perPage = 30
+	}
+
+	perPage = min(perPage, 100)
+
+	page, err := strconv.Atoi(query.Get("page"))
+	if err != nil || page <= 0 {
+		page = 1
+	}
+
+	f.mu.RLock()
+	repos := f.orgs[org]
+	f.mu.RUnlock()
+
+	pages := (len(repos) + perPage - 1) / perPage
+	start := min((page-1)*perPage, len(repos))
+	end := min(start+perPage, len(repos))
+
+	return repos[start:end], page, pages
+}
+
+// setLinkHeader writes RFC 5988 next/last links for the request URL.
+func (f *FakeForge) setLinkHeader(w http.ResponseWriter, r *http.Request, page, pages int) {
+	if page >= pages {
+		return
+	}
+
+	link := func(p int) string {
+		u := url.URL{Scheme: "http", Host: r.Host, Path: r.URL.Path}
+		query := r.URL.Query()
+		query.Set("page", strconv.Itoa(p))
+		u.RawQuery = query.Encode()
+
+		return u.String()
+	}
+
+	w.Header().Set("Link", fmt.Sprintf(`<%s>; rel="next", <%s>; rel="last"`, link(page+1), link(pages)))
+}
+
+func (f *FakeForge) listGitHub(w http.ResponseWriter, r *http.Request, org string) {
+	repos, page, pages := f.page(r, org, "per_page")
+	f.setLinkHeader(w, r, page, pages)
+
+	out := make([]map[string]any, 0, len(repos))
+	for _, repo := range repos {
+		out = append(out, gitHubRepository(org, repo))
+	}
+
+	writeFakeJSON(w, out)
+}
+
+func (f *FakeForge) listGitLab(w http.ResponseWriter, r *http.Request, group string) {
+	repos, page, pages := f.page(r, group, "per_page")
+
+	w.Header().Set("X-Total-Pages", strconv.Itoa(pages))
+	w.Header().Set("X-Page", strconv.Itoa(page))
+
+	if page < pages {
+		w.Header().Set("X-Next-Page", strconv.Itoa(page+1))
+	}
+
+	out := make([]map[string]any, 0, len(repos))
+	for i, repo := range repos {
+		visibility := "public"
+		if repo.Private {
+			visibility = "private"
+		}
+
+		out = append(out, map[string]any{
+			"id":                  (page-1)*100 + i + 1,
+			"name":                repo.Name,
+			"path":                repo.Name,
+			"path_with_namespace": group + "/" + repo.Name,
+			"http_url_to_repo":    repo.CloneURL,
+			"default_branch":      repo.DefaultBranch,
+			"visibility":          visibility,
+			"archived":            repo.Archived,
+		})
+	}
+
+	writeFakeJSON(w, out)
+}
+
+func (f *FakeForge) listGitea(w http.ResponseWriter, r *http.Request, org string) {
+	repos, page, pages := f.page(r, org, "limit")
+	f.setLinkHeader(w, r, page, pages)
+
+	f.mu.RLock()
+	total := len(f.orgs[org])
+	f.mu.RUnlock()
+
+	w.Header().Set("X-Total-Count", strconv.Itoa(total))
+
+	out := make([]map[string]any, 0, len(repos))
+	for _, repo := range repos {
+		out = append(out, map[string]any{
+			"name":           repo.Name,
+			"full_name":      org + "/" + repo.Name,
+			"clone_url":      repo.CloneURL,
+			"default_branch": repo.DefaultBranch,
+			"private":        repo.Private,
+			"archived":       repo.Archived,
+			"size":           repo.SizeKB,
+		})
+	}
+
+	writeFakeJSON(w, out)
+}
+
+// repository serves /repos/{owner}/{repo} and its sub-resources.
+func (f *FakeForge) repository(w http.ResponseWriter, owner, name string, rest []string) {
+	f.mu.RLock()
+	repo, ok := f.repos[owner+"/"+name]
+	f.mu.RUnlock()
+
+	switch {
+	case len(rest) == 0:
+		f.count("github.repo")
+	case len(rest) == 3 && rest[0] == "branches" && rest[2] == "protection":
+		f.count("github.protection")
+	case len(rest) == 1 && (rest[0] == "teams" || rest[0] == "collaborators"):
+		f.count("github." + rest[0])
+	default:
+		f.count("unknown")
+		writeFakeError(w, http.StatusNotFound, "Not Found")
+
+		return
+	}
+
+	if !ok {
+		writeFakeError(w, http.StatusNotFound, "Not Found")
+		return
+	}
+
+	switch {
+	case len(rest) == 0:
+		writeFakeJSON(w, gitHubRepository(owner, repo))
+	case rest[0] == "branches":
+		writeFakeJSON(w, map[string]any{
+			"required_status_checks":        map[string]any{"strict": true, "contexts": []string{"ci"}},
+			"enforce_admins":                false,
+			"required_pull_request_reviews": map[string]any{"required_approving_review_count": 1},
+		})
+	default:
+		writeFakeJSON(w, []any{})
+	}
+}
+
+func (f *FakeForge) rateLimitStatus(w http.ResponseWriter) {
+	f.limitMu.Lock()
+	limit, remaining := f.opts.RateLimit, f.remaining
+	reset := f.windowStart.Add(f.opts.RateLimitWindow)
+	f.limitMu.Unlock()
+
+	if limit <= 0 {
+		limit, remaining = 5000, 5000
+	}
+
+	core := map[string]any{"limit": limit, "remaining": remaining, "reset": reset.Unix()}
+	writeFakeJSON(w, map[string]any{"resources": map[string]any{"core": core}, "rate": core})
+}
+
+func gitHubRepository(owner string, repo FakeRepo) map[string]any {
+	return map[string]any{
+		"id":                 fakeRepoID(owner + "/" + repo.Name),
+		"name":               repo.Name,
+		"full_name":          owner + "/" + repo.Name,
+		"private":            repo.Private,
+		"archived":           repo.Archived,
+		"size":               repo.SizeKB,
+		"clone_url":          repo.CloneURL,
+		"ssh_url":            repo.CloneURL,
+		"html_url":           "https://forge.invalid/" + owner + "/" + repo.Name,
+		"default_branch":     repo.DefaultBranch,
+		"has_issues":         true,
+		"has_wiki":           true,
+		"allow_squash_merge": true,
+		"allow_merge_commit": true,
+		"updated_at":         "2025-01-01T00:00:00Z",
+		"created_at":         "2024-01-01T00:00:00Z",
+	}
+}
+
+// fakeRepoID derives a stable numeric ID from a repository name (FNV-1a).
+func fakeRepoID(fullName string) int64 {
+	var h uint32 = 2166136261
+	for i := 0; i < len(fullName); i++ {
+		h ^= uint32(fullName[i])
+		h *= 16777619
+	}
+
+	return int64(h)
+}
+
+func writeFakeJSON(w http.ResponseWriter, v any) {
+	w.Header().Set("Content-Type", "application/json")
+	_ = json.NewEncoder(w).Encode(v)
+}
+
+func writeFakeError(w http.ResponseWriter, status int, message string) {
+	w.Header().Set("Content-Type", "application/json")
+	w.WriteHeader(status)
+	_ = json.NewEncoder(w).Encode(map[string]string{"message": message})
+}
@@ -0,0 +1,137 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package testlib
+
+import (
+	"encoding/json"
+	"fmt"
+	"net/http"
+	"strings"
+	"testing"
+	"time"
+)
+
+func newTestForge(t *testing.T, opts FakeForgeOptions, repos int) *FakeForge {
+	t.Helper()
+
+	forge := NewFakeForge(opts)
+	t.Cleanup(forge.Close)
+
+	for i := 0; i < repos; i++ {
+		forge.AddRepository("acme", FakeRepo{Name: fmt.Sprintf("repo-%02d", i), CloneURL: "/tmp/repo"})
+	}
+
+	return forge
+}
+
+func getForge(t *testing.T, url string) (*http.Response, []map[string]any) {
+	t.Helper()
+
+	resp, err := http.Get(url) //nolint:gosec,noctx // Test server URL
+	if err != nil {
+		t.Fatalf("GET %s: %v", url, err)
+	}
+	defer resp.Body.Close()
+
+	// Only listings are arrays
+	listing := strings.HasSuffix(strings.SplitN(url, "?", 2)[0], "/repos") || strings.Contains(url, "/projects")
+
+	var body []map[string]any
+	if resp.StatusCode == http.StatusOK && listing {
+		if err := json.NewDecoder(resp.Body).Decode(&body); err != nil {
+			t.Fatalf("decode %s: %v", url, err)
+		}
+	}
+
+	return resp, body
+}
+
+func TestFakeForgeGitHubPaging(t *testing.T) {
+	forge := newTestForge(t, FakeForgeOptions{}, 5)
+
+	resp, repos := getForge(t, forge.URL()+"/orgs/acme/repos?per_page=2")
+	if len(repos) != 2 || repos[0]["full_name"] != "acme/repo-00" {
+		t.Fatalf("unexpected first page: %v", repos)
+	}
+
+	link := resp.Header.Get("Link")
+	if !strings.Contains(link, `page=2&per_page=2>; rel="next"`) || !strings.Contains(link, `page=3&per_page=2>; rel="last"`) {
+		t.Errorf("unexpected Link header: %q", link)
+	}
+
+	resp, repos = getForge(t, forge.URL()+"/orgs/acme/repos?per_page=2&page=3")
+	if len(repos) != 1 || resp.Header.Get("Link") != "" {
+		t.Errorf("last page: got %d repos, Link %q", len(repos), resp.Header.Get("Link"))
+	}
+
+	resp, _ = getForge(t, forge.URL()+"/repos/acme/missing")
+	if resp.StatusCode != http.StatusNotFound {
+		t.Errorf("missing repository: got status %d", resp.StatusCode)
+	}
+
+	stats := forge.Stats()
+	if stats.Requests != 3 || stats.Routes["github.list"] != 2 || stats.Routes["github.repo"] != 1 {
+		t.Errorf("unexpected stats: %+v", stats)
+	}
+
+	forge.ResetStats()
+
+	if stats := forge.Stats(); stats.Requests != 0 || len(stats.Routes) != 0 {
+		t.Errorf("stats not reset: %+v", stats)
+	}
+}
+
+func TestFakeForgeGitLabAndGitea(t *testing.T) {
+	forge := newTestForge(t, FakeForgeOptions{}, 3)
+
+	resp, projects := getForge(t, forge.GitLabURL()+"/groups/acme/projects?per_page=2")
+	if len(projects) != 2 || projects[0]["path_with_namespace"] != "acme/repo-00" {
+		t.Errorf("unexpected GitLab projects: %v", projects)
+	}
+
+	if resp.Header.Get("X-Next-Page") != "2" || resp.Header.Get("X-Total-Pages") != "2" {
+		t.Errorf("unexpected GitLab paging headers: %v", resp.Header)
+	}
+
+	resp, repos := getForge(t, forge.GiteaURL()+"/orgs/acme/repos?limit=10")
+	if len(repos) != 3 || resp.Header.Get("X-Total-Count") != "3" {
+		t.Errorf("unexpected Gitea listing: %d repos, total %q", len(repos), resp.Header.Get("X-Total-Count"))
+	}
+}
+
+func TestFakeForgeRateLimitAndLatency(t *testing.T) {
+	forge := newTestForge(t, FakeForgeOptions{
+		Latency:   10 * time.Millisecond,
+		RateLimit: 2,
+	}, 1)
+
+	start := time.Now()
+
+	for i := 0; i < 2; i++ {
+		resp, _ := getForge(t, forge.URL()+"/repos/acme/repo-00")
+		if resp.StatusCode != http.StatusOK {
+			t.Fatalf("request %d: got status %d", i, resp.StatusCode)
+		}
+	}
+
+	if elapsed := time.Since(start); elapsed < 20*time.Millisecond {
+		t.Errorf("latency not injected: two requests took %v", elapsed)
+	}
+
+	resp, _ := getForge(t, forge.URL()+"/repos/acme/repo-00")
+	if resp.StatusCode != http.StatusForbidden || resp.Header.Get("X-RateLimit-Remaining") != "0" || resp.Header.Get("Retry-After") == "" {
+		t.Errorf("rate limit not enforced: status %d, headers %v", resp.StatusCode, resp.Header)
+	}
+
+	if stats := forge.Stats(); stats.RateLimited != 1 {
+		t.Errorf("rate-limited requests: got %d, want 1", stats.RateLimited)
+	}
+
+	// Resetting the stats refills the window
+	forge.ResetStats()
+
+	if resp, _ := getForge(t, forge.URL()+"/repos/acme/repo-00"); resp.StatusCode != http.StatusOK {
+		t.Errorf("after reset: got status %d", resp.StatusCode)
+	}
+}
@@ -3,4 +3,9 @@
 
 // Package workerpool provides concurrent worker pool functionality for processing jobs.
 // This includes repository cloning workers, job queuing, and parallel task execution with retry logic.
+//
+// Bulk repository operations run on the shared scheduler (Schedule, Run), which
+// starts the largest tasks first, balances load between workers by work stealing,
+// and caps concurrent git subprocesses and network calls process-wide through a
+// Budget.
 package workerpool
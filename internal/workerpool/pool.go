@@ -201,7 +201,7 @@ func (p *Pool[T]) worker(_ int) {
 	}
 }
 
-// ProcessBatch processes a batch of items using the worker pool.
+// ProcessBatch processes a batch of items using the shared scheduler.
 func ProcessBatch[T any](ctx context.Context, items []T, config WorkerPoolConfig,
 	processFn func(context.Context, T) error,
 ) ([]Result[T], error) {
@@ -209,35 +209,33 @@ func ProcessBatch[T any](ctx context.Context, items []T, config WorkerPoolConfig
 		return []Result[T]{}, nil
 	}
 
-	// Ensure buffer size is large enough for all items
-	if config.BufferSize < len(items) {
-		config.BufferSize = len(items)
+	if config.WorkerCount <= 0 {
+		config.WorkerCount = runtime.NumCPU()
 	}
 
-	pool := New[T](config)
-	if err := pool.Start(); err != nil {
-		return nil, fmt.Errorf("failed to start worker pool: %w", err)
+	if config.Timeout <= 0 {
+		config.Timeout = 30 * time.Second
 	}
-	defer pool.Stop()
 
-	// Submit all jobs
-	for _, item := range items {
-		select {
-		case <-ctx.Done():
-			return nil, ctx.Err()
-		default:
-		}
+	tasks := make([]Task[T], len(items))
+	for i, item := range items {
+		tasks[i] = Task[T]{Data: item}
+	}
 
-		if err := pool.Submit(item, processFn); err != nil {
-			return nil, fmt.Errorf("failed to submit job: %w", err)
-		}
+	timed := func(ctx context.Context, data T) error {
+		jobCtx, jobCancel := context.WithTimeout(ctx, config.Timeout)
+		defer jobCancel()
+
+		return processFn(jobCtx, data)
 	}
 
 	// Collect results
+	resultsChan := Schedule(ctx, SchedulerConfig{Workers: config.WorkerCount}, tasks, timed)
+
 	results := make([]Result[T], 0, len(items))
 	for range items {
 		select {
-		case result := <-pool.Results():
+		case result := <-resultsChan:
 			results = append(results, result)
 		case <-ctx.Done():
 			return results, ctx.Err()
@@ -7,6 +7,8 @@ import (
 	"context"
 	"fmt"
 	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
 )
 
 // RepositoryOperation represents a repository operation type.
@@ -29,6 +31,8 @@ type RepositoryJob struct {
 	Branch           string
 	Strategy         string
 	WorkerPoolConfig map[string]any // For configuration operations
+	// Size is the estimated repository size (KB); larger repositories are scheduled first
+	Size int64
 }
 
 // RepositoryResult represents the result of a repository operation.
@@ -184,18 +188,13 @@ func (rp *RepositoryWorkerPool) ProcessRepositories(ctx context.Context,
 		return []RepositoryResult{}, nil
 	}
 
-	// Submit all jobs
-	for _, job := range jobs {
-		if err := rp.SubmitJob(job, processFn); err != nil {
-			return nil, fmt.Errorf("failed to submit job for %s: %w", job.Repository, err)
-		}
-	}
-
 	// Collect results
+	resultsChan := rp.Schedule(ctx, jobs, processFn)
+
 	results := make([]RepositoryResult, 0, len(jobs))
 	for range jobs {
 		select {
-		case result := <-rp.results:
+		case result := <-resultsChan:
 			results = append(results, result)
 		case <-ctx.Done():
 			return results, ctx.Err()
@@ -205,6 +204,111 @@ func (rp *RepositoryWorkerPool) ProcessRepositories(ctx context.Context,
 	return results, nil
 }
 
+// Schedule runs a batch of repository jobs on the shared work-stealing
+// scheduler, largest repositories first, and streams one result per job.
+// Git operations draw from the process-wide git subprocess budget and
+// configuration operations from the network budget.
+func (rp *RepositoryWorkerPool) Schedule(ctx context.Context,
+	jobs []RepositoryJob, processFn func(context.Context, RepositoryJob) error,
+) <-chan RepositoryResult {
+	tasks := make([]Task[*repositoryRun], len(jobs))
+	for i, job := range jobs {
+		tasks[i] = repositoryTask(job)
+	}
+
+	scheduled := Schedule(ctx, SchedulerConfig{Workers: rp.schedulerWorkers()}, tasks, rp.runFunc(processFn))
+
+	return rp.repositoryResults(scheduled, len(jobs))
+}
+
+// ScheduleStream is like Schedule for jobs that are still being produced, such
+// as repositories arriving page by page from a listing. Jobs start in arrival
+// order as soon as a worker is free. The caller closes jobs once the listing
+// is done; the results channel is closed after the last job has reported.
+func (rp *RepositoryWorkerPool) ScheduleStream(ctx context.Context,
+	jobs <-chan RepositoryJob, processFn func(context.Context, RepositoryJob) error,
+) <-chan RepositoryResult {
+	tasks := make(chan Task[*repositoryRun])
+
+	go func() {
+		defer close(tasks)
+
+		for job := range jobs {
+			tasks <- repositoryTask(job)
+		}
+	}()
+
+	scheduled := ScheduleStream(ctx, SchedulerConfig{Workers: rp.schedulerWorkers()}, tasks, rp.runFunc(processFn))
+
+	return rp.repositoryResults(scheduled, rp.schedulerWorkers())
+}
+
+func repositoryTask(job RepositoryJob) Task[*repositoryRun] {
+	resource := ResourceGit
+	if job.Operation == OperationConfig {
+		resource = ResourceNetwork
+	}
+
+	return Task[*repositoryRun]{Data: &repositoryRun{job: job}, Size: job.Size, Resource: resource}
+}
+
+func (rp *RepositoryWorkerPool) schedulerWorkers() int {
+	return max(rp.config.CloneWorkers, rp.config.UpdateWorkers, rp.config.ConfigWorkers)
+}
+
+// runFunc wraps processFn with the operation check, timeout and retries.
+func (rp *RepositoryWorkerPool) runFunc(processFn func(context.Context, RepositoryJob) error) func(context.Context, *repositoryRun) error {
+	// Wrap processFn with retry logic
+	wrappedFn := rp.wrapWithRetry(processFn)
+
+	return func(ctx context.Context, run *repositoryRun) error {
+		switch run.job.Operation {
+		case OperationClone, OperationPull, OperationFetch, OperationReset, OperationConfig:
+		default:
+			return fmt.Errorf("unknown operation: %s", run.job.Operation)
+		}
+
+		if rp.config.OperationTimeout > 0 {
+			var cancel context.CancelFunc
+
+			ctx, cancel = context.WithTimeout(ctx, rp.config.OperationTimeout)
+			defer cancel()
+		}
+
+		startTime := time.Now()
+		err := wrappedFn(ctx, run.job)
+		run.duration = time.Since(startTime)
+
+		return err
+	}
+}
+
+func (rp *RepositoryWorkerPool) repositoryResults(scheduled <-chan Result[*repositoryRun], buffer int) <-chan RepositoryResult {
+	results := make(chan RepositoryResult, buffer)
+
+	go func() {
+		defer close(results)
+
+		for result := range scheduled {
+			results <- RepositoryResult{
+				Job:      result.Data.job,
+				Success:  result.Error == nil,
+				Error:    result.Error,
+				Duration: result.Data.duration,
+				Message:  fmt.Sprintf("Processed %s", result.Data.job.Operation),
+			}
+		}
+	}()
+
+	return results
+}
+
+// repositoryRun carries a job through the scheduler and records how long it took.
+type repositoryRun struct {
+	job      RepositoryJob
+	duration time.Duration
+}
+
 // collectResults collects results from a worker pool and forwards them.
 func (rp *RepositoryWorkerPool) collectResults(resultsChan <-chan Result[RepositoryJob], poolType string) {
 	for result := range resultsChan {
@@ -240,9 +344,10 @@ func (rp *RepositoryWorkerPool) wrapWithRetry( //nolint:gocognit // Complex work
 				}
 			}
 
-			startTime := time.Now()
+			// Each attempt is recorded as a phase named after the operation
+			span := phase.Start(ctx, phase.Name(job.Operation))
 			err := processFn(ctx, job)
-			duration := time.Since(startTime)
+			duration := span.End(err)
 
 			if err == nil {
 				// Success - log if this was a retry
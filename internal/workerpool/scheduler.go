@@ -0,0 +1,327 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package workerpool
+
+import (
+	"context"
+	"os"
+	"runtime"
+	"sort"
+	"strconv"
+	"sync"
+)
+
+// ResourceClass identifies the process-wide budget a scheduled task draws from.
+type ResourceClass int
+
+// Resource classes for scheduled tasks.
+const (
+	// ResourceNone tasks are limited only by the scheduler's worker count.
+	ResourceNone ResourceClass = iota
+	// ResourceGit tasks run git subprocesses (clone, fetch, pull, reset).
+	ResourceGit
+	// ResourceNetwork tasks make forge API or other network calls.
+	ResourceNetwork
+)
+
+// Environment variables overriding the default process-wide budget.
+const (
+	EnvMaxGitProcesses = "GZH_MAX_GIT_PROCESSES"
+	EnvMaxNetworkCalls = "GZH_MAX_NETWORK_CALLS"
+)
+
+// Budget caps the number of concurrently running tasks per resource class
+// across every scheduler that shares it.
+type Budget struct {
+	git     chan struct{}
+	network chan struct{}
+}
+
+// NewBudget creates a budget allowing gitSlots concurrent git subprocesses and
+// networkSlots concurrent network calls. Non-positive values mean unlimited.
+func NewBudget(gitSlots, networkSlots int) *Budget {
+	b := &Budget{}
+	if gitSlots > 0 {
+		b.git = make(chan struct{}, gitSlots)
+	}
+
+	if networkSlots > 0 {
+		b.network = make(chan struct{}, networkSlots)
+	}
+
+	return b
+}
+
+var (
+	defaultBudgetMu sync.Mutex
+	defaultBudget   *Budget
+)
+
+// DefaultBudget returns the process-wide budget used by schedulers that do not
+// set one. It allows 4 git subprocesses per CPU (at least 16) and 64 network
+// calls, overridable through GZH_MAX_GIT_PROCESSES and GZH_MAX_NETWORK_CALLS.
+func DefaultBudget() *Budget {
+	defaultBudgetMu.Lock()
+	defer defaultBudgetMu.Unlock()
+
+	if defaultBudget == nil {
+		gitSlots := max(16, 4*runtime.NumCPU())
+		networkSlots := 64
+
+		if v, err := strconv.Atoi(os.Getenv(EnvMaxGitProcesses)); err == nil {
+			gitSlots = v
+		}
+
+		if v, err := strconv.Atoi(os.Getenv(EnvMaxNetworkCalls)); err == nil {
+			networkSlots = v
+		}
+
+		defaultBudget = NewBudget(gitSlots, networkSlots)
+	}
+
+	return defaultBudget
+}
+
+// SetDefaultBudget replaces the process-wide budget. Schedulers already
+// running keep the budget they started with.
+func SetDefaultBudget(b *Budget) {
+	defaultBudgetMu.Lock()
+	defaultBudget = b
+	defaultBudgetMu.Unlock()
+}
+
+// Acquire blocks until a slot of the given class is available and returns a
+// function releasing it.
+func (b *Budget) Acquire(ctx context.Context, class ResourceClass) (func(), error) {
+	var slots chan struct{}
+
+	switch class {
+	case ResourceGit:
+		slots = b.git
+	case ResourceNetwork:
+		slots = b.network
+	case ResourceNone:
+	}
+
+	if slots == nil {
+		return func() {}, nil
+	}
+
+	select {
+	case slots <- struct{}{}:
+		return func() { <-slots }, nil
+	case <-ctx.Done():
+		return nil, ctx.Err()
+	}
+}
+
+// Task is a unit of work for the scheduler.
+type Task[T any] struct {
+	Data T
+	// Size is the relative cost of the task, e.g. the repository size.
+	// Larger tasks are started first.
+	Size int64
+	// Resource is the budget class the task draws a slot from while running.
+	Resource ResourceClass
+}
+
+// SchedulerConfig configures a scheduler run.
+type SchedulerConfig struct {
+	// Workers specifies the number of workers. If 0, defaults to runtime.NumCPU()
+	Workers int
+	// Budget caps concurrent tasks per resource class. If nil, DefaultBudget() is used
+	Budget *Budget
+}
+
+// taskDeque is a worker's queue of task indices, largest first. Owners and
+// thieves both take from the front, so every task still starts in
+// largest-first order and a stolen task is the victim's largest remaining one.
+type taskDeque struct {
+	mu    sync.Mutex
+	items []int
+}
+
+func (d *taskDeque) popFront() (int, bool) {
+	d.mu.Lock()
+	defer d.mu.Unlock()
+
+	if len(d.items) == 0 {
+		return 0, false
+	}
+
+	i := d.items[0]
+	d.items = d.items[1:]
+
+	return i, true
+}
+
+// Schedule runs fn for every task on a fixed set of workers and streams the
+// results. Tasks are ordered largest first and dealt round-robin onto
+// per-worker deques; a worker whose deque runs dry steals from the others, so
+// a few large tasks do not leave the remaining workers idle. Exactly one result
+// is delivered per task; tasks not started before ctx is done report ctx.Err().
+// The channel is closed once all tasks have reported.
+func Schedule[T any](ctx context.Context, config SchedulerConfig, tasks []Task[T],
+	fn func(context.Context, T) error,
+) <-chan Result[T] {
+	results := make(chan Result[T], len(tasks))
+
+	go func() {
+		defer close(results)
+
+		schedule(ctx, config, tasks, fn, func(_ int, result Result[T]) {
+			results <- result
+		})
+	}()
+
+	return results
+}
+
+// Run is like Schedule but waits for all tasks and returns their results in
+// task order.
+func Run[T any](ctx context.Context, config SchedulerConfig, tasks []Task[T],
+	fn func(context.Context, T) error,
+) []Result[T] {
+	results := make([]Result[T], len(tasks))
+
+	schedule(ctx, config, tasks, fn, func(i int, result Result[T]) {
+		results[i] = result
+	})
+
+	return results
+}
+
+// ScheduleStream is like Schedule for tasks that are still being produced, e.g.
+// while a repository listing is paged in. Each task starts as soon as a worker
+// is free, in arrival order, so the first tasks run while later ones are still
+// being listed; the largest-first ordering of Schedule is given up for that.
+// Exactly one result is delivered per task received. The producer must close
+// tasks; the results channel is closed once every received task has reported.
+func ScheduleStream[T any](ctx context.Context, config SchedulerConfig, tasks <-chan Task[T],
+	fn func(context.Context, T) error,
+) <-chan Result[T] {
+	workers := config.Workers
+	if workers <= 0 {
+		workers = runtime.NumCPU()
+	}
+
+	budget := config.Budget
+	if budget == nil {
+		budget = DefaultBudget()
+	}
+
+	results := make(chan Result[T], workers)
+
+	var wg sync.WaitGroup
+
+	for w := 0; w < workers; w++ {
+		wg.Add(1)
+
+		go func() {
+			defer wg.Done()
+
+			for task := range tasks {
+				results <- Result[T]{Data: task.Data, Error: runTask(ctx, budget, task, fn)}
+			}
+		}()
+	}
+
+	go func() {
+		wg.Wait()
+		close(results)
+	}()
+
+	return results
+}
+
+func schedule[T any](ctx context.Context, config SchedulerConfig, tasks []Task[T],
+	fn func(context.Context, T) error, emit func(int, Result[T]),
+) {
+	if len(tasks) == 0 {
+		return
+	}
+
+	workers := config.Workers
+	if workers <= 0 {
+		workers = runtime.NumCPU()
+	}
+
+	workers = min(workers, len(tasks))
+
+	budget := config.Budget
+	if budget == nil {
+		budget = DefaultBudget()
+	}
+
+	order := make([]int, len(tasks))
+	for i := range order {
+		order[i] = i
+	}
+
+	sort.SliceStable(order, func(a, b int) bool {
+		return tasks[order[a]].Size > tasks[order[b]].Size
+	})
+
+	deques := make([]*taskDeque, workers)
+	for w := range deques {
+		deques[w] = &taskDeque{items: make([]int, 0, len(tasks)/workers+1)}
+	}
+
+	for k, i := range order {
+		deques[k%workers].items = append(deques[k%workers].items, i)
+	}
+
+	var wg sync.WaitGroup
+
+	for w := 0; w < workers; w++ {
+		wg.Add(1)
+
+		go func(id int) {
+			defer wg.Done()
+
+			for {
+				i, ok := nextTask(deques, id)
+				if !ok {
+					return
+				}
+
+				task := tasks[i]
+				emit(i, Result[T]{Data: task.Data, Error: runTask(ctx, budget, task, fn)})
+			}
+		}(w)
+	}
+
+	wg.Wait()
+}
+
+// nextTask takes the next task from the worker's own deque, or steals one
+// from another worker. No tasks are added once workers start, so finding every
+// deque empty means the run is complete for this worker.
+func nextTask(deques []*taskDeque, id int) (int, bool) {
+	if i, ok := deques[id].popFront(); ok {
+		return i, true
+	}
+
+	for offset := 1; offset < len(deques); offset++ {
+		if i, ok := deques[(id+offset)%len(deques)].popFront(); ok {
+			return i, true
+		}
+	}
+
+	return 0, false
+}
+
+func runTask[T any](ctx context.Context, budget *Budget, task Task[T], fn func(context.Context, T) error) error {
+	if err := ctx.Err(); err != nil {
+		return err
+	}
+
+	release, err := budget.Acquire(ctx, task.Resource)
+	if err != nil {
+		return err
+	}
+	defer release()
+
+	return fn(ctx, task.Data)
+}
@@ -0,0 +1,223 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package workerpool
+
+import (
+	"context"
+	"errors"
+	"sync"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func TestRun_ResultsInTaskOrder(t *testing.T) {
+	tasks := make([]Task[int], 50)
+	for i := range tasks {
+		tasks[i] = Task[int]{Data: i, Size: int64(i % 7)}
+	}
+
+	var calls atomic.Int64
+
+	results := Run(context.Background(), SchedulerConfig{Workers: 4, Budget: NewBudget(0, 0)}, tasks,
+		func(_ context.Context, data int) error {
+			calls.Add(1)
+
+			if data%10 == 0 {
+				return errors.New("failed")
+			}
+
+			return nil
+		})
+
+	require.Len(t, results, len(tasks))
+	assert.Equal(t, int64(len(tasks)), calls.Load())
+
+	for i, result := range results {
+		assert.Equal(t, i, result.Data)
+		assert.Equal(t, i%10 == 0, result.Error != nil)
+	}
+}
+
+func TestSchedule_LargestFirst(t *testing.T) {
+	tasks := []Task[string]{
+		{Data: "small", Size: 1},
+		{Data: "large", Size: 1000},
+		{Data: "medium", Size: 50},
+		{Data: "unknown"},
+	}
+
+	var (
+		mu    sync.Mutex
+		order []string
+	)
+
+	results := Schedule(context.Background(), SchedulerConfig{Workers: 1, Budget: NewBudget(0, 0)}, tasks,
+		func(_ context.Context, data string) error {
+			mu.Lock()
+			order = append(order, data)
+			mu.Unlock()
+
+			return nil
+		})
+
+	count := 0
+	for range results {
+		count++
+	}
+
+	assert.Equal(t, len(tasks), count)
+	assert.Equal(t, []string{"large", "medium", "small", "unknown"}, order)
+}
+
+func TestSchedule_WorkStealing(t *testing.T) {
+	// Round-robin dealing gives the first worker "large", 30 and 10 and the
+	// second worker 40 and 20. The large task blocks until every small task has
+	// run, so 30 and 10 only finish if the second worker steals them.
+	tasks := []Task[int]{{Data: 0, Size: 100}}
+	for _, size := range []int{40, 30, 20, 10} {
+		tasks = append(tasks, Task[int]{Data: size, Size: int64(size)})
+	}
+
+	var (
+		mu     sync.Mutex
+		order  []int
+		stolen bool
+	)
+
+	started := make(chan struct{})
+	smallDone := make(chan struct{})
+
+	Run(context.Background(), SchedulerConfig{Workers: 2, Budget: NewBudget(0, 0)}, tasks,
+		func(_ context.Context, data int) error {
+			if data == 0 {
+				close(started)
+
+				select {
+				case <-smallDone:
+					stolen = true
+				case <-time.After(5 * time.Second):
+				}
+
+				return nil
+			}
+
+			// Keep the second worker busy until the first has taken the large task
+			<-started
+
+			mu.Lock()
+			order = append(order, data)
+			if len(order) == 4 {
+				close(smallDone)
+			}
+			mu.Unlock()
+
+			return nil
+		})
+
+	assert.True(t, stolen, "small tasks queued behind the large one were not stolen")
+	// Thieves take the victim's largest remaining task first
+	assert.Equal(t, []int{40, 20, 30, 10}, order)
+}
+
+func TestBudget_CapsConcurrencyAcrossSchedulers(t *testing.T) {
+	budget := NewBudget(2, 0)
+
+	var running, peak atomic.Int64
+
+	work := func(_ context.Context, _ int) error {
+		current := running.Add(1)
+		for {
+			old := peak.Load()
+			if current <= old || peak.CompareAndSwap(old, current) {
+				break
+			}
+		}
+
+		time.Sleep(10 * time.Millisecond)
+		running.Add(-1)
+
+		return nil
+	}
+
+	tasks := make([]Task[int], 10)
+	for i := range tasks {
+		tasks[i] = Task[int]{Data: i, Resource: ResourceGit}
+	}
+
+	var wg sync.WaitGroup
+	for range 3 {
+		wg.Add(1)
+
+		go func() {
+			defer wg.Done()
+			Run(context.Background(), SchedulerConfig{Workers: 4, Budget: budget}, tasks, work)
+		}()
+	}
+
+	wg.Wait()
+
+	assert.LessOrEqual(t, peak.Load(), int64(2))
+}
+
+func TestSchedule_ContextCancelled(t *testing.T) {
+	ctx, cancel := context.WithCancel(context.Background())
+	cancel()
+
+	tasks := []Task[int]{{Data: 1}, {Data: 2}, {Data: 3}}
+
+	results := Run(ctx, SchedulerConfig{Workers: 2}, tasks, func(_ context.Context, _ int) error {
+		t.Error("task should not run after cancellation")
+		return nil
+	})
+
+	require.Len(t, results, len(tasks))
+
+	for _, result := range results {
+		assert.ErrorIs(t, result.Error, context.Canceled)
+	}
+}
+
+func TestScheduleStream_StartsBeforeProducerFinishes(t *testing.T) {
+	tasks := make(chan Task[int])
+	started := make(chan int, 10)
+
+	results := ScheduleStream(context.Background(), SchedulerConfig{Workers: 2, Budget: NewBudget(0, 0)}, tasks,
+		func(_ context.Context, data int) error {
+			started <- data
+
+			if data == 3 {
+				return errors.New("failed")
+			}
+
+			return nil
+		})
+
+	// The first task runs while the producer is still holding back the rest
+	tasks <- Task[int]{Data: 1}
+	assert.Equal(t, 1, <-started)
+
+	go func() {
+		defer close(tasks)
+
+		for i := 2; i <= 5; i++ {
+			tasks <- Task[int]{Data: i}
+		}
+	}()
+
+	seen := make(map[int]bool)
+	failed := 0
+
+	for result := range results {
+		seen[result.Data] = true
+
+		if result.Error != nil {
+			failed++
+		}
+	}
+
+	assert.Len(t, seen, 5)
+	assert.Equal(t, 1, failed)
+}
@@ -25,6 +25,12 @@ func NewGitHubAuditAdapter(client *github.RepoConfigClient) *GitHubAuditAdapter
 
 // RunComplianceAudit performs a compliance audit for all repositories in an organization.
 func (a *GitHubAuditAdapter) RunComplianceAudit(ctx context.Context, configPath, org string) (*AuditReport, error) {
+	return a.RunComplianceAuditWithOptions(ctx, configPath, org, github.PipelineOptions{GraphQLBatchSize: github.DefaultGraphQLBatchSize})
+}
+
+// RunComplianceAuditWithOptions performs a compliance audit, collecting repository
+// states through the concurrent pipeline configured by opts.
+func (a *GitHubAuditAdapter) RunComplianceAuditWithOptions(ctx context.Context, configPath, org string, opts github.PipelineOptions) (*AuditReport, error) {
 	// Load the repository configuration
 	repoConfig, err := LoadRepoConfig(configPath)
 	if err != nil {
@@ -32,7 +38,7 @@ func (a *GitHubAuditAdapter) RunComplianceAudit(ctx context.Context, configPath,
 	}
 
 	// Collect repository states from GitHub
-	githubStates, err := a.client.CollectRepositoryStates(ctx, org)
+	githubStates, err := a.client.CollectRepositoryStatesWithOptions(ctx, org, opts)
 	if err != nil {
 		return nil, fmt.Errorf("failed to collect repository states: %w", err)
 	}
@@ -87,8 +87,10 @@ func (rc *RepoConfig) RunComplianceAudit(actualRepos map[string]RepositoryState)
 	policyResults := rc.initializePolicyResults()
 
 	// Audit each repository
+	resolver := NewRepoConfigResolver(rc)
+
 	for repoName, repoState := range actualRepos {
-		repoResult := rc.auditRepository(repoName, repoState, policyResults)
+		repoResult := rc.auditRepository(resolver, repoName, repoState, policyResults)
 		rc.updateAuditSummary(report, repoResult)
 		report.Repositories = append(report.Repositories, repoResult)
 	}
@@ -419,7 +421,7 @@ func (rc *RepoConfig) initializePolicyResults() map[string]*PolicyAuditResult {
 }
 
 // auditRepository audits a single repository against all policies.
-func (rc *RepoConfig) auditRepository(repoName string, repoState RepositoryState, policyResults map[string]*PolicyAuditResult) RepoAuditResult {
+func (rc *RepoConfig) auditRepository(resolver *RepoConfigResolver, repoName string, repoState RepositoryState, policyResults map[string]*PolicyAuditResult) RepoAuditResult {
 	repoResult := RepoAuditResult{
 		Repository:   repoName,
 		Compliant:    true,
@@ -429,16 +431,16 @@ func (rc *RepoConfig) auditRepository(repoName string, repoState RepositoryState
 	}
 
 	// Get effective configuration and exceptions for this repository
-	settings, security, permissions, exceptions, err := rc.GetEffectiveConfig(repoName)
+	effective, err := resolver.Resolve(repoName)
 	if err != nil {
 		return repoResult // Return empty result if we can't get config
 	}
 
-	repoResult.Exceptions = exceptions
+	repoResult.Exceptions = effective.Exceptions
 
 	// Check each policy
 	for policyName, policy := range rc.Policies {
-		rc.auditRepositoryPolicy(repoName, repoState, policy, policyName, settings, security, permissions, exceptions, &repoResult, policyResults)
+		rc.auditRepositoryPolicy(repoName, repoState, policy, policyName, effective.Settings, effective.Security, effective.Permissions, effective.Exceptions, &repoResult, policyResults)
 	}
 
 	return repoResult
@@ -0,0 +1,219 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package config
+
+import (
+	"slices"
+	"strings"
+)
+
+// EffectiveRepoConfig is the configuration a repository resolves to, together
+// with the template that determined it.
+type EffectiveRepoConfig struct {
+	Settings    *RepoSettings
+	Security    *SecuritySettings
+	Permissions *PermissionSettings
+	Exceptions  []PolicyException
+
+	// Template is the template of the most specific layer that applied to
+	// the repository, or empty when no layer names one.
+	Template string
+}
+
+// RepoConfigResolver resolves effective repository configurations against a
+// RepoConfig compiled once: specific repositories are indexed by name,
+// patterns are precompiled and templates are flattened along their base
+// chain up front. It is safe for concurrent use, but does not observe
+// changes made to the RepoConfig after it was built.
+type RepoConfigResolver struct {
+	defaults *configLayer
+	specific map[string]*configLayer
+	patterns []patternLayer
+	fallback *configLayer
+}
+
+// configLayer is one level of the configuration hierarchy with its template
+// already resolved.
+type configLayer struct {
+	templateName string
+	template     *RepoTemplate // nil when unnamed or unresolvable
+	settings     *RepoSettings
+	security     *SecuritySettings
+	permissions  *PermissionSettings
+	exceptions   []PolicyException
+}
+
+type patternLayer struct {
+	match globMatcher
+	layer *configLayer
+}
+
+// NewRepoConfigResolver compiles rc for repeated lookups. Templates that fail
+// to resolve are skipped when applied, as GetEffectiveConfig always did.
+func NewRepoConfigResolver(rc *RepoConfig) *RepoConfigResolver {
+	templates := make(map[string]*RepoTemplate)
+	newLayer := func(templateName string, settings *RepoSettings, security *SecuritySettings, permissions *PermissionSettings, exceptions []PolicyException) *configLayer {
+		layer := &configLayer{
+			templateName: templateName,
+			settings:     settings,
+			security:     security,
+			permissions:  permissions,
+			exceptions:   exceptions,
+		}
+
+		if templateName != "" {
+			template, ok := templates[templateName]
+			if !ok {
+				template, _ = rc.resolveTemplate(templateName)
+				templates[templateName] = template
+			}
+
+			layer.template = template
+		}
+
+		return layer
+	}
+
+	r := &RepoConfigResolver{specific: make(map[string]*configLayer)}
+
+	if rc.Defaults != nil {
+		r.defaults = newLayer(rc.Defaults.Template, rc.Defaults.Settings, rc.Defaults.Security, rc.Defaults.Permissions, nil)
+	}
+
+	if rc.Repositories == nil {
+		return r
+	}
+
+	for _, specific := range rc.Repositories.Specific {
+		// The first entry for a repository wins
+		if _, ok := r.specific[specific.Name]; !ok {
+			r.specific[specific.Name] = newLayer(specific.Template, specific.Settings, specific.Security, specific.Permissions, specific.Exceptions)
+		}
+	}
+
+	for _, pattern := range rc.Repositories.Patterns {
+		r.patterns = append(r.patterns, patternLayer{
+			match: compileGlob(pattern.Match),
+			layer: newLayer(pattern.Template, pattern.Settings, pattern.Security, pattern.Permissions, pattern.Exceptions),
+		})
+	}
+
+	if def := rc.Repositories.Default; def != nil {
+		r.fallback = newLayer(def.Template, def.Settings, def.Security, def.Permissions, nil)
+	}
+
+	return r
+}
+
+// Resolve returns the effective configuration of repoName. Defaults apply
+// first; a specific entry for the repository then applies on its own,
+// otherwise every matching pattern applies in order followed by the
+// repository default.
+func (r *RepoConfigResolver) Resolve(repoName string) (*EffectiveRepoConfig, error) {
+	result := &EffectiveRepoConfig{}
+
+	if r.defaults != nil {
+		result.apply(r.defaults)
+	}
+
+	if specific, ok := r.specific[repoName]; ok {
+		result.apply(specific)
+		result.Template = firstTemplate(specific, r.defaults)
+
+		return result, nil
+	}
+
+	var matched *configLayer
+
+	for _, pattern := range r.patterns {
+		if !pattern.match.Match(repoName) {
+			continue
+		}
+
+		result.apply(pattern.layer)
+
+		if matched == nil && pattern.layer.templateName != "" {
+			matched = pattern.layer
+		}
+	}
+
+	if r.fallback != nil {
+		result.apply(r.fallback)
+	}
+
+	result.Template = firstTemplate(matched, r.fallback, r.defaults)
+
+	return result, nil
+}
+
+// apply merges a layer, template first, into the accumulated configuration.
+// The merge helpers copy their inputs, so layers are never modified.
+func (c *EffectiveRepoConfig) apply(layer *configLayer) {
+	if template := layer.template; template != nil {
+		c.Settings = mergeRepoSettings(c.Settings, template.Settings)
+		c.Security = mergeSecuritySettings(c.Security, template.Security)
+		c.Permissions = mergePermissionSettings(c.Permissions, template.Permissions)
+	}
+
+	c.Settings = mergeRepoSettings(c.Settings, layer.settings)
+	c.Security = mergeSecuritySettings(c.Security, layer.security)
+	c.Permissions = mergePermissionSettings(c.Permissions, layer.permissions)
+
+	if len(layer.exceptions) > 0 {
+		c.Exceptions = append(slices.Clip(c.Exceptions), layer.exceptions...)
+	}
+}
+
+// firstTemplate returns the template name of the first layer that has one.
+func firstTemplate(layers ...*configLayer) string {
+	for _, layer := range layers {
+		if layer != nil && layer.templateName != "" {
+			return layer.templateName
+		}
+	}
+
+	return ""
+}
+
+// globMatcher matches names against a pattern in which '*' stands for any
+// run of characters and everything else is literal. The pattern is anchored
+// at both ends.
+type globMatcher struct {
+	exact string
+	parts []string // set when the pattern has a wildcard
+}
+
+func compileGlob(pattern string) globMatcher {
+	if !strings.Contains(pattern, "*") {
+		return globMatcher{exact: pattern}
+	}
+
+	return globMatcher{parts: strings.Split(pattern, "*")}
+}
+
+// Match reports whether name matches the whole pattern.
+func (g globMatcher) Match(name string) bool {
+	if g.parts == nil {
+		return name == g.exact
+	}
+
+	prefix, suffix := g.parts[0], g.parts[len(g.parts)-1]
+	if len(name) < len(prefix)+len(suffix) || !strings.HasPrefix(name, prefix) || !strings.HasSuffix(name, suffix) {
+		return false
+	}
+
+	// Middle parts match leftmost, which is enough for '*' only patterns
+	rest := name[len(prefix) : len(name)-len(suffix)]
+
+	for _, part := range g.parts[1 : len(g.parts)-1] {
+		i := strings.Index(rest, part)
+		if i < 0 {
+			return false
+		}
+
+		rest = rest[i+len(part):]
+	}
+
+	return true
+}
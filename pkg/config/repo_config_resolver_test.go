@@ -0,0 +1,179 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package config
+
+import (
+	"fmt"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func newResolverTestConfig() *RepoConfig {
+	return &RepoConfig{
+		Defaults: &RepoDefaults{
+			Template: "base",
+			Settings: &RepoSettings{Private: boolPtr(true)},
+		},
+		Templates: map[string]*RepoTemplate{
+			"base":         {Settings: &RepoSettings{HasIssues: boolPtr(true)}},
+			"backend":      {Base: "base", Settings: &RepoSettings{HasWiki: boolPtr(false)}},
+			"microservice": {Base: "backend", Settings: &RepoSettings{HasProjects: boolPtr(false)}},
+			"frontend":     {Settings: &RepoSettings{HasPages: boolPtr(true)}},
+			"testing":      {Settings: &RepoSettings{Private: boolPtr(false)}},
+			"standard":     {Settings: &RepoSettings{HasDownloads: boolPtr(false)}},
+		},
+		Repositories: &RepoTargets{
+			Specific: []RepoSpecificConfig{
+				{Name: "api-service", Template: "microservice"},
+				{Name: "web-app", Template: "frontend"},
+				{Name: "web-app", Template: "testing"},
+				{Name: "plain", Settings: &RepoSettings{Description: stringPtr("plain")}},
+			},
+			Patterns: []RepoPatternConfig{
+				{Match: "*-service", Template: "backend", Exceptions: []PolicyException{{PolicyName: "p", RuleName: "r"}}},
+				{Match: "test-*", Template: "testing"},
+				{Match: "*-svc-*", Settings: &RepoSettings{Topics: []string{"svc"}}},
+			},
+			Default: &RepoDefaultConfig{
+				Template: "standard",
+			},
+		},
+	}
+}
+
+func TestRepoConfigResolver_Template(t *testing.T) {
+	resolver := NewRepoConfigResolver(newResolverTestConfig())
+
+	tests := []struct {
+		repoName string
+		expected string
+	}{
+		{"api-service", "microservice"}, // specific match
+		{"web-app", "frontend"},         // first specific entry wins
+		{"plain", "base"},               // specific match without template
+		{"auth-service", "backend"},     // pattern match
+		{"test-integration", "testing"}, // pattern match
+		{"random-repo", "standard"},     // default match
+		{"api-svc-auth", "standard"},    // pattern without template
+		{"another-service", "backend"},  // pattern match
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.repoName, func(t *testing.T) {
+			effective, err := resolver.Resolve(tt.repoName)
+			require.NoError(t, err)
+			assert.Equal(t, tt.expected, effective.Template)
+		})
+	}
+
+	effective, err := NewRepoConfigResolver(&RepoConfig{}).Resolve("anything")
+	require.NoError(t, err)
+	assert.Empty(t, effective.Template)
+}
+
+func TestRepoConfigResolver_Resolve(t *testing.T) {
+	rc := newResolverTestConfig()
+	resolver := NewRepoConfigResolver(rc)
+
+	effective, err := resolver.Resolve("api-service")
+	require.NoError(t, err)
+	assert.True(t, *effective.Settings.Private)      // From defaults
+	assert.True(t, *effective.Settings.HasIssues)    // From base template
+	assert.False(t, *effective.Settings.HasWiki)     // From backend template
+	assert.False(t, *effective.Settings.HasProjects) // From microservice template
+	assert.Nil(t, effective.Settings.HasDownloads, "patterns and default are skipped for specific repositories")
+	assert.Empty(t, effective.Exceptions)
+
+	effective, err = resolver.Resolve("auth-svc-service")
+	require.NoError(t, err)
+	assert.False(t, *effective.Settings.HasWiki)
+	assert.False(t, *effective.Settings.HasDownloads)
+	assert.Equal(t, []string{"svc"}, effective.Settings.Topics)
+	assert.Len(t, effective.Exceptions, 1)
+
+	// Results must not share slices with the resolver or each other
+	effective.Settings.Topics[0] = "changed"
+	effective.Exceptions[0].RuleName = "changed"
+
+	again, err := resolver.Resolve("auth-svc-service")
+	require.NoError(t, err)
+	assert.Equal(t, []string{"svc"}, again.Settings.Topics)
+	assert.Equal(t, "r", again.Exceptions[0].RuleName)
+
+	// GetEffectiveConfig resolves the same configuration
+	settings, _, _, exceptions, err := rc.GetEffectiveConfig("auth-svc-service")
+	require.NoError(t, err)
+	assert.Equal(t, again.Settings, settings)
+	assert.Equal(t, again.Exceptions, exceptions)
+}
+
+func TestRepoConfigResolver_MissingTemplate(t *testing.T) {
+	resolver := NewRepoConfigResolver(&RepoConfig{
+		Repositories: &RepoTargets{
+			Specific: []RepoSpecificConfig{
+				{Name: "repo", Template: "missing", Settings: &RepoSettings{HasWiki: boolPtr(true)}},
+			},
+		},
+	})
+
+	effective, err := resolver.Resolve("repo")
+	require.NoError(t, err)
+	assert.True(t, *effective.Settings.HasWiki)
+	assert.Equal(t, "missing", effective.Template)
+}
+
+func TestGlobMatcher(t *testing.T) {
+	tests := []struct {
+		name     string
+		pattern  string
+		expected bool
+	}{
+		{"api-service", "*-service", true},
+		{"service-api", "*-service", false},
+		{"test-repo", "test-*", true},
+		{"repo-test", "test-*", false},
+		{"exact-match", "exact-match", true},
+		{"no-match", "exact-match", false},
+		{"api-complex-service", "api-*-service", true},
+		{"api-service", "api-*-service", false},
+		{"a.b", "a.*", true},
+		{"axb", "a.*", false},
+		{"anything", "*", true},
+		{"core-lib-go", "*-lib-*", true},
+		{"lib", "*-lib-*", false},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name+"-"+tt.pattern, func(t *testing.T) {
+			assert.Equal(t, tt.expected, compileGlob(tt.pattern).Match(tt.name))
+		})
+	}
+}
+
+func BenchmarkRepoConfigResolver(b *testing.B) {
+	rc := newResolverTestConfig()
+
+	for i := 0; i < 200; i++ {
+		rc.Repositories.Specific = append(rc.Repositories.Specific, RepoSpecificConfig{Name: fmt.Sprintf("repo-%d", i), Template: "microservice"})
+		rc.Repositories.Patterns = append(rc.Repositories.Patterns, RepoPatternConfig{Match: fmt.Sprintf("team%d-*", i), Template: "backend"})
+	}
+
+	b.Run("GetEffectiveConfig", func(b *testing.B) {
+		for i := 0; i < b.N; i++ {
+			if _, _, _, _, err := rc.GetEffectiveConfig("team150-api"); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+
+	b.Run("Resolver", func(b *testing.B) {
+		resolver := NewRepoConfigResolver(rc)
+
+		for i := 0; i < b.N; i++ {
+			if _, err := resolver.Resolve("team150-api"); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+}
@@ -619,65 +619,15 @@ func (rc *RepoConfig) resolveTemplateWithChain(templateName string, chain []stri
 }
 
 // GetEffectiveConfig returns the effective configuration for a specific repository.
+// Callers resolving many repositories should build a RepoConfigResolver once
+// instead.
 func (rc *RepoConfig) GetEffectiveConfig(repoName string) (*RepoSettings, *SecuritySettings, *PermissionSettings, []PolicyException, error) {
-	config := &effectiveConfig{}
-
-	// Start with defaults
-	if rc.Defaults != nil {
-		rc.applyConfigLayer(config, rc.Defaults.Template, rc.Defaults.Settings, rc.Defaults.Security, rc.Defaults.Permissions, nil)
-	}
-
-	// Apply repository-specific configuration
-	if rc.Repositories != nil {
-		// Check specific repositories
-		for _, specific := range rc.Repositories.Specific {
-			if specific.Name == repoName {
-				rc.applyConfigLayer(config, specific.Template, specific.Settings, specific.Security, specific.Permissions, specific.Exceptions)
-				return config.settings, config.security, config.permissions, config.exceptions, nil
-			}
-		}
-
-		// Check patterns
-		for _, pattern := range rc.Repositories.Patterns {
-			if matchPattern(repoName, pattern.Match) {
-				rc.applyConfigLayer(config, pattern.Template, pattern.Settings, pattern.Security, pattern.Permissions, pattern.Exceptions)
-			}
-		}
-
-		// Apply default if exists
-		if rc.Repositories.Default != nil {
-			rc.applyConfigLayer(config, rc.Repositories.Default.Template, rc.Repositories.Default.Settings, rc.Repositories.Default.Security, rc.Repositories.Default.Permissions, nil)
-		}
-	}
-
-	return config.settings, config.security, config.permissions, config.exceptions, nil
-}
-
-// effectiveConfig holds the accumulated configuration during processing.
-type effectiveConfig struct {
-	settings    *RepoSettings
-	security    *SecuritySettings
-	permissions *PermissionSettings
-	exceptions  []PolicyException
-}
-
-// applyConfigLayer applies a configuration layer (template + direct settings).
-func (rc *RepoConfig) applyConfigLayer(config *effectiveConfig, templateName string, settings *RepoSettings, security *SecuritySettings, permissions *PermissionSettings, exceptions []PolicyException) {
-	// Apply template if specified
-	if templateName != "" {
-		template, err := rc.resolveTemplate(templateName)
-		if err == nil {
-			config.settings = mergeRepoSettings(config.settings, template.Settings)
-			config.security = mergeSecuritySettings(config.security, template.Security)
-			config.permissions = mergePermissionSettings(config.permissions, template.Permissions)
-		}
+	effective, err := NewRepoConfigResolver(rc).Resolve(repoName)
+	if err != nil {
+		return nil, nil, nil, nil, err
 	}
 
-	// Apply direct settings
-	config.settings = mergeRepoSettings(config.settings, settings)
-	config.security = mergeSecuritySettings(config.security, security)
-	config.permissions = mergePermissionSettings(config.permissions, permissions)
-	config.exceptions = append(config.exceptions, exceptions...)
+	return effective.Settings, effective.Security, effective.Permissions, effective.Exceptions, nil
 }
 
 // ValidatePolicyExceptions validates all policy exceptions in the configuration.
@@ -979,18 +929,3 @@ func copyBranchProtectionRule(rule *BranchProtectionRule) *BranchProtectionRule
 
 	return result
 }
-
-// matchPattern checks if a string matches a pattern (simple glob support).
-func matchPattern(str, pattern string) bool {
-	// Simple implementation - can be enhanced with more sophisticated pattern matching
-	if strings.Contains(pattern, "*") {
-		// Convert simple glob to regex
-		pattern = strings.ReplaceAll(pattern, ".", "\\.")
-		pattern = strings.ReplaceAll(pattern, "*", ".*")
-		pattern = "^" + pattern + "$"
-
-		return strings.Contains(str, strings.Trim(pattern, "^.*$"))
-	}
-
-	return str == pattern
-}
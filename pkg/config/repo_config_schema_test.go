@@ -243,7 +243,7 @@ func TestMatchPattern(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.str+" vs "+tt.pattern, func(t *testing.T) {
-			got := matchPattern(tt.str, tt.pattern)
+			got := compileGlob(tt.pattern).Match(tt.str)
 			assert.Equal(t, tt.want, got)
 		})
 	}
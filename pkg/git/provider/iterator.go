@@ -0,0 +1,139 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package provider
+
+import (
+	"context"
+
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
+)
+
+// RepositoryIterator pulls repositories one at a time, fetching further pages
+// only as the consumer asks for them.
+//
+//	it := provider.IterateRepositories(ctx, p, opts)
+//	for it.Next() {
+//		repo := it.Repository()
+//		...
+//	}
+//	if err := it.Err(); err != nil {
+//		...
+//	}
+type RepositoryIterator interface {
+	// Next advances to the next repository and reports whether there is one.
+	Next() bool
+	// Repository returns the current repository.
+	Repository() Repository
+	// Err returns the error that stopped the iteration, if any.
+	Err() error
+	// Close releases the resources of an iteration abandoned before Next
+	// returned false.
+	Close() error
+}
+
+// RepositoryStreamer is implemented by providers that can decode repository
+// listings incrementally instead of returning whole pages.
+type RepositoryStreamer interface {
+	StreamRepositories(ctx context.Context, opts ListOptions) RepositoryIterator
+}
+
+// defaultIteratorPageSize is the page size used when ListOptions has none.
+const defaultIteratorPageSize = 100
+
+// IterateRepositories returns an iterator over the repositories matching
+// opts. Providers implementing RepositoryStreamer stream natively; for the
+// others the iterator walks ListRepositories page by page starting at
+// opts.Page, so only one page is held at a time.
+func IterateRepositories(ctx context.Context, p GitProvider, opts ListOptions) RepositoryIterator {
+	if streamer, ok := p.(RepositoryStreamer); ok {
+		return streamer.StreamRepositories(ctx, opts)
+	}
+
+	return PageRepositories(ctx, p, opts)
+}
+
+// PageRepositories returns an iterator walking ListRepositories page by page.
+// Streaming providers use it as their fallback for listings they cannot
+// stream.
+func PageRepositories(ctx context.Context, p GitProvider, opts ListOptions) RepositoryIterator {
+	if opts.Page <= 0 {
+		opts.Page = 1
+	}
+
+	if opts.PerPage <= 0 {
+		opts.PerPage = defaultIteratorPageSize
+	}
+
+	return &pageIterator{ctx: ctx, provider: p, opts: opts, more: true}
+}
+
+// pageIterator adapts the page-based ListRepositories to RepositoryIterator.
+type pageIterator struct {
+	ctx      context.Context
+	provider GitProvider
+	opts     ListOptions
+
+	page    []Repository
+	current Repository
+	more    bool
+	err     error
+}
+
+func (it *pageIterator) Next() bool {
+	for len(it.page) == 0 {
+		if !it.more || it.err != nil {
+			return false
+		}
+
+		if err := it.ctx.Err(); err != nil {
+			it.err = err
+			return false
+		}
+
+		span := phase.Start(it.ctx, phase.APIList)
+		list, err := it.provider.ListRepositories(it.ctx, it.opts)
+		span.End(err)
+
+		if err != nil {
+			it.err = err
+			return false
+		}
+
+		it.page = list.Repositories
+		// An empty page ends providers that always report another page
+		it.more = list.HasNext && len(list.Repositories) > 0
+		it.opts.Page++
+	}
+
+	it.current = it.page[0]
+	it.page[0] = Repository{}
+	it.page = it.page[1:]
+
+	return true
+}
+
+func (it *pageIterator) Repository() Repository {
+	return it.current
+}
+
+func (it *pageIterator) Err() error {
+	return it.err
+}
+
+func (it *pageIterator) Close() error {
+	it.page, it.more = nil, false
+	return nil
+}
+
+// CollectRepositories drains the iterator into a slice.
+func CollectRepositories(it RepositoryIterator) ([]Repository, error) {
+	defer func() { _ = it.Close() }()
+
+	var repos []Repository
+	for it.Next() {
+		repos = append(repos, it.Repository())
+	}
+
+	return repos, it.Err()
+}
@@ -0,0 +1,241 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package provider
+
+import (
+	"context"
+	"net/http"
+	"net/url"
+	"strconv"
+	"strings"
+)
+
+// PageInfo is what a listing response says about the pages after it.
+type PageInfo struct {
+	// NextURL is the rel="next" link of the response. For keyset (cursor)
+	// pagination it is the only way to reach the next page.
+	NextURL string
+	// NextPage is the number of the next page, or 0 when unknown or last.
+	NextPage int
+	// TotalPages is the number of pages in the listing, or 0 when the API
+	// did not say.
+	TotalPages int
+}
+
+// HasNext reports whether another page follows.
+func (i PageInfo) HasNext() bool {
+	return i.NextURL != "" || i.NextPage > 0
+}
+
+// ParsePageInfo reads the pagination headers used by GitHub, GitLab and
+// Gitea: RFC 5988 Link headers (rel="next" and rel="last"), including GitLab
+// keyset links, and GitLab's X-Next-Page and X-Total-Pages.
+func ParsePageInfo(header http.Header) PageInfo {
+	var info PageInfo
+
+	links := ParseLinkHeader(header.Get("Link"))
+	if next, ok := links["next"]; ok {
+		info.NextURL = next
+		info.NextPage, _ = pageParam(next)
+	}
+
+	if last, ok := links["last"]; ok {
+		info.TotalPages, _ = pageParam(last)
+	}
+
+	if next, err := strconv.Atoi(header.Get("X-Next-Page")); err == nil && next > 0 {
+		info.NextPage = next
+	}
+
+	if total, err := strconv.Atoi(header.Get("X-Total-Pages")); err == nil && total > 0 {
+		info.TotalPages = total
+	}
+
+	return info
+}
+
+// ParseLinkHeader maps the rel values of a Link header to their URLs.
+func ParseLinkHeader(header string) map[string]string {
+	links := make(map[string]string)
+
+	for _, part := range strings.Split(header, ",") {
+		target, params, ok := strings.Cut(strings.TrimSpace(part), ";")
+		if !ok {
+			continue
+		}
+
+		target = strings.Trim(strings.TrimSpace(target), "<>")
+
+		for _, param := range strings.Split(params, ";") {
+			if rel, ok := strings.CutPrefix(strings.TrimSpace(param), "rel="); ok {
+				links[strings.Trim(rel, `"`)] = target
+			}
+		}
+	}
+
+	return links
+}
+
+// pageParam returns the page query parameter of a pagination URL.
+func pageParam(rawURL string) (int, error) {
+	u, err := url.Parse(rawURL)
+	if err != nil {
+		return 0, err
+	}
+
+	return strconv.Atoi(u.Query().Get("page"))
+}
+
+// PageRequest identifies the page a PageFetcher should fetch.
+type PageRequest struct {
+	// Page is the 1-based page number.
+	Page int
+	// URL is the link the previous response gave for this page, if any.
+	// Fetchers using keyset pagination must follow it; others may build
+	// the request from Page instead.
+	URL string
+}
+
+// Page is one fetched page of a listing.
+type Page[T any] struct {
+	// Number is the 1-based page number.
+	Number int
+	Items  []T
+	Info   PageInfo
+}
+
+// PageFetcher fetches one page of a listing.
+type PageFetcher[T any] func(ctx context.Context, req PageRequest) ([]T, PageInfo, error)
+
+// PagerOptions configures WalkPages.
+type PagerOptions struct {
+	// Concurrency bounds the pages in flight when the total is known.
+	// Values below 2 walk the listing one page at a time.
+	Concurrency int
+	// Wait, when set, is called before every request so the walk stays
+	// within the caller's rate budget.
+	Wait func(ctx context.Context) error
+}
+
+// WalkPages fetches every page of a listing and passes each page to yield in
+// page order, stopping at the first error from fetch or yield.
+//
+// When the first response announces the total number of pages, the
+// remaining pages are prefetched concurrently, at most opts.Concurrency at a
+// time, and buffered only until their turn to be yielded. Otherwise the walk
+// follows the next links one page at a time, as keyset pagination requires.
+func WalkPages[T any](ctx context.Context, fetch PageFetcher[T], opts PagerOptions, yield func(page Page[T]) error) error {
+	page, err := fetchPage(ctx, fetch, opts, PageRequest{Page: 1})
+	if err != nil {
+		return err
+	}
+
+	if err := yield(page); err != nil {
+		return err
+	}
+
+	if opts.Concurrency > 1 && page.Info.TotalPages > 1 && page.Info.NextPage == 2 {
+		page, err = prefetchPages(ctx, fetch, opts, page, yield)
+		if err != nil {
+			return err
+		}
+	}
+
+	// An empty page ends providers that always report another page
+	for page.Info.HasNext() && len(page.Items) > 0 {
+		req := PageRequest{Page: page.Number + 1, URL: page.Info.NextURL}
+		if page.Info.NextPage > 0 {
+			req.Page = page.Info.NextPage
+		}
+
+		page, err = fetchPage(ctx, fetch, opts, req)
+		if err != nil {
+			return err
+		}
+
+		if err := yield(page); err != nil {
+			return err
+		}
+	}
+
+	return nil
+}
+
+type pageResult[T any] struct {
+	page Page[T]
+	err  error
+}
+
+// prefetchPages fetches the pages after first up to the total it announced
+// concurrently and yields them in order. It returns the last page yielded,
+// which links to further pages if the listing grew while it was walked.
+func prefetchPages[T any](ctx context.Context, fetch PageFetcher[T], opts PagerOptions, first Page[T], yield func(page Page[T]) error) (Page[T], error) {
+	ctx, cancel := context.WithCancel(ctx)
+	defer cancel()
+
+	// Each queued page owns a fetch in flight; together with the page being
+	// waited on that keeps Concurrency requests outstanding.
+	pending := make(chan chan pageResult[T], opts.Concurrency-1)
+
+	go func() {
+		defer close(pending)
+
+		for number := 2; number <= first.Info.TotalPages; number++ {
+			result := make(chan pageResult[T], 1)
+
+			select {
+			case pending <- result:
+			case <-ctx.Done():
+				return
+			}
+
+			go func(number int) {
+				page, err := fetchPage(ctx, fetch, opts, PageRequest{Page: number})
+				result <- pageResult[T]{page: page, err: err}
+			}(number)
+		}
+	}()
+
+	last := first
+
+	for result := range pending {
+		r := <-result
+		if r.err != nil {
+			return last, r.err
+		}
+
+		last = r.page
+
+		if err := yield(last); err != nil {
+			return last, err
+		}
+	}
+
+	// The producer stops early only when the caller's context ends
+	if last.Number < first.Info.TotalPages {
+		return last, ctx.Err()
+	}
+
+	return last, nil
+}
+
+func fetchPage[T any](ctx context.Context, fetch PageFetcher[T], opts PagerOptions, req PageRequest) (Page[T], error) {
+	page := Page[T]{Number: req.Page}
+
+	if err := ctx.Err(); err != nil {
+		return page, err
+	}
+
+	if opts.Wait != nil {
+		if err := opts.Wait(ctx); err != nil {
+			return page, err
+		}
+	}
+
+	var err error
+
+	page.Items, page.Info, err = fetch(ctx, req)
+
+	return page, err
+}
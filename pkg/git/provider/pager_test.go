@@ -0,0 +1,277 @@
+// Copyright (c) 2025 Gizzahub
+// SPDX-License-Identifier: MIT
+
+package provider
+
+import (
+	"context"
+	"errors"
+	"fmt"
+	"net/http"
+	"sync"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func TestParsePageInfo(t *testing.T) {
+	tests := []struct {
+		name    string
+		headers map[string]string
+		want    PageInfo
+	}{
+		{
+			name: "github link header",
+			headers: map[string]string{
+				"Link": `<https://api.github.com/orgs/acme/repos?page=3>; rel="next", <https://api.github.com/orgs/acme/repos?page=9>; rel="last"`,
+			},
+			want: PageInfo{NextURL: "https://api.github.com/orgs/acme/repos?page=3", NextPage: 3, TotalPages: 9},
+		},
+		{
+			name:    "last page",
+			headers: map[string]string{"Link": `<https://api.github.com/orgs/acme/repos?page=1>; rel="prev"`},
+			want:    PageInfo{},
+		},
+		{
+			name:    "gitlab offset headers",
+			headers: map[string]string{"X-Next-Page": "2", "X-Total-Pages": "40", "X-Page": "1"},
+			want:    PageInfo{NextPage: 2, TotalPages: 40},
+		},
+		{
+			name:    "gitlab last page",
+			headers: map[string]string{"X-Next-Page": "", "X-Total-Pages": "40"},
+			want:    PageInfo{TotalPages: 40},
+		},
+		{
+			name: "gitlab keyset link",
+			headers: map[string]string{
+				"Link": `<https://gitlab.com/api/v4/groups/9/projects?id_after=42&pagination=keyset&per_page=100>; rel="next"`,
+			},
+			want: PageInfo{NextURL: "https://gitlab.com/api/v4/groups/9/projects?id_after=42&pagination=keyset&per_page=100"},
+		},
+		{
+			name: "no pagination",
+			want: PageInfo{},
+		},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			header := http.Header{}
+			for key, value := range tt.headers {
+				header.Set(key, value)
+			}
+
+			info := ParsePageInfo(header)
+			assert.Equal(t, tt.want, info)
+			assert.Equal(t, tt.want.NextURL != "" || tt.want.NextPage > 0, info.HasNext())
+		})
+	}
+}
+
+// fakeListing serves pages of ints, numbered or by cursor, and records how
+// many requests were in flight at once.
+type fakeListing struct {
+	pages     int
+	perPage   int
+	keyset    bool
+	failPage  int
+	delay     time.Duration
+	inFlight  atomic.Int32
+	maxFlight atomic.Int32
+	requests  atomic.Int32
+}
+
+func (f *fakeListing) fetch(ctx context.Context, req PageRequest) ([]int, PageInfo, error) {
+	n := f.inFlight.Add(1)
+	defer f.inFlight.Add(-1)
+
+	for {
+		peak := f.maxFlight.Load()
+		if n <= peak || f.maxFlight.CompareAndSwap(peak, n) {
+			break
+		}
+	}
+
+	f.requests.Add(1)
+
+	page := req.Page
+	if f.keyset && page > 1 {
+		if _, err := fmt.Sscanf(req.URL, "cursor=%d", &page); err != nil {
+			return nil, PageInfo{}, fmt.Errorf("page %d requested without cursor", req.Page)
+		}
+	}
+
+	select {
+	case <-time.After(f.delay):
+	case <-ctx.Done():
+		return nil, PageInfo{}, ctx.Err()
+	}
+
+	if page == f.failPage {
+		return nil, PageInfo{}, errors.New("boom")
+	}
+
+	items := make([]int, f.perPage)
+	for i := range items {
+		items[i] = (page-1)*f.perPage + i
+	}
+
+	var info PageInfo
+
+	if page < f.pages {
+		if f.keyset {
+			info.NextURL = fmt.Sprintf("cursor=%d", page+1)
+		} else {
+			info.NextPage = page + 1
+		}
+	}
+
+	if !f.keyset {
+		info.TotalPages = f.pages
+	}
+
+	return items, info, nil
+}
+
+func collectPages(t *testing.T, listing *fakeListing, opts PagerOptions) ([]int, []int, error) {
+	t.Helper()
+
+	var numbers, items []int
+
+	err := WalkPages(context.Background(), listing.fetch, opts, func(page Page[int]) error {
+		numbers = append(numbers, page.Number)
+		items = append(items, page.Items...)
+
+		return nil
+	})
+
+	return numbers, items, err
+}
+
+func expectedPages(pages, perPage int) ([]int, []int) {
+	var numbers, items []int
+	for page := 1; page <= pages; page++ {
+		numbers = append(numbers, page)
+	}
+
+	for i := 0; i < pages*perPage; i++ {
+		items = append(items, i)
+	}
+
+	return numbers, items
+}
+
+func TestWalkPages_PrefetchesKnownTotal(t *testing.T) {
+	listing := &fakeListing{pages: 12, perPage: 3, delay: 5 * time.Millisecond}
+
+	var waits atomic.Int32
+
+	numbers, items, err := collectPages(t, listing, PagerOptions{
+		Concurrency: 4,
+		Wait: func(context.Context) error {
+			waits.Add(1)
+			return nil
+		},
+	})
+	require.NoError(t, err)
+
+	wantNumbers, wantItems := expectedPages(12, 3)
+	assert.Equal(t, wantNumbers, numbers, "pages are yielded in order")
+	assert.Equal(t, wantItems, items)
+	assert.EqualValues(t, 12, listing.requests.Load())
+	assert.EqualValues(t, 12, waits.Load(), "every request waits for the rate budget")
+	assert.Greater(t, listing.maxFlight.Load(), int32(1))
+	assert.LessOrEqual(t, listing.maxFlight.Load(), int32(4))
+}
+
+func TestWalkPages_SerialWithoutTotal(t *testing.T) {
+	for _, opts := range []PagerOptions{{Concurrency: 4}, {Concurrency: 1}} {
+		listing := &fakeListing{pages: 5, perPage: 2, keyset: true}
+
+		numbers, items, err := collectPages(t, listing, opts)
+		require.NoError(t, err)
+
+		wantNumbers, wantItems := expectedPages(5, 2)
+		assert.Equal(t, wantNumbers, numbers)
+		assert.Equal(t, wantItems, items)
+		assert.EqualValues(t, 1, listing.maxFlight.Load())
+	}
+
+	// Without prefetching, numbered listings walk serially as well
+	listing := &fakeListing{pages: 5, perPage: 2}
+
+	_, items, err := collectPages(t, listing, PagerOptions{})
+	require.NoError(t, err)
+	assert.Len(t, items, 10)
+	assert.EqualValues(t, 1, listing.maxFlight.Load())
+}
+
+func TestWalkPages_StopsAtFirstError(t *testing.T) {
+	listing := &fakeListing{pages: 20, perPage: 1, failPage: 5, delay: time.Millisecond}
+
+	numbers, _, err := collectPages(t, listing, PagerOptions{Concurrency: 3})
+	require.EqualError(t, err, "boom")
+	assert.Equal(t, []int{1, 2, 3, 4}, numbers)
+
+	stop := errors.New("stop")
+	listing = &fakeListing{pages: 20, perPage: 1}
+
+	var mu sync.Mutex
+
+	yielded := 0
+	err = WalkPages(context.Background(), listing.fetch, PagerOptions{Concurrency: 3}, func(page Page[int]) error {
+		mu.Lock()
+		defer mu.Unlock()
+
+		yielded++
+		if page.Number == 2 {
+			return stop
+		}
+
+		return nil
+	})
+	require.ErrorIs(t, err, stop)
+	assert.Equal(t, 2, yielded)
+	assert.Less(t, listing.requests.Load(), int32(20), "remaining pages are not fetched")
+}
+
+func TestWalkPages_ContinuesPastAnnouncedTotal(t *testing.T) {
+	grown := &fakeListing{pages: 5, perPage: 1}
+
+	// The first page announces three pages, but the listing grew since
+	fetch := func(ctx context.Context, req PageRequest) ([]int, PageInfo, error) {
+		items, info, err := grown.fetch(ctx, req)
+		if req.Page == 1 {
+			info.TotalPages = 3
+		}
+
+		return items, info, err
+	}
+
+	var numbers []int
+
+	err := WalkPages(context.Background(), fetch, PagerOptions{Concurrency: 2}, func(page Page[int]) error {
+		numbers = append(numbers, page.Number)
+		return nil
+	})
+	require.NoError(t, err)
+	assert.Equal(t, []int{1, 2, 3, 4, 5}, numbers)
+}
+
+func TestWalkPages_Cancelled(t *testing.T) {
+	ctx, cancel := context.WithCancel(context.Background())
+	listing := &fakeListing{pages: 50, perPage: 1, delay: time.Millisecond}
+
+	err := WalkPages(ctx, listing.fetch, PagerOptions{Concurrency: 4}, func(page Page[int]) error {
+		if page.Number == 3 {
+			cancel()
+		}
+
+		return nil
+	})
+	require.ErrorIs(t, err, context.Canceled)
+}
@@ -10,8 +10,11 @@ import (
 	"golang.org/x/sync/errgroup"
 	"golang.org/x/sync/semaphore"
 
+	"github.com/gizzahub/gzh-cli/internal/constants"
 	"github.com/gizzahub/gzh-cli/internal/git"
+	"github.com/gizzahub/gzh-cli/internal/git/objectcache"
 	"github.com/gizzahub/gzh-cli/internal/httpclient"
+	"github.com/gizzahub/gzh-cli/pkg/git/provider"
 )
 
 // RepoInfo represents Gitea repository information returned by the Gitea API.
@@ -75,18 +78,40 @@ func GetDefaultBranch(ctx context.Context, org string, repo string) (string, err
 // Returns a slice of repository names or an error if the organization
 // doesn't exist, access is denied, or the API request fails.
 func List(ctx context.Context, org string) ([]string, error) {
-	url := fmt.Sprintf("https://gitea.com/api/v1/orgs/%s/repos", org)
+	client := httpclient.GetGlobalClient("gitea")
 
-	req, err := http.NewRequestWithContext(ctx, "GET", url, nil)
+	fetch := func(ctx context.Context, page provider.PageRequest) ([]string, provider.PageInfo, error) {
+		return listPage(ctx, client, org, page.Page)
+	}
+
+	var repoNames []string
+
+	err := provider.WalkPages(ctx, fetch, provider.PagerOptions{Concurrency: constants.DefaultParallelism}, func(page provider.Page[string]) error {
+		repoNames = append(repoNames, page.Items...)
+		return nil
+	})
 	if err != nil {
-		return nil, fmt.Errorf("failed to create request: %w", err)
+		return nil, err
 	}
 
-	client := httpclient.GetGlobalClient("gitea")
+	return repoNames, nil
+}
+
+// listPageSize is the largest page Gitea serves with its default settings.
+const listPageSize = 50
+
+// listPage fetches one page of an organization's repository names.
+func listPage(ctx context.Context, client *http.Client, org string, page int) ([]string, provider.PageInfo, error) {
+	url := fmt.Sprintf("https://gitea.com/api/v1/orgs/%s/repos?limit=%d&page=%d", org, listPageSize, page)
+
+	req, err := http.NewRequestWithContext(ctx, "GET", url, nil)
+	if err != nil {
+		return nil, provider.PageInfo{}, fmt.Errorf("failed to create request: %w", err)
+	}
 
 	resp, err := client.Do(req)
 	if err != nil {
-		return nil, fmt.Errorf("failed to get repositories: %w", err)
+		return nil, provider.PageInfo{}, fmt.Errorf("failed to get repositories: %w", err)
 	}
 	defer func() {
 		if err := resp.Body.Close(); err != nil {
@@ -96,14 +121,14 @@ func List(ctx context.Context, org string) ([]string, error) {
 	}()
 
 	if resp.StatusCode != http.StatusOK {
-		return nil, fmt.Errorf("failed to get repositories: %s", resp.Status)
+		return nil, provider.PageInfo{}, fmt.Errorf("failed to get repositories: %s", resp.Status)
 	}
 
 	var repos []struct {
 		Name string `json:"name"`
 	}
 	if err := json.NewDecoder(resp.Body).Decode(&repos); err != nil {
-		return nil, fmt.Errorf("failed to decode response: %w", err)
+		return nil, provider.PageInfo{}, fmt.Errorf("failed to decode response: %w", err)
 	}
 
 	repoNames := make([]string, 0, len(repos))
@@ -111,7 +136,7 @@ func List(ctx context.Context, org string) ([]string, error) {
 		repoNames = append(repoNames, repo.Name)
 	}
 
-	return repoNames, nil
+	return repoNames, provider.ParsePageInfo(resp.Header), nil
 }
 
 // Clone downloads a Gitea repository to the specified local path.
@@ -147,7 +172,10 @@ func Clone(ctx context.Context, targetPath string, org string, repo string, bran
 	}
 
 	// Execute git clone with secure validation
-	if err := executor.ExecuteSecure(ctx, targetPath, "clone", "-b", branch, cloneURL, "."); err != nil {
+	args := append([]string{"clone", "-b", branch}, objectcache.DefaultStrategy().CloneArgs(ctx, cloneURL)...)
+	args = append(args, cloneURL, ".")
+
+	if err := executor.ExecuteSecure(ctx, targetPath, args...); err != nil {
 		return fmt.Errorf("clone failed (url: %s, branch: %s, targetPath: %s): %w", cloneURL, branch, targetPath, err)
 	}
 
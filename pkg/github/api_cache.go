@@ -0,0 +1,338 @@
+package github
+
+import (
+	"container/list"
+	"crypto/sha256"
+	"encoding/hex"
+	"encoding/json"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+	"sync"
+	"time"
+)
+
+// apiCacheEntry is a cached API response body together with its HTTP validator.
+// Stale entries are kept so that their ETag can be used for conditional requests.
+type apiCacheEntry struct {
+	Key       string          `json:"key"`
+	Body      json.RawMessage `json:"body"`
+	ETag      string          `json:"etag,omitempty"`
+	StoredAt  time.Time       `json:"stored_at"`
+	ExpiresAt time.Time       `json:"expires_at"`
+}
+
+// fresh reports whether the entry can be served without contacting the API.
+func (e *apiCacheEntry) fresh(now time.Time) bool {
+	return now.Before(e.ExpiresAt)
+}
+
+// CacheStats contains hit/miss/eviction counters of an APICache.
+type CacheStats struct {
+	Hits          int64 // Fresh entries served without an API request
+	Revalidations int64 // Stale entries confirmed by a 304 Not Modified response
+	Misses        int64 // Requests that had to download a full response
+	Evictions     int64 // Entries dropped from memory by the LRU policy
+	DiskReads     int64 // Entries promoted from the on-disk store into memory
+	Entries       int   // Entries currently held in memory
+}
+
+// HitRate returns the share of lookups answered from cache (including 304 revalidations).
+func (s CacheStats) HitRate() float64 {
+	total := s.Hits + s.Revalidations + s.Misses
+	if total == 0 {
+		return 0
+	}
+
+	return float64(s.Hits+s.Revalidations) / float64(total)
+}
+
+// APICache is a two-level cache for GitHub API responses: a bounded in-memory LRU
+// in front of an optional on-disk store that survives between gz invocations.
+type APICache struct {
+	mu       sync.Mutex
+	capacity int
+	items    map[string]*list.Element
+	lru      *list.List
+	diskDir  string
+	stats    CacheStats
+}
+
+// NewAPICache creates a cache from the given configuration.
+// The disk tier is disabled when EnableDiskCache is false or the directory cannot be created.
+func NewAPICache(config CacheConfiguration) *APICache {
+	capacity := config.LocalCacheSize
+	if !config.EnableLocalCache || capacity <= 0 {
+		capacity = 1
+	}
+
+	cache := &APICache{
+		capacity: capacity,
+		items:    make(map[string]*list.Element),
+		lru:      list.New(),
+	}
+
+	if config.EnableDiskCache {
+		dir := config.DiskCacheDir
+		if dir == "" {
+			dir = defaultDiskCacheDir()
+		}
+
+		if err := os.MkdirAll(dir, 0o700); err == nil {
+			cache.diskDir = dir
+			cache.pruneDisk(config.DiskCacheMaxAge, config.DiskCacheMaxEntries, time.Now())
+		}
+	}
+
+	return cache
+}
+
+// defaultDiskCacheDir returns ~/.gzh/cache/github, falling back to the current directory.
+func defaultDiskCacheDir() string {
+	if homeDir, err := os.UserHomeDir(); err == nil {
+		return filepath.Join(homeDir, ".gzh", "cache", "github")
+	}
+
+	return filepath.Join(".gzh", "cache", "github")
+}
+
+// lookup returns the entry for key from memory or disk, whether fresh or stale.
+func (c *APICache) lookup(key string) (*apiCacheEntry, bool) {
+	c.mu.Lock()
+	if elem, ok := c.items[key]; ok {
+		c.lru.MoveToFront(elem)
+		entry := elem.Value.(*apiCacheEntry) //nolint:forcetypeassert // list only holds cache entries
+		c.mu.Unlock()
+
+		return entry, true
+	}
+	c.mu.Unlock()
+
+	entry, ok := c.readDisk(key)
+	if !ok {
+		return nil, false
+	}
+
+	c.mu.Lock()
+	c.stats.DiskReads++
+	c.storeLocked(entry)
+	c.mu.Unlock()
+
+	return entry, true
+}
+
+// store saves the entry in memory and, when enabled, on disk.
+func (c *APICache) store(entry *apiCacheEntry) {
+	c.mu.Lock()
+	c.storeLocked(entry)
+	c.mu.Unlock()
+
+	c.writeDisk(entry)
+}
+
+// storeLocked inserts or replaces an entry in the LRU. Caller must hold c.mu.
+func (c *APICache) storeLocked(entry *apiCacheEntry) {
+	if elem, ok := c.items[entry.Key]; ok {
+		elem.Value = entry
+		c.lru.MoveToFront(elem)
+
+		return
+	}
+
+	c.items[entry.Key] = c.lru.PushFront(entry)
+
+	for c.lru.Len() > c.capacity {
+		oldest := c.lru.Back()
+		c.lru.Remove(oldest)
+		delete(c.items, oldest.Value.(*apiCacheEntry).Key) //nolint:forcetypeassert // list only holds cache entries
+		c.stats.Evictions++
+	}
+}
+
+// Delete removes the entry for key from both tiers and reports whether it existed.
+func (c *APICache) Delete(key string) bool {
+	return c.deleteMatching(func(k string) bool { return k == key }) > 0
+}
+
+// DeletePrefix removes every entry whose key starts with prefix from both tiers.
+// It returns the number of distinct keys removed.
+func (c *APICache) DeletePrefix(prefix string) int {
+	return c.deleteMatching(func(k string) bool { return strings.HasPrefix(k, prefix) })
+}
+
+func (c *APICache) deleteMatching(match func(key string) bool) int {
+	removed := make(map[string]struct{})
+
+	c.mu.Lock()
+	for key, elem := range c.items {
+		if match(key) {
+			c.lru.Remove(elem)
+			delete(c.items, key)
+			removed[key] = struct{}{}
+		}
+	}
+	c.mu.Unlock()
+
+	if c.diskDir != "" {
+		files, _ := filepath.Glob(filepath.Join(c.diskDir, "*.json"))
+		for _, file := range files {
+			entry, err := readCacheFile(file)
+			if err != nil || !match(entry.Key) {
+				continue
+			}
+
+			if err := os.Remove(file); err == nil {
+				removed[entry.Key] = struct{}{}
+			}
+		}
+	}
+
+	return len(removed)
+}
+
+// Stats returns a snapshot of the cache counters.
+func (c *APICache) Stats() CacheStats {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	stats := c.stats
+	stats.Entries = c.lru.Len()
+
+	return stats
+}
+
+// recordHit, recordRevalidation and recordMiss update the request outcome counters.
+func (c *APICache) recordHit() {
+	c.mu.Lock()
+	c.stats.Hits++
+	c.mu.Unlock()
+}
+
+func (c *APICache) recordRevalidation() {
+	c.mu.Lock()
+	c.stats.Revalidations++
+	c.mu.Unlock()
+}
+
+func (c *APICache) recordMiss() {
+	c.mu.Lock()
+	c.stats.Misses++
+	c.mu.Unlock()
+}
+
+// pruneDisk removes disk entries last written before now-maxAge and then the
+// oldest entries beyond maxEntries. Zero disables the respective bound.
+func (c *APICache) pruneDisk(maxAge time.Duration, maxEntries int, now time.Time) {
+	dirEntries, err := os.ReadDir(c.diskDir)
+	if err != nil {
+		return
+	}
+
+	type diskFile struct {
+		path    string
+		modTime time.Time
+	}
+
+	files := make([]diskFile, 0, len(dirEntries))
+
+	for _, dirEntry := range dirEntries {
+		// Cache entries and temp files left by interrupted writes
+		name := dirEntry.Name()
+		if dirEntry.IsDir() || (filepath.Ext(name) != ".json" && !strings.HasPrefix(name, ".entry-")) {
+			continue
+		}
+
+		info, err := dirEntry.Info()
+		if err != nil {
+			continue
+		}
+
+		path := filepath.Join(c.diskDir, name)
+		if maxAge > 0 && now.Sub(info.ModTime()) > maxAge {
+			_ = os.Remove(path)
+			continue
+		}
+
+		files = append(files, diskFile{path: path, modTime: info.ModTime()})
+	}
+
+	if maxEntries <= 0 || len(files) <= maxEntries {
+		return
+	}
+
+	sort.Slice(files, func(i, j int) bool { return files[i].modTime.After(files[j].modTime) })
+
+	for _, file := range files[maxEntries:] {
+		_ = os.Remove(file.path)
+	}
+}
+
+// diskPath maps a cache key onto a file name that is safe on every platform.
+func (c *APICache) diskPath(key string) string {
+	sum := sha256.Sum256([]byte(key))
+	return filepath.Join(c.diskDir, hex.EncodeToString(sum[:])+".json")
+}
+
+func (c *APICache) readDisk(key string) (*apiCacheEntry, bool) {
+	if c.diskDir == "" {
+		return nil, false
+	}
+
+	entry, err := readCacheFile(c.diskPath(key))
+	if err != nil || entry.Key != key {
+		return nil, false
+	}
+
+	return entry, true
+}
+
+// writeDisk persists the entry atomically; failures only cost a future cache miss.
+func (c *APICache) writeDisk(entry *apiCacheEntry) {
+	if c.diskDir == "" {
+		return
+	}
+
+	data, err := json.Marshal(entry)
+	if err != nil {
+		return
+	}
+
+	path := c.diskPath(entry.Key)
+
+	tmp, err := os.CreateTemp(c.diskDir, ".entry-*")
+	if err != nil {
+		return
+	}
+
+	if _, err := tmp.Write(data); err != nil {
+		_ = tmp.Close()
+		_ = os.Remove(tmp.Name())
+
+		return
+	}
+
+	if err := tmp.Close(); err != nil {
+		_ = os.Remove(tmp.Name())
+		return
+	}
+
+	if err := os.Rename(tmp.Name(), path); err != nil {
+		_ = os.Remove(tmp.Name())
+	}
+}
+
+func readCacheFile(path string) (*apiCacheEntry, error) {
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return nil, err
+	}
+
+	var entry apiCacheEntry
+	if err := json.Unmarshal(data, &entry); err != nil {
+		return nil, fmt.Errorf("corrupt cache entry %s: %w", path, err)
+	}
+
+	return &entry, nil
+}
@@ -0,0 +1,211 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package github
+
+import (
+	"context"
+	"fmt"
+	"net/http"
+	"net/http/httptest"
+	"os"
+	"path/filepath"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func newTestCachedClient(t *testing.T, serverURL string, config CacheConfiguration) *CachedGitHubClient {
+	t.Helper()
+
+	client := NewCachedGitHubClientWithConfig("test-token", config)
+	client.baseURL = serverURL
+	client.httpClient = http.DefaultClient
+
+	return client
+}
+
+func TestCachedGitHubClient_ETagRevalidation(t *testing.T) {
+	var fullResponses, notModified atomic.Int32
+
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		if r.Header.Get("If-None-Match") == `"v1"` {
+			notModified.Add(1)
+			w.WriteHeader(http.StatusNotModified)
+
+			return
+		}
+
+		fullResponses.Add(1)
+		w.Header().Set("ETag", `"v1"`)
+		_, _ = w.Write([]byte(`{"name":"repo","default_branch":"main"}`))
+	}))
+	defer server.Close()
+
+	config := DefaultCacheConfiguration()
+	config.EnableDiskCache = false
+	config.TTLs = map[string]time.Duration{"default_branch": time.Hour}
+	client := newTestCachedClient(t, server.URL, config)
+
+	ctx := context.Background()
+
+	branch, err := client.GetDefaultBranchWithCache(ctx, "org", "repo")
+	require.NoError(t, err)
+	assert.Equal(t, "main", branch)
+
+	// Fresh entry is served without a request
+	branch, err = client.GetDefaultBranchWithCache(ctx, "org", "repo")
+	require.NoError(t, err)
+	assert.Equal(t, "main", branch)
+	assert.Equal(t, int32(1), fullResponses.Load())
+	assert.Equal(t, int32(0), notModified.Load())
+
+	// Expire the entry; the next call must revalidate with If-None-Match
+	entry, ok := client.cache.lookup(client.cacheKey("default_branch:org/repo"))
+	require.True(t, ok)
+	entry.ExpiresAt = time.Now().Add(-time.Second)
+
+	branch, err = client.GetDefaultBranchWithCache(ctx, "org", "repo")
+	require.NoError(t, err)
+	assert.Equal(t, "main", branch)
+	assert.Equal(t, int32(1), fullResponses.Load())
+	assert.Equal(t, int32(1), notModified.Load())
+
+	stats := client.Stats()
+	assert.Equal(t, int64(1), stats.Hits)
+	assert.Equal(t, int64(1), stats.Revalidations)
+	assert.Equal(t, int64(1), stats.Misses)
+}
+
+func TestCachedGitHubClient_ListRepositoriesPersistsToDisk(t *testing.T) {
+	var requests atomic.Int32
+
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		requests.Add(1)
+		assert.Equal(t, "/orgs/acme/repos", r.URL.Path)
+		w.Header().Set("ETag", `"page"`)
+		_, _ = w.Write([]byte(`[{"name":"a"},{"name":"b"}]`))
+	}))
+	defer server.Close()
+
+	config := DefaultCacheConfiguration()
+	config.DiskCacheDir = t.TempDir()
+
+	first := newTestCachedClient(t, server.URL, config)
+	repos, err := first.ListRepositoriesWithCache(context.Background(), "acme")
+	require.NoError(t, err)
+	assert.Equal(t, []string{"a", "b"}, repos)
+
+	// A new client (new process) is served from the disk tier
+	second := newTestCachedClient(t, server.URL, config)
+	repos, err = second.ListRepositoriesWithCache(context.Background(), "acme")
+	require.NoError(t, err)
+	assert.Equal(t, []string{"a", "b"}, repos)
+	assert.Equal(t, int32(1), requests.Load())
+	assert.Equal(t, int64(1), second.Stats().DiskReads)
+
+	assert.Equal(t, 1, second.InvalidateOrgCache(context.Background(), "acme"))
+
+	_, err = second.ListRepositoriesWithCache(context.Background(), "acme")
+	require.NoError(t, err)
+	assert.Equal(t, int32(2), requests.Load())
+}
+
+func TestCachedGitHubClient_KeysScopedByTokenAndHost(t *testing.T) {
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		// Each token sees a different default branch
+		branch := "main"
+		if r.Header.Get("Authorization") == "token other-token" {
+			branch = "develop"
+		}
+
+		_, _ = fmt.Fprintf(w, `{"name":"repo","default_branch":%q}`, branch)
+	}))
+	defer server.Close()
+
+	config := DefaultCacheConfiguration()
+	config.DiskCacheDir = t.TempDir()
+
+	first := newTestCachedClient(t, server.URL, config)
+	branch, err := first.GetDefaultBranchWithCache(context.Background(), "org", "repo")
+	require.NoError(t, err)
+	assert.Equal(t, "main", branch)
+
+	// Another token must not be served the first token's disk entry
+	other := newTestCachedClient(t, server.URL, config)
+	other.token = "other-token"
+	branch, err = other.GetDefaultBranchWithCache(context.Background(), "org", "repo")
+	require.NoError(t, err)
+	assert.Equal(t, "develop", branch)
+	assert.Zero(t, other.Stats().DiskReads)
+
+	elsewhere := newTestCachedClient(t, "https://ghe.example.com/api/v3", config)
+	assert.NotEqual(t, first.cacheKey("default_branch:org/repo"), elsewhere.cacheKey("default_branch:org/repo"))
+
+	assert.Equal(t, 2, first.InvalidateRepoCache(context.Background(), "org", "repo"))
+}
+
+func TestAPICache_PruneDisk(t *testing.T) {
+	dir := t.TempDir()
+	now := time.Now()
+
+	writer := NewAPICache(CacheConfiguration{EnableLocalCache: true, LocalCacheSize: 10, EnableDiskCache: true, DiskCacheDir: dir})
+	for i, key := range []string{"old", "a", "b", "c"} {
+		writer.store(&apiCacheEntry{Key: key, Body: []byte(`1`)})
+		modTime := now.Add(-time.Duration(4-i) * time.Minute)
+		if key == "old" {
+			modTime = now.Add(-48 * time.Hour)
+		}
+
+		require.NoError(t, os.Chtimes(writer.diskPath(key), modTime, modTime))
+	}
+
+	require.NoError(t, os.WriteFile(filepath.Join(dir, ".entry-123"), nil, 0o600))
+	require.NoError(t, os.Chtimes(filepath.Join(dir, ".entry-123"), now.Add(-48*time.Hour), now.Add(-48*time.Hour)))
+
+	reader := NewAPICache(CacheConfiguration{
+		EnableLocalCache:    true,
+		LocalCacheSize:      10,
+		EnableDiskCache:     true,
+		DiskCacheDir:        dir,
+		DiskCacheMaxAge:     24 * time.Hour,
+		DiskCacheMaxEntries: 2,
+	})
+
+	// Expired by age, then the oldest beyond the entry bound
+	for key, kept := range map[string]bool{"old": false, "a": false, "b": true, "c": true} {
+		_, ok := reader.lookup(key)
+		assert.Equal(t, kept, ok, key)
+	}
+
+	assert.NoFileExists(t, filepath.Join(dir, ".entry-123"))
+}
+
+func TestAPICache_LRUEviction(t *testing.T) {
+	cache := NewAPICache(CacheConfiguration{EnableLocalCache: true, LocalCacheSize: 2})
+
+	for _, key := range []string{"a", "b", "c"} {
+		cache.store(&apiCacheEntry{Key: key, Body: []byte(`1`)})
+	}
+
+	_, ok := cache.lookup("a")
+	assert.False(t, ok)
+
+	_, ok = cache.lookup("c")
+	assert.True(t, ok)
+
+	stats := cache.Stats()
+	assert.Equal(t, int64(1), stats.Evictions)
+	assert.Equal(t, 2, stats.Entries)
+}
+
+func TestCacheConfiguration_TTLFor(t *testing.T) {
+	config := CacheConfiguration{
+		DefaultTTL: time.Minute,
+		TTLs:       map[string]time.Duration{"default_branch": time.Hour},
+	}
+
+	assert.Equal(t, time.Hour, config.TTLFor("default_branch:org/repo"))
+	assert.Equal(t, time.Minute, config.TTLFor("repos:org:page:1"))
+}
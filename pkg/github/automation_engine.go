@@ -205,8 +205,20 @@ func (ae *AutomationEngine) Stop(ctx context.Context) error {
 	}
 }
 
-// ProcessEvent processes a GitHub event through the automation engine.
+// ProcessEvent processes a GitHub event through the automation engine. The
+// event is dropped when the event channel is full.
 func (ae *AutomationEngine) ProcessEvent(ctx context.Context, event *GitHubEvent) error {
+	return ae.enqueueEvent(ctx, event, false)
+}
+
+// DispatchEvent queues a stored event for rule evaluation like ProcessEvent,
+// but waits for room in the event channel instead of dropping the event so
+// ingestion workers are slowed down to the engine's pace.
+func (ae *AutomationEngine) DispatchEvent(ctx context.Context, event *GitHubEvent) error {
+	return ae.enqueueEvent(ctx, event, true)
+}
+
+func (ae *AutomationEngine) enqueueEvent(ctx context.Context, event *GitHubEvent, wait bool) error {
 	if !ae.isRunning() {
 		return fmt.Errorf("automation engine is not running")
 	}
@@ -236,23 +248,39 @@ func (ae *AutomationEngine) ProcessEvent(ctx context.Context, event *GitHubEvent
 	// Send to event channel for processing
 	select {
 	case ae.eventChannel <- event:
-		ae.updateMetrics(func(m *EngineMetrics) {
-			m.EventsProcessed++
-
-			m.LastProcessedEvent = time.Now()
-			if m.EventTypeDistribution == nil {
-				m.EventTypeDistribution = make(map[string]int64)
-			}
-
-			m.EventTypeDistribution[event.Type]++
-		})
-
+		ae.recordQueuedEvent(event)
 		return nil
 	case <-ctx.Done():
 		return ctx.Err()
 	default:
+	}
+
+	if !wait {
 		return fmt.Errorf("event channel is full, dropping event %s", event.ID)
 	}
+
+	select {
+	case ae.eventChannel <- event:
+		ae.recordQueuedEvent(event)
+		return nil
+	case <-ae.shutdownChannel:
+		return fmt.Errorf("automation engine stopped before event %s was queued", event.ID)
+	case <-ctx.Done():
+		return ctx.Err()
+	}
+}
+
+func (ae *AutomationEngine) recordQueuedEvent(event *GitHubEvent) {
+	ae.updateMetrics(func(m *EngineMetrics) {
+		m.EventsProcessed++
+
+		m.LastProcessedEvent = time.Now()
+		if m.EventTypeDistribution == nil {
+			m.EventTypeDistribution = make(map[string]int64)
+		}
+
+		m.EventTypeDistribution[event.Type]++
+	})
 }
 
 // GetMetrics returns current engine metrics.
@@ -330,13 +358,8 @@ func (ae *AutomationEngine) executionWorker(ctx context.Context, workerID int) {
 func (ae *AutomationEngine) handleEvent(ctx context.Context, event *GitHubEvent, workerID int) {
 	ae.logger.Debug("Processing event", "event_id", event.ID, "worker_id", workerID)
 
-	// Get applicable rules for the organization
-	filter := &RuleFilter{
-		Organization: event.Organization,
-		Enabled:      boolPtr(true),
-	}
-
-	rules, err := ae.ruleManager.ListRules(ctx, event.Organization, filter)
+	// Get the rules of the organization that could match this event
+	rules, err := ae.ruleManager.CandidateRules(ctx, event)
 	if err != nil {
 		ae.logger.Error("Failed to get rules for organization",
 			"organization", event.Organization,
@@ -9,6 +9,7 @@ import (
 	"github.com/schollz/progressbar/v3"
 
 	"github.com/gizzahub/gzh-cli/internal/git"
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
 	"github.com/gizzahub/gzh-cli/internal/workerpool"
 )
 
@@ -59,6 +60,8 @@ func (b *BulkOperationsManager) Stop() {
 func (b *BulkOperationsManager) RefreshAllWithWorkerPool(ctx context.Context,
 	targetPath, org, strategy string,
 ) error {
+	ctx = phase.WithOperation(ctx, "bulk_clone")
+
 	// Get repository list
 	repos, err := List(ctx, org)
 	if err != nil {
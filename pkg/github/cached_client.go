@@ -2,9 +2,17 @@ package github
 
 import (
 	"context"
+	"crypto/sha256"
+	"encoding/hex"
+	"encoding/json"
 	"fmt"
-	"sync"
+	"io"
+	"net/http"
+	"os"
+	"strings"
 	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/httpclient"
 )
 
 // SyncCloneStats represents statistics from sync clone operations.
@@ -18,114 +26,225 @@ type SyncCloneStats struct {
 	Failed            int
 }
 
-// CachedGitHubClient wraps GitHub API calls with caching - DISABLED (cache package removed)
-// Simple in-memory cache implementation to replace deleted cache package.
+// CachedGitHubClient wraps GitHub API calls with a TTL- and ETag-aware cache.
+// Fresh entries are served locally; stale entries are revalidated with
+// If-None-Match so unchanged data costs a 304 that does not count against the rate limit.
 type CachedGitHubClient struct {
-	cache sync.Map // Simple in-memory cache replacement
-	token string
+	cache      *APICache
+	config     CacheConfiguration
+	httpClient *http.Client
+	baseURL    string
+	token      string
 }
 
-// NewCachedGitHubClient creates a new cached GitHub client - DISABLED (cache package removed)
-// Simple implementation without external cache dependency.
+// NewCachedGitHubClient creates a new cached GitHub client with the default cache configuration.
 func NewCachedGitHubClient(token string) *CachedGitHubClient {
+	return NewCachedGitHubClientWithConfig(token, DefaultCacheConfiguration())
+}
+
+// NewCachedGitHubClientWithConfig creates a new cached GitHub client with the given cache configuration.
+func NewCachedGitHubClientWithConfig(token string, config CacheConfiguration) *CachedGitHubClient {
 	return &CachedGitHubClient{
-		cache: sync.Map{},
-		token: token,
+		cache:      NewAPICache(config),
+		config:     config,
+		httpClient: httpclient.GetGlobalClient("github"),
+		baseURL:    "https://api.github.com",
+		token:      token,
 	}
 }
 
-// ListRepositoriesWithCache lists repositories with caching support - DISABLED (cache package removed)
-// Simple implementation without external cache dependency.
+// ListRepositoriesWithCache lists repository names of an organization with caching support.
 func (c *CachedGitHubClient) ListRepositoriesWithCache(ctx context.Context, org string) ([]string, error) {
-	// Try to get from simple cache first
-	cacheKey := fmt.Sprintf("repos:%s", org)
-	if cached, found := c.cache.Load(cacheKey); found {
-		if repos, ok := cached.([]string); ok {
-			return repos, nil
-		}
-	}
-
-	// Cache miss - fetch from API
-	repos, err := List(ctx, org)
+	repos, err := c.ListRepoInfosWithCache(ctx, org)
 	if err != nil {
-		return nil, fmt.Errorf("failed to fetch repositories: %w", err)
+		return nil, err
 	}
 
-	// Store in simple cache (no TTL implementation)
-	c.cache.Store(cacheKey, repos)
+	names := make([]string, 0, len(repos))
+	for _, repo := range repos {
+		names = append(names, repo.Name)
+	}
 
-	return repos, nil
+	return names, nil
 }
 
-// GetDefaultBranchWithCache gets repository default branch with caching - DISABLED (cache package removed)
-// Simple implementation without external cache dependency.
-func (c *CachedGitHubClient) GetDefaultBranchWithCache(ctx context.Context, org, repo string) (string, error) {
-	// Try to get from simple cache first
-	cacheKey := fmt.Sprintf("default_branch:%s/%s", org, repo)
-	if cached, found := c.cache.Load(cacheKey); found {
-		if branch, ok := cached.(string); ok {
-			return branch, nil
+// ListRepoInfosWithCache lists repository metadata of an organization.
+// Every page is cached and revalidated independently, so an unchanged org
+// listing is answered entirely with 304 responses.
+func (c *CachedGitHubClient) ListRepoInfosWithCache(ctx context.Context, org string) ([]RepoInfo, error) {
+	const perPage = 100
+
+	var allRepos []RepoInfo
+
+	for page := 1; ; page++ {
+		cacheKey := c.cacheKey(fmt.Sprintf("repos:%s:page:%d", org, page))
+		url := fmt.Sprintf("%s/orgs/%s/repos?page=%d&per_page=%d", c.baseURL, org, page, perPage)
+
+		var repos []RepoInfo
+		if err := c.getJSON(ctx, cacheKey, url, &repos); err != nil {
+			return nil, fmt.Errorf("failed to fetch repositories: %w", err)
+		}
+
+		allRepos = append(allRepos, repos...)
+
+		if len(repos) < perPage {
+			break
 		}
 	}
 
-	// Cache miss - fetch from API
-	branch, err := GetDefaultBranch(ctx, org, repo)
-	if err != nil {
+	return allRepos, nil
+}
+
+// GetDefaultBranchWithCache gets repository default branch with caching support.
+func (c *CachedGitHubClient) GetDefaultBranchWithCache(ctx context.Context, org, repo string) (string, error) {
+	cacheKey := c.cacheKey(fmt.Sprintf("default_branch:%s/%s", org, repo))
+	url := fmt.Sprintf("%s/repos/%s/%s", c.baseURL, org, repo)
+
+	var repoInfo RepoInfo
+	if err := c.getJSON(ctx, cacheKey, url, &repoInfo); err != nil {
 		return "", fmt.Errorf("failed to get default branch: %w", err)
 	}
 
-	// Store in simple cache (no TTL implementation)
-	c.cache.Store(cacheKey, branch)
+	return repoInfo.DefaultBranch, nil
+}
+
+// credential returns the token requests are authenticated with.
+func (c *CachedGitHubClient) credential() string {
+	if c.token != "" {
+		return c.token
+	}
 
-	return branch, nil
+	return os.Getenv("GITHUB_TOKEN")
 }
 
-// InvalidateOrgCache invalidates all cache entries for an organization - DISABLED (cache package removed)
-// Simple implementation without external cache dependency.
-func (c *CachedGitHubClient) InvalidateOrgCache(ctx context.Context, org string) int {
-	count := 0
+// cacheKey scopes key to the API base URL and the credential, so that one
+// token's responses (such as private repositories) are never served to
+// another and same-named organizations on different hosts do not collide.
+// The scope is appended so that key kinds and invalidation prefixes still
+// work on the start of the key.
+func (c *CachedGitHubClient) cacheKey(key string) string {
+	sum := sha256.Sum256([]byte(c.baseURL + "\x00" + c.credential()))
+	return key + "@" + hex.EncodeToString(sum[:8])
+}
 
-	cacheKey := fmt.Sprintf("repos:%s", org)
-	if _, found := c.cache.LoadAndDelete(cacheKey); found {
-		count++
+// getJSON decodes the response for url into out, going through the cache under cacheKey.
+func (c *CachedGitHubClient) getJSON(ctx context.Context, cacheKey, url string, out any) error {
+	entry, found := c.cache.lookup(cacheKey)
+	if found && entry.fresh(time.Now()) {
+		c.cache.recordHit()
+		return json.Unmarshal(entry.Body, out)
 	}
 
-	return count
-}
+	req, err := http.NewRequestWithContext(ctx, http.MethodGet, url, nil)
+	if err != nil {
+		return fmt.Errorf("failed to create request: %w", err)
+	}
+
+	if token := c.credential(); token != "" {
+		req.Header.Set("Authorization", "token "+token)
+	}
+
+	req.Header.Set("Accept", "application/vnd.github.v3+json")
+
+	if found && entry.ETag != "" {
+		req.Header.Set("If-None-Match", entry.ETag)
+	}
+
+	resp, err := c.httpClient.Do(req)
+	if err != nil {
+		return err
+	}
+	defer func() { _ = resp.Body.Close() }() //nolint:errcheck // HTTP response body cleanup
 
-// InvalidateRepoCache invalidates cache entries for a specific repository - DISABLED (cache package removed)
-// Simple implementation without external cache dependency.
-func (c *CachedGitHubClient) InvalidateRepoCache(ctx context.Context, org, repo string) int {
-	count := 0
+	now := time.Now()
+	ttl := c.config.TTLFor(cacheKey)
 
-	cacheKey := fmt.Sprintf("default_branch:%s/%s", org, repo)
-	if _, found := c.cache.LoadAndDelete(cacheKey); found {
-		count++
+	switch {
+	case resp.StatusCode == http.StatusNotModified && found:
+		c.cache.recordRevalidation()
+
+		revalidated := *entry
+		revalidated.StoredAt = now
+		revalidated.ExpiresAt = now.Add(ttl)
+		c.cache.store(&revalidated)
+
+		return json.Unmarshal(revalidated.Body, out)
+
+	case resp.StatusCode == http.StatusOK:
+		c.cache.recordMiss()
+
+		body, err := io.ReadAll(resp.Body)
+		if err != nil {
+			return fmt.Errorf("failed to read response: %w", err)
+		}
+
+		if err := json.Unmarshal(body, out); err != nil {
+			return fmt.Errorf("failed to decode response: %w", err)
+		}
+
+		c.cache.store(&apiCacheEntry{
+			Key:       cacheKey,
+			Body:      body,
+			ETag:      resp.Header.Get("ETag"),
+			StoredAt:  now,
+			ExpiresAt: now.Add(ttl),
+		})
+
+		return nil
+
+	default:
+		return fmt.Errorf("unexpected response: %s", resp.Status)
 	}
+}
+
+// InvalidateOrgCache invalidates all cache entries for an organization, for
+// every credential and host.
+func (c *CachedGitHubClient) InvalidateOrgCache(_ context.Context, org string) int {
+	return c.cache.DeletePrefix(fmt.Sprintf("repos:%s:", org)) +
+		c.cache.DeletePrefix(fmt.Sprintf("default_branch:%s/", org))
+}
 
-	return count
+// InvalidateRepoCache invalidates cache entries for a specific repository.
+func (c *CachedGitHubClient) InvalidateRepoCache(_ context.Context, org, repo string) int {
+	return c.cache.DeletePrefix(fmt.Sprintf("default_branch:%s/%s@", org, repo))
 }
 
-// GetCacheStats returns GitHub cache statistics - DISABLED (cache package removed)
-// Simple implementation without external cache dependency.
+// GetCacheStats returns GitHub cache statistics.
 func (c *CachedGitHubClient) GetCacheStats() map[string]any {
+	stats := c.cache.Stats()
+
 	return map[string]any{
-		"type": "simple_sync_map",
-		"note": "cache package removed, using simple sync.Map",
+		"type":          "lru_disk",
+		"hits":          stats.Hits,
+		"revalidations": stats.Revalidations,
+		"misses":        stats.Misses,
+		"evictions":     stats.Evictions,
+		"disk_reads":    stats.DiskReads,
+		"entries":       stats.Entries,
+		"hit_rate":      stats.HitRate(),
+		"disk_enabled":  c.cache.diskDir != "",
 	}
 }
 
+// Stats returns typed cache statistics.
+func (c *CachedGitHubClient) Stats() CacheStats {
+	return c.cache.Stats()
+}
+
 // CachedSyncCloneManager extends OptimizedSyncCloneManager with caching.
 type CachedSyncCloneManager struct {
 	*OptimizedSyncCloneManager
 	cachedClient *CachedGitHubClient
 }
 
-// NewCachedSyncCloneManager creates a new cached sync clone manager - DISABLED (cache package removed)
-// Simple implementation without external cache dependency.
+// NewCachedSyncCloneManager creates a new cached sync clone manager using the default cache configuration.
 func NewCachedSyncCloneManager(token string, config OptimizedCloneConfig) (*CachedSyncCloneManager, error) {
-	// Create cached client with simple cache
-	cachedClient := NewCachedGitHubClient(token)
+	return NewCachedSyncCloneManagerWithCache(token, config, DefaultCacheConfiguration())
+}
+
+// NewCachedSyncCloneManagerWithCache creates a new cached sync clone manager with an explicit cache configuration.
+func NewCachedSyncCloneManagerWithCache(token string, config OptimizedCloneConfig, cacheConfig CacheConfiguration) (*CachedSyncCloneManager, error) {
+	cachedClient := NewCachedGitHubClientWithConfig(token, cacheConfig)
 
 	// Create optimized manager
 	optimizedManager, err := NewOptimizedSyncCloneManager(token, config)
@@ -143,59 +262,80 @@ func NewCachedSyncCloneManager(token string, config OptimizedCloneConfig) (*Cach
 func (cbm *CachedSyncCloneManager) RefreshAllOptimizedWithCache(ctx context.Context, targetPath, org, strategy string) (SyncCloneStats, error) {
 	fmt.Printf("🚀 Starting cached sync clone for organization: %s\n", org)
 
+	before := cbm.cachedClient.Stats()
+
 	// Use cached client for repository listing
-	repos, err := cbm.cachedClient.ListRepositoriesWithCache(ctx, org)
+	repos, err := cbm.cachedClient.ListRepoInfosWithCache(ctx, org)
 	if err != nil {
 		return SyncCloneStats{}, fmt.Errorf("failed to list repositories with cache: %w", err)
 	}
 
-	fmt.Printf("📦 Found %d repositories (cached result: %v)\n", len(repos), true)
+	after := cbm.cachedClient.Stats()
+	fromCache := after.Misses == before.Misses
+
+	fmt.Printf("📦 Found %d repositories (cached result: %v)\n", len(repos), fromCache)
 
 	// Continue with optimized processing using the cached repository list
 	return cbm.processRepositoriesOptimized(ctx, targetPath, org, strategy, repos)
 }
 
-// processRepositoriesOptimized processes repositories with caching optimizations.
-func (cbm *CachedSyncCloneManager) processRepositoriesOptimized(ctx context.Context, targetPath, org, strategy string, repos []string) (SyncCloneStats, error) {
+// processRepositoriesOptimized clones or updates the given repositories in batches
+// through the worker pool, without listing the organization again.
+func (cbm *CachedSyncCloneManager) processRepositoriesOptimized(ctx context.Context, targetPath, org, strategy string, repos []RepoInfo) (SyncCloneStats, error) {
 	stats := SyncCloneStats{
 		TotalRepositories: len(repos),
 		StartTime:         time.Now(),
 	}
 
-	// Use the existing optimized processing logic but with cached repository data
-	// This would integrate with the existing OptimizedSyncCloneManager methods
+	if err := os.MkdirAll(targetPath, 0o755); err != nil {
+		return stats, fmt.Errorf("failed to create target directory: %w", err)
+	}
 
-	// For now, delegate to the existing optimized method
-	// In a full implementation, this would use the cached repos list
-	_, err := cbm.RefreshAllOptimized(ctx, targetPath, org, strategy)
-	if err != nil {
-		return SyncCloneStats{}, err
+	batchSize := cbm.config.BatchSize
+	if batchSize <= 0 {
+		batchSize = len(repos)
 	}
 
-	// Convert CloneStats to SyncCloneStats
-	syncStats := SyncCloneStats{
-		TotalRepositories: stats.TotalRepositories,
-		StartTime:         stats.StartTime,
-		EndTime:           time.Now(),
-		SuccessCount:      0, // TODO: Extract from cloneStats
-		FailureCount:      0, // TODO: Extract from cloneStats
-		Successful:        0, // TODO: Extract from cloneStats
-		Failed:            0, // TODO: Extract from cloneStats
+	total := &CloneStats{ErrorDetails: make([]CloneError, 0)}
+
+	for start := 0; start < len(repos); start += batchSize {
+		if ctx.Err() != nil {
+			return stats, fmt.Errorf("operation cancelled: %w", ctx.Err())
+		}
+
+		end := min(start+batchSize, len(repos))
+
+		batch := make([]*Repository, 0, end-start)
+		for _, info := range repos[start:end] {
+			batch = append(batch, &Repository{
+				Name:          info.Name,
+				FullName:      org + "/" + info.Name,
+				CloneURL:      info.CloneURL,
+				DefaultBranch: info.DefaultBranch,
+				Private:       info.Private,
+				Archived:      info.Archived,
+			})
+		}
+
+		cbm.mergeStats(total, cbm.processBatch(ctx, targetPath, org, strategy, batch, nil))
 	}
 
-	return syncStats, nil
+	stats.EndTime = time.Now()
+	stats.SuccessCount = total.Successful
+	stats.FailureCount = total.Failed
+	stats.Successful = total.Successful
+	stats.Failed = total.Failed
+
+	return stats, nil
 }
 
-// Close cleans up cached manager resources - DISABLED (cache package removed)
-// Simple implementation without external cache dependency.
+// Close cleans up cached manager resources.
+// Cache entries are persisted as they are written, so there is nothing to flush.
 func (cbm *CachedSyncCloneManager) Close() error {
-	// No cache manager to close - using simple sync.Map
-	// Close optimized manager
 	return cbm.OptimizedSyncCloneManager.Close()
 }
 
-// RefreshAllOptimizedStreamingWithCache is the cached version of the streaming API - DISABLED (cache package removed)
-// Simple implementation without external cache dependency.
+// RefreshAllOptimizedStreamingWithCache is the cached version of the streaming API.
 func RefreshAllOptimizedStreamingWithCache(ctx context.Context, targetPath, org, strategy, token string) error {
 	// Create cached manager
 	config := DefaultOptimizedCloneConfig()
@@ -217,48 +357,81 @@ func RefreshAllOptimizedStreamingWithCache(ctx context.Context, targetPath, org,
 	}
 
 	// Print summary with cache information
-	cacheStats := manager.cachedClient.GetCacheStats()
+	cacheStats := manager.cachedClient.Stats()
+
+	successRate := 0.0
+	if stats.TotalRepositories > 0 {
+		successRate = float64(stats.Successful) / float64(stats.TotalRepositories) * 100
+	}
 
 	fmt.Printf("\n🎉 Cached sync clone completed: %d successful, %d failed (%.1f%% success rate)\n",
-		stats.Successful, stats.Failed,
-		float64(stats.Successful)/float64(stats.TotalRepositories)*100)
+		stats.Successful, stats.Failed, successRate)
 
-	fmt.Printf("📊 Cache performance: %s\n", cacheStats["note"])
+	fmt.Printf("📊 Cache performance: %d hits, %d revalidated (304), %d misses, %d evictions (%.1f%% hit rate)\n",
+		cacheStats.Hits, cacheStats.Revalidations, cacheStats.Misses, cacheStats.Evictions,
+		cacheStats.HitRate()*100)
 
 	return nil
 }
 
-// CacheConfiguration provides cache configuration for GitHub operations - DISABLED (cache package removed)
-// Simple configuration struct without external cache dependency.
+// CacheConfiguration provides cache configuration for GitHub operations.
 type CacheConfiguration struct {
 	EnableLocalCache bool
-	// EnableRedisCache bool // Disabled - cache package removed
-	LocalCacheSize int
-	DefaultTTL     time.Duration
-	// RedisAddress     string // Disabled - cache package removed
-	// RedisPassword    string // Disabled - cache package removed
+	LocalCacheSize   int
+	DefaultTTL       time.Duration
+
+	// EnableDiskCache persists entries under DiskCacheDir (default ~/.gzh/cache/github)
+	EnableDiskCache bool
+	DiskCacheDir    string
+
+	// DiskCacheMaxAge and DiskCacheMaxEntries bound the disk tier. Entries not
+	// written for longer than the age, and the oldest entries beyond the
+	// count, are removed when the cache is opened. Zero disables a bound.
+	DiskCacheMaxAge     time.Duration
+	DiskCacheMaxEntries int
+
+	// TTLs overrides DefaultTTL per key kind: the part of the cache key before
+	// the first ':' (e.g. "repos", "default_branch").
+	TTLs map[string]time.Duration
 }
 
-// DefaultCacheConfiguration returns sensible defaults for GitHub caching - DISABLED (cache package removed)
-// Simple configuration without external cache dependency.
+// DefaultCacheConfiguration returns sensible defaults for GitHub caching.
 func DefaultCacheConfiguration() CacheConfiguration {
 	return CacheConfiguration{
 		EnableLocalCache: true,
-		// EnableRedisCache: false, // Disabled - cache package removed
-		LocalCacheSize: 1000,
-		DefaultTTL:     10 * time.Minute,
-		// RedisAddress:     "localhost:6379", // Disabled - cache package removed
-		// RedisPassword:    "", // Disabled - cache package removed
+		LocalCacheSize:   1000,
+		DefaultTTL:       10 * time.Minute,
+		EnableDiskCache:  true,
+		// Stale entries stay useful for ETag revalidation, so keep them for a week
+		DiskCacheMaxAge:     7 * 24 * time.Hour,
+		DiskCacheMaxEntries: 10000,
+		TTLs: map[string]time.Duration{
+			"repos":          10 * time.Minute,
+			"default_branch": 1 * time.Hour,
+		},
 	}
 }
 
-// ToCacheManagerConfig converts to cache manager configuration - DISABLED (cache package removed)
-// Simple configuration conversion without external cache dependency.
+// TTLFor returns the time-to-live for the given cache key.
+func (cc CacheConfiguration) TTLFor(key string) time.Duration {
+	kind, _, _ := strings.Cut(key, ":")
+	if ttl, ok := cc.TTLs[kind]; ok {
+		return ttl
+	}
+
+	return cc.DefaultTTL
+}
+
+// ToCacheManagerConfig converts to cache manager configuration.
 func (cc CacheConfiguration) ToCacheManagerConfig() map[string]any {
 	return map[string]any{
 		"enable_local_cache": cc.EnableLocalCache,
 		"local_cache_size":   cc.LocalCacheSize,
 		"default_ttl":        cc.DefaultTTL,
-		"note":               "cache package removed, using simple sync.Map",
+		"enable_disk_cache":  cc.EnableDiskCache,
+		"disk_cache_dir":     cc.DiskCacheDir,
+		"disk_cache_max_age": cc.DiskCacheMaxAge,
+		"disk_cache_entries": cc.DiskCacheMaxEntries,
+		"ttls":               cc.TTLs,
 	}
 }
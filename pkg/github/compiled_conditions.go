@@ -0,0 +1,186 @@
+package github
+
+import (
+	"context"
+	"encoding/json"
+	"fmt"
+	"regexp"
+	"strconv"
+	"strings"
+	"sync"
+)
+
+// CompiledConditions is an AutomationConditions with every regex pattern and
+// payload matcher operand prepared ahead of evaluation. Compile once per rule
+// version with CompileConditions and evaluate it any number of times concurrently.
+type CompiledConditions struct {
+	Conditions *AutomationConditions
+
+	repositoryPatterns []compiledPattern
+	branchPatterns     []compiledPattern
+	filePatterns       []compiledPattern
+	pathPatterns       []compiledPattern
+	payloadMatchers    []compiledPayloadMatcher
+	subConditions      []*CompiledConditions
+}
+
+// CompiledConditionEvaluator is implemented by condition evaluators that can
+// evaluate precompiled conditions. RuleManager uses it when available.
+type CompiledConditionEvaluator interface {
+	EvaluateCompiledConditions(ctx context.Context, compiled *CompiledConditions, event *GitHubEvent, evalContext *EvaluationContext) (*EvaluationResult, error)
+}
+
+// compiledPattern is a regex pattern together with its compile error, which is
+// reported when the pattern is evaluated, exactly as an uncompiled pattern would be.
+type compiledPattern struct {
+	kind    string
+	pattern string
+	re      *regexp.Regexp
+	err     error
+}
+
+func compilePatterns(kind string, patterns []string) []compiledPattern {
+	compiled := make([]compiledPattern, len(patterns))
+	for i, pattern := range patterns {
+		re, err := regexp.Compile(pattern)
+		compiled[i] = compiledPattern{kind: kind, pattern: pattern, re: re, err: err}
+	}
+
+	return compiled
+}
+
+func (p *compiledPattern) match(value string) (bool, error) {
+	if p.err != nil {
+		return false, fmt.Errorf("invalid %s pattern '%s': %w", p.kind, p.pattern, p.err)
+	}
+
+	return p.re.MatchString(value), nil
+}
+
+// compiledPayloadMatcher holds a PayloadMatcher with its expected operand
+// already formatted, case-folded, parsed as a number and compiled as a regex,
+// as required by its operator.
+type compiledPayloadMatcher struct {
+	PayloadMatcher
+
+	expected    string
+	regex       *regexp.Regexp
+	regexErr    error
+	expectedNum float64
+	numErr      error
+}
+
+func compilePayloadMatcher(matcher PayloadMatcher) compiledPayloadMatcher {
+	compiled := compiledPayloadMatcher{PayloadMatcher: matcher}
+
+	expected := fmt.Sprintf("%v", matcher.Value)
+
+	switch matcher.Operator {
+	case MatchOperatorRegex:
+		if !matcher.CaseSensitive {
+			expected = "(?i)" + expected
+		}
+
+		compiled.regex, compiled.regexErr = regexp.Compile(expected)
+	case MatchOperatorGreaterThan, MatchOperatorLessThan:
+		compiled.expectedNum, compiled.numErr = toFloat64(matcher.Value)
+	default:
+		if !matcher.CaseSensitive {
+			expected = strings.ToLower(expected)
+		}
+	}
+
+	compiled.expected = expected
+
+	return compiled
+}
+
+// CompileConditions compiles conditions and all of their sub-conditions.
+// Invalid patterns do not fail compilation; use Err to detect them.
+func CompileConditions(conditions *AutomationConditions) *CompiledConditions {
+	compiled := &CompiledConditions{
+		Conditions:         conditions,
+		repositoryPatterns: compilePatterns("repository", conditions.RepositoryPatterns),
+		branchPatterns:     compilePatterns("branch", conditions.BranchPatterns),
+		filePatterns:       compilePatterns("file", conditions.FilePatterns),
+		pathPatterns:       compilePatterns("path", conditions.PathPatterns),
+		payloadMatchers:    make([]compiledPayloadMatcher, len(conditions.PayloadMatch)),
+		subConditions:      make([]*CompiledConditions, len(conditions.SubConditions)),
+	}
+
+	for i, matcher := range conditions.PayloadMatch {
+		compiled.payloadMatchers[i] = compilePayloadMatcher(matcher)
+	}
+
+	for i := range conditions.SubConditions {
+		compiled.subConditions[i] = CompileConditions(&conditions.SubConditions[i])
+	}
+
+	return compiled
+}
+
+// Err returns the first pattern compile error in the conditions tree, if any.
+func (c *CompiledConditions) Err() error {
+	for _, patterns := range [][]compiledPattern{c.repositoryPatterns, c.branchPatterns, c.filePatterns, c.pathPatterns} {
+		for i := range patterns {
+			if _, err := patterns[i].match(""); err != nil {
+				return err
+			}
+		}
+	}
+
+	for i := range c.payloadMatchers {
+		if err := c.payloadMatchers[i].regexErr; err != nil {
+			return fmt.Errorf("invalid regex pattern '%s': %w", c.payloadMatchers[i].expected, err)
+		}
+	}
+
+	for _, sub := range c.subConditions {
+		if err := sub.Err(); err != nil {
+			return err
+		}
+	}
+
+	return nil
+}
+
+// eventPayload provides the JSON encoding of an event payload, encoding it at
+// most once per evaluation when the event carries no raw webhook body.
+type eventPayload struct {
+	once  sync.Once
+	event *GitHubEvent
+	data  []byte
+	err   error
+}
+
+func newEventPayload(event *GitHubEvent) *eventPayload {
+	return &eventPayload{event: event}
+}
+
+func (p *eventPayload) bytes() ([]byte, error) {
+	p.once.Do(func() {
+		if len(p.event.RawPayload) > 0 {
+			p.data = p.event.RawPayload
+			return
+		}
+
+		p.data, p.err = json.Marshal(p.event.Payload)
+	})
+
+	return p.data, p.err
+}
+
+func toFloat64(value any) (float64, error) {
+	switch v := value.(type) {
+	case float64:
+		return v, nil
+	case int:
+		return float64(v), nil
+	case int64:
+		return float64(v), nil
+	case string:
+		return strconv.ParseFloat(v, 64)
+	default:
+		return 0, fmt.Errorf("cannot convert %T to float64", value)
+	}
+}
@@ -0,0 +1,113 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package github
+
+import (
+	"context"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/mock"
+	"github.com/stretchr/testify/require"
+)
+
+func TestCompileConditions_InvalidPatterns(t *testing.T) {
+	compiled := CompileConditions(&AutomationConditions{
+		BranchPatterns: []string{"^main$"},
+		SubConditions: []AutomationConditions{
+			{RepositoryPatterns: []string{"[invalid"}},
+		},
+	})
+
+	err := compiled.Err()
+	require.Error(t, err)
+	assert.Contains(t, err.Error(), "invalid repository pattern '[invalid'")
+
+	compiled = CompileConditions(&AutomationConditions{
+		PayloadMatch: []PayloadMatcher{{Path: "action", Operator: MatchOperatorRegex, Value: "(", CaseSensitive: true}},
+	})
+	assert.Error(t, compiled.Err())
+
+	assert.NoError(t, CompileConditions(&AutomationConditions{BranchPatterns: []string{"^main$"}}).Err())
+}
+
+func TestConditionEvaluator_EvaluateCompiledConditions(t *testing.T) {
+	evaluator, ok := NewConditionEvaluator(&mockLogger{}, &mockAPIClient{}).(*conditionEvaluatorImpl)
+	require.True(t, ok, "evaluator should be of correct type")
+
+	conditions := &AutomationConditions{
+		EventTypes: []EventType{EventTypePullRequest},
+		PayloadMatch: []PayloadMatcher{
+			{Path: "pull_request.title", Operator: MatchOperatorContains, Value: "FIX"},
+			{Path: "pull_request.number", Operator: MatchOperatorGreaterThan, Value: 10},
+			{Path: "pull_request.title", Operator: MatchOperatorRegex, Value: "^fix"},
+		},
+		SubConditions: []AutomationConditions{
+			{PayloadMatch: []PayloadMatcher{{Path: "action", Operator: MatchOperatorEquals, Value: "opened", CaseSensitive: true}}},
+		},
+		LogicalOperator: ConditionOperatorAND,
+	}
+	compiled := CompileConditions(conditions)
+
+	t.Run("matches against raw webhook payload", func(t *testing.T) {
+		event := createTestEvent()
+		event.RawPayload = []byte(`{"action":"opened","pull_request":{"title":"Fix login","number":42}}`)
+
+		result, err := evaluator.EvaluateCompiledConditions(context.Background(), compiled, event, createTestEvaluationContext())
+		require.NoError(t, err)
+		assert.True(t, result.Matched, "errors: %v", result.Errors)
+		assert.True(t, result.SubConditionResults["sub_condition_0"].Matched)
+		assert.Equal(t, float64(42), result.PayloadMatchResults[1].ActualValue)
+	})
+
+	t.Run("compiled evaluation agrees with uncompiled evaluation", func(t *testing.T) {
+		event := createTestEvent()
+		event.Payload["pull_request"].(map[string]any)["number"] = 3
+
+		compiledResult, err := evaluator.EvaluateCompiledConditions(context.Background(), compiled, event, createTestEvaluationContext())
+		require.NoError(t, err)
+
+		result, err := evaluator.EvaluateConditions(context.Background(), conditions, event, createTestEvaluationContext())
+		require.NoError(t, err)
+
+		assert.False(t, result.Matched)
+		assert.Equal(t, result.Matched, compiledResult.Matched)
+		assert.Equal(t, result.FailedConditions, compiledResult.FailedConditions)
+	})
+
+	t.Run("invalid patterns are reported at evaluation", func(t *testing.T) {
+		invalid := CompileConditions(&AutomationConditions{BranchPatterns: []string{"[invalid"}})
+
+		result, err := evaluator.EvaluateCompiledConditions(context.Background(), invalid, createTestEvent(), createTestEvaluationContext())
+		require.NoError(t, err)
+		require.Len(t, result.Errors, 1)
+		assert.Contains(t, result.Errors[0], "invalid branch pattern '[invalid'")
+	})
+}
+
+func TestRuleManager_CompiledConditionsCache(t *testing.T) {
+	storage := &mockRuleStorage{}
+	rm := NewRuleManager(&mockLogger{}, &mockAPIClient{}, NewConditionEvaluator(&mockLogger{}, &mockAPIClient{}),
+		&mockRuleActionExecutor{}, storage, &mockTemplateStorage{})
+	rule := createTestRule()
+
+	compiled := rm.compiledFor(rule)
+	assert.Same(t, compiled, rm.compiledFor(rule), "unchanged rule should reuse compiled conditions")
+
+	rule.Conditions.Actions = []EventAction{ActionClosed}
+	rule.UpdatedAt = rule.UpdatedAt.Add(time.Second)
+	updated := rm.compiledFor(rule)
+	assert.NotSame(t, compiled, updated, "updated rule should be recompiled")
+
+	matched, err := rm.EvaluateConditions(context.Background(), rule, createTestEventForRuleManager())
+	require.NoError(t, err)
+	assert.False(t, matched, "evaluation should use the updated conditions")
+
+	storage.On("DeleteRule", mock.Anything, rule.Organization, rule.ID).Return(nil)
+	require.NoError(t, rm.DeleteRule(context.Background(), rule.Organization, rule.ID))
+
+	rm.mu.RLock()
+	_, exists := rm.compiledRules[rm.cacheKey(rule.Organization, rule.ID)]
+	rm.mu.RUnlock()
+	assert.False(t, exists, "deleted rule should be evicted from the compiled cache")
+}
@@ -4,12 +4,10 @@ package github
 
 import (
 	"context"
-	"encoding/json"
 	"fmt"
 	"path/filepath"
 	"regexp"
 	"slices"
-	"strconv"
 	"strings"
 	"time"
 
@@ -201,7 +199,18 @@ func NewConditionEvaluator(logger Logger, apiClient APIClient) ConditionEvaluato
 
 // EvaluateConditions evaluates all conditions for an automation rule.
 func (e *conditionEvaluatorImpl) EvaluateConditions(ctx context.Context, conditions *AutomationConditions, event *GitHubEvent, evalContext *EvaluationContext) (*EvaluationResult, error) {
+	return e.EvaluateCompiledConditions(ctx, CompileConditions(conditions), event, evalContext)
+}
+
+// EvaluateCompiledConditions evaluates precompiled conditions for an automation rule.
+// The event payload is encoded at most once for the whole conditions tree.
+func (e *conditionEvaluatorImpl) EvaluateCompiledConditions(ctx context.Context, compiled *CompiledConditions, event *GitHubEvent, evalContext *EvaluationContext) (*EvaluationResult, error) {
+	return e.evaluateCompiled(ctx, compiled, event, evalContext, newEventPayload(event))
+}
+
+func (e *conditionEvaluatorImpl) evaluateCompiled(ctx context.Context, compiled *CompiledConditions, event *GitHubEvent, evalContext *EvaluationContext, payload *eventPayload) (*EvaluationResult, error) {
 	startTime := time.Now()
+	conditions := compiled.Conditions
 
 	result := &EvaluationResult{
 		MatchedConditions:   []string{},
@@ -244,7 +253,7 @@ func (e *conditionEvaluatorImpl) EvaluateConditions(ctx context.Context, conditi
 
 	// Evaluate repository conditions if repository info is available
 	if evalContext.Repository != nil {
-		repoMatched, err := e.EvaluateRepositoryConditions(ctx, evalContext.Repository, conditions)
+		repoMatched, err := e.evaluateRepositoryConditions(evalContext.Repository, compiled)
 		switch {
 		case err != nil:
 			result.Errors = append(result.Errors, fmt.Sprintf("Repository evaluation error: %v", err))
@@ -256,7 +265,7 @@ func (e *conditionEvaluatorImpl) EvaluateConditions(ctx context.Context, conditi
 	}
 
 	// Evaluate content-based conditions
-	contentMatched, err := e.EvaluateContentConditions(ctx, event, conditions)
+	contentMatched, err := e.evaluateContentConditions(event, compiled)
 	switch {
 	case err != nil:
 		result.Errors = append(result.Errors, fmt.Sprintf("Content evaluation error: %v", err))
@@ -267,9 +276,8 @@ func (e *conditionEvaluatorImpl) EvaluateConditions(ctx context.Context, conditi
 	}
 
 	// Evaluate payload matchers
-	for i, matcher := range conditions.PayloadMatch {
-		m := matcher // Create copy to avoid memory aliasing
-		matchResult, err := e.evaluatePayloadMatcherWithResult(&m, event.Payload)
+	for i := range compiled.payloadMatchers {
+		matchResult, err := e.evaluateCompiledMatcher(&compiled.payloadMatchers[i], payload)
 		result.PayloadMatchResults = append(result.PayloadMatchResults, matchResult)
 
 		switch {
@@ -283,12 +291,11 @@ func (e *conditionEvaluatorImpl) EvaluateConditions(ctx context.Context, conditi
 	}
 
 	// Evaluate sub-conditions if present
-	if len(conditions.SubConditions) > 0 {
+	if len(compiled.subConditions) > 0 {
 		result.SubConditionResults = make(map[string]*EvaluationResult)
 
-		for i := range conditions.SubConditions {
-			subCondition := conditions.SubConditions[i]
-			subResult, err := e.EvaluateConditions(ctx, &subCondition, event, evalContext)
+		for i, subCondition := range compiled.subConditions {
+			subResult, err := e.evaluateCompiled(ctx, subCondition, event, evalContext, payload)
 			if err != nil {
 				result.Errors = append(result.Errors, fmt.Sprintf("Sub-condition %d error: %v", i, err))
 			}
@@ -364,12 +371,18 @@ func (e *conditionEvaluatorImpl) EvaluateEventConditions(event *GitHubEvent, con
 
 // EvaluateRepositoryConditions evaluates repository-specific conditions.
 func (e *conditionEvaluatorImpl) EvaluateRepositoryConditions(ctx context.Context, repoInfo *RepositoryInfo, conditions *AutomationConditions) (bool, error) {
+	return e.evaluateRepositoryConditions(repoInfo, CompileConditions(conditions))
+}
+
+func (e *conditionEvaluatorImpl) evaluateRepositoryConditions(repoInfo *RepositoryInfo, compiled *CompiledConditions) (bool, error) {
+	conditions := compiled.Conditions
+
 	// Check repository patterns
-	if len(conditions.RepositoryPatterns) > 0 {
+	if len(compiled.repositoryPatterns) > 0 {
 		matched := false
-		for _, pattern := range conditions.RepositoryPatterns {
-			if patternMatched, err := regexp.MatchString(pattern, repoInfo.Name); err != nil {
-				return false, fmt.Errorf("invalid repository pattern '%s': %w", pattern, err)
+		for i := range compiled.repositoryPatterns {
+			if patternMatched, err := compiled.repositoryPatterns[i].match(repoInfo.Name); err != nil {
+				return false, err
 			} else if patternMatched {
 				matched = true
 				break
@@ -493,15 +506,19 @@ func (e *conditionEvaluatorImpl) EvaluateTimeConditions(timestamp time.Time, con
 
 // EvaluateContentConditions evaluates content-based conditions (branches, files, paths).
 func (e *conditionEvaluatorImpl) EvaluateContentConditions(ctx context.Context, event *GitHubEvent, conditions *AutomationConditions) (bool, error) {
+	return e.evaluateContentConditions(event, CompileConditions(conditions))
+}
+
+func (e *conditionEvaluatorImpl) evaluateContentConditions(event *GitHubEvent, compiled *CompiledConditions) (bool, error) {
 	// Extract branch information from event payload
 	branch := e.extractBranchFromPayload(event.Payload)
 
 	// Check branch patterns
-	if len(conditions.BranchPatterns) > 0 && branch != "" {
+	if len(compiled.branchPatterns) > 0 && branch != "" {
 		matched := false
-		for _, pattern := range conditions.BranchPatterns {
-			if patternMatched, err := regexp.MatchString(pattern, branch); err != nil {
-				return false, fmt.Errorf("invalid branch pattern '%s': %w", pattern, err)
+		for i := range compiled.branchPatterns {
+			if patternMatched, err := compiled.branchPatterns[i].match(branch); err != nil {
+				return false, err
 			} else if patternMatched {
 				matched = true
 				break
@@ -514,7 +531,7 @@ func (e *conditionEvaluatorImpl) EvaluateContentConditions(ctx context.Context,
 	}
 
 	// Check file patterns
-	if len(conditions.FilePatterns) > 0 {
+	if len(compiled.filePatterns) > 0 {
 		files := e.extractFilesFromPayload(event.Payload)
 		if len(files) == 0 {
 			return false, nil
@@ -522,10 +539,10 @@ func (e *conditionEvaluatorImpl) EvaluateContentConditions(ctx context.Context,
 
 		matched := false
 
-		for _, pattern := range conditions.FilePatterns {
+		for i := range compiled.filePatterns {
 			for _, file := range files {
-				if isMatch, err := regexp.MatchString(pattern, file); err != nil {
-					return false, fmt.Errorf("invalid file pattern '%s': %w", pattern, err)
+				if isMatch, err := compiled.filePatterns[i].match(file); err != nil {
+					return false, err
 				} else if isMatch {
 					matched = true
 					break
@@ -543,7 +560,7 @@ func (e *conditionEvaluatorImpl) EvaluateContentConditions(ctx context.Context,
 	}
 
 	// Check path patterns
-	if len(conditions.PathPatterns) > 0 {
+	if len(compiled.pathPatterns) > 0 {
 		paths := e.extractPathsFromPayload(event.Payload)
 		if len(paths) == 0 {
 			return false, nil
@@ -551,10 +568,10 @@ func (e *conditionEvaluatorImpl) EvaluateContentConditions(ctx context.Context,
 
 		matched := false
 
-		for _, pattern := range conditions.PathPatterns {
+		for i := range compiled.pathPatterns {
 			for _, path := range paths {
-				if isMatch, err := regexp.MatchString(pattern, path); err != nil {
-					return false, fmt.Errorf("invalid path pattern '%s': %w", pattern, err)
+				if isMatch, err := compiled.pathPatterns[i].match(path); err != nil {
+					return false, err
 				} else if isMatch {
 					matched = true
 					break
@@ -582,6 +599,12 @@ func (e *conditionEvaluatorImpl) EvaluatePayloadMatcher(ctx context.Context, mat
 
 // evaluatePayloadMatcherWithResult evaluates a payload matcher and returns detailed results.
 func (e *conditionEvaluatorImpl) evaluatePayloadMatcherWithResult(matcher *PayloadMatcher, payload map[string]any) (PayloadMatchResult, error) {
+	compiled := compilePayloadMatcher(*matcher)
+	return e.evaluateCompiledMatcher(&compiled, newEventPayload(&GitHubEvent{Payload: payload}))
+}
+
+// evaluateCompiledMatcher evaluates a compiled payload matcher against the event payload.
+func (e *conditionEvaluatorImpl) evaluateCompiledMatcher(matcher *compiledPayloadMatcher, payload *eventPayload) (PayloadMatchResult, error) {
 	result := PayloadMatchResult{
 		Path:          matcher.Path,
 		Operator:      matcher.Operator,
@@ -589,8 +612,8 @@ func (e *conditionEvaluatorImpl) evaluatePayloadMatcherWithResult(matcher *Paylo
 		Matched:       false,
 	}
 
-	// Convert payload to JSON for gjson parsing
-	jsonBytes, err := json.Marshal(payload)
+	// gjson queries the JSON document directly; raw webhook bodies are used as-is
+	jsonBytes, err := payload.bytes()
 	if err != nil {
 		result.Error = fmt.Sprintf("Failed to marshal payload: %v", err)
 		return result, err
@@ -633,7 +656,7 @@ func (e *conditionEvaluatorImpl) evaluatePayloadMatcherWithResult(matcher *Paylo
 	result.ActualValue = gjsonResult.Value()
 
 	// Evaluate based on operator
-	matched, err := e.evaluateOperator(matcher.Operator, gjsonResult.Value(), matcher.Value, matcher.CaseSensitive)
+	matched, err := e.evaluateOperator(matcher, result.ActualValue)
 	if err != nil {
 		result.Error = err.Error()
 		return result, err
@@ -644,29 +667,29 @@ func (e *conditionEvaluatorImpl) evaluatePayloadMatcherWithResult(matcher *Paylo
 	return result, nil
 }
 
-// evaluateOperator evaluates a value against an expected value using the specified operator.
-func (e *conditionEvaluatorImpl) evaluateOperator(operator MatchOperator, actual, expected any, caseSensitive bool) (bool, error) {
-	switch operator {
+// evaluateOperator evaluates a value against the matcher's precompiled operand.
+func (e *conditionEvaluatorImpl) evaluateOperator(matcher *compiledPayloadMatcher, actual any) (bool, error) {
+	switch matcher.Operator {
 	case MatchOperatorEquals:
-		return e.compareValues(actual, expected, caseSensitive, "equals")
+		return e.actualString(matcher, actual) == matcher.expected, nil
 	case MatchOperatorNotEquals:
-		result, err := e.compareValues(actual, expected, caseSensitive, "equals")
-		return !result, err
+		return e.actualString(matcher, actual) != matcher.expected, nil
 	case MatchOperatorContains:
-		return e.compareValues(actual, expected, caseSensitive, "contains")
+		return strings.Contains(e.actualString(matcher, actual), matcher.expected), nil
 	case MatchOperatorNotContains:
-		result, err := e.compareValues(actual, expected, caseSensitive, "contains")
-		return !result, err
+		return !strings.Contains(e.actualString(matcher, actual), matcher.expected), nil
 	case MatchOperatorStartsWith:
-		return e.compareValues(actual, expected, caseSensitive, "starts_with")
+		return strings.HasPrefix(e.actualString(matcher, actual), matcher.expected), nil
 	case MatchOperatorEndsWith:
-		return e.compareValues(actual, expected, caseSensitive, "ends_with")
+		return strings.HasSuffix(e.actualString(matcher, actual), matcher.expected), nil
 	case MatchOperatorRegex:
-		return e.matchRegex(actual, expected, caseSensitive)
-	case MatchOperatorGreaterThan:
-		return e.compareNumeric(actual, expected, "greater")
-	case MatchOperatorLessThan:
-		return e.compareNumeric(actual, expected, "less")
+		if matcher.regexErr != nil {
+			return false, fmt.Errorf("invalid regex pattern '%s': %w", matcher.expected, matcher.regexErr)
+		}
+
+		return matcher.regex.MatchString(fmt.Sprintf("%v", actual)), nil
+	case MatchOperatorGreaterThan, MatchOperatorLessThan:
+		return e.compareNumeric(matcher, actual)
 	case MatchOperatorExists:
 		return actual != nil, nil
 	case MatchOperatorNotExists:
@@ -676,70 +699,36 @@ func (e *conditionEvaluatorImpl) evaluateOperator(operator MatchOperator, actual
 	case MatchOperatorNotEmpty:
 		return !e.isEmpty(actual), nil
 	default:
-		return false, fmt.Errorf("unsupported operator: %s", operator)
+		return false, fmt.Errorf("unsupported operator: %s", matcher.Operator)
 	}
 }
 
 // Helper methods for condition evaluation
 
-func (e *conditionEvaluatorImpl) compareValues(actual, expected any, caseSensitive bool, operation string) (bool, error) {
+func (e *conditionEvaluatorImpl) actualString(matcher *compiledPayloadMatcher, actual any) string {
 	actualStr := fmt.Sprintf("%v", actual)
-	expectedStr := fmt.Sprintf("%v", expected)
-
-	if !caseSensitive {
+	if !matcher.CaseSensitive {
 		actualStr = strings.ToLower(actualStr)
-		expectedStr = strings.ToLower(expectedStr)
-	}
-
-	switch operation {
-	case "equals":
-		return actualStr == expectedStr, nil
-	case "contains":
-		return strings.Contains(actualStr, expectedStr), nil
-	case "starts_with":
-		return strings.HasPrefix(actualStr, expectedStr), nil
-	case "ends_with":
-		return strings.HasSuffix(actualStr, expectedStr), nil
-	default:
-		return false, fmt.Errorf("unsupported string operation: %s", operation)
-	}
-}
-
-func (e *conditionEvaluatorImpl) matchRegex(actual, expected any, caseSensitive bool) (bool, error) {
-	actualStr := fmt.Sprintf("%v", actual)
-	patternStr := fmt.Sprintf("%v", expected)
-
-	if !caseSensitive {
-		patternStr = "(?i)" + patternStr
 	}
 
-	matched, err := regexp.MatchString(patternStr, actualStr)
-	if err != nil {
-		return false, fmt.Errorf("invalid regex pattern '%s': %w", patternStr, err)
-	}
-
-	return matched, nil
+	return actualStr
 }
 
-func (e *conditionEvaluatorImpl) compareNumeric(actual, expected any, operation string) (bool, error) {
-	actualNum, err := e.toFloat64(actual)
+func (e *conditionEvaluatorImpl) compareNumeric(matcher *compiledPayloadMatcher, actual any) (bool, error) {
+	actualNum, err := toFloat64(actual)
 	if err != nil {
 		return false, fmt.Errorf("actual value is not numeric: %v", actual)
 	}
 
-	expectedNum, err := e.toFloat64(expected)
-	if err != nil {
-		return false, fmt.Errorf("expected value is not numeric: %v", expected)
+	if matcher.numErr != nil {
+		return false, fmt.Errorf("expected value is not numeric: %v", matcher.Value)
 	}
 
-	switch operation {
-	case "greater":
-		return actualNum > expectedNum, nil
-	case "less":
-		return actualNum < expectedNum, nil
-	default:
-		return false, fmt.Errorf("unsupported numeric operation: %s", operation)
+	if matcher.Operator == MatchOperatorGreaterThan {
+		return actualNum > matcher.expectedNum, nil
 	}
+
+	return actualNum < matcher.expectedNum, nil
 }
 
 func (e *conditionEvaluatorImpl) isEmpty(value any) bool {
@@ -760,18 +749,7 @@ func (e *conditionEvaluatorImpl) isEmpty(value any) bool {
 }
 
 func (e *conditionEvaluatorImpl) toFloat64(value any) (float64, error) {
-	switch v := value.(type) {
-	case float64:
-		return v, nil
-	case int:
-		return float64(v), nil
-	case int64:
-		return float64(v), nil
-	case string:
-		return strconv.ParseFloat(v, 64)
-	default:
-		return 0, fmt.Errorf("cannot convert %T to float64", value)
-	}
+	return toFloat64(value)
 }
 
 func (e *conditionEvaluatorImpl) applyLogicalOperator(operator ConditionOperator, result *EvaluationResult) bool {
@@ -803,6 +781,11 @@ func (e *conditionEvaluatorImpl) hasContentConditions(conditions *AutomationCond
 }
 
 func (e *conditionEvaluatorImpl) extractBranchFromPayload(payload map[string]any) string {
+	return branchFromPayload(payload)
+}
+
+// branchFromPayload extracts the branch a push or pull request event refers to.
+func branchFromPayload(payload map[string]any) string {
 	// Try to extract branch from different event types
 	if ref, ok := payload["ref"].(string); ok {
 		if after, ok0 := strings.CutPrefix(ref, "refs/heads/"); ok0 {
@@ -1,16 +1,20 @@
 package github
 
 import (
+	"bytes"
 	"context"
 	"crypto/hmac"
 	"crypto/sha256"
 	"encoding/hex"
 	"encoding/json"
+	"errors"
 	"fmt"
 	"io"
+	"maps"
 	"net/http"
 	"slices"
 	"strings"
+	"sync"
 	"time"
 )
 
@@ -26,6 +30,10 @@ type GitHubEvent struct {
 	Payload      map[string]any    `json:"payload"`
 	Headers      map[string]string `json:"headers"`
 	Signature    string            `json:"signature"`
+
+	// RawPayload holds the original webhook body. Payload matchers query it
+	// directly instead of re-encoding Payload; it must describe the same data.
+	RawPayload json.RawMessage `json:"-"`
 }
 
 // EventType defines the type of GitHub events.
@@ -140,7 +148,16 @@ type eventProcessorImpl struct {
 	handlers map[EventType][]EventHandler
 	storage  EventStorage
 	logger   Logger
-	metrics  *EventMetrics
+
+	metricsMu sync.Mutex
+	metrics   *EventMetrics
+}
+
+// EventDispatcher receives events that have already been stored. Both the
+// event processor, which runs the registered handlers, and the automation
+// engine implement it.
+type EventDispatcher interface {
+	DispatchEvent(ctx context.Context, event *GitHubEvent) error
 }
 
 // NewEventProcessor creates a new event processor.
@@ -173,6 +190,22 @@ func (e *eventProcessorImpl) ProcessEvent(ctx context.Context, event *GitHubEven
 		return fmt.Errorf("failed to store event: %w", err)
 	}
 
+	return e.dispatchEvent(ctx, event)
+}
+
+// DispatchEvent runs the registered handlers for an event that has already
+// been stored.
+func (e *eventProcessorImpl) DispatchEvent(ctx context.Context, event *GitHubEvent) error {
+	startTime := time.Now()
+
+	defer func() {
+		e.updateMetrics(event, time.Since(startTime))
+	}()
+
+	return e.dispatchEvent(ctx, event)
+}
+
+func (e *eventProcessorImpl) dispatchEvent(ctx context.Context, event *GitHubEvent) error {
 	// Get handlers for this event type
 	handlers, exists := e.handlers[EventType(event.Type)]
 	if !exists || len(handlers) == 0 {
@@ -274,12 +307,13 @@ func (e *eventProcessorImpl) ParseWebhookEvent(r *http.Request) (*GitHubEvent, e
 
 	// Extract common fields
 	event := &GitHubEvent{
-		ID:        eventID,
-		Type:      eventType,
-		Timestamp: time.Now(),
-		Payload:   payload,
-		Headers:   make(map[string]string),
-		Signature: signature,
+		ID:         eventID,
+		Type:       eventType,
+		Timestamp:  time.Now(),
+		Payload:    payload,
+		RawPayload: body,
+		Headers:    make(map[string]string),
+		Signature:  signature,
 	}
 
 	// Copy headers
@@ -308,7 +342,9 @@ func (e *eventProcessorImpl) RegisterEventHandler(eventType EventType, handler E
 	// Sort handlers by priority (highest first)
 	e.sortHandlersByPriority(eventType)
 
+	e.metricsMu.Lock()
 	e.metrics.HandlersStatus[string(eventType)] = "active"
+	e.metricsMu.Unlock()
 
 	return nil
 }
@@ -318,7 +354,9 @@ func (e *eventProcessorImpl) UnregisterEventHandler(eventType EventType) error {
 	e.logger.Info("Unregistering event handlers", "event_type", eventType)
 
 	delete(e.handlers, eventType)
+	e.metricsMu.Lock()
 	delete(e.metrics.HandlersStatus, string(eventType))
+	e.metricsMu.Unlock()
 
 	return nil
 }
@@ -384,6 +422,9 @@ func (e *eventProcessorImpl) sortHandlersByPriority(eventType EventType) {
 }
 
 func (e *eventProcessorImpl) updateMetrics(event *GitHubEvent, duration time.Duration) {
+	e.metricsMu.Lock()
+	defer e.metricsMu.Unlock()
+
 	e.metrics.TotalEventsReceived++
 	e.metrics.TotalEventsProcessed++
 	e.metrics.EventsByType[event.Type]++
@@ -400,7 +441,16 @@ func (e *eventProcessorImpl) updateMetrics(event *GitHubEvent, duration time.Dur
 
 // GetMetrics returns current event processing metrics.
 func (e *eventProcessorImpl) GetMetrics() *EventMetrics {
-	return e.metrics
+	e.metricsMu.Lock()
+	defer e.metricsMu.Unlock()
+
+	// Handlers may be running on ingestion workers, so return a snapshot
+	metrics := *e.metrics
+	metrics.EventsByType = maps.Clone(e.metrics.EventsByType)
+	metrics.EventsByOrganization = maps.Clone(e.metrics.EventsByOrganization)
+	metrics.HandlersStatus = maps.Clone(e.metrics.HandlersStatus)
+
+	return &metrics
 }
 
 // ValidateEvent validates a GitHub event.
@@ -483,11 +533,15 @@ func (e *eventProcessorImpl) FilterEvent(ctx context.Context, event *GitHubEvent
 	return true, nil
 }
 
+// maxWebhookPayloadSize is the largest payload GitHub delivers.
+const maxWebhookPayloadSize = 25 << 20
+
 // EventWebhookServer provides HTTP server functionality for receiving GitHub webhooks.
 type EventWebhookServer struct {
 	processor EventProcessor
 	secret    string
 	logger    Logger
+	ingestor  *WebhookIngestor
 }
 
 // NewEventWebhookServer creates a new webhook server.
@@ -499,6 +553,12 @@ func NewEventWebhookServer(processor EventProcessor, secret string, logger Logge
 	}
 }
 
+// SetIngestor makes the server acknowledge deliveries as soon as they are
+// queued on the ingestor instead of processing them before responding.
+func (s *EventWebhookServer) SetIngestor(ingestor *WebhookIngestor) {
+	s.ingestor = ingestor
+}
+
 // HandleWebhook handles incoming GitHub webhook requests.
 func (s *EventWebhookServer) HandleWebhook(w http.ResponseWriter, r *http.Request) {
 	if r.Method != http.MethodPost {
@@ -506,7 +566,26 @@ func (s *EventWebhookServer) HandleWebhook(w http.ResponseWriter, r *http.Reques
 		return
 	}
 
+	// Read the body once; the signature covers the raw bytes
+	body, err := io.ReadAll(http.MaxBytesReader(w, r.Body, maxWebhookPayloadSize))
+	if err != nil {
+		s.logger.Error("Failed to read webhook body", "error", err)
+		http.Error(w, "Bad request", http.StatusBadRequest)
+
+		return
+	}
+
+	// Validate signature before spending any work on the payload
+	if s.secret != "" && !s.processor.ValidateSignature(body, r.Header.Get("X-Hub-Signature-256"), s.secret) {
+		s.logger.Warn("Invalid webhook signature", "event_id", r.Header.Get("X-GitHub-Delivery"))
+		http.Error(w, "Unauthorized", http.StatusUnauthorized)
+
+		return
+	}
+
 	// Parse the webhook event
+	r.Body = io.NopCloser(bytes.NewReader(body))
+
 	event, err := s.processor.ParseWebhookEvent(r)
 	if err != nil {
 		s.logger.Error("Failed to parse webhook event", "error", err)
@@ -515,17 +594,9 @@ func (s *EventWebhookServer) HandleWebhook(w http.ResponseWriter, r *http.Reques
 		return
 	}
 
-	// Validate signature if secret is configured
-	if s.secret != "" {
-		body, _ := io.ReadAll(r.Body)
-		r.Body = io.NopCloser(strings.NewReader(string(body))) // Reset body for parsing
-
-		if !s.processor.ValidateSignature(body, event.Signature, s.secret) {
-			s.logger.Warn("Invalid webhook signature", "event_id", event.ID)
-			http.Error(w, "Unauthorized", http.StatusUnauthorized)
-
-			return
-		}
+	if s.ingestor != nil {
+		s.enqueueEvent(w, event)
+		return
 	}
 
 	// Process the event
@@ -537,14 +608,36 @@ func (s *EventWebhookServer) HandleWebhook(w http.ResponseWriter, r *http.Reques
 		return
 	}
 
-	// Return success response
+	writeWebhookResponse(w, http.StatusOK, event.ID, "Event processed successfully")
+}
+
+func (s *EventWebhookServer) enqueueEvent(w http.ResponseWriter, event *GitHubEvent) {
+	err := s.ingestor.Enqueue(event)
+
+	switch {
+	case err == nil:
+		writeWebhookResponse(w, http.StatusAccepted, event.ID, "Event queued for processing")
+	case errors.Is(err, ErrDuplicateDelivery):
+		// GitHub redelivers on timeouts; the first delivery is already queued
+		writeWebhookResponse(w, http.StatusOK, event.ID, "Event already received")
+	case errors.Is(err, ErrIngestQueueFull):
+		s.logger.Warn("Webhook queue is full", "event_id", event.ID)
+		w.Header().Set("Retry-After", "1")
+		http.Error(w, "Service unavailable", http.StatusServiceUnavailable)
+	default:
+		s.logger.Error("Failed to queue event", "event_id", event.ID, "error", err)
+		http.Error(w, "Service unavailable", http.StatusServiceUnavailable)
+	}
+}
+
+func writeWebhookResponse(w http.ResponseWriter, status int, eventID, message string) {
 	w.Header().Set("Content-Type", "application/json")
-	w.WriteHeader(http.StatusOK)
+	w.WriteHeader(status)
 
 	response := map[string]any{
 		"status":   "success",
-		"event_id": event.ID,
-		"message":  "Event processed successfully",
+		"event_id": eventID,
+		"message":  message,
 	}
 	_ = json.NewEncoder(w).Encode(response) //nolint:errcheck // HTTP response encoding
 }
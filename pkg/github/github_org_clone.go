@@ -19,6 +19,7 @@ import (
 	"golang.org/x/sync/semaphore"
 
 	"github.com/gizzahub/gzh-cli/internal/git"
+	"github.com/gizzahub/gzh-cli/internal/git/objectcache"
 	"github.com/gizzahub/gzh-cli/internal/httpclient"
 )
 
@@ -39,6 +40,8 @@ type RepoInfo struct {
 	Fork bool `json:"fork"`
 	// DefaultBranch is the name of the repository's default branch (e.g., "main", "master")
 	DefaultBranch string `json:"default_branch"`
+	// PushedAt is the time of the last push to any branch of the repository
+	PushedAt time.Time `json:"pushed_at" yaml:"pushedat,omitempty"`
 }
 
 // GetDefaultBranch retrieves the default branch name for a GitHub repository.
@@ -99,89 +102,139 @@ func ListRepos(ctx context.Context, org string) ([]RepoInfo, error) {
 	for {
 		url := fmt.Sprintf("https://api.github.com/orgs/%s/repos?page=%d&per_page=%d", org, page, perPage)
 
-		req, err := http.NewRequestWithContext(ctx, "GET", url, nil)
+		repos, err := fetchRepoPage(ctx, client, url)
 		if err != nil {
-			return nil, fmt.Errorf("failed to create request: %w", err)
+			return nil, err
 		}
 
-		// Add GitHub token if available
-		if token := os.Getenv("GITHUB_TOKEN"); token != "" {
-			req.Header.Set("Authorization", "token "+token)
+		// Append repos to the result
+		allRepos = append(allRepos, repos...)
+
+		// If we got fewer repos than requested, we've reached the end
+		if len(repos) < perPage {
+			break
 		}
-		req.Header.Set("Accept", "application/vnd.github.v3+json")
 
-		resp, err := client.Do(req)
+		// Move to next page
+		page++
+	}
+
+	return allRepos, nil
+}
+
+// ListReposPushedSince retrieves the repositories of a GitHub organization
+// pushed to at or after since. Repositories are requested most recently
+// pushed first and paging stops at the first one older than since, so an
+// incremental sync of a large organization costs a page or two instead of
+// a full listing. A zero since lists every repository.
+func ListReposPushedSince(ctx context.Context, org string, since time.Time) ([]RepoInfo, error) {
+	if since.IsZero() {
+		return ListRepos(ctx, org)
+	}
+
+	var changed []RepoInfo
+	page := 1
+	perPage := 100
+
+	client := httpclient.GetGlobalClient("github")
+
+	for {
+		url := fmt.Sprintf("https://api.github.com/orgs/%s/repos?sort=pushed&direction=desc&page=%d&per_page=%d", org, page, perPage)
+
+		repos, err := fetchRepoPage(ctx, client, url)
 		if err != nil {
-			return nil, fmt.Errorf("failed to get repositories: %w", err)
+			return nil, err
 		}
-		defer func() { _ = resp.Body.Close() }() //nolint:errcheck // HTTP response body cleanup
-
-		if resp.StatusCode != http.StatusOK {
-			// Read response body for error details
-			body, _ := io.ReadAll(resp.Body)
-
-			// Check for rate limit error
-			if resp.StatusCode == http.StatusForbidden {
-				rateLimit := resp.Header.Get("X-RateLimit-Limit")
-				rateRemaining := resp.Header.Get("X-RateLimit-Remaining")
-				rateReset := resp.Header.Get("X-RateLimit-Reset")
-
-				if rateRemaining == "0" {
-					resetTime, err := strconv.ParseInt(rateReset, 10, 64)
-					if err == nil {
-						c := color.New(color.FgRed, color.Bold)
-						_, _ = c.Println("\n🚫 GitHub API Rate Limit Exceeded!")
-
-						c = color.New(color.FgYellow)
-						_, _ = c.Printf("   Rate Limit: %s requests/hour\n", rateLimit)
-						_, _ = c.Printf("   Remaining: %s\n", rateRemaining)
-						_, _ = c.Printf("   Reset Time: %s\n", time.Unix(resetTime, 0).Format(time.RFC1123))
-
-						duration := time.Until(time.Unix(resetTime, 0))
-						_, _ = c.Printf("   Wait Time: %d minutes %d seconds\n\n", int(duration.Minutes()), int(duration.Seconds())%60)
-
-						// Check if token is set
-						token := os.Getenv("GITHUB_TOKEN")
-						if token == "" {
-							c = color.New(color.FgGreen)
-							_, _ = c.Println("💡 Solution: Set GITHUB_TOKEN environment variable to bypass rate limits")
-							_, _ = c.Println("   export GITHUB_TOKEN=\"your_github_personal_access_token\"")
-						} else {
-							c = color.New(color.FgMagenta)
-							_, _ = c.Println("⚠️  Token is set but rate limit still exceeded. Token may be invalid or have insufficient permissions.")
-						}
-					}
-					return nil, fmt.Errorf("GitHub API rate limit exceeded")
-				}
-			}
 
-			// For other errors, show the status and body
-			errorMsg := fmt.Sprintf("failed to get repositories: %s", resp.Status)
-			if len(body) > 0 {
-				errorMsg = fmt.Sprintf("%s - %s", errorMsg, string(body))
+		for _, repo := range repos {
+			if repo.PushedAt.Before(since) {
+				return changed, nil
 			}
-			return nil, fmt.Errorf("%s", errorMsg)
-		}
 
-		// Decode the response directly into RepoInfo structs
-		var repos []RepoInfo
-		if err := json.NewDecoder(resp.Body).Decode(&repos); err != nil {
-			return nil, fmt.Errorf("failed to decode response: %w", err)
+			changed = append(changed, repo)
 		}
 
-		// Append repos to the result
-		allRepos = append(allRepos, repos...)
-
-		// If we got fewer repos than requested, we've reached the end
 		if len(repos) < perPage {
-			break
+			return changed, nil
 		}
 
-		// Move to next page
 		page++
 	}
+}
 
-	return allRepos, nil
+// fetchRepoPage requests one page of repositories from the GitHub API.
+func fetchRepoPage(ctx context.Context, client *http.Client, url string) ([]RepoInfo, error) {
+	req, err := http.NewRequestWithContext(ctx, "GET", url, nil)
+	if err != nil {
+		return nil, fmt.Errorf("failed to create request: %w", err)
+	}
+
+	// Add GitHub token if available
+	if token := os.Getenv("GITHUB_TOKEN"); token != "" {
+		req.Header.Set("Authorization", "token "+token)
+	}
+	req.Header.Set("Accept", "application/vnd.github.v3+json")
+
+	resp, err := client.Do(req)
+	if err != nil {
+		return nil, fmt.Errorf("failed to get repositories: %w", err)
+	}
+	defer func() { _ = resp.Body.Close() }() //nolint:errcheck // HTTP response body cleanup
+
+	if resp.StatusCode != http.StatusOK {
+		// Read response body for error details
+		body, _ := io.ReadAll(resp.Body)
+
+		// Check for rate limit error
+		if resp.StatusCode == http.StatusForbidden {
+			rateLimit := resp.Header.Get("X-RateLimit-Limit")
+			rateRemaining := resp.Header.Get("X-RateLimit-Remaining")
+			rateReset := resp.Header.Get("X-RateLimit-Reset")
+
+			if rateRemaining == "0" {
+				resetTime, err := strconv.ParseInt(rateReset, 10, 64)
+				if err == nil {
+					c := color.New(color.FgRed, color.Bold)
+					_, _ = c.Println("\n🚫 GitHub API Rate Limit Exceeded!")
+
+					c = color.New(color.FgYellow)
+					_, _ = c.Printf("   Rate Limit: %s requests/hour\n", rateLimit)
+					_, _ = c.Printf("   Remaining: %s\n", rateRemaining)
+					_, _ = c.Printf("   Reset Time: %s\n", time.Unix(resetTime, 0).Format(time.RFC1123))
+
+					duration := time.Until(time.Unix(resetTime, 0))
+					_, _ = c.Printf("   Wait Time: %d minutes %d seconds\n\n", int(duration.Minutes()), int(duration.Seconds())%60)
+
+					// Check if token is set
+					token := os.Getenv("GITHUB_TOKEN")
+					if token == "" {
+						c = color.New(color.FgGreen)
+						_, _ = c.Println("💡 Solution: Set GITHUB_TOKEN environment variable to bypass rate limits")
+						_, _ = c.Println("   export GITHUB_TOKEN=\"your_github_personal_access_token\"")
+					} else {
+						c = color.New(color.FgMagenta)
+						_, _ = c.Println("⚠️  Token is set but rate limit still exceeded. Token may be invalid or have insufficient permissions.")
+					}
+				}
+				return nil, fmt.Errorf("GitHub API rate limit exceeded")
+			}
+		}
+
+		// For other errors, show the status and body
+		errorMsg := fmt.Sprintf("failed to get repositories: %s", resp.Status)
+		if len(body) > 0 {
+			errorMsg = fmt.Sprintf("%s - %s", errorMsg, string(body))
+		}
+		return nil, fmt.Errorf("%s", errorMsg)
+	}
+
+	// Decode the response directly into RepoInfo structs
+	var repos []RepoInfo
+	if err := json.NewDecoder(resp.Body).Decode(&repos); err != nil {
+		return nil, fmt.Errorf("failed to decode response: %w", err)
+	}
+
+	return repos, nil
 }
 
 // List retrieves all repository names for a GitHub organization.
@@ -239,8 +292,11 @@ func Clone(ctx context.Context, targetPath string, org string, repo string) erro
 	}
 
 	// Execute secure git clone operation
-	// Clone directly to the target path
-	if err := executor.ExecuteSecure(ctx, filepath.Dir(targetPath), "clone", cloneURL, filepath.Base(targetPath)); err != nil {
+	// Clone directly to the target path, with the shared clone strategy options
+	args := append([]string{"clone"}, objectcache.DefaultStrategy().CloneArgs(ctx, cloneURL)...)
+	args = append(args, cloneURL, filepath.Base(targetPath))
+
+	if err := executor.ExecuteSecure(ctx, filepath.Dir(targetPath), args...); err != nil {
 		return fmt.Errorf("Clone Failed (url: %s, targetPath: %s, err: %w)", cloneURL, targetPath, err)
 	}
 
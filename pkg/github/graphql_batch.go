@@ -0,0 +1,460 @@
+package github
+
+import (
+	"context"
+	"encoding/json"
+	"fmt"
+	"strings"
+)
+
+const (
+	// DefaultGraphQLBatchSize is the number of repositories requested per GraphQL query.
+	DefaultGraphQLBatchSize = 50
+
+	// MaxGraphQLBatchSize keeps a single query well inside GitHub's node and timeout limits.
+	MaxGraphQLBatchSize = 100
+
+	// graphQLPath is the GraphQL endpoint relative to the REST base URL of github.com.
+	graphQLPath = "/graphql"
+)
+
+// stateFilesToCheck lists the files whose presence is recorded in RepositoryStateData.Files.
+var stateFilesToCheck = []string{
+	"README.md",
+	"LICENSE",
+	"SECURITY.md",
+	"CONTRIBUTING.md",
+	"CODE_OF_CONDUCT.md",
+	".github/CODEOWNERS",
+	"COMPLIANCE.md",
+}
+
+// graphQLRepositoryFragment selects every per-repository field used by
+// RepositoryConfig and RepositoryStateData that GraphQL exposes.
+// Team/user permissions and has_downloads are not available and come from REST.
+var graphQLRepositoryFragment = buildGraphQLRepositoryFragment()
+
+func buildGraphQLRepositoryFragment() string {
+	var b strings.Builder
+
+	b.WriteString(`fragment repoFields on Repository {
+  name
+  description
+  homepageUrl
+  isPrivate
+  isArchived
+  hasIssuesEnabled
+  hasProjectsEnabled
+  hasWikiEnabled
+  squashMergeAllowed
+  mergeCommitAllowed
+  rebaseMergeAllowed
+  deleteBranchOnMerge
+  updatedAt
+  repositoryTopics(first: 100) { nodes { topic { name } } }
+  defaultBranchRef {
+    name
+    branchProtectionRule {
+      requiredApprovingReviewCount
+      dismissesStaleReviews
+      requiresCodeOwnerReviews
+      requiresStatusChecks
+      requiresStrictStatusChecks
+      requiredStatusCheckContexts
+      isAdminEnforced
+      restrictsPushes
+      allowsForcePushes
+      allowsDeletions
+      requiresConversationResolution
+      pushAllowances(first: 20) { nodes { actor { __typename ... on User { login } ... on Team { slug } } } }
+    }
+  }
+  workflows: object(expression: "HEAD:.github/workflows") { ... on Tree { entries { name } } }
+`)
+
+	for i, file := range stateFilesToCheck {
+		fmt.Fprintf(&b, "  file%d: object(expression: %q) { id }\n", i, "HEAD:"+file)
+	}
+
+	b.WriteString("}\n")
+
+	return b.String()
+}
+
+// graphQLRepository is the decoded repoFields fragment.
+type graphQLRepository struct {
+	Name                string `json:"name"`
+	Description         string `json:"description"`
+	HomepageURL         string `json:"homepageUrl"`
+	IsPrivate           bool   `json:"isPrivate"`
+	IsArchived          bool   `json:"isArchived"`
+	HasIssuesEnabled    bool   `json:"hasIssuesEnabled"`
+	HasProjectsEnabled  bool   `json:"hasProjectsEnabled"`
+	HasWikiEnabled      bool   `json:"hasWikiEnabled"`
+	SquashMergeAllowed  bool   `json:"squashMergeAllowed"`
+	MergeCommitAllowed  bool   `json:"mergeCommitAllowed"`
+	RebaseMergeAllowed  bool   `json:"rebaseMergeAllowed"`
+	DeleteBranchOnMerge bool   `json:"deleteBranchOnMerge"`
+	UpdatedAt           string `json:"updatedAt"`
+	RepositoryTopics    struct {
+		Nodes []struct {
+			Topic struct {
+				Name string `json:"name"`
+			} `json:"topic"`
+		} `json:"nodes"`
+	} `json:"repositoryTopics"`
+	DefaultBranchRef *struct {
+		Name                 string                       `json:"name"`
+		BranchProtectionRule *graphQLBranchProtectionRule `json:"branchProtectionRule"`
+	} `json:"defaultBranchRef"`
+	Workflows *struct {
+		Entries []struct {
+			Name string `json:"name"`
+		} `json:"entries"`
+	} `json:"workflows"`
+
+	// files holds the names from stateFilesToCheck that exist on the default branch.
+	files []string
+}
+
+type graphQLBranchProtectionRule struct {
+	RequiredApprovingReviewCount   int      `json:"requiredApprovingReviewCount"`
+	DismissesStaleReviews          bool     `json:"dismissesStaleReviews"`
+	RequiresCodeOwnerReviews       bool     `json:"requiresCodeOwnerReviews"`
+	RequiresStatusChecks           bool     `json:"requiresStatusChecks"`
+	RequiresStrictStatusChecks     bool     `json:"requiresStrictStatusChecks"`
+	RequiredStatusCheckContexts    []string `json:"requiredStatusCheckContexts"`
+	IsAdminEnforced                bool     `json:"isAdminEnforced"`
+	RestrictsPushes                bool     `json:"restrictsPushes"`
+	AllowsForcePushes              bool     `json:"allowsForcePushes"`
+	AllowsDeletions                bool     `json:"allowsDeletions"`
+	RequiresConversationResolution bool     `json:"requiresConversationResolution"`
+	PushAllowances                 struct {
+		Nodes []struct {
+			Actor struct {
+				Typename string `json:"__typename"`
+				Login    string `json:"login"`
+				Slug     string `json:"slug"`
+			} `json:"actor"`
+		} `json:"nodes"`
+	} `json:"pushAllowances"`
+}
+
+type graphQLError struct {
+	Type    string `json:"type"`
+	Message string `json:"message"`
+	Path    []any  `json:"path"`
+}
+
+// GraphQLBatchFetcher fetches configuration and state for many repositories
+// with one GraphQL query per batch, falling back to REST for anything the
+// GraphQL API cannot provide.
+type GraphQLBatchFetcher struct {
+	client             *RepoConfigClient
+	batchSize          int
+	includePermissions bool
+}
+
+// NewGraphQLBatchFetcher creates a batch fetcher that shares the client's token, transport and rate limiter.
+// batchSize <= 0 selects DefaultGraphQLBatchSize; values above MaxGraphQLBatchSize are capped.
+func NewGraphQLBatchFetcher(client *RepoConfigClient, batchSize int) *GraphQLBatchFetcher {
+	if batchSize <= 0 {
+		batchSize = DefaultGraphQLBatchSize
+	}
+
+	return &GraphQLBatchFetcher{
+		client:             client,
+		batchSize:          min(batchSize, MaxGraphQLBatchSize),
+		includePermissions: true,
+	}
+}
+
+// SetIncludePermissions controls whether FetchConfigs loads team and user
+// permissions. They are not exposed through GraphQL and cost two REST calls per repository.
+func (f *GraphQLBatchFetcher) SetIncludePermissions(include bool) {
+	f.includePermissions = include
+}
+
+// FetchConfigs returns the RepositoryConfig of every given repository, keyed by name.
+// Repositories that GraphQL cannot resolve are fetched with GetRepositoryConfiguration.
+func (f *GraphQLBatchFetcher) FetchConfigs(ctx context.Context, owner string, repos []*Repository) (map[string]*RepositoryConfig, error) {
+	configs := make(map[string]*RepositoryConfig, len(repos))
+
+	err := f.forEachBatch(ctx, owner, repos, func(repo *Repository, data *graphQLRepository) error {
+		if data == nil {
+			config, err := f.client.GetRepositoryConfiguration(ctx, owner, repo.Name)
+			if err != nil {
+				return fmt.Errorf("REST fallback for %s failed: %w", repo.Name, err)
+			}
+
+			configs[repo.Name] = config
+
+			return nil
+		}
+
+		config := data.toRepositoryConfig(repo)
+
+		if f.includePermissions {
+			teams, users, err := f.client.GetRepositoryPermissions(ctx, owner, repo.Name)
+			if err == nil {
+				config.Permissions = PermissionsConfig{Teams: teams, Users: users}
+			}
+		}
+
+		configs[repo.Name] = config
+
+		return nil
+	})
+	if err != nil {
+		return nil, err
+	}
+
+	return configs, nil
+}
+
+// FetchStates returns the RepositoryStateData of every given repository, keyed by name.
+// Repositories that GraphQL cannot resolve are collected through the REST calls.
+func (f *GraphQLBatchFetcher) FetchStates(ctx context.Context, owner string, repos []*Repository) (map[string]RepositoryStateData, error) {
+	states := make(map[string]RepositoryStateData, len(repos))
+
+	err := f.forEachBatch(ctx, owner, repos, func(repo *Repository, data *graphQLRepository) error {
+		if data == nil {
+			states[repo.Name] = f.client.collectRepositoryState(ctx, owner, repo)
+			return nil
+		}
+
+		states[repo.Name] = data.toRepositoryState(repo)
+
+		return nil
+	})
+	if err != nil {
+		return nil, err
+	}
+
+	return states, nil
+}
+
+// forEachBatch queries repos in batches and calls fn for each repository with
+// its GraphQL data, or nil when the repository could not be resolved.
+func (f *GraphQLBatchFetcher) forEachBatch(ctx context.Context, owner string, repos []*Repository,
+	fn func(repo *Repository, data *graphQLRepository) error,
+) error {
+	for start := 0; start < len(repos); start += f.batchSize {
+		batch := repos[start:min(start+f.batchSize, len(repos))]
+
+		results, err := f.queryBatch(ctx, owner, batch)
+		if err != nil {
+			return err
+		}
+
+		for i, repo := range batch {
+			if err := fn(repo, results[i]); err != nil {
+				return err
+			}
+		}
+	}
+
+	return nil
+}
+
+// queryBatch runs one aliased GraphQL query for the batch. The result slice is
+// index-aligned with batch; unresolved repositories are nil.
+func (f *GraphQLBatchFetcher) queryBatch(ctx context.Context, owner string, batch []*Repository) ([]*graphQLRepository, error) {
+	var query strings.Builder
+
+	variables := map[string]any{"owner": owner}
+
+	query.WriteString("query($owner: String!")
+
+	for i := range batch {
+		fmt.Fprintf(&query, ", $n%d: String!", i)
+	}
+
+	query.WriteString(") {\n")
+
+	for i, repo := range batch {
+		fmt.Fprintf(&query, "  r%d: repository(owner: $owner, name: $n%d) { ...repoFields }\n", i, i)
+		variables[fmt.Sprintf("n%d", i)] = repo.Name
+	}
+
+	query.WriteString("}\n")
+	query.WriteString(graphQLRepositoryFragment)
+
+	resp, err := f.client.makeRequest(ctx, "POST", graphQLPath, map[string]any{
+		"query":     query.String(),
+		"variables": variables,
+	})
+	if err != nil {
+		return nil, fmt.Errorf("GraphQL batch query failed: %w", err)
+	}
+	defer func() { _ = resp.Body.Close() }()
+
+	var response struct {
+		Data   map[string]json.RawMessage `json:"data"`
+		Errors []graphQLError             `json:"errors"`
+	}
+
+	if err := json.NewDecoder(resp.Body).Decode(&response); err != nil {
+		return nil, fmt.Errorf("failed to decode GraphQL response: %w", err)
+	}
+
+	if response.Data == nil && len(response.Errors) > 0 {
+		return nil, fmt.Errorf("GraphQL batch query failed: %s", response.Errors[0].Message)
+	}
+
+	results := make([]*graphQLRepository, len(batch))
+
+	for i := range batch {
+		raw, ok := response.Data[fmt.Sprintf("r%d", i)]
+		if !ok || string(raw) == "null" {
+			continue // NOT_FOUND, FORBIDDEN, ... are resolved through REST
+		}
+
+		repo, err := decodeGraphQLRepository(raw)
+		if err != nil {
+			continue
+		}
+
+		results[i] = repo
+	}
+
+	return results, nil
+}
+
+func decodeGraphQLRepository(raw json.RawMessage) (*graphQLRepository, error) {
+	var repo graphQLRepository
+	if err := json.Unmarshal(raw, &repo); err != nil {
+		return nil, err
+	}
+
+	var fields map[string]json.RawMessage
+	if err := json.Unmarshal(raw, &fields); err != nil {
+		return nil, err
+	}
+
+	for i, file := range stateFilesToCheck {
+		if value, ok := fields[fmt.Sprintf("file%d", i)]; ok && string(value) != "null" {
+			repo.files = append(repo.files, file)
+		}
+	}
+
+	return &repo, nil
+}
+
+func (r *graphQLRepository) topics() []string {
+	topics := make([]string, 0, len(r.RepositoryTopics.Nodes))
+	for _, node := range r.RepositoryTopics.Nodes {
+		topics = append(topics, node.Topic.Name)
+	}
+
+	return topics
+}
+
+func (r *graphQLRepository) workflows() []string {
+	if r.Workflows == nil {
+		return nil
+	}
+
+	var workflows []string
+
+	for _, entry := range r.Workflows.Entries {
+		if strings.HasSuffix(entry.Name, ".yml") || strings.HasSuffix(entry.Name, ".yaml") {
+			workflows = append(workflows, entry.Name)
+		}
+	}
+
+	return workflows
+}
+
+// toRepositoryConfig converts the GraphQL data; listed carries REST-only fields from the org listing.
+func (r *graphQLRepository) toRepositoryConfig(listed *Repository) *RepositoryConfig {
+	config := &RepositoryConfig{
+		Name:        r.Name,
+		Description: r.Description,
+		Homepage:    r.HomepageURL,
+		Private:     r.IsPrivate,
+		Archived:    r.IsArchived,
+		Topics:      r.topics(),
+		Settings: RepoConfigSettings{
+			HasIssues:           r.HasIssuesEnabled,
+			HasProjects:         r.HasProjectsEnabled,
+			HasWiki:             r.HasWikiEnabled,
+			HasDownloads:        listed.HasDownloads,
+			AllowSquashMerge:    r.SquashMergeAllowed,
+			AllowMergeCommit:    r.MergeCommitAllowed,
+			AllowRebaseMerge:    r.RebaseMergeAllowed,
+			DeleteBranchOnMerge: r.DeleteBranchOnMerge,
+		},
+	}
+
+	if r.DefaultBranchRef == nil {
+		return config
+	}
+
+	config.Settings.DefaultBranch = r.DefaultBranchRef.Name
+
+	if rule := r.DefaultBranchRef.BranchProtectionRule; rule != nil {
+		config.BranchProtection = map[string]BranchProtectionConfig{
+			r.DefaultBranchRef.Name: rule.toBranchProtectionConfig(),
+		}
+	}
+
+	return config
+}
+
+// toRepositoryState converts the GraphQL data; listed carries REST-only fields from the org listing.
+func (r *graphQLRepository) toRepositoryState(listed *Repository) RepositoryStateData {
+	state := RepositoryStateData{
+		Name:             r.Name,
+		Private:          r.IsPrivate,
+		Archived:         r.IsArchived,
+		HasIssues:        r.HasIssuesEnabled,
+		HasWiki:          r.HasWikiEnabled,
+		HasProjects:      r.HasProjectsEnabled,
+		HasDownloads:     listed.HasDownloads,
+		LastModified:     r.UpdatedAt,
+		BranchProtection: make(map[string]BranchProtectionData),
+		Files:            r.files,
+		Workflows:        r.workflows(),
+	}
+
+	if r.DefaultBranchRef != nil && r.DefaultBranchRef.BranchProtectionRule != nil {
+		rule := r.DefaultBranchRef.BranchProtectionRule
+		state.BranchProtection[r.DefaultBranchRef.Name] = BranchProtectionData{
+			Protected:       true,
+			RequiredReviews: rule.RequiredApprovingReviewCount,
+			EnforceAdmins:   rule.IsAdminEnforced,
+		}
+	}
+
+	return state
+}
+
+func (rule *graphQLBranchProtectionRule) toBranchProtectionConfig() BranchProtectionConfig {
+	config := BranchProtectionConfig{
+		RequiredReviews:               rule.RequiredApprovingReviewCount,
+		DismissStaleReviews:           rule.DismissesStaleReviews,
+		RequireCodeOwnerReviews:       rule.RequiresCodeOwnerReviews,
+		StrictStatusChecks:            rule.RequiresStrictStatusChecks,
+		EnforceAdmins:                 rule.IsAdminEnforced,
+		RestrictPushes:                rule.RestrictsPushes,
+		RequireConversationResolution: rule.RequiresConversationResolution,
+		AllowForcePushes:              rule.AllowsForcePushes,
+		AllowDeletions:                rule.AllowsDeletions,
+	}
+
+	if rule.RequiresStatusChecks {
+		config.RequiredStatusChecks = rule.RequiredStatusCheckContexts
+	}
+
+	for _, node := range rule.PushAllowances.Nodes {
+		switch node.Actor.Typename {
+		case "User":
+			config.AllowedUsers = append(config.AllowedUsers, node.Actor.Login)
+		case "Team":
+			config.AllowedTeams = append(config.AllowedTeams, node.Actor.Slug)
+		}
+	}
+
+	return config
+}
@@ -0,0 +1,251 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package github
+
+import (
+	"context"
+	"encoding/json"
+	"net/http"
+	"net/http/httptest"
+	"strings"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+// newGraphQLTestServer answers /graphql for every alias with a protected
+// repository, except "hidden" which resolves to null. REST calls are counted.
+func newGraphQLTestServer(t *testing.T, graphQLCalls, restCalls *atomic.Int32) *httptest.Server {
+	t.Helper()
+
+	return httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		if r.URL.Path != "/graphql" {
+			restCalls.Add(1)
+
+			switch {
+			case strings.HasSuffix(r.URL.Path, "/teams"), strings.HasSuffix(r.URL.Path, "/collaborators"):
+				_, _ = w.Write([]byte(`[]`))
+			default:
+				_, _ = w.Write([]byte(`{"name":"hidden","private":true}`))
+			}
+
+			return
+		}
+
+		graphQLCalls.Add(1)
+
+		var request struct {
+			Query     string            `json:"query"`
+			Variables map[string]string `json:"variables"`
+		}
+		require.NoError(t, json.NewDecoder(r.Body).Decode(&request))
+		assert.Contains(t, request.Query, "fragment repoFields on Repository")
+
+		data := make(map[string]any)
+
+		for key, name := range request.Variables {
+			if key == "owner" {
+				continue
+			}
+
+			alias := "r" + strings.TrimPrefix(key, "n")
+			if name == "hidden" {
+				data[alias] = nil
+				continue
+			}
+
+			data[alias] = map[string]any{
+				"name":               name,
+				"isPrivate":          false,
+				"hasIssuesEnabled":   true,
+				"squashMergeAllowed": true,
+				"updatedAt":          "2026-01-01T00:00:00Z",
+				"repositoryTopics":   map[string]any{"nodes": []any{map[string]any{"topic": map[string]any{"name": "go"}}}},
+				"defaultBranchRef": map[string]any{
+					"name": "main",
+					"branchProtectionRule": map[string]any{
+						"requiredApprovingReviewCount": 2,
+						"isAdminEnforced":              true,
+						"requiresStatusChecks":         true,
+						"requiredStatusCheckContexts":  []string{"ci"},
+						"pushAllowances": map[string]any{"nodes": []any{
+							map[string]any{"actor": map[string]any{"__typename": "Team", "slug": "core"}},
+						}},
+					},
+				},
+				"workflows": map[string]any{"entries": []any{
+					map[string]any{"name": "ci.yml"},
+					map[string]any{"name": "README.md"},
+				}},
+				"file0": map[string]any{"id": "x"},
+				"file1": nil,
+			}
+		}
+
+		_ = json.NewEncoder(w).Encode(map[string]any{
+			"data":   data,
+			"errors": []any{map[string]any{"type": "NOT_FOUND", "message": "not found", "path": []string{"r0"}}},
+		})
+	}))
+}
+
+func TestGraphQLBatchFetcher_FetchStates(t *testing.T) {
+	var graphQLCalls, restCalls atomic.Int32
+
+	server := newGraphQLTestServer(t, &graphQLCalls, &restCalls)
+	defer server.Close()
+
+	client := NewRepoConfigClient("test-token")
+	client.baseURL = server.URL
+
+	repos := []*Repository{{Name: "a"}, {Name: "b", HasDownloads: true}, {Name: "c"}}
+	fetcher := NewGraphQLBatchFetcher(client, 2)
+
+	states, err := fetcher.FetchStates(context.Background(), "acme", repos)
+	require.NoError(t, err)
+	require.Len(t, states, 3)
+
+	assert.Equal(t, int32(2), graphQLCalls.Load()) // 3 repositories in batches of 2
+	assert.Equal(t, int32(0), restCalls.Load())
+
+	state := states["b"]
+	assert.True(t, state.HasIssues)
+	assert.True(t, state.HasDownloads)
+	assert.Equal(t, []string{"README.md"}, state.Files)
+	assert.Equal(t, []string{"ci.yml"}, state.Workflows)
+	assert.Equal(t, BranchProtectionData{Protected: true, RequiredReviews: 2, EnforceAdmins: true}, state.BranchProtection["main"])
+}
+
+func TestGraphQLBatchFetcher_FetchConfigsFallsBackToREST(t *testing.T) {
+	var graphQLCalls, restCalls atomic.Int32
+
+	server := newGraphQLTestServer(t, &graphQLCalls, &restCalls)
+	defer server.Close()
+
+	client := NewRepoConfigClient("test-token")
+	client.baseURL = server.URL
+
+	fetcher := NewGraphQLBatchFetcher(client, 0)
+	fetcher.SetIncludePermissions(false)
+
+	configs, err := fetcher.FetchConfigs(context.Background(), "acme", []*Repository{{Name: "a"}, {Name: "hidden"}})
+	require.NoError(t, err)
+	require.Len(t, configs, 2)
+
+	assert.Equal(t, int32(1), graphQLCalls.Load())
+	assert.Positive(t, restCalls.Load())
+	assert.True(t, configs["hidden"].Private)
+
+	config := configs["a"]
+	assert.Equal(t, []string{"go"}, config.Topics)
+	assert.Equal(t, "main", config.Settings.DefaultBranch)
+	assert.True(t, config.Settings.AllowSquashMerge)
+
+	protection := config.BranchProtection["main"]
+	assert.Equal(t, 2, protection.RequiredReviews)
+	assert.Equal(t, []string{"ci"}, protection.RequiredStatusChecks)
+	assert.Equal(t, []string{"core"}, protection.AllowedTeams)
+}
+
+func TestNewGraphQLBatchFetcher_CapsBatchSize(t *testing.T) {
+	fetcher := NewGraphQLBatchFetcher(NewRepoConfigClient("test-token"), 500)
+	assert.Equal(t, MaxGraphQLBatchSize, fetcher.batchSize)
+}
+
+func TestCollectRepositoryStatesBatched_Concurrent(t *testing.T) {
+	var inFlight, maxInFlight atomic.Int32
+
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		if r.URL.Path != "/graphql" {
+			if r.URL.Query().Get("page") == "1" {
+				_, _ = w.Write([]byte(`[{"name":"a"},{"name":"b"},{"name":"c"},{"name":"d"},{"name":"e"},{"name":"f"}]`))
+			} else {
+				_, _ = w.Write([]byte(`[]`))
+			}
+
+			return
+		}
+
+		current := inFlight.Add(1)
+		defer inFlight.Add(-1)
+
+		for seen := maxInFlight.Load(); current > seen && !maxInFlight.CompareAndSwap(seen, current); seen = maxInFlight.Load() {
+		}
+
+		time.Sleep(50 * time.Millisecond)
+
+		var request struct {
+			Variables map[string]string `json:"variables"`
+		}
+		require.NoError(t, json.NewDecoder(r.Body).Decode(&request))
+
+		_ = json.NewEncoder(w).Encode(map[string]any{
+			"data": map[string]any{"r0": map[string]any{"name": request.Variables["n0"]}},
+		})
+	}))
+	defer server.Close()
+
+	client := NewRepoConfigClient("test-token")
+	client.baseURL = server.URL
+
+	states, err := client.CollectRepositoryStatesWithOptions(context.Background(), "acme", PipelineOptions{
+		Concurrency:      3,
+		GraphQLBatchSize: 1,
+		ListOptions:      &ListOptions{PerPage: 6},
+	})
+	require.NoError(t, err)
+	assert.Len(t, states, 6)
+	assert.Equal(t, "f", states["f"].Name)
+
+	assert.Greater(t, maxInFlight.Load(), int32(1), "batches are queried concurrently")
+	assert.LessOrEqual(t, maxInFlight.Load(), int32(3), "at most Concurrency batches at a time")
+}
+
+func TestCollectRepositoryStatesBatched_FailedBatchFallsBackToREST(t *testing.T) {
+	var graphQLCalls, restCalls atomic.Int32
+
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		switch {
+		case r.URL.Path == "/graphql":
+			graphQLCalls.Add(1)
+			w.WriteHeader(http.StatusBadRequest)
+			_, _ = w.Write([]byte(`{"message":"query too complex"}`))
+		case strings.HasSuffix(r.URL.Path, "/repos"):
+			if r.URL.Query().Get("page") == "1" {
+				_, _ = w.Write([]byte(`[{"name":"a","private":true,"default_branch":"main"},{"name":"b","default_branch":"main"}]`))
+			} else {
+				_, _ = w.Write([]byte(`[]`))
+			}
+		default:
+			restCalls.Add(1)
+			_, _ = w.Write([]byte(`{}`))
+		}
+	}))
+	defer server.Close()
+
+	client := NewRepoConfigClient("test-token")
+	client.baseURL = server.URL
+
+	states, err := client.CollectRepositoryStatesWithOptions(context.Background(), "acme", PipelineOptions{
+		GraphQLBatchSize: 1,
+		ListOptions:      &ListOptions{PerPage: 2},
+	})
+	require.NoError(t, err)
+	require.Len(t, states, 2)
+	assert.True(t, states["a"].Private)
+	assert.Equal(t, "b", states["b"].Name)
+
+	assert.Equal(t, int32(2), graphQLCalls.Load())
+	assert.Positive(t, restCalls.Load())
+}
+
+func TestRepoConfigClient_GraphQLEndpoint(t *testing.T) {
+	client := NewRepoConfigClient("test-token")
+	assert.Equal(t, "https://api.github.com/graphql", client.endpoint(graphQLPath))
+
+	client.SetBaseURL("https://ghe.example.com/api/v3/")
+	assert.Equal(t, "https://ghe.example.com/api/graphql", client.endpoint(graphQLPath))
+	assert.Equal(t, "https://ghe.example.com/api/v3/orgs/acme/repos", client.endpoint("/orgs/acme/repos"))
+}
@@ -0,0 +1,223 @@
+package github
+
+import (
+	"context"
+	"fmt"
+	"maps"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"sort"
+	"strings"
+	"sync"
+	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/workerpool"
+	synclonepkg "github.com/gizzahub/gzh-cli/pkg/synclone"
+)
+
+// incrementalChanges is the work of one incremental sync run: the
+// repositories pushed since the previous run, plus the ones the previous run
+// did not finish.
+type incrementalChanges struct {
+	repos    []string
+	strategy string
+	// watermark is the most recent push time seen in this run's listing
+	watermark time.Time
+	pushedAt  map[string]time.Time
+	// known is the sync state at the start of the run. It is read by the
+	// workers and never modified.
+	known map[string]synclonepkg.RepositorySyncState
+
+	mu      sync.Mutex
+	heads   map[string]string
+	skipped map[string]bool
+}
+
+// prepareIncrementalRun loads or creates the incremental state of an
+// organization and lists the repositories that need processing.
+func (rcm *ResumableCloneManager) prepareIncrementalRun(ctx context.Context, org, targetPath, strategy string, parallel, maxRetries int) (*synclonepkg.CloneState, *incrementalChanges, error) {
+	state := rcm.loadIncrementalState(org, targetPath, strategy, parallel, maxRetries)
+	carryOver := state.BeginIncrementalRun(strategy, parallel, maxRetries)
+
+	changed, err := ListReposPushedSince(ctx, org, state.Watermark)
+	if err != nil {
+		return nil, nil, fmt.Errorf("failed to list repositories: %w", err)
+	}
+
+	if state.Watermark.IsZero() {
+		fmt.Printf("🔍 No previous incremental sync for %s, processing all %d repositories\n", org, len(changed))
+	} else {
+		fmt.Printf("🔍 %d repositories pushed since %s\n", len(changed), state.Watermark.Format(time.RFC3339))
+	}
+
+	changes := &incrementalChanges{
+		strategy:  strategy,
+		watermark: state.Watermark,
+		pushedAt:  make(map[string]time.Time, len(changed)),
+		known:     maps.Clone(state.Repositories),
+		heads:     make(map[string]string),
+		skipped:   make(map[string]bool),
+	}
+
+	seen := make(map[string]bool)
+	add := func(name string) {
+		if !seen[name] {
+			seen[name] = true
+			changes.repos = append(changes.repos, name)
+		}
+	}
+
+	for _, repo := range changed {
+		changes.pushedAt[repo.Name] = repo.PushedAt
+		if repo.PushedAt.After(changes.watermark) {
+			changes.watermark = repo.PushedAt
+		}
+
+		add(repo.Name)
+	}
+
+	for _, name := range carryOver {
+		add(name)
+	}
+
+	// Known repositories whose local clone was removed are cloned again
+	var missing []string
+
+	for name := range state.Repositories {
+		if _, err := os.Stat(filepath.Join(targetPath, name)); os.IsNotExist(err) {
+			missing = append(missing, name)
+		}
+	}
+
+	sort.Strings(missing)
+
+	for _, name := range missing {
+		add(name)
+	}
+
+	state.SetPendingRepositories(changes.repos)
+
+	return state, changes, nil
+}
+
+// loadIncrementalState returns the saved state for the organization if it
+// belongs to the same target path, or a new state otherwise.
+func (rcm *ResumableCloneManager) loadIncrementalState(org, targetPath, strategy string, parallel, maxRetries int) *synclonepkg.CloneState {
+	if rcm.stateManager.HasState("github", org) {
+		state, err := rcm.stateManager.LoadState("github", org)
+		if err == nil && state.TargetPath == targetPath {
+			return state
+		}
+	}
+
+	return synclonepkg.NewCloneState("github", org, targetPath, strategy, parallel, maxRetries)
+}
+
+// wrap returns a job function that skips pulling repositories whose remote
+// HEAD still matches the commit recorded by the previous sync. The check uses
+// `git ls-remote`, which costs one round trip instead of a fetch. With the
+// fetch strategy every branch matters, so repositories are always fetched.
+func (c *incrementalChanges) wrap(fn func(context.Context, workerpool.RepositoryJob) error) func(context.Context, workerpool.RepositoryJob) error {
+	return func(ctx context.Context, job workerpool.RepositoryJob) error {
+		switch {
+		case job.Operation == workerpool.OperationClone:
+			if err := fn(ctx, job); err != nil {
+				return err
+			}
+
+			if head, err := localHeadSHA(ctx, job.Path); err == nil {
+				c.setHead(job.Repository, head)
+			}
+
+			return nil
+
+		case c.strategy == "fetch":
+			return fn(ctx, job)
+		}
+
+		head, err := remoteHeadSHA(ctx, job.Path)
+		if err != nil {
+			// Fall back to syncing the repository
+			return fn(ctx, job)
+		}
+
+		c.setHead(job.Repository, head)
+
+		if known, ok := c.known[job.Repository]; ok && known.HeadSHA == head {
+			c.mu.Lock()
+			c.skipped[job.Repository] = true
+			c.mu.Unlock()
+
+			return nil
+		}
+
+		return fn(ctx, job)
+	}
+}
+
+func (c *incrementalChanges) setHead(repo, head string) {
+	c.mu.Lock()
+	c.heads[repo] = head
+	c.mu.Unlock()
+}
+
+// recordSynced journals the remote state a successfully processed repository
+// was synced to and returns the completion message to record.
+func (c *incrementalChanges) recordSynced(sm *synclonepkg.StateManager, state *synclonepkg.CloneState, repo, message string) string {
+	c.mu.Lock()
+	head := c.heads[repo]
+	skipped := c.skipped[repo]
+	c.mu.Unlock()
+
+	pushedAt, ok := c.pushedAt[repo]
+	if !ok {
+		pushedAt = c.known[repo].PushedAt
+	}
+
+	if err := sm.RecordSynced(state, repo, pushedAt, head); err != nil {
+		fmt.Printf("\n⚠️  Warning: failed to record state: %v\n", err)
+	}
+
+	if skipped {
+		return "Up to date"
+	}
+
+	return message
+}
+
+// remoteHeadSHA returns the commit the origin remote's HEAD points to.
+func remoteHeadSHA(ctx context.Context, repoPath string) (string, error) {
+	output, err := exec.CommandContext(ctx, "git", "-C", repoPath, "ls-remote", "origin", "HEAD").Output()
+	if err != nil {
+		return "", fmt.Errorf("git ls-remote failed: %w", err)
+	}
+
+	sha, _, _ := strings.Cut(strings.TrimSpace(string(output)), "\t")
+	if sha == "" {
+		return "", fmt.Errorf("remote HEAD not found")
+	}
+
+	return sha, nil
+}
+
+// localHeadSHA returns the commit HEAD points to in a local repository.
+func localHeadSHA(ctx context.Context, repoPath string) (string, error) {
+	output, err := exec.CommandContext(ctx, "git", "-C", repoPath, "rev-parse", "HEAD").Output()
+	if err != nil {
+		return "", fmt.Errorf("git rev-parse failed: %w", err)
+	}
+
+	return strings.TrimSpace(string(output)), nil
+}
+
+// RefreshAllIncremental synchronizes an organization incrementally: only
+// repositories pushed since the previous incremental run are listed, and
+// repositories whose remote HEAD is unchanged are not pulled.
+func RefreshAllIncremental(ctx context.Context, targetPath, org, strategy string, parallel, maxRetries int, progressMode string) error {
+	config := DefaultBulkOperationsConfig()
+	manager := NewResumableCloneManager(config)
+	manager.SetIncremental(true)
+
+	return manager.RefreshAllResumable(ctx, targetPath, org, strategy, parallel, maxRetries, false, progressMode)
+}
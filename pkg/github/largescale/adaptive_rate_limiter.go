@@ -4,6 +4,9 @@ import (
 	"context"
 	"sync"
 	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
+	"github.com/gizzahub/gzh-cli/pkg/github/tokenpool"
 )
 
 // AdaptiveRateLimiter provides intelligent rate limiting for GitHub API operations.
@@ -20,6 +23,10 @@ type AdaptiveRateLimiter struct {
 	maxRequestsPerSecond int
 	bufferRatio          float64 // Keep this ratio of requests as buffer
 	adaptiveDelay        bool
+
+	// pool, when set, supplies the combined budget of all its credentials
+	// instead of the single budget reported by response headers
+	pool *tokenpool.Pool
 }
 
 // NewAdaptiveRateLimiter creates a new adaptive rate limiter.
@@ -50,10 +57,14 @@ func (rl *AdaptiveRateLimiter) Wait(ctx context.Context) error {
 	delay := rl.calculateDelay(now)
 
 	if delay > 0 {
+		span := phase.Start(ctx, phase.RateLimitWait)
+
 		select {
 		case <-ctx.Done():
+			span.End(ctx.Err())
 			return ctx.Err()
 		case <-time.After(delay):
+			span.End(nil)
 		}
 	}
 
@@ -96,32 +107,54 @@ func (rl *AdaptiveRateLimiter) UpdateResetTime(resetTime time.Time) {
 	rl.resetTime = resetTime
 }
 
+// SetTokenPool paces requests against the combined budget of pool.
+func (rl *AdaptiveRateLimiter) SetTokenPool(pool *tokenpool.Pool) {
+	rl.mu.Lock()
+	defer rl.mu.Unlock()
+
+	rl.pool = pool
+}
+
+// budget returns the remaining requests and the next reset time.
+func (rl *AdaptiveRateLimiter) budget() (int, time.Time) {
+	if rl.pool.Len() > 0 {
+		remaining, _, reset := rl.pool.Budget(tokenpool.ResourceCore)
+		return remaining, reset
+	}
+
+	return rl.remaining, rl.resetTime
+}
+
 // GetStatus returns current rate limiter status.
 func (rl *AdaptiveRateLimiter) GetStatus() (remaining int, resetTime time.Time, estimatedDelay time.Duration) {
 	rl.mu.RLock()
 	defer rl.mu.RUnlock()
 
-	return rl.remaining, rl.resetTime, rl.calculateDelay(time.Now())
+	remaining, resetTime = rl.budget()
+
+	return remaining, resetTime, rl.calculateDelay(time.Now())
 }
 
 // calculateDelay determines how long to wait before next request.
 func (rl *AdaptiveRateLimiter) calculateDelay(now time.Time) time.Duration {
+	remaining, resetTime := rl.budget()
+
 	// If we're past reset time, no delay needed
-	if now.After(rl.resetTime) {
+	if now.After(resetTime) {
 		return 0
 	}
 
 	// Calculate time until reset
-	timeUntilReset := rl.resetTime.Sub(now)
+	timeUntilReset := resetTime.Sub(now)
 
 	// If no remaining requests, wait until reset
-	if rl.remaining <= 0 {
+	if remaining <= 0 {
 		return timeUntilReset
 	}
 
 	// Keep a buffer of requests
-	bufferRequests := int(float64(rl.remaining) * rl.bufferRatio)
-	effectiveRemaining := rl.remaining - bufferRequests
+	bufferRequests := int(float64(remaining) * rl.bufferRatio)
+	effectiveRemaining := remaining - bufferRequests
 
 	if effectiveRemaining <= 0 {
 		// Use buffer requests very slowly
@@ -230,6 +263,14 @@ func (rl *AdaptiveRateLimiter) EstimateTimeToCompletion(requestsNeeded int) time
 
 	now := time.Now()
 
+	// With a token pool the combined budget of every credential counts
+	if rl.pool.Len() > 0 {
+		remaining, _ := rl.budget()
+		pacing := time.Duration(min(remaining, requestsNeeded)) * rl.calculateDelay(now)
+
+		return pacing + rl.pool.EstimateTimeToCompletion(tokenpool.ResourceCore, requestsNeeded)
+	}
+
 	// If we have enough remaining requests
 	if rl.remaining >= requestsNeeded {
 		// Estimate based on current rate limiting
@@ -15,7 +15,10 @@
 // Example usage:
 //
 //	config := largescale.DefaultLargeScaleConfig()
-//	manager := largescale.NewLargeScaleManager(config, progressCallback)
+//	manager, err := largescale.NewPooledLargeScaleManager(config, progressCallback)
+//	if err != nil {
+//		log.Fatal(err)
+//	}
 //
 //	repos, err := manager.ListAllRepositories(ctx, "organization")
 //	if err != nil {
@@ -3,6 +3,7 @@ package largescale
 import (
 	"context"
 	"encoding/json"
+	"errors"
 	"fmt"
 	"net/http"
 	"net/url"
@@ -11,8 +12,12 @@ import (
 	"sync"
 	"time"
 
-	"golang.org/x/sync/errgroup"
-	"golang.org/x/sync/semaphore"
+	"github.com/gizzahub/gzh-cli/internal/git/objectcache"
+	"github.com/gizzahub/gzh-cli/internal/httpclient"
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
+	"github.com/gizzahub/gzh-cli/internal/workerpool"
+	"github.com/gizzahub/gzh-cli/pkg/git/provider"
+	"github.com/gizzahub/gzh-cli/pkg/github/tokenpool"
 )
 
 // LargeScaleConfig holds configuration for large-scale repository operations.
@@ -59,6 +64,7 @@ type LargeScaleManager struct {
 	config           *LargeScaleConfig
 	client           *http.Client
 	rateLimiter      *AdaptiveRateLimiter
+	tokenPool        *tokenpool.Pool
 	progressCallback ProgressCallback
 	stats            *OperationStats
 }
@@ -84,7 +90,7 @@ func NewLargeScaleManager(config *LargeScaleConfig, progressCallback ProgressCal
 
 	return &LargeScaleManager{
 		config:           config,
-		client:           &http.Client{Timeout: 30 * time.Second},
+		client:           httpclient.GetGlobalClientWithTimeout("github", 30*time.Second),
 		rateLimiter:      NewAdaptiveRateLimiter(),
 		progressCallback: progressCallback,
 		stats: &OperationStats{
@@ -93,48 +99,81 @@ func NewLargeScaleManager(config *LargeScaleConfig, progressCallback ProgressCal
 	}
 }
 
-// ListAllRepositories fetches all repositories from an organization with proper pagination.
+// NewPooledLargeScaleManager creates a manager whose requests are spread over
+// the tokens and GitHub App installations configured in the environment
+// (GITHUB_TOKENS, GZH_GITHUB_APP_*).
+func NewPooledLargeScaleManager(config *LargeScaleConfig, progressCallback ProgressCallback) (*LargeScaleManager, error) {
+	pool, err := tokenpool.FromEnv(getGitHubToken())
+	if err != nil {
+		return nil, fmt.Errorf("failed to configure GitHub tokens: %w", err)
+	}
+
+	manager := NewLargeScaleManager(config, progressCallback)
+	if pool.Len() > 0 {
+		manager.SetTokenPool(pool)
+	}
+
+	return manager, nil
+}
+
+// SetTokenPool authenticates API requests with the credentials of pool and
+// paces them against its combined budget.
+func (m *LargeScaleManager) SetTokenPool(pool *tokenpool.Pool) {
+	client := *m.client
+	client.Transport = pool.Transport(client.Transport)
+
+	m.client = &client
+	m.tokenPool = pool
+	m.rateLimiter.SetTokenPool(pool)
+}
+
+// maxListingConcurrency caps the listing pages requested at once, well below
+// the point where GitHub's secondary rate limits start rejecting requests.
+const maxListingConcurrency = 8
+
+// ListAllRepositories fetches all repositories from an organization. Once the
+// first page reveals the page count, the remaining pages are fetched
+// concurrently, paced by the rate limiter.
 func (m *LargeScaleManager) ListAllRepositories(ctx context.Context, org string) ([]LargeScaleRepository, error) {
+	ctx = phase.WithOperation(ctx, "largescale")
+
 	var allRepos []LargeScaleRepository
 
-	page := 1
 	perPage := m.config.BatchSize
 
-	for {
-		select {
-		case <-ctx.Done():
-			return nil, ctx.Err()
-		default:
-		}
+	fetch := func(ctx context.Context, req provider.PageRequest) ([]LargeScaleRepository, provider.PageInfo, error) {
+		return m.fetchRepositoryPage(ctx, org, req.Page, perPage)
+	}
 
-		// Wait for rate limit if necessary
-		if err := m.rateLimiter.Wait(ctx); err != nil {
-			return nil, fmt.Errorf("rate limit error: %w", err)
-		}
+	opts := provider.PagerOptions{
+		Concurrency: minInt(m.config.MaxConcurrency, maxListingConcurrency),
+		Wait: func(ctx context.Context) error {
+			if err := m.rateLimiter.Wait(ctx); err != nil {
+				return fmt.Errorf("rate limit error: %w", err)
+			}
 
-		repos, hasMore, err := m.fetchRepositoryPage(ctx, org, page, perPage)
-		if err != nil {
-			return nil, fmt.Errorf("failed to fetch page %d: %w", page, err)
-		}
+			return nil
+		},
+	}
 
-		allRepos = append(allRepos, repos...)
-		m.updateStats(len(repos), 0, 0)
+	err := provider.WalkPages(ctx, fetch, opts, func(page provider.Page[LargeScaleRepository]) error {
+		allRepos = append(allRepos, page.Items...)
+		m.updateStats(len(page.Items), 0, 0)
 
 		// Update progress
 		if m.progressCallback != nil {
-			m.progressCallback(len(allRepos), -1, fmt.Sprintf("Fetched page %d (%d repos)", page, len(repos)))
+			m.progressCallback(len(allRepos), -1, fmt.Sprintf("Fetched page %d (%d repos)", page.Number, len(page.Items)))
 		}
 
-		if !hasMore {
-			break
-		}
-
-		page++
-
 		// Check memory usage and trigger GC if necessary
 		if m.shouldTriggerGC(len(allRepos)) {
 			runtime.GC()
 		}
+
+		return nil
+	})
+	if err != nil {
+		return nil, err
 	}
 
 	m.stats.mu.Lock()
@@ -145,10 +184,10 @@ func (m *LargeScaleManager) ListAllRepositories(ctx context.Context, org string)
 }
 
 // fetchRepositoryPage fetches a single page of repositories.
-func (m *LargeScaleManager) fetchRepositoryPage(ctx context.Context, org string, page, perPage int) ([]LargeScaleRepository, bool, error) {
+func (m *LargeScaleManager) fetchRepositoryPage(ctx context.Context, org string, page, perPage int) ([]LargeScaleRepository, provider.PageInfo, error) {
 	u, err := url.Parse(fmt.Sprintf("https://api.github.com/orgs/%s/repos", org))
 	if err != nil {
-		return nil, false, err
+		return nil, provider.PageInfo{}, err
 	}
 
 	q := u.Query()
@@ -160,19 +199,23 @@ func (m *LargeScaleManager) fetchRepositoryPage(ctx context.Context, org string,
 
 	req, err := http.NewRequestWithContext(ctx, "GET", u.String(), nil)
 	if err != nil {
-		return nil, false, err
+		return nil, provider.PageInfo{}, err
 	}
 
-	// Add authentication if available
-	if token := getGitHubToken(); token != "" {
+	// Add authentication if available. With a token pool the transport picks
+	// the credential; a preset header would bypass it.
+	if token := getGitHubToken(); token != "" && m.tokenPool.Len() == 0 {
 		req.Header.Set("Authorization", "token "+token)
 	}
 
 	req.Header.Set("Accept", "application/vnd.github.v3+json")
 
+	span := phase.Start(ctx, phase.APIList)
 	resp, err := m.client.Do(req)
+	span.End(err)
+
 	if err != nil {
-		return nil, false, err
+		return nil, provider.PageInfo{}, fmt.Errorf("failed to fetch page %d: %w", page, err)
 	}
 	defer func() {
 		if err := resp.Body.Close(); err != nil {
@@ -184,21 +227,15 @@ func (m *LargeScaleManager) fetchRepositoryPage(ctx context.Context, org string,
 	m.updateAPIStats(resp)
 
 	if resp.StatusCode != http.StatusOK {
-		return nil, false, fmt.Errorf("GitHub API error: %s", resp.Status)
+		return nil, provider.PageInfo{}, fmt.Errorf("failed to fetch page %d: GitHub API error: %s", page, resp.Status)
 	}
 
 	var repos []LargeScaleRepository
 	if err := json.NewDecoder(resp.Body).Decode(&repos); err != nil {
-		return nil, false, err
-	}
-
-	// Check if there are more pages using Link header
-	hasMore := false
-	if linkHeader := resp.Header.Get("Link"); linkHeader != "" {
-		hasMore = containsNextLink(linkHeader)
+		return nil, provider.PageInfo{}, fmt.Errorf("failed to fetch page %d: %w", page, err)
 	}
 
-	return repos, hasMore, nil
+	return repos, provider.ParsePageInfo(resp.Header), nil
 }
 
 // BulkCloneRepositories clones multiple repositories with optimized concurrency.
@@ -207,11 +244,14 @@ func (m *LargeScaleManager) BulkCloneRepositories(ctx context.Context, repos []L
 		return nil
 	}
 
+	ctx = phase.WithOperation(ctx, "largescale")
+
 	// Calculate optimal concurrency based on available resources
 	concurrency := m.calculateOptimalConcurrency(len(repos))
-	sem := semaphore.NewWeighted(int64(concurrency))
 
-	g, ctx := errgroup.WithContext(ctx)
+	// The first failure cancels the remaining clones
+	ctx, cancel := context.WithCancel(ctx)
+	defer cancel()
 
 	// Progress tracking
 	var (
@@ -242,65 +282,75 @@ func (m *LargeScaleManager) BulkCloneRepositories(ctx context.Context, repos []L
 		}
 	}()
 
-	// Process repositories in batches
+	// Largest repositories are scheduled first so they do not finish last
+	tasks := make([]workerpool.Task[LargeScaleRepository], len(repos))
 	for i, repo := range repos {
-		// Capture loop variable
-		index := i
+		tasks[i] = workerpool.Task[LargeScaleRepository]{
+			Data:     repo,
+			Size:     int64(repo.Size),
+			Resource: workerpool.ResourceGit,
+		}
+	}
 
-		g.Go(func() error {
-			if err := sem.Acquire(ctx, 1); err != nil {
-				return err
-			}
-			defer sem.Release(1)
+	cloneFn := func(ctx context.Context, repo LargeScaleRepository) error {
+		// Check if we should skip this repository
+		if m.shouldSkipRepository(repo) {
+			m.updateStats(0, 0, 1)
+			return nil
+		}
 
-			// Check if we should skip this repository
-			if m.shouldSkipRepository(repo) {
-				m.updateStats(0, 0, 1)
-				return nil
+		// Clone with retry logic
+		var err error
+		for attempt := 0; attempt < m.config.MaxRetries; attempt++ {
+			err = m.cloneRepository(ctx, repo, targetPath)
+			if err == nil {
+				break
 			}
 
-			// Clone with retry logic
-			var err error
-			for attempt := 0; attempt < m.config.MaxRetries; attempt++ {
-				err = m.cloneRepository(ctx, repo, targetPath)
-				if err == nil {
-					break
-				}
-
-				// Wait before retry with exponential backoff
-				if attempt < m.config.MaxRetries-1 {
-					backoff := time.Duration(attempt+1) * time.Second
-					select {
-					case <-time.After(backoff):
-					case <-ctx.Done():
-						return ctx.Err()
-					}
+			// Wait before retry with exponential backoff
+			if attempt < m.config.MaxRetries-1 {
+				backoff := time.Duration(attempt+1) * time.Second
+				select {
+				case <-time.After(backoff):
+				case <-ctx.Done():
+					return ctx.Err()
 				}
 			}
+		}
 
-			mu.Lock()
+		mu.Lock()
 
-			processed++
+		processed++
+		current := processed
 
-			mu.Unlock()
+		mu.Unlock()
 
-			if err != nil {
-				m.updateStats(0, 1, 0)
-				return fmt.Errorf("failed to clone %s after %d attempts: %w", repo.Name, m.config.MaxRetries, err)
-			}
+		// Check memory pressure every 100 repositories
+		if current%100 == 0 && m.shouldTriggerGC(int(current)) {
+			runtime.GC()
+		}
 
-			m.updateStats(1, 0, 0)
+		if err != nil {
+			m.updateStats(0, 1, 0)
+			cancel()
 
-			return nil
-		})
+			return fmt.Errorf("failed to clone %s after %d attempts: %w", repo.Name, m.config.MaxRetries, err)
+		}
 
-		// Check memory pressure every 100 repositories
-		if index%100 == 0 && m.shouldTriggerGC(index) {
-			runtime.GC()
+		m.updateStats(1, 0, 0)
+
+		return nil
+	}
+
+	var firstErr error
+
+	for result := range workerpool.Schedule(ctx, workerpool.SchedulerConfig{Workers: concurrency}, tasks, cloneFn) {
+		if result.Error != nil && (firstErr == nil || errors.Is(firstErr, context.Canceled)) {
+			firstErr = result.Error
 		}
 	}
 
-	return g.Wait()
+	return firstErr
 }
 
 // cloneRepository clones a single repository with optimization.
@@ -315,9 +365,16 @@ func (m *LargeScaleManager) cloneRepository(ctx context.Context, repo LargeScale
 		args = append(args, "--config", "core.compression=9")
 	}
 
+	if m.config.UseShallowClone {
+		args = append(args, objectcache.DefaultStrategy().FilterArgs()...)
+	} else {
+		args = append(args, objectcache.DefaultStrategy().CloneArgs(ctx, repo.CloneURL)...)
+	}
 	args = append(args, repo.CloneURL, targetPath+"/"+repo.Name)
 
-	return executeGitCommand(ctx, args...)
+	return phase.Track(ctx, phase.Clone, func() error {
+		return executeGitCommand(ctx, args...)
+	})
 }
 
 // Helper functions
@@ -419,29 +476,6 @@ func (m *LargeScaleManager) GetStats() OperationStats {
 
 // Utility functions
 
-func containsNextLink(linkHeader string) bool {
-	return len(linkHeader) > 0 && (contains(linkHeader, `rel="next"`) ||
-		contains(linkHeader, `rel="last"`))
-}
-
-func contains(s, substr string) bool {
-	return len(s) >= len(substr) && (s == substr ||
-		(len(s) > len(substr) &&
-			(s[:len(substr)] == substr ||
-				s[len(s)-len(substr):] == substr ||
-				stringContains(s, substr))))
-}
-
-func stringContains(s, substr string) bool {
-	for i := 0; i <= len(s)-len(substr); i++ {
-		if s[i:i+len(substr)] == substr {
-			return true
-		}
-	}
-
-	return false
-}
-
 func minInt(a, b int) int {
 	if a < b {
 		return a
@@ -239,43 +239,6 @@ func TestUtilityFunctions(t *testing.T) {
 	if maxInt(1, 10) != 10 {
 		t.Error("maxInt(1, 10) should be 10")
 	}
-
-	// Test containsNextLink function
-	testCases := []struct {
-		linkHeader string
-		expected   bool
-		name       string
-	}{
-		{
-			linkHeader: `<https://api.github.com/orgs/org/repos?page=2>; rel="next"`,
-			expected:   true,
-			name:       "should detect next link",
-		},
-		{
-			linkHeader: `<https://api.github.com/orgs/org/repos?page=1>; rel="prev"`,
-			expected:   false,
-			name:       "should not detect prev-only link",
-		},
-		{
-			linkHeader: "",
-			expected:   false,
-			name:       "should handle empty link header",
-		},
-		{
-			linkHeader: `<https://api.github.com/orgs/org/repos?page=5>; rel="last"`,
-			expected:   true,
-			name:       "should detect last link",
-		},
-	}
-
-	for _, tc := range testCases {
-		t.Run(tc.name, func(t *testing.T) {
-			result := containsNextLink(tc.linkHeader)
-			if result != tc.expected {
-				t.Errorf("Expected %v for '%s', got %v", tc.expected, tc.linkHeader, result)
-			}
-		})
-	}
 }
 
 func TestContextCancellation(t *testing.T) {
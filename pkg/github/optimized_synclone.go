@@ -12,6 +12,8 @@ import (
 	"github.com/schollz/progressbar/v3"
 
 	"github.com/gizzahub/gzh-cli/internal/git"
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
+	"github.com/gizzahub/gzh-cli/internal/simpleprof"
 	"github.com/gizzahub/gzh-cli/internal/workerpool"
 )
 
@@ -146,6 +148,8 @@ func NewOptimizedSyncCloneManager(token string, config OptimizedCloneConfig) (*O
 
 // RefreshAllOptimized performs optimized bulk repository refresh with streaming and memory management.
 func (m *OptimizedSyncCloneManager) RefreshAllOptimized(ctx context.Context, targetPath, org, strategy string) (*CloneStats, error) {
+	ctx = phase.WithOperation(ctx, "synclone")
+
 	stats := &CloneStats{
 		ErrorDetails: make([]CloneError, 0),
 	}
@@ -164,15 +168,6 @@ func (m *OptimizedSyncCloneManager) RefreshAllOptimized(ctx context.Context, tar
 		return stats, fmt.Errorf("failed to create target directory: %w", err)
 	}
 
-	// Start streaming repositories
-	repoStream, err := m.streamingClient.StreamOrganizationRepositories(ctx, org, m.config.StreamingConfig)
-	if err != nil {
-		return stats, fmt.Errorf("failed to start repository stream: %w", err)
-	}
-
-	// Process repositories in batches
-	batch := make([]*Repository, 0, m.config.BatchSize)
-
 	var progressBar *progressbar.ProgressBar
 
 	if m.config.ShowProgress {
@@ -185,63 +180,67 @@ func (m *OptimizedSyncCloneManager) RefreshAllOptimized(ctx context.Context, tar
 		)
 	}
 
-	for {
-		select {
-		case <-ctx.Done():
-			return stats, fmt.Errorf("operation cancelled: %w", ctx.Err())
-
-		case repoResult, ok := <-repoStream:
-			if !ok {
-				// Stream finished, process remaining batch
-				if len(batch) > 0 {
-					batchStats := m.processBatch(ctx, targetPath, org, strategy, batch, progressBar)
-					m.mergeStats(stats, batchStats)
-				}
+	// Pull repositories page by page and hand each one to the workers as it
+	// is decoded, so the first clones start with the first page
+	jobs := make(chan workerpool.RepositoryJob, max(m.config.PrefetchSize, 1))
 
-				goto finish
-			}
+	var listErr error
 
-			if repoResult.Error != nil {
-				stats.ErrorDetails = append(stats.ErrorDetails, CloneError{
-					Repository:  "stream",
-					Operation:   "fetch",
-					Error:       repoResult.Error,
-					Timestamp:   time.Now(),
-					MemoryUsage: repoResult.Metadata.MemoryUsage,
-				})
+	go func() {
+		defer close(jobs)
 
-				continue
-			}
+		it := m.streamingClient.OrganizationRepositories(ctx, org, m.config.StreamingConfig)
+		defer func() { _ = it.Close() }()
 
-			// Add repository to current batch
-			batch = append(batch, repoResult.Repository)
-			stats.TotalRepositories++
+		for it.Next() {
+			// Update progress bar total once the page count is known
+			if progressBar != nil && it.TotalPages() > 0 {
+				progressBar.ChangeMax(it.TotalPages() * m.config.StreamingConfig.PageSize)
+			}
 
-			// Update progress bar total if we have metadata
-			if progressBar != nil && repoResult.Metadata.TotalPages > 0 {
-				estimatedTotal := repoResult.Metadata.TotalPages * m.config.StreamingConfig.PageSize
-				progressBar.ChangeMax(estimatedTotal)
+			select {
+			case jobs <- m.repositoryJob(targetPath, strategy, it.Repository().Name):
+			case <-ctx.Done():
+				return
 			}
+		}
 
-			// Process batch when it's full
-			if len(batch) >= m.config.BatchSize {
-				batchStats := m.processBatch(ctx, targetPath, org, strategy, batch, progressBar)
-				m.mergeStats(stats, batchStats)
+		listErr = it.Err()
+	}()
+
+	processFn := func(ctx context.Context, job workerpool.RepositoryJob) error {
+		return m.processRepositoryJob(ctx, job, org)
+	}
 
-				// Reset batch
-				batch = batch[:0]
+	for result := range m.workerPool.ScheduleStream(ctx, jobs, processFn) {
+		stats.TotalRepositories++
+		m.recordResult(stats, result, progressBar)
 
-				// Check memory usage and cleanup if needed
-				if err := m.checkAndOptimizeMemory(); err != nil {
-					if m.config.VerboseLogging {
-						fmt.Printf("⚠️ Memory optimization warning: %v\n", err)
-					}
+		// Check memory usage and cleanup if needed
+		if m.config.BatchSize > 0 && stats.TotalRepositories%m.config.BatchSize == 0 {
+			if err := m.checkAndOptimizeMemory(); err != nil {
+				if m.config.VerboseLogging {
+					fmt.Printf("⚠️ Memory optimization warning: %v\n", err)
 				}
 			}
 		}
 	}
 
-finish:
+	if err := ctx.Err(); err != nil {
+		return stats, fmt.Errorf("operation cancelled: %w", err)
+	}
+
+	// The listing goroutine has finished once the results are drained
+	if listErr != nil {
+		stats.ErrorDetails = append(stats.ErrorDetails, CloneError{
+			Repository:  "stream",
+			Operation:   "fetch",
+			Error:       listErr,
+			Timestamp:   time.Now(),
+			MemoryUsage: m.getCurrentMemoryUsage(),
+		})
+	}
+
 	stats.TotalDuration = time.Since(startTime)
 
 	if stats.TotalDuration > 0 {
@@ -275,31 +274,7 @@ func (m *OptimizedSyncCloneManager) processBatch(ctx context.Context, targetPath
 	// Create jobs for each repository
 	jobs := make([]workerpool.RepositoryJob, 0, len(repositories))
 	for _, repo := range repositories {
-		repoPath := filepath.Join(targetPath, repo.Name)
-
-		// Determine operation type
-		var operation workerpool.RepositoryOperation
-		if _, err := os.Stat(repoPath); os.IsNotExist(err) {
-			operation = workerpool.OperationClone
-		} else {
-			switch strategy {
-			case "reset":
-				operation = workerpool.OperationReset
-			case "pull":
-				operation = workerpool.OperationPull
-			case "fetch":
-				operation = workerpool.OperationFetch
-			default:
-				operation = workerpool.OperationPull
-			}
-		}
-
-		jobs = append(jobs, workerpool.RepositoryJob{
-			Repository: repo.Name,
-			Operation:  operation,
-			Path:       repoPath,
-			Strategy:   strategy,
-		})
+		jobs = append(jobs, m.repositoryJob(targetPath, strategy, repo.Name))
 	}
 
 	// Process repositories using worker pool
@@ -307,63 +282,83 @@ func (m *OptimizedSyncCloneManager) processBatch(ctx context.Context, targetPath
 		return m.processRepositoryJob(ctx, job, org)
 	}
 
-	// Submit jobs
-	for _, job := range jobs {
-		if err := m.workerPool.SubmitJob(job, processFn); err != nil {
-			batchStats.ErrorDetails = append(batchStats.ErrorDetails, CloneError{
-				Repository:  job.Repository,
-				Operation:   "submit",
-				Error:       err,
-				Timestamp:   time.Now(),
-				MemoryUsage: m.getCurrentMemoryUsage(),
-			})
-			batchStats.Failed++
-
-			continue
-		}
-	}
-
-	// Collect results
-	resultsChan := m.workerPool.Results()
+	// Schedule jobs on the shared scheduler and collect results
+	resultsChan := m.workerPool.Schedule(ctx, jobs, processFn)
 
 	for i := 0; i < len(jobs); i++ {
 		select {
 		case result := <-resultsChan:
-			if result.Success {
-				batchStats.Successful++
+			m.recordResult(batchStats, result, progressBar)
+		case <-ctx.Done():
+			return batchStats
+		}
+	}
 
-				if m.config.VerboseLogging {
-					fmt.Printf("✅ %s: %s completed\n", result.Job.Repository, result.Job.Operation)
-				}
-			} else {
-				batchStats.Failed++
-				batchStats.ErrorDetails = append(batchStats.ErrorDetails, CloneError{
-					Repository:  result.Job.Repository,
-					Operation:   string(result.Job.Operation),
-					Error:       result.Error,
-					Timestamp:   time.Now(),
-					MemoryUsage: m.getCurrentMemoryUsage(),
-				})
+	return batchStats
+}
 
-				if m.config.VerboseLogging {
-					fmt.Printf("❌ %s: %s failed: %v\n", result.Job.Repository, result.Job.Operation, result.Error)
-				}
-			}
+// repositoryJob returns the job for a repository: a clone when it is not
+// present under targetPath yet, otherwise the update strategy.
+func (m *OptimizedSyncCloneManager) repositoryJob(targetPath, strategy, name string) workerpool.RepositoryJob {
+	repoPath := filepath.Join(targetPath, name)
+
+	// Determine operation type
+	var operation workerpool.RepositoryOperation
+	if _, err := os.Stat(repoPath); os.IsNotExist(err) {
+		operation = workerpool.OperationClone
+	} else {
+		switch strategy {
+		case "reset":
+			operation = workerpool.OperationReset
+		case "pull":
+			operation = workerpool.OperationPull
+		case "fetch":
+			operation = workerpool.OperationFetch
+		default:
+			operation = workerpool.OperationPull
+		}
+	}
 
-			if progressBar != nil {
-				_ = progressBar.Add(1)
-			}
+	return workerpool.RepositoryJob{
+		Repository: name,
+		Operation:  operation,
+		Path:       repoPath,
+		Strategy:   strategy,
+	}
+}
 
-		case <-ctx.Done():
-			return batchStats
+// recordResult adds a job result to stats and advances the progress bar.
+func (m *OptimizedSyncCloneManager) recordResult(stats *CloneStats, result workerpool.RepositoryResult, progressBar *progressbar.ProgressBar) {
+	if result.Success {
+		stats.Successful++
+
+		if m.config.VerboseLogging {
+			fmt.Printf("✅ %s: %s completed\n", result.Job.Repository, result.Job.Operation)
+		}
+	} else {
+		stats.Failed++
+		stats.ErrorDetails = append(stats.ErrorDetails, CloneError{
+			Repository:  result.Job.Repository,
+			Operation:   string(result.Job.Operation),
+			Error:       result.Error,
+			Timestamp:   time.Now(),
+			MemoryUsage: m.getCurrentMemoryUsage(),
+		})
+
+		if m.config.VerboseLogging {
+			fmt.Printf("❌ %s: %s failed: %v\n", result.Job.Repository, result.Job.Operation, result.Error)
 		}
 	}
 
-	return batchStats
+	if progressBar != nil {
+		_ = progressBar.Add(1)
+	}
 }
 
 // processRepositoryJob processes a single repository job.
 func (m *OptimizedSyncCloneManager) processRepositoryJob(ctx context.Context, job workerpool.RepositoryJob, org string) error {
+	defer simpleprof.DefaultFlightRecorder().Begin(fmt.Sprintf("%s %s/%s", job.Operation, org, job.Repository))()
+
 	switch job.Operation {
 	case workerpool.OperationClone:
 		return Clone(ctx, job.Path, org, job.Repository)
@@ -420,6 +415,10 @@ func (m *OptimizedSyncCloneManager) startMemoryMonitoring() {
 					usagePercent*100, threshold*100)
 			}
 
+			// Capture what led up to the pressure before cleaning it up
+			simpleprof.DefaultFlightRecorder().Trigger(fmt.Sprintf("memory usage %.1f%% above threshold %.1f%%",
+				usagePercent*100, threshold*100))
+
 			m.forceMemoryCleanup()
 		}
 	}
@@ -522,6 +521,9 @@ func (m *OptimizedSyncCloneManager) printFinalStats(stats *CloneStats) {
 	fmt.Printf("Total Requests: %d\n", metrics.totalRequests)
 	fmt.Printf("Average Latency: %v\n", metrics.averageLatency)
 	fmt.Printf("Cache Hits: %d\n", metrics.cachedResponses)
+
+	fmt.Printf("\n⏱️ Time by Phase:\n")
+	_ = phase.Default.WriteSummary(os.Stdout, "synclone")
 }
 
 // Close cleans up resources.
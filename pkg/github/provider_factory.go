@@ -32,6 +32,9 @@ func CreateGitHubProvider(config *provider.ProviderConfig) (provider.GitProvider
 
 	// Create resilient client
 	resilientClient := NewResilientGitHubClientWithConfig(config.Token, time.Duration(config.Timeout)*time.Second)
+	if config.BaseURL != "" {
+		resilientClient.SetBaseURL(config.BaseURL)
+	}
 
 	// Create adapter to bridge different interfaces
 	apiClientAdapter := &GitHubAPIClientAdapter{client: resilientClient}
@@ -42,6 +45,14 @@ func CreateGitHubProvider(config *provider.ProviderConfig) (provider.GitProvider
 	// Create the provider
 	gitHubProvider := NewGitHubProvider(apiClientAdapter, cloneService)
 
+	// Stream organization listings so bulk operations start on the first page
+	streamingClient := NewStreamingClient(config.Token, DefaultStreamingConfig())
+	if config.BaseURL != "" {
+		streamingClient.SetBaseURL(config.BaseURL)
+	}
+
+	gitHubProvider.SetStreamingClient(streamingClient)
+
 	// Authenticate if credentials are available
 	if credentials != nil {
 		ctx, cancel := context.WithTimeout(context.Background(), 30*time.Second)
@@ -17,10 +17,15 @@ type GitHubProvider struct {
 	client  APIClient
 	cloner  CloneService
 	helpers *provider.CommonHelpers
+
+	streaming *StreamingClient
 }
 
 // Ensure GitHubProvider implements GitProvider interface
-var _ provider.GitProvider = (*GitHubProvider)(nil)
+var (
+	_ provider.GitProvider        = (*GitHubProvider)(nil)
+	_ provider.RepositoryStreamer = (*GitHubProvider)(nil)
+)
 
 // NewGitHubProvider creates a new GitHub provider instance.
 func NewGitHubProvider(client APIClient, cloner CloneService) *GitHubProvider {
@@ -118,6 +123,77 @@ func (g *GitHubProvider) ListRepositories(ctx context.Context, opts provider.Lis
 	}, nil
 }
 
+// SetStreamingClient enables incremental organization listings through sc.
+func (g *GitHubProvider) SetStreamingClient(sc *StreamingClient) {
+	g.streaming = sc
+}
+
+// StreamRepositories implements provider.RepositoryStreamer. Organization
+// listings are decoded page by page as they are consumed; other listings, or
+// all of them without a streaming client, go through ListRepositories.
+func (g *GitHubProvider) StreamRepositories(ctx context.Context, opts provider.ListOptions) provider.RepositoryIterator {
+	if g.streaming == nil || opts.Organization == "" {
+		return provider.PageRepositories(ctx, g, opts)
+	}
+
+	config := DefaultStreamingConfig()
+	if opts.PerPage > 0 {
+		config.PageSize = opts.PerPage
+	}
+
+	return &providerRepositoryIterator{it: g.streaming.OrganizationRepositories(ctx, opts.Organization, config)}
+}
+
+// providerRepositoryIterator converts a RepositoryIterator to the provider
+// types.
+type providerRepositoryIterator struct {
+	it      *RepositoryIterator
+	current provider.Repository
+}
+
+func (p *providerRepositoryIterator) Next() bool {
+	if !p.it.Next() {
+		return false
+	}
+
+	repo := p.it.Repository()
+	createdAt, _ := time.Parse(time.RFC3339, repo.CreatedAt)
+	updatedAt, _ := time.Parse(time.RFC3339, repo.UpdatedAt)
+
+	p.current = provider.Repository{
+		ID:            repo.FullName,
+		Name:          repo.Name,
+		FullName:      repo.FullName,
+		Description:   repo.Description,
+		DefaultBranch: repo.DefaultBranch,
+		CloneURL:      repo.CloneURL,
+		SSHURL:        repo.SSHURL,
+		HTMLURL:       repo.HTMLURL,
+		Private:       repo.Private,
+		Archived:      repo.Archived,
+		Fork:          repo.Fork,
+		CreatedAt:     createdAt,
+		UpdatedAt:     updatedAt,
+		Language:      repo.Language,
+		Size:          int64(repo.Size),
+		Topics:        repo.Topics,
+	}
+
+	return true
+}
+
+func (p *providerRepositoryIterator) Repository() provider.Repository {
+	return p.current
+}
+
+func (p *providerRepositoryIterator) Err() error {
+	return p.it.Err()
+}
+
+func (p *providerRepositoryIterator) Close() error {
+	return p.it.Close()
+}
+
 // GetRepository retrieves information about a specific repository.
 func (g *GitHubProvider) GetRepository(ctx context.Context, id string) (*provider.Repository, error) {
 	// Parse owner/repo from id
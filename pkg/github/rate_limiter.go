@@ -8,6 +8,8 @@ import (
 	"strconv"
 	"sync"
 	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
 )
 
 // RateLimiter handles GitHub API rate limiting with retry logic.
@@ -40,7 +42,7 @@ func (rl *RateLimiter) Wait(ctx context.Context) error {
 		rl.retryAfter = 0 // Reset after use
 		rl.mu.Unlock()
 
-		if err := sleep(ctx, waitDuration); err != nil {
+		if err := sleepRateLimited(ctx, waitDuration); err != nil {
 			return err
 		}
 
@@ -52,7 +54,7 @@ func (rl *RateLimiter) Wait(ctx context.Context) error {
 		waitDuration := time.Until(rl.resetTime)
 		rl.mu.Unlock()
 
-		if err := sleep(ctx, waitDuration); err != nil {
+		if err := sleepRateLimited(ctx, waitDuration); err != nil {
 			return err
 		}
 
@@ -107,6 +109,14 @@ func (rl *RateLimiter) SetRetryAfter(duration time.Duration) {
 	rl.retryAfter = duration
 }
 
+// RetryAfter returns the pending Retry-After duration, or 0 when none was received.
+func (rl *RateLimiter) RetryAfter() time.Duration {
+	rl.mu.Lock()
+	defer rl.mu.Unlock()
+
+	return rl.retryAfter
+}
+
 // GetStatus returns current rate limit status.
 func (rl *RateLimiter) GetStatus() (int, int, time.Time) {
 	rl.mu.Lock()
@@ -183,6 +193,13 @@ func (e *RetryableError) IsRetryable() bool {
 	return e.AttemptsLeft > 0
 }
 
+// sleepRateLimited sleeps as a rate_limit_wait phase.
+func sleepRateLimited(ctx context.Context, duration time.Duration) error {
+	return phase.Track(ctx, phase.RateLimitWait, func() error {
+		return sleep(ctx, duration)
+	})
+}
+
 // sleep is a context-aware sleep function.
 func sleep(ctx context.Context, duration time.Duration) error {
 	select {
@@ -123,7 +123,7 @@ func TestRateLimiter_Update(t *testing.T) {
 	assert.Equal(t, 42, remaining)
 	assert.Equal(t, 5000, limit)
 	assert.WithinDuration(t, time.Now().Add(30*time.Minute), resetTime, 1*time.Second)
-	assert.Equal(t, 60*time.Second, rl.retryAfter)
+	assert.Equal(t, 60*time.Second, rl.RetryAfter())
 }
 
 func TestCalculateBackoff(t *testing.T) {
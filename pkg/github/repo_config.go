@@ -9,11 +9,15 @@ import (
 	"io"
 	"maps"
 	"net/http"
+	"strings"
 	"sync"
 	"time"
 
 	"golang.org/x/sync/errgroup"
 	"golang.org/x/sync/semaphore"
+
+	"github.com/gizzahub/gzh-cli/internal/httpclient"
+	"github.com/gizzahub/gzh-cli/pkg/github/tokenpool"
 )
 
 const (
@@ -27,6 +31,7 @@ type RepoConfigClient struct {
 	baseURL     string
 	httpClient  HTTPClient
 	rateLimiter *RateLimiter
+	tokenPool   *tokenpool.Pool
 	logger      *ChangeLogger
 }
 
@@ -39,6 +44,8 @@ type Repository struct {
 	Homepage      string   `json:"homepage"`
 	Private       bool     `json:"private"`
 	Archived      bool     `json:"archived"`
+	Fork          bool     `json:"fork"`
+	Size          int      `json:"size"` // in KB
 	HTMLURL       string   `json:"html_url"`
 	CloneURL      string   `json:"clone_url"`
 	SSHURL        string   `json:"ssh_url"`
@@ -179,26 +186,63 @@ func (e *APIError) Error() string {
 // NewRepoConfigClient creates a new GitHub API client for repository configuration.
 func NewRepoConfigClient(token string) *RepoConfigClient {
 	return &RepoConfigClient{
-		token:   token,
-		baseURL: "https://api.github.com",
-		httpClient: NewHTTPClientAdapterWithClient(&http.Client{
-			Timeout: 30 * time.Second,
-		}),
+		token:       token,
+		baseURL:     "https://api.github.com",
+		httpClient:  NewHTTPClientAdapterWithClient(httpclient.GetGlobalClientWithTimeout("github", 30*time.Second)),
 		rateLimiter: NewRateLimiter(),
 	}
 }
 
+// NewPooledRepoConfigClient creates a client whose requests are spread over
+// token and the extra tokens and GitHub App installations configured in the
+// environment (GITHUB_TOKENS, GZH_GITHUB_APP_*).
+func NewPooledRepoConfigClient(token string) (*RepoConfigClient, error) {
+	pool, err := tokenpool.FromEnv(token)
+	if err != nil {
+		return nil, fmt.Errorf("failed to configure GitHub tokens: %w", err)
+	}
+
+	client := NewRepoConfigClient(token)
+	if pool.Len() > 0 {
+		client.SetTokenPool(pool)
+	}
+
+	return client, nil
+}
+
 // SetLogger sets the change logger for this client.
 func (c *RepoConfigClient) SetLogger(logger *ChangeLogger) {
 	c.logger = logger
 }
 
+// SetTokenPool authenticates requests through pool instead of the single
+// token, spreading them over every credential in the pool.
+func (c *RepoConfigClient) SetTokenPool(pool *tokenpool.Pool) {
+	c.tokenPool = pool
+}
+
+// SetBaseURL updates the API base URL (useful for GitHub Enterprise).
+func (c *RepoConfigClient) SetBaseURL(baseURL string) {
+	c.baseURL = strings.TrimSuffix(baseURL, "/")
+}
+
+// endpoint returns the URL of an API path. GitHub Enterprise serves REST
+// under /api/v3 but GraphQL under /api/graphql, so the GraphQL path is
+// resolved against the API root rather than the REST base.
+func (c *RepoConfigClient) endpoint(path string) string {
+	if path == graphQLPath {
+		if root, ok := strings.CutSuffix(c.baseURL, "/v3"); ok && strings.HasSuffix(root, "/api") {
+			return root + graphQLPath
+		}
+	}
+
+	return c.baseURL + path
+}
+
 // SetTimeout configures the HTTP client timeout.
 func (c *RepoConfigClient) SetTimeout(timeout time.Duration) {
 	// If the underlying client is our adapter, recreate it with the new timeout
-	c.httpClient = NewHTTPClientAdapterWithClient(&http.Client{
-		Timeout: timeout,
-	})
+	c.httpClient = NewHTTPClientAdapterWithClient(httpclient.GetGlobalClientWithTimeout("github", timeout))
 }
 
 // makeRequest performs an HTTP request with authentication, rate limiting, and retry logic.
@@ -207,12 +251,20 @@ func (c *RepoConfigClient) makeRequest(ctx context.Context, method, path string,
 	maxRetries := 3
 
 	for retries <= maxRetries {
-		// Wait for rate limit if necessary
-		if err := c.rateLimiter.Wait(ctx); err != nil {
+		var lease *tokenpool.Lease
+
+		if c.tokenPool.Len() > 0 {
+			// The pool picks the credential with the most headroom, waiting
+			// only when all of them are exhausted
+			var err error
+			if lease, err = c.tokenPool.Acquire(ctx, tokenpool.ResourceForPath(path)); err != nil {
+				return nil, fmt.Errorf("rate limit wait failed: %w", err)
+			}
+		} else if err := c.rateLimiter.Wait(ctx); err != nil {
 			return nil, fmt.Errorf("rate limit wait failed: %w", err)
 		}
 
-		url := c.baseURL + path
+		url := c.endpoint(path)
 
 		var bodyReader io.Reader
 
@@ -234,7 +286,10 @@ func (c *RepoConfigClient) makeRequest(ctx context.Context, method, path string,
 		req.Header.Set("Accept", "application/vnd.github.v3+json")
 		req.Header.Set("User-Agent", "gzh-cli/1.0")
 
-		if c.token != "" {
+		switch {
+		case lease != nil:
+			req.Header.Set("Authorization", "token "+lease.Token)
+		case c.token != "":
 			req.Header.Set("Authorization", "token "+c.token)
 		}
 
@@ -249,6 +304,14 @@ func (c *RepoConfigClient) makeRequest(ctx context.Context, method, path string,
 		}
 
 		// Update rate limit information
+		if lease != nil && lease.Observe(resp) && retries < maxRetries {
+			// Rate limited: retry right away with the next credential
+			_ = resp.Body.Close()
+			retries++
+
+			continue
+		}
+
 		c.rateLimiter.Update(resp)
 
 		// Check if we should retry
@@ -260,7 +323,7 @@ func (c *RepoConfigClient) makeRequest(ctx context.Context, method, path string,
 			backoff := CalculateBackoff(retries)
 
 			// Use Retry-After if available and longer than backoff
-			if retryAfter := c.rateLimiter.retryAfter; retryAfter > backoff {
+			if retryAfter := c.rateLimiter.RetryAfter(); retryAfter > backoff {
 				backoff = retryAfter
 			}
 
@@ -304,15 +367,28 @@ func (c *RepoConfigClient) GetRateLimitStatus() (int, int, time.Time) {
 
 // ListRepositories lists all repositories for an organization with pagination.
 func (c *RepoConfigClient) ListRepositories(ctx context.Context, org string, options *ListOptions) ([]*Repository, error) {
-	if options == nil {
-		options = &ListOptions{PerPage: 30}
+	var allRepos []*Repository
+
+	err := c.ForEachRepositoryPage(ctx, org, options, func(repos []*Repository) error {
+		allRepos = append(allRepos, repos...)
+		return nil
+	})
+	if err != nil {
+		return nil, err
 	}
 
-	var allRepos []*Repository
+	return allRepos, nil
+}
 
-	page := 1
+// ForEachRepositoryPage lists repositories for an organization and calls fn for
+// every page as soon as it has been decoded, so callers can start working
+// before the whole organization has been listed.
+func (c *RepoConfigClient) ForEachRepositoryPage(ctx context.Context, org string, options *ListOptions, fn func([]*Repository) error) error {
+	if options == nil {
+		options = &ListOptions{PerPage: 30}
+	}
 
-	for {
+	for page := 1; ; page++ {
 		path := fmt.Sprintf("/orgs/%s/repos?per_page=%d&page=%d", org, options.PerPage, page)
 		if options.Type != "" {
 			path += "&type=" + options.Type
@@ -328,26 +404,27 @@ func (c *RepoConfigClient) ListRepositories(ctx context.Context, org string, opt
 
 		resp, err := c.makeRequest(ctx, "GET", path, nil)
 		if err != nil {
-			return nil, fmt.Errorf("failed to list repositories: %w", err)
+			return fmt.Errorf("failed to list repositories: %w", err)
 		}
-		defer func() { _ = resp.Body.Close() }()
 
 		var repos []*Repository
-		if err := json.NewDecoder(resp.Body).Decode(&repos); err != nil {
-			return nil, fmt.Errorf("failed to decode repositories: %w", err)
+
+		err = json.NewDecoder(resp.Body).Decode(&repos)
+		_ = resp.Body.Close()
+
+		if err != nil {
+			return fmt.Errorf("failed to decode repositories: %w", err)
 		}
 
-		allRepos = append(allRepos, repos...)
+		if err := fn(repos); err != nil {
+			return err
+		}
 
 		// Check if there are more pages
 		if len(repos) < options.PerPage {
-			break
+			return nil
 		}
-
-		page++
 	}
-
-	return allRepos, nil
 }
 
 // GetRepository gets a specific repository.
@@ -0,0 +1,351 @@
+package github
+
+import (
+	"context"
+	"sync"
+
+	"github.com/gizzahub/gzh-cli/pkg/github/largescale"
+)
+
+// DefaultPipelineConcurrency is the number of fetch workers used when none is configured.
+const DefaultPipelineConcurrency = 5
+
+// PipelineOptions configures RunRepositoryPipeline.
+type PipelineOptions struct {
+	// Concurrency is the number of repositories fetched at the same time.
+	Concurrency int
+
+	// RateLimiter paces fetch requests across all workers. Pass the same limiter
+	// to several pipelines to make them share one API budget; nil creates a new one.
+	RateLimiter *largescale.AdaptiveRateLimiter
+
+	// ListOptions controls the organization listing stage.
+	ListOptions *ListOptions
+
+	// Filter drops repositories at the list stage before any per-repo request is made.
+	Filter func(*Repository) bool
+
+	// GraphQLBatchSize, when positive, lets callers that support it resolve
+	// repositories with one GraphQL query per batch instead of per-repo REST calls.
+	GraphQLBatchSize int
+}
+
+// PipelineResult is the outcome of the fetch stage for one repository.
+type PipelineResult[T any] struct {
+	Repository *Repository
+	Value      T
+	Err        error
+}
+
+// RunRepositoryPipeline runs a three-stage list → fetch → handle pipeline for an organization.
+//
+// Repositories are listed page by page and handed to a bounded set of fetch
+// workers as soon as each page arrives. Results are passed to handle in
+// completion order from a single goroutine, so handle may write output or
+// mutate state without locking. Returning an error from handle stops the pipeline.
+func RunRepositoryPipeline[T any](
+	ctx context.Context,
+	client *RepoConfigClient,
+	org string,
+	opts PipelineOptions,
+	fetch func(ctx context.Context, repo *Repository) (T, error),
+	handle func(PipelineResult[T]) error,
+) error {
+	listOpts := opts.ListOptions
+	if listOpts == nil {
+		listOpts = &ListOptions{PerPage: 100}
+	}
+
+	source := func(ctx context.Context, yield func(*Repository) error) error {
+		return client.ForEachRepositoryPage(ctx, org, listOpts, func(repos []*Repository) error {
+			for _, repo := range repos {
+				if opts.Filter != nil && !opts.Filter(repo) {
+					continue
+				}
+
+				if err := yield(repo); err != nil {
+					return err
+				}
+			}
+
+			return nil
+		})
+	}
+
+	return runPipeline(ctx, source, opts.Concurrency, client.adaptiveRateLimiter(opts.RateLimiter), func(limiter *largescale.AdaptiveRateLimiter) {
+		syncAdaptiveLimiter(limiter, client)
+	}, fetch, handle)
+}
+
+// repositorySource produces the repositories of a pipeline, calling yield for
+// each one until yield returns an error.
+type repositorySource func(ctx context.Context, yield func(*Repository) error) error
+
+// runPipeline runs the fetch and handle stages of RunRepositoryPipeline over
+// the repositories produced by source. observe, when set, runs after every fetch
+// to feed observed rate limit headers into the limiter.
+func runPipeline[T any](
+	ctx context.Context,
+	source repositorySource,
+	workers int,
+	limiter *largescale.AdaptiveRateLimiter,
+	observe func(*largescale.AdaptiveRateLimiter),
+	fetch func(ctx context.Context, repo *Repository) (T, error),
+	handle func(PipelineResult[T]) error,
+) error {
+	if workers <= 0 {
+		workers = DefaultPipelineConcurrency
+	}
+
+	if limiter == nil {
+		limiter = largescale.NewAdaptiveRateLimiter()
+	}
+
+	ctx, cancel := context.WithCancel(ctx)
+	defer cancel()
+
+	repoCh := make(chan *Repository, workers*2)
+	resultCh := make(chan PipelineResult[T], workers*2)
+	listErrCh := make(chan error, 1)
+
+	// Stage 1: list
+	go func() {
+		defer close(repoCh)
+
+		listErrCh <- source(ctx, func(repo *Repository) error {
+			select {
+			case repoCh <- repo:
+				return nil
+			case <-ctx.Done():
+				return ctx.Err()
+			}
+		})
+	}()
+
+	// Stage 2: fetch
+	var wg sync.WaitGroup
+
+	for range workers {
+		wg.Add(1)
+
+		go func() {
+			defer wg.Done()
+
+			for repo := range repoCh {
+				result := PipelineResult[T]{Repository: repo}
+
+				if err := limiter.Wait(ctx); err != nil {
+					result.Err = err
+				} else {
+					result.Value, result.Err = fetch(ctx, repo)
+
+					if observe != nil {
+						observe(limiter)
+					}
+				}
+
+				select {
+				case resultCh <- result:
+				case <-ctx.Done():
+					return
+				}
+			}
+		}()
+	}
+
+	go func() {
+		wg.Wait()
+		close(resultCh)
+	}()
+
+	// Stage 3: handle
+	var handleErr error
+
+	for result := range resultCh {
+		if handleErr != nil {
+			continue // drain so workers can exit
+		}
+
+		if err := handle(result); err != nil {
+			handleErr = err
+			cancel()
+		}
+	}
+
+	if handleErr != nil {
+		return handleErr
+	}
+
+	if err := <-listErrCh; err != nil {
+		return err
+	}
+
+	return ctx.Err()
+}
+
+// RunRepositoryBatchPipeline is RunRepositoryPipeline for fetchers that
+// resolve several repositories per request, such as GraphQLBatchFetcher.
+//
+// Each listed page is split into batches of opts.GraphQLBatchSize
+// repositories and up to opts.Concurrency batches are fetched at the same
+// time. When fetchBatch fails or leaves out a repository, that repository is
+// fetched on its own with fetch instead. Results are passed to handle from a
+// single goroutine, as in RunRepositoryPipeline.
+func RunRepositoryBatchPipeline[T any](
+	ctx context.Context,
+	client *RepoConfigClient,
+	org string,
+	opts PipelineOptions,
+	fetchBatch func(ctx context.Context, batch []*Repository) (map[string]T, error),
+	fetch func(ctx context.Context, repo *Repository) (T, error),
+	handle func(PipelineResult[T]) error,
+) error {
+	listOpts := opts.ListOptions
+	if listOpts == nil {
+		listOpts = &ListOptions{PerPage: 100}
+	}
+
+	batchSize := opts.GraphQLBatchSize
+	if batchSize <= 0 {
+		batchSize = DefaultGraphQLBatchSize
+	}
+
+	batchSize = min(batchSize, MaxGraphQLBatchSize)
+
+	workers := opts.Concurrency
+	if workers <= 0 {
+		workers = DefaultPipelineConcurrency
+	}
+
+	limiter := client.adaptiveRateLimiter(opts.RateLimiter)
+
+	ctx, cancel := context.WithCancel(ctx)
+	defer cancel()
+
+	batchCh := make(chan []*Repository, workers)
+	resultCh := make(chan PipelineResult[T], workers*batchSize)
+	listErrCh := make(chan error, 1)
+
+	// Stage 1: list and batch
+	go func() {
+		defer close(batchCh)
+
+		listErrCh <- client.ForEachRepositoryPage(ctx, org, listOpts, func(page []*Repository) error {
+			repos := page
+			if opts.Filter != nil {
+				repos = make([]*Repository, 0, len(page))
+
+				for _, repo := range page {
+					if opts.Filter(repo) {
+						repos = append(repos, repo)
+					}
+				}
+			}
+
+			for start := 0; start < len(repos); start += batchSize {
+				select {
+				case batchCh <- repos[start:min(start+batchSize, len(repos))]:
+				case <-ctx.Done():
+					return ctx.Err()
+				}
+			}
+
+			return nil
+		})
+	}()
+
+	// Stage 2: fetch batches, falling back to single fetches
+	send := func(result PipelineResult[T]) bool {
+		select {
+		case resultCh <- result:
+			return true
+		case <-ctx.Done():
+			return false
+		}
+	}
+
+	var wg sync.WaitGroup
+
+	for range workers {
+		wg.Add(1)
+
+		go func() {
+			defer wg.Done()
+
+			for batch := range batchCh {
+				if err := limiter.Wait(ctx); err != nil {
+					return
+				}
+
+				values, batchErr := fetchBatch(ctx, batch)
+				syncAdaptiveLimiter(limiter, client)
+
+				for _, repo := range batch {
+					result := PipelineResult[T]{Repository: repo}
+
+					value, ok := values[repo.Name]
+					if batchErr == nil && ok {
+						result.Value = value
+					} else {
+						result.Value, result.Err = fetch(ctx, repo)
+					}
+
+					if !send(result) {
+						return
+					}
+				}
+			}
+		}()
+	}
+
+	go func() {
+		wg.Wait()
+		close(resultCh)
+	}()
+
+	// Stage 3: handle
+	var handleErr error
+
+	for result := range resultCh {
+		if handleErr != nil {
+			continue // drain so workers can exit
+		}
+
+		if err := handle(result); err != nil {
+			handleErr = err
+			cancel()
+		}
+	}
+
+	if handleErr != nil {
+		return handleErr
+	}
+
+	if err := <-listErrCh; err != nil {
+		return err
+	}
+
+	return ctx.Err()
+}
+
+// adaptiveRateLimiter returns limiter, or a new limiter paced against the
+// client's token pool when limiter is nil.
+func (c *RepoConfigClient) adaptiveRateLimiter(limiter *largescale.AdaptiveRateLimiter) *largescale.AdaptiveRateLimiter {
+	if limiter != nil {
+		return limiter
+	}
+
+	limiter = largescale.NewAdaptiveRateLimiter()
+	if c.tokenPool.Len() > 0 {
+		limiter.SetTokenPool(c.tokenPool)
+	}
+
+	return limiter
+}
+
+// syncAdaptiveLimiter feeds the rate limit headers observed by the client into the shared limiter.
+func syncAdaptiveLimiter(limiter *largescale.AdaptiveRateLimiter, client *RepoConfigClient) {
+	remaining, _, resetTime := client.GetRateLimitStatus()
+	limiter.UpdateRemaining(remaining)
+	limiter.UpdateResetTime(resetTime)
+}
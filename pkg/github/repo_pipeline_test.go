@@ -0,0 +1,120 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package github
+
+import (
+	"context"
+	"encoding/json"
+	"errors"
+	"fmt"
+	"net/http"
+	"net/http/httptest"
+	"strconv"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+
+	"github.com/gizzahub/gzh-cli/pkg/github/largescale"
+)
+
+// newPipelineTestServer serves total repositories in pages of perPage with an expired rate limit window.
+func newPipelineTestServer(t *testing.T, total, perPage int) *httptest.Server {
+	t.Helper()
+
+	return httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		w.Header().Set("X-RateLimit-Remaining", "5000")
+		w.Header().Set("X-RateLimit-Reset", strconv.FormatInt(time.Now().Add(-time.Minute).Unix(), 10))
+
+		page, _ := strconv.Atoi(r.URL.Query().Get("page"))
+
+		var repos []*Repository
+		for i := (page - 1) * perPage; i < min(page*perPage, total); i++ {
+			repos = append(repos, &Repository{Name: fmt.Sprintf("repo-%d", i), Archived: i%5 == 0})
+		}
+
+		_ = json.NewEncoder(w).Encode(repos)
+	}))
+}
+
+func newPipelineTestLimiter() *largescale.AdaptiveRateLimiter {
+	limiter := largescale.NewAdaptiveRateLimiter()
+	limiter.UpdateResetTime(time.Now().Add(-time.Minute))
+
+	return limiter
+}
+
+func TestRunRepositoryPipeline_BoundedConcurrency(t *testing.T) {
+	server := newPipelineTestServer(t, 23, 10)
+	defer server.Close()
+
+	client := NewRepoConfigClient("test-token")
+	client.baseURL = server.URL
+
+	var inFlight, peak atomic.Int32
+
+	fetch := func(_ context.Context, repo *Repository) (string, error) {
+		current := inFlight.Add(1)
+		defer inFlight.Add(-1)
+
+		for {
+			old := peak.Load()
+			if current <= old || peak.CompareAndSwap(old, current) {
+				break
+			}
+		}
+
+		time.Sleep(5 * time.Millisecond)
+
+		return repo.Name, nil
+	}
+
+	seen := make(map[string]bool)
+
+	err := RunRepositoryPipeline(context.Background(), client, "testorg", PipelineOptions{
+		Concurrency: 3,
+		RateLimiter: newPipelineTestLimiter(),
+		ListOptions: &ListOptions{PerPage: 10},
+		Filter:      func(repo *Repository) bool { return !repo.Archived },
+	}, fetch, func(result PipelineResult[string]) error {
+		require.NoError(t, result.Err)
+		assert.Equal(t, result.Repository.Name, result.Value)
+		seen[result.Value] = true
+
+		return nil
+	})
+
+	require.NoError(t, err)
+	assert.Len(t, seen, 18) // 23 repositories minus 5 archived
+	assert.LessOrEqual(t, peak.Load(), int32(3))
+}
+
+func TestRunRepositoryPipeline_HandleErrorStops(t *testing.T) {
+	server := newPipelineTestServer(t, 50, 10)
+	defer server.Close()
+
+	client := NewRepoConfigClient("test-token")
+	client.baseURL = server.URL
+
+	stop := errors.New("stop")
+	handled := 0
+
+	err := RunRepositoryPipeline(context.Background(), client, "testorg", PipelineOptions{
+		Concurrency: 2,
+		RateLimiter: newPipelineTestLimiter(),
+		ListOptions: &ListOptions{PerPage: 10},
+	}, func(_ context.Context, repo *Repository) (string, error) {
+		return repo.Name, nil
+	}, func(PipelineResult[string]) error {
+		handled++
+		if handled == 3 {
+			return stop
+		}
+
+		return nil
+	})
+
+	require.ErrorIs(t, err, stop)
+	assert.Equal(t, 3, handled)
+}
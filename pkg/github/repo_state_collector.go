@@ -41,16 +41,61 @@ type BranchProtectionData struct {
 
 // CollectRepositoryStates collects state data for all repositories in the organization.
 func (c *RepoConfigClient) CollectRepositoryStates(ctx context.Context, org string) (map[string]RepositoryStateData, error) {
-	repos, err := c.ListRepositories(ctx, org, nil)
+	return c.CollectRepositoryStatesWithOptions(ctx, org, PipelineOptions{GraphQLBatchSize: DefaultGraphQLBatchSize})
+}
+
+// CollectRepositoryStatesWithOptions collects state data using the concurrent
+// repository pipeline configured by opts, or with batched GraphQL queries when
+// opts.GraphQLBatchSize is set. Both honour opts.Concurrency.
+func (c *RepoConfigClient) CollectRepositoryStatesWithOptions(ctx context.Context, org string, opts PipelineOptions) (map[string]RepositoryStateData, error) {
+	if opts.GraphQLBatchSize > 0 {
+		return c.collectRepositoryStatesBatched(ctx, org, opts)
+	}
+
+	states := make(map[string]RepositoryStateData)
+
+	fetch := func(ctx context.Context, repo *Repository) (RepositoryStateData, error) {
+		return c.collectRepositoryState(ctx, org, repo), nil
+	}
+
+	err := RunRepositoryPipeline(ctx, c, org, opts, fetch, func(result PipelineResult[RepositoryStateData]) error {
+		if result.Err != nil {
+			return result.Err
+		}
+
+		states[result.Repository.Name] = result.Value
+
+		return nil
+	})
 	if err != nil {
 		return nil, err
 	}
 
+	return states, nil
+}
+
+// collectRepositoryStatesBatched lists the organization page by page and
+// resolves the pages with GraphQL batch queries instead of per-repo REST calls.
+// Up to opts.Concurrency batches are queried at the same time. Repositories of
+// a batch whose query fails are collected over REST instead.
+func (c *RepoConfigClient) collectRepositoryStatesBatched(ctx context.Context, org string, opts PipelineOptions) (map[string]RepositoryStateData, error) {
+	fetcher := NewGraphQLBatchFetcher(c, opts.GraphQLBatchSize)
 	states := make(map[string]RepositoryStateData)
 
-	for _, repo := range repos {
-		state := c.collectRepositoryState(ctx, org, repo)
-		states[repo.Name] = state
+	fetchBatch := func(ctx context.Context, batch []*Repository) (map[string]RepositoryStateData, error) {
+		return fetcher.FetchStates(ctx, org, batch)
+	}
+
+	fetch := func(ctx context.Context, repo *Repository) (RepositoryStateData, error) {
+		return c.collectRepositoryState(ctx, org, repo), nil
+	}
+
+	err := RunRepositoryBatchPipeline(ctx, c, org, opts, fetchBatch, fetch, func(result PipelineResult[RepositoryStateData]) error {
+		states[result.Repository.Name] = result.Value
+		return nil
+	})
+	if err != nil {
+		return nil, err
 	}
 
 	return states, nil
@@ -110,18 +155,7 @@ func getBranchProtectionRequiredReviews(protection *BranchProtection) int {
 func (c *RepoConfigClient) checkForFiles(ctx context.Context, org, repoName string) []string {
 	var foundFiles []string
 
-	// List of files to check
-	filesToCheck := []string{
-		"README.md",
-		"LICENSE",
-		"SECURITY.md",
-		"CONTRIBUTING.md",
-		"CODE_OF_CONDUCT.md",
-		".github/CODEOWNERS",
-		"COMPLIANCE.md",
-	}
-
-	for _, file := range filesToCheck {
+	for _, file := range stateFilesToCheck {
 		// Skip file checking for now since we'd need to implement GetContents
 		// or use the existing HTTP client directly
 		// This is a placeholder that should be implemented with proper API calls
@@ -0,0 +1,317 @@
+package github
+
+import (
+	"bytes"
+	"context"
+	"encoding/json"
+	"errors"
+	"fmt"
+	"net/http"
+	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
+	"github.com/gizzahub/gzh-cli/pkg/git/provider"
+)
+
+// RepositoryIterator pulls an organization's repositories one at a time.
+// Pages are requested only when the previous one is used up, so memory use
+// stays bounded by one page however large the organization is.
+//
+// Each page is read completely before its first repository is returned and
+// is then decoded element by element. Consumers may take as long as they like
+// between calls to Next: no response body is held open while they work, so
+// slow consumers cannot trip the HTTP client's overall timeout.
+//
+// The repository returned by Repository is reused by the next call to Next;
+// callers that keep it past that call must take it with TakeRepository.
+type RepositoryIterator struct {
+	sc     *StreamingClient
+	ctx    context.Context
+	config StreamingConfig
+
+	nextURL    string
+	page       int
+	totalPages int
+
+	buf     []byte
+	decoder *json.Decoder
+
+	current *Repository
+	err     error
+	done    bool
+}
+
+// OrganizationRepositories returns an iterator over the repositories of org.
+// Close must be called if the iteration is abandoned before Next returns false.
+func (sc *StreamingClient) OrganizationRepositories(ctx context.Context, org string, config StreamingConfig) *RepositoryIterator {
+	return &RepositoryIterator{
+		sc:      sc,
+		ctx:     ctx,
+		config:  config,
+		nextURL: sc.buildRepositoryURL(org, CursorPagination{First: config.PageSize}),
+	}
+}
+
+// Next advances to the next repository and reports whether there is one.
+func (it *RepositoryIterator) Next() bool {
+	if it.done {
+		return false
+	}
+
+	it.recycle()
+
+	for {
+		if it.decoder == nil {
+			if it.nextURL == "" {
+				it.finish(nil)
+				return false
+			}
+
+			if err := it.openPage(); err != nil {
+				it.finish(err)
+				return false
+			}
+		}
+
+		if !it.decoder.More() {
+			// Consume the closing bracket and move on to the next page
+			if _, err := it.decoder.Token(); err != nil {
+				it.finish(fmt.Errorf("failed to decode page %d: %w", it.page, err))
+				return false
+			}
+
+			it.closePage()
+
+			continue
+		}
+
+		repo, ok := it.sc.memoryPool.repositoryPool.Get().(*Repository)
+		if !ok {
+			repo = &Repository{}
+		}
+
+		if err := it.decoder.Decode(repo); err != nil {
+			*repo = Repository{}
+			it.sc.memoryPool.repositoryPool.Put(repo)
+
+			// A type mismatch consumes the whole element; skip it like before
+			var typeErr *json.UnmarshalTypeError
+			if errors.As(err, &typeErr) {
+				continue
+			}
+
+			it.finish(fmt.Errorf("failed to decode page %d: %w", it.page, err))
+
+			return false
+		}
+
+		it.current = repo
+
+		return true
+	}
+}
+
+// Repository returns the current repository. It is only valid until the next
+// call to Next.
+func (it *RepositoryIterator) Repository() *Repository {
+	return it.current
+}
+
+// TakeRepository returns the current repository and hands ownership to the
+// caller, so it is not reused by the next call to Next.
+func (it *RepositoryIterator) TakeRepository() *Repository {
+	repo := it.current
+	it.current = nil
+
+	return repo
+}
+
+// Page returns the page number of the current repository.
+func (it *RepositoryIterator) Page() int {
+	return it.page
+}
+
+// TotalPages returns the number of pages announced by the API, or 0 when the
+// listing has a single page or the API did not say.
+func (it *RepositoryIterator) TotalPages() int {
+	return it.totalPages
+}
+
+// Err returns the error that stopped the iteration, if any.
+func (it *RepositoryIterator) Err() error {
+	return it.err
+}
+
+// Close releases the buffer of the current page.
+func (it *RepositoryIterator) Close() error {
+	it.recycle()
+	it.finish(nil)
+
+	return nil
+}
+
+// recycle returns the previous repository to the pool.
+func (it *RepositoryIterator) recycle() {
+	if it.current != nil {
+		*it.current = Repository{}
+		it.sc.memoryPool.repositoryPool.Put(it.current)
+		it.current = nil
+	}
+}
+
+func (it *RepositoryIterator) finish(err error) {
+	it.closePage()
+	it.done = true
+
+	if it.err == nil {
+		it.err = err
+	}
+}
+
+// openPage requests and reads the next page and positions the decoder on its
+// first element.
+func (it *RepositoryIterator) openPage() error {
+	if err := it.ctx.Err(); err != nil {
+		return err
+	}
+
+	// Check memory usage before proceeding
+	if err := it.sc.checkMemoryLimit(it.config.MemoryLimit); err != nil {
+		return fmt.Errorf("memory limit exceeded: %w", err)
+	}
+
+	if err := it.sc.waitForRateLimit(it.ctx, it.config.RateLimitBuffer); err != nil {
+		return fmt.Errorf("rate limit check failed: %w", err)
+	}
+
+	it.page++
+
+	// Trigger pool cleanup periodically
+	if it.page%10 == 0 {
+		it.sc.optimizeMemory()
+	}
+
+	span := phase.Start(it.ctx, phase.APIList)
+	resp, err := it.sc.getRepositoryPage(it.ctx, it.nextURL)
+	span.End(err)
+
+	if err != nil {
+		return fmt.Errorf("failed to fetch page %d: %w", it.page, err)
+	}
+
+	info := provider.ParsePageInfo(resp.Header)
+	it.nextURL = info.NextURL
+
+	if info.TotalPages > 0 {
+		it.totalPages = info.TotalPages
+	}
+
+	buf, err := it.sc.memoryPool.readPage(resp.Body)
+	_ = resp.Body.Close()
+
+	if err != nil {
+		return fmt.Errorf("failed to read page %d: %w", it.page, err)
+	}
+
+	it.buf = buf
+	it.decoder = json.NewDecoder(bytes.NewReader(buf))
+
+	if err := seekRepositoryArray(it.decoder); err != nil {
+		return fmt.Errorf("failed to decode page %d: %w", it.page, err)
+	}
+
+	return nil
+}
+
+func (it *RepositoryIterator) closePage() {
+	if it.buf != nil {
+		it.sc.memoryPool.putPage(it.buf)
+		it.buf = nil
+	}
+
+	it.decoder = nil
+}
+
+// seekRepositoryArray consumes tokens up to the opening bracket of the
+// repository array: the response itself for /orgs/{org}/repos, or the items
+// field of a search response.
+func seekRepositoryArray(decoder *json.Decoder) error {
+	tok, err := decoder.Token()
+	if err != nil {
+		return err
+	}
+
+	switch tok {
+	case json.Delim('['):
+		return nil
+	case json.Delim('{'):
+	default:
+		return fmt.Errorf("unexpected token %v", tok)
+	}
+
+	for decoder.More() {
+		key, err := decoder.Token()
+		if err != nil {
+			return err
+		}
+
+		if key == "items" {
+			tok, err := decoder.Token()
+			if err != nil {
+				return err
+			}
+
+			if tok != json.Delim('[') {
+				return fmt.Errorf("items is not an array")
+			}
+
+			return nil
+		}
+
+		// Skip the value of any other field
+		var skip json.RawMessage
+		if err := decoder.Decode(&skip); err != nil {
+			return err
+		}
+	}
+
+	return fmt.Errorf("response has no items array")
+}
+
+// getRepositoryPage requests one listing page and returns the response with
+// its body still unread.
+func (sc *StreamingClient) getRepositoryPage(ctx context.Context, pageURL string) (*http.Response, error) {
+	req, err := http.NewRequestWithContext(ctx, http.MethodGet, pageURL, nil)
+	if err != nil {
+		return nil, fmt.Errorf("failed to create request: %w", err)
+	}
+
+	// Set headers
+	if sc.token != "" {
+		req.Header.Set("Authorization", "Bearer "+sc.token)
+	}
+
+	req.Header.Set("Accept", "application/vnd.github+json")
+	req.Header.Set("X-GitHub-Api-Version", "2022-11-28")
+
+	// Execute request
+	startTime := time.Now()
+
+	resp, err := sc.httpClient.Do(req)
+	if err != nil {
+		return nil, fmt.Errorf("request failed: %w", err)
+	}
+
+	// Update metrics
+	sc.updateRequestMetrics(time.Since(startTime))
+
+	// Update rate limit info
+	sc.updateRateLimit(resp.Header)
+
+	if resp.StatusCode != http.StatusOK {
+		_ = resp.Body.Close()
+		return nil, fmt.Errorf("API request failed: %s", resp.Status)
+	}
+
+	return resp, nil
+}
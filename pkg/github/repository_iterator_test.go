@@ -0,0 +1,131 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package github
+
+import (
+	"context"
+	"fmt"
+	"net/http"
+	"net/http/httptest"
+	"strings"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func newTestStreamingClient(t *testing.T, handler http.HandlerFunc) *StreamingClient {
+	t.Helper()
+
+	server := httptest.NewServer(handler)
+	t.Cleanup(server.Close)
+
+	sc := NewStreamingClient("", DefaultStreamingConfig())
+	sc.baseURL = server.URL
+	sc.httpClient = server.Client()
+
+	return sc
+}
+
+func TestRepositoryIterator_FollowsLinkHeader(t *testing.T) {
+	var sc *StreamingClient
+
+	sc = newTestStreamingClient(t, func(w http.ResponseWriter, r *http.Request) {
+		assert.Equal(t, "/orgs/acme/repos", r.URL.Path)
+
+		switch r.URL.Query().Get("page") {
+		case "":
+			w.Header().Set("Link", fmt.Sprintf(`<%s/orgs/acme/repos?page=2>; rel="next", <%s/orgs/acme/repos?page=2>; rel="last"`, sc.baseURL, sc.baseURL))
+			fmt.Fprint(w, `[{"name":"one","size":10},{"name":"bad","size":"huge"},{"name":"two","fork":true}]`)
+		case "2":
+			fmt.Fprint(w, `[{"name":"three"}]`)
+		default:
+			t.Errorf("unexpected page %q", r.URL.Query().Get("page"))
+		}
+	})
+
+	it := sc.OrganizationRepositories(context.Background(), "acme", DefaultStreamingConfig())
+	defer func() { _ = it.Close() }()
+
+	var names []string
+
+	for it.Next() {
+		repo := it.TakeRepository()
+		names = append(names, repo.Name)
+
+		if repo.Name == "one" {
+			assert.Equal(t, 10, repo.Size)
+			assert.Equal(t, 2, it.TotalPages())
+		}
+
+		if repo.Name == "two" {
+			assert.True(t, repo.Fork)
+		}
+	}
+
+	require.NoError(t, it.Err())
+	// The element with a mismatched type is skipped
+	assert.Equal(t, []string{"one", "two", "three"}, names)
+	assert.Equal(t, 2, it.Page())
+}
+
+func TestRepositoryIterator_SearchItems(t *testing.T) {
+	sc := newTestStreamingClient(t, func(w http.ResponseWriter, _ *http.Request) {
+		fmt.Fprint(w, `{"total_count":2,"incomplete_results":false,"items":[{"name":"a"},{"name":"b"}]}`)
+	})
+
+	it := sc.OrganizationRepositories(context.Background(), "acme", DefaultStreamingConfig())
+
+	var names []string
+	for it.Next() {
+		names = append(names, it.Repository().Name)
+	}
+
+	require.NoError(t, it.Err())
+	assert.Equal(t, []string{"a", "b"}, names)
+}
+
+func TestRepositoryIterator_HTTPError(t *testing.T) {
+	sc := newTestStreamingClient(t, func(w http.ResponseWriter, _ *http.Request) {
+		http.Error(w, "not found", http.StatusNotFound)
+	})
+
+	it := sc.OrganizationRepositories(context.Background(), "missing", DefaultStreamingConfig())
+
+	assert.False(t, it.Next())
+	require.Error(t, it.Err())
+	assert.Contains(t, it.Err().Error(), "404")
+	assert.False(t, it.Next())
+}
+
+func TestRepositoryIterator_SlowConsumerOutlivesClientTimeout(t *testing.T) {
+	const repos = 2000
+
+	sc := newTestStreamingClient(t, func(w http.ResponseWriter, _ *http.Request) {
+		// Large enough that the page cannot sit in a read buffer
+		items := make([]string, repos)
+		for i := range items {
+			items[i] = fmt.Sprintf(`{"name":"repo-%d","description":%q}`, i, strings.Repeat("x", 200))
+		}
+
+		fmt.Fprint(w, "["+strings.Join(items, ",")+"]")
+	})
+	sc.httpClient.Timeout = 100 * time.Millisecond
+
+	it := sc.OrganizationRepositories(context.Background(), "acme", DefaultStreamingConfig())
+	defer func() { _ = it.Close() }()
+
+	count := 0
+
+	for it.Next() {
+		if count == 0 {
+			// A consumer busy cloning must not time out the page read
+			time.Sleep(200 * time.Millisecond)
+		}
+
+		count++
+	}
+
+	require.NoError(t, it.Err())
+	assert.Equal(t, repos, count)
+}
@@ -8,6 +8,8 @@ import (
 	"strconv"
 	"strings"
 	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/httpclient"
 )
 
 // ResilientGitHubClient provides GitHub API operations with network resilience - DISABLED (recovery package removed)
@@ -22,11 +24,9 @@ type ResilientGitHubClient struct {
 // Simple HTTP client implementation to replace deleted recovery package.
 func NewResilientGitHubClient(token string) *ResilientGitHubClient {
 	return &ResilientGitHubClient{
-		httpClient: &http.Client{
-			Timeout: 30 * time.Second,
-		},
-		baseURL: "https://api.github.com",
-		token:   token,
+		httpClient: httpclient.GetGlobalClientWithTimeout("github", 30*time.Second),
+		baseURL:    "https://api.github.com",
+		token:      token,
 	}
 }
 
@@ -38,11 +38,9 @@ func NewResilientGitHubClientWithConfig(token string, timeout time.Duration) *Re
 	}
 
 	return &ResilientGitHubClient{
-		httpClient: &http.Client{
-			Timeout: timeout,
-		},
-		baseURL: "https://api.github.com",
-		token:   token,
+		httpClient: httpclient.GetGlobalClientWithTimeout("github", timeout),
+		baseURL:    "https://api.github.com",
+		token:      token,
 	}
 }
 
@@ -10,6 +10,7 @@ import (
 	"strings"
 	"time"
 
+	"github.com/gizzahub/gzh-cli/internal/profiling/phase"
 	"github.com/gizzahub/gzh-cli/internal/workerpool"
 	synclonepkg "github.com/gizzahub/gzh-cli/pkg/synclone"
 )
@@ -18,6 +19,7 @@ import (
 type ResumableCloneManager struct {
 	stateManager *synclonepkg.StateManager
 	config       BulkOperationsConfig
+	incremental  bool
 }
 
 // NewResumableCloneManager creates a new resumable clone manager.
@@ -28,33 +30,64 @@ func NewResumableCloneManager(config BulkOperationsConfig) *ResumableCloneManage
 	}
 }
 
+// SetIncremental enables incremental mode. An incremental run only lists the
+// repositories pushed since the previous run's watermark, skips fetching
+// repositories whose remote HEAD is unchanged, and keeps its state after
+// completion for the next run.
+func (rcm *ResumableCloneManager) SetIncremental(incremental bool) {
+	rcm.incremental = incremental
+}
+
 // RefreshAllResumable performs bulk repository refresh with resumable support.
 func (rcm *ResumableCloneManager) RefreshAllResumable(ctx context.Context, targetPath, org, strategy string, parallel, maxRetries int, resume bool, progressMode string) error {
+	ctx = phase.WithOperation(ctx, "synclone_resumable")
+
 	// Initialize or load state
 	// 상태파일을 타겟 디렉토리 하위에 저장하도록 상태 매니저 경로를 설정
 	rcm.stateManager = synclonepkg.NewStateManager(filepath.Join(targetPath, ".gzh", "state"))
-	state, err := rcm.initializeOrLoadState(org, targetPath, strategy, parallel, maxRetries, resume)
-	if err != nil {
-		return err
-	}
+	defer func() { _ = rcm.stateManager.Close() }()
+
+	var (
+		state                    *synclonepkg.CloneState
+		allRepos, reposToProcess []string
+		changes                  *incrementalChanges
+		err                      error
+	)
+
+	if rcm.incremental {
+		state, changes, err = rcm.prepareIncrementalRun(ctx, org, targetPath, strategy, parallel, maxRetries)
+		if err != nil {
+			return err
+		}
 
-	// Get repositories and determine processing list
-	allRepos, reposToProcess, err := rcm.prepareRepositoryList(ctx, org, state, resume)
-	if err != nil {
-		return err
+		allRepos, reposToProcess = changes.repos, changes.repos
+	} else {
+		state, err = rcm.initializeOrLoadState(org, targetPath, strategy, parallel, maxRetries, resume)
+		if err != nil {
+			return err
+		}
+
+		// Get repositories and determine processing list
+		allRepos, reposToProcess, err = rcm.prepareRepositoryList(ctx, org, state, resume)
+		if err != nil {
+			return err
+		}
 	}
 
 	if len(reposToProcess) == 0 {
 		fmt.Printf("✅ All repositories already processed\n")
+		if changes != nil {
+			state.AdvanceWatermark(changes.watermark)
+		}
 		state.MarkCompleted()
-		_ = rcm.stateManager.SaveState(state) //nolint:errcheck // State save is best effort
+		_ = rcm.saveState(ctx, state) //nolint:errcheck // State save is best effort
 		return nil
 	}
 
 	fmt.Printf("📦 Processing %d repositories (%d remaining)\n", len(allRepos), len(reposToProcess))
 
 	// Save initial state
-	if err := rcm.stateManager.SaveState(state); err != nil {
+	if err := rcm.saveState(ctx, state); err != nil {
 		return fmt.Errorf("failed to save state: %w", err)
 	}
 
@@ -137,6 +170,10 @@ func (rcm *ResumableCloneManager) RefreshAllResumable(ctx context.Context, targe
 		return processRepositoryJob(ctx, job, org)
 	}
 
+	if changes != nil {
+		processFn = changes.wrap(processFn)
+	}
+
 	// Submit jobs and collect results
 	resultsChan := pool.Results()
 
@@ -166,12 +203,20 @@ func (rcm *ResumableCloneManager) RefreshAllResumable(ctx context.Context, targe
 			processed++
 			if result.Error != nil {
 				failureCount++
-				state.AddFailedRepository(result.Job.Repository, result.Job.Path, string(result.Job.Operation), result.Error.Error(), 1)
+				if err := rcm.stateManager.RecordFailed(state, result.Job.Repository, result.Job.Path, string(result.Job.Operation), result.Error.Error(), 1); err != nil {
+					fmt.Printf("\n⚠️  Warning: failed to record state: %v\n", err)
+				}
 				progressTracker.SetRepositoryError(result.Job.Repository, result.Error.Error())
 			} else {
 				successCount++
-				state.AddCompletedRepository(result.Job.Repository, result.Job.Path, string(result.Job.Operation), result.Message)
-				progressTracker.CompleteRepository(result.Job.Repository, result.Message)
+				message := result.Message
+				if changes != nil {
+					message = changes.recordSynced(rcm.stateManager, state, result.Job.Repository, message)
+				}
+				if err := rcm.stateManager.RecordCompleted(state, result.Job.Repository, result.Job.Path, string(result.Job.Operation), message); err != nil {
+					fmt.Printf("\n⚠️  Warning: failed to record state: %v\n", err)
+				}
+				progressTracker.CompleteRepository(result.Job.Repository, message)
 			}
 
 		case <-progressUpdateTicker.C:
@@ -180,14 +225,14 @@ func (rcm *ResumableCloneManager) RefreshAllResumable(ctx context.Context, targe
 
 		case <-stateSaveTicker.C:
 			// Periodically save state
-			if err := rcm.stateManager.SaveState(state); err != nil {
+			if err := rcm.saveState(ctx, state); err != nil {
 				fmt.Printf("\n⚠️  Warning: failed to save state: %v\n", err)
 			}
 
 		case <-ctx.Done():
 			// Operation cancelled
 			state.MarkCancelled()
-			if err := rcm.stateManager.SaveState(state); err != nil {
+			if err := rcm.saveState(ctx, state); err != nil {
 				fmt.Printf("\n⚠️  Warning: failed to save state: %v\n", err)
 			}
 
@@ -197,7 +242,12 @@ func (rcm *ResumableCloneManager) RefreshAllResumable(ctx context.Context, targe
 	// Final progress update
 	fmt.Printf("\r\033[K%s\n", progressTracker.RenderProgress())
 
-	// Final state update
+	// Final state update. Repositories that failed are carried over by the
+	// next incremental run, so the watermark can advance regardless.
+	if changes != nil {
+		state.AdvanceWatermark(changes.watermark)
+	}
+
 	if len(state.GetRemainingRepositories()) == 0 {
 		state.MarkCompleted()
 	} else {
@@ -205,16 +255,21 @@ func (rcm *ResumableCloneManager) RefreshAllResumable(ctx context.Context, targe
 	}
 
 	// Save final state
-	if err := rcm.stateManager.SaveState(state); err != nil {
+	if err := rcm.saveState(ctx, state); err != nil {
 		fmt.Printf("⚠️  Warning: failed to save final state: %v\n", err)
 	}
 
 	// Skip detailed summary to avoid duplication
 
-	// Clean up state file if completed successfully
+	// Clean up state file if completed successfully. Incremental states hold
+	// the watermark for the next run and are kept.
 	if state.Status == "completed" {
-		_ = rcm.stateManager.DeleteState("github", org)
+		if !rcm.incremental {
+			_ = rcm.stateManager.DeleteState("github", org)
+		}
 		fmt.Printf("✅ Clone operation completed successfully\n")
+	} else if rcm.incremental {
+		fmt.Printf("⚠️  Clone operation incomplete. Failed repositories are retried by the next incremental run\n")
 	} else {
 		fmt.Printf("⚠️  Clone operation incomplete. Use --resume to continue\n")
 	}
@@ -228,6 +283,13 @@ func (rcm *ResumableCloneManager) RefreshAllResumable(ctx context.Context, targe
 	return nil
 }
 
+// saveState persists state as a state_save phase of the run.
+func (rcm *ResumableCloneManager) saveState(ctx context.Context, state *synclonepkg.CloneState) error {
+	return phase.Track(ctx, phase.StateSave, func() error {
+		return rcm.stateManager.SaveState(state)
+	})
+}
+
 // initializeOrLoadState handles state initialization and loading for resume operations.
 func (rcm *ResumableCloneManager) initializeOrLoadState(org, targetPath, strategy string, parallel, maxRetries int, resume bool) (*synclonepkg.CloneState, error) {
 	if resume {
@@ -261,11 +323,11 @@ func (rcm *ResumableCloneManager) createNewState(org, targetPath, strategy strin
 	if rcm.stateManager.HasState("github", org) {
 		// Load existing state to check if it's for the same target path
 		existingState, err := rcm.stateManager.LoadState("github", org)
-		if err == nil && existingState.TargetPath == targetPath {
-			// If it's the same target path, suggest using --resume
+		if err == nil && existingState.TargetPath == targetPath && existingState.Status != "completed" {
+			// If it's an unfinished run for the same target path, suggest using --resume
 			return nil, fmt.Errorf("existing state found for %s at %s. Use --resume to continue or 'gz synclone state clean --all' to start fresh", org, targetPath)
 		}
-		// Different target path, clean up old state
+		// Different target path or a finished run, clean up old state
 		_ = rcm.stateManager.DeleteState("github", org)
 	}
 
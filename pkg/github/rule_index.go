@@ -0,0 +1,312 @@
+package github
+
+import (
+	"context"
+	"sort"
+	"sync"
+)
+
+// ruleDispatchKey identifies a dispatch bucket. An empty field matches any
+// event type or action, mirroring rules that leave EventTypes or Actions unset.
+type ruleDispatchKey struct {
+	eventType string
+	action    string
+}
+
+// orgRuleIndex holds the enabled rules of one organization bucketed by the
+// event types and actions they listen to.
+type orgRuleIndex struct {
+	// keys records the buckets each rule was added to, since rules may be
+	// mutated in place before they are re-indexed.
+	keys    map[string][]ruleDispatchKey
+	buckets map[ruleDispatchKey]map[string]*AutomationRule
+	// unbucketed holds rules whose match does not require the event conditions
+	// to pass (OR/NOT logical operators); they are candidates for every event.
+	unbucketed map[string]*AutomationRule
+}
+
+func newOrgRuleIndex() *orgRuleIndex {
+	return &orgRuleIndex{
+		keys:       make(map[string][]ruleDispatchKey),
+		buckets:    make(map[ruleDispatchKey]map[string]*AutomationRule),
+		unbucketed: make(map[string]*AutomationRule),
+	}
+}
+
+// ruleIndex maps (organization, event type, action) to the rules that could
+// match such an event, so event dispatch does not list and evaluate every
+// rule of the organization.
+type ruleIndex struct {
+	mu      sync.RWMutex
+	orgs    map[string]*orgRuleIndex
+	loading map[string]*orgRuleLoad
+}
+
+// orgRuleLoad tracks an organization whose rules are being read from storage.
+type orgRuleLoad struct {
+	done chan struct{}
+	err  error
+	// changes are the upserts and removals that arrived after the storage read
+	// started; they are replayed over the loaded rules so none is lost.
+	changes []func(*orgRuleIndex)
+	// stale is set when the organization is invalidated during the load.
+	stale bool
+}
+
+func newRuleIndex() *ruleIndex {
+	return &ruleIndex{
+		orgs:    make(map[string]*orgRuleIndex),
+		loading: make(map[string]*orgRuleLoad),
+	}
+}
+
+// dispatchKeys returns the buckets a rule belongs to.
+func dispatchKeys(rule *AutomationRule) []ruleDispatchKey {
+	eventTypes := []string{""}
+	if len(rule.Conditions.EventTypes) > 0 {
+		eventTypes = make([]string, len(rule.Conditions.EventTypes))
+		for i, eventType := range rule.Conditions.EventTypes {
+			eventTypes[i] = string(eventType)
+		}
+	}
+
+	actions := []string{""}
+	if len(rule.Conditions.Actions) > 0 {
+		actions = make([]string, len(rule.Conditions.Actions))
+		for i, action := range rule.Conditions.Actions {
+			actions[i] = string(action)
+		}
+	}
+
+	keys := make([]ruleDispatchKey, 0, len(eventTypes)*len(actions))
+	for _, eventType := range eventTypes {
+		for _, action := range actions {
+			keys = append(keys, ruleDispatchKey{eventType: eventType, action: action})
+		}
+	}
+
+	return keys
+}
+
+// requiresEventMatch reports whether a rule can only match when its event
+// conditions pass, which is what makes bucketing by event type sound.
+func requiresEventMatch(rule *AutomationRule) bool {
+	switch rule.Conditions.LogicalOperator {
+	case ConditionOperatorOR, ConditionOperatorNOT:
+		return false
+	default:
+		return true
+	}
+}
+
+func (oi *orgRuleIndex) add(rule *AutomationRule) {
+	if !rule.Enabled {
+		return
+	}
+
+	if !requiresEventMatch(rule) {
+		oi.keys[rule.ID] = nil
+		oi.unbucketed[rule.ID] = rule
+
+		return
+	}
+
+	keys := dispatchKeys(rule)
+	oi.keys[rule.ID] = keys
+
+	for _, key := range keys {
+		bucket, exists := oi.buckets[key]
+		if !exists {
+			bucket = make(map[string]*AutomationRule)
+			oi.buckets[key] = bucket
+		}
+
+		bucket[rule.ID] = rule
+	}
+}
+
+func (oi *orgRuleIndex) remove(ruleID string) {
+	keys, exists := oi.keys[ruleID]
+	if !exists {
+		return
+	}
+
+	delete(oi.keys, ruleID)
+	delete(oi.unbucketed, ruleID)
+
+	for _, key := range keys {
+		if bucket, exists := oi.buckets[key]; exists {
+			delete(bucket, ruleID)
+
+			if len(bucket) == 0 {
+				delete(oi.buckets, key)
+			}
+		}
+	}
+}
+
+// ensureLoaded indexes the rules returned by list unless the organization is
+// indexed already. Concurrent callers for the same organization share one load.
+func (ri *ruleIndex) ensureLoaded(ctx context.Context, org string, list func() ([]*AutomationRule, error)) error {
+	for {
+		ri.mu.Lock()
+
+		if _, exists := ri.orgs[org]; exists {
+			ri.mu.Unlock()
+			return nil
+		}
+
+		if inflight, exists := ri.loading[org]; exists {
+			ri.mu.Unlock()
+
+			select {
+			case <-inflight.done:
+			case <-ctx.Done():
+				return ctx.Err()
+			}
+
+			if inflight.err != nil {
+				return inflight.err
+			}
+
+			continue // loaded, or invalidated while loading
+		}
+
+		load := &orgRuleLoad{done: make(chan struct{})}
+		ri.loading[org] = load
+		ri.mu.Unlock()
+
+		rules, err := list()
+
+		ri.mu.Lock()
+
+		if ri.loading[org] == load {
+			delete(ri.loading, org)
+		}
+
+		if err == nil && !load.stale {
+			oi := newOrgRuleIndex()
+			for _, rule := range rules {
+				oi.add(rule)
+			}
+
+			for _, change := range load.changes {
+				change(oi)
+			}
+
+			ri.orgs[org] = oi
+		}
+
+		load.err = err
+		ri.mu.Unlock()
+		close(load.done)
+
+		if err != nil {
+			return err
+		}
+	}
+}
+
+// updateLocked applies change to the index of org. Changes to an organization that
+// is being loaded are kept and replayed once the load completes; organizations
+// that are neither loaded nor loading pick the change up from storage.
+// Caller must hold ri.mu.
+func (ri *ruleIndex) updateLocked(org string, change func(*orgRuleIndex)) {
+	if oi, exists := ri.orgs[org]; exists {
+		change(oi)
+		return
+	}
+
+	if load, exists := ri.loading[org]; exists {
+		load.changes = append(load.changes, change)
+	}
+}
+
+// upsert re-indexes a created or updated rule.
+func (ri *ruleIndex) upsert(rule *AutomationRule) {
+	ri.mu.Lock()
+	defer ri.mu.Unlock()
+
+	ri.updateLocked(rule.Organization, func(oi *orgRuleIndex) {
+		oi.remove(rule.ID)
+		oi.add(rule)
+	})
+}
+
+// remove drops a rule from the index.
+func (ri *ruleIndex) remove(org, ruleID string) {
+	ri.mu.Lock()
+	defer ri.mu.Unlock()
+
+	ri.updateLocked(org, func(oi *orgRuleIndex) {
+		oi.remove(ruleID)
+	})
+}
+
+// invalidate forgets an organization so that it is reloaded on next use. A
+// load in progress is discarded and its waiters load again.
+func (ri *ruleIndex) invalidate(org string) {
+	ri.mu.Lock()
+	defer ri.mu.Unlock()
+
+	delete(ri.orgs, org)
+
+	if load, exists := ri.loading[org]; exists {
+		load.stale = true
+		delete(ri.loading, org)
+	}
+}
+
+// candidates returns the enabled rules of the event's organization whose event
+// type and action conditions admit the event, ordered like ListRules.
+func (ri *ruleIndex) candidates(event *GitHubEvent) []*AutomationRule {
+	ri.mu.RLock()
+	defer ri.mu.RUnlock()
+
+	oi, exists := ri.orgs[event.Organization]
+	if !exists {
+		return nil
+	}
+
+	seen := make(map[string]*AutomationRule)
+	collect := func(bucket map[string]*AutomationRule) {
+		for id, rule := range bucket {
+			seen[id] = rule
+		}
+	}
+
+	collect(oi.unbucketed)
+
+	if event.Action != "" {
+		for _, eventType := range []string{event.Type, ""} {
+			collect(oi.buckets[ruleDispatchKey{eventType: eventType, action: event.Action}])
+			collect(oi.buckets[ruleDispatchKey{eventType: eventType}])
+		}
+	} else {
+		// Action conditions are not checked for events without an action
+		for key, bucket := range oi.buckets {
+			if key.eventType == event.Type || key.eventType == "" {
+				collect(bucket)
+			}
+		}
+	}
+
+	rules := make([]*AutomationRule, 0, len(seen))
+	for _, rule := range seen {
+		rules = append(rules, rule)
+	}
+
+	sort.Slice(rules, func(i, j int) bool {
+		if rules[i].Priority != rules[j].Priority {
+			return rules[i].Priority > rules[j].Priority
+		}
+
+		if !rules[i].CreatedAt.Equal(rules[j].CreatedAt) {
+			return rules[i].CreatedAt.Before(rules[j].CreatedAt)
+		}
+
+		return rules[i].ID < rules[j].ID
+	})
+
+	return rules
+}
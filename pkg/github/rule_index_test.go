@@ -0,0 +1,217 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package github
+
+import (
+	"context"
+	"sync"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/mock"
+	"github.com/stretchr/testify/require"
+)
+
+func createIndexTestRule(id string, priority int, conditions AutomationConditions) *AutomationRule {
+	return &AutomationRule{
+		ID:           id,
+		Name:         id,
+		Organization: "testorg",
+		Enabled:      true,
+		Priority:     priority,
+		Conditions:   conditions,
+		CreatedAt:    time.Now(),
+		UpdatedAt:    time.Now(),
+	}
+}
+
+func ruleIDs(rules []*AutomationRule) []string {
+	ids := make([]string, len(rules))
+	for i, rule := range rules {
+		ids[i] = rule.ID
+	}
+
+	return ids
+}
+
+func loadRuleIndex(t *testing.T, index *ruleIndex, org string, rules []*AutomationRule) {
+	t.Helper()
+
+	require.NoError(t, index.ensureLoaded(context.Background(), org, func() ([]*AutomationRule, error) {
+		return rules, nil
+	}))
+}
+
+func TestRuleIndex_Candidates(t *testing.T) {
+	index := newRuleIndex()
+	loadRuleIndex(t, index, "testorg", []*AutomationRule{
+		createIndexTestRule("pr-opened", 200, AutomationConditions{
+			EventTypes: []EventType{EventTypePullRequest},
+			Actions:    []EventAction{ActionOpened, ActionSynchronize},
+		}),
+		createIndexTestRule("pr-any", 150, AutomationConditions{EventTypes: []EventType{EventTypePullRequest}}),
+		createIndexTestRule("push", 100, AutomationConditions{EventTypes: []EventType{EventTypePush}}),
+		createIndexTestRule("any-event", 50, AutomationConditions{}),
+		createIndexTestRule("or-rule", 10, AutomationConditions{
+			EventTypes:      []EventType{EventTypeIssues},
+			LogicalOperator: ConditionOperatorOR,
+		}),
+		{ID: "disabled", Organization: "testorg", Conditions: AutomationConditions{EventTypes: []EventType{EventTypePush}}},
+	})
+
+	tests := []struct {
+		name     string
+		event    *GitHubEvent
+		expected []string
+	}{
+		{
+			name:     "event type and action",
+			event:    &GitHubEvent{Organization: "testorg", Type: "pull_request", Action: "opened"},
+			expected: []string{"pr-opened", "pr-any", "any-event", "or-rule"},
+		},
+		{
+			name:     "other action",
+			event:    &GitHubEvent{Organization: "testorg", Type: "pull_request", Action: "closed"},
+			expected: []string{"pr-any", "any-event", "or-rule"},
+		},
+		{
+			name:     "event without action",
+			event:    &GitHubEvent{Organization: "testorg", Type: "pull_request"},
+			expected: []string{"pr-opened", "pr-any", "any-event", "or-rule"},
+		},
+		{
+			name:     "other event type",
+			event:    &GitHubEvent{Organization: "testorg", Type: "push"},
+			expected: []string{"push", "any-event", "or-rule"},
+		},
+		{
+			name:     "unknown organization",
+			event:    &GitHubEvent{Organization: "otherorg", Type: "push"},
+			expected: []string{},
+		},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			assert.Equal(t, tt.expected, ruleIDs(index.candidates(tt.event)))
+		})
+	}
+}
+
+func TestRuleIndex_UpsertAndRemove(t *testing.T) {
+	index := newRuleIndex()
+	rule := createIndexTestRule("rule", 100, AutomationConditions{EventTypes: []EventType{EventTypePush}})
+	loadRuleIndex(t, index, "testorg", []*AutomationRule{rule})
+
+	pushEvent := &GitHubEvent{Organization: "testorg", Type: "push"}
+	prEvent := &GitHubEvent{Organization: "testorg", Type: "pull_request"}
+
+	// Rules may be mutated in place before being re-indexed
+	rule.Conditions.EventTypes = []EventType{EventTypePullRequest}
+	index.upsert(rule)
+	assert.Empty(t, index.candidates(pushEvent))
+	assert.Equal(t, []string{"rule"}, ruleIDs(index.candidates(prEvent)))
+
+	rule.Enabled = false
+	index.upsert(rule)
+	assert.Empty(t, index.candidates(prEvent))
+
+	rule.Enabled = true
+	index.upsert(rule)
+	index.remove("testorg", "rule")
+	assert.Empty(t, index.candidates(prEvent))
+
+	// Rules of organizations that were never loaded are not indexed
+	index.upsert(&AutomationRule{ID: "other", Organization: "otherorg", Enabled: true})
+	assert.NotContains(t, index.orgs, "otherorg")
+}
+
+func TestRuleIndex_LoadKeepsConcurrentChanges(t *testing.T) {
+	index := newRuleIndex()
+	stale := createIndexTestRule("stale", 100, AutomationConditions{EventTypes: []EventType{EventTypePush}})
+	added := createIndexTestRule("added", 200, AutomationConditions{EventTypes: []EventType{EventTypePush}})
+
+	var lists atomic.Int32
+
+	started := make(chan struct{})
+	release := make(chan struct{})
+
+	list := func() ([]*AutomationRule, error) {
+		if lists.Add(1) == 1 {
+			close(started)
+			<-release
+		}
+
+		return []*AutomationRule{stale}, nil
+	}
+
+	var wg sync.WaitGroup
+
+	for range 4 {
+		wg.Add(1)
+
+		go func() {
+			defer wg.Done()
+			assert.NoError(t, index.ensureLoaded(context.Background(), "testorg", list))
+		}()
+	}
+
+	// Changes that land while storage is being read survive the load
+	<-started
+	index.upsert(added)
+	index.remove("testorg", "stale")
+	close(release)
+	wg.Wait()
+
+	assert.Equal(t, int32(1), lists.Load(), "concurrent loads share one storage read")
+	assert.Equal(t, []string{"added"}, ruleIDs(index.candidates(&GitHubEvent{Organization: "testorg", Type: "push"})))
+}
+
+func TestRuleManager_CandidateRules(t *testing.T) {
+	rm, storage, _, actionExecutor, evaluator := createTestRuleManager()
+
+	rules := []*AutomationRule{
+		createIndexTestRule("main-only", 200, AutomationConditions{
+			EventTypes:     []EventType{EventTypePush},
+			BranchPatterns: []string{"^main$"},
+		}),
+		createIndexTestRule("other-repo", 150, AutomationConditions{
+			EventTypes: []EventType{EventTypePush},
+			Repository: "other-repo",
+		}),
+		createIndexTestRule("feature", 100, AutomationConditions{
+			EventTypes:     []EventType{EventTypePush},
+			BranchPatterns: []string{"^feature/"},
+		}),
+	}
+	storage.On("ListRules", mock.Anything, "testorg", mock.AnythingOfType("*github.RuleFilter")).Return(rules, nil).Once()
+
+	event := &GitHubEvent{
+		Organization: "testorg",
+		Repository:   "test-repo",
+		Type:         "push",
+		Payload:      map[string]any{"ref": "refs/heads/feature/index"},
+	}
+
+	candidates, err := rm.CandidateRules(context.Background(), event)
+	require.NoError(t, err)
+	assert.Equal(t, []string{"feature"}, ruleIDs(candidates))
+
+	// Mutations keep the loaded index current without another storage read
+	added := createIndexTestRule("added", 300, AutomationConditions{EventTypes: []EventType{EventTypePush}})
+	added.Actions = []AutomationAction{{ID: "label", Type: ActionTypeAddLabel, Enabled: true}}
+	evaluator.On("ValidateConditions", &added.Conditions).Return(&ConditionValidationResult{Valid: true}, nil)
+	actionExecutor.On("ValidateAction", mock.Anything, mock.Anything).Return(nil)
+	storage.On("CreateRule", mock.Anything, added).Return(nil)
+	storage.On("DeleteRule", mock.Anything, "testorg", "feature").Return(nil)
+
+	require.NoError(t, rm.CreateRule(context.Background(), added))
+	require.NoError(t, rm.DeleteRule(context.Background(), "testorg", "feature"))
+
+	candidates, err = rm.CandidateRules(context.Background(), event)
+	require.NoError(t, err)
+	assert.Equal(t, []string{"added"}, ruleIDs(candidates))
+
+	storage.AssertExpectations(t)
+}
@@ -24,6 +24,15 @@ type RuleManager struct {
 	mu              sync.RWMutex
 	ruleCache       map[string]*AutomationRule
 	enabledRules    map[string]bool
+	compiledRules   map[string]*compiledRuleEntry
+	ruleIndex       *ruleIndex
+}
+
+// compiledRuleEntry caches the compiled conditions of one rule version.
+type compiledRuleEntry struct {
+	conditions *AutomationConditions
+	updatedAt  time.Time
+	compiled   *CompiledConditions
 }
 
 // RuleStorage defines the interface for persisting automation rules.
@@ -75,6 +84,8 @@ func NewRuleManager(logger Logger, apiClient APIClient, evaluator ConditionEvalu
 		templateStorage: templateStorage,
 		ruleCache:       make(map[string]*AutomationRule),
 		enabledRules:    make(map[string]bool),
+		compiledRules:   make(map[string]*compiledRuleEntry),
+		ruleIndex:       newRuleIndex(),
 	}
 }
 
@@ -128,8 +139,11 @@ func (rm *RuleManager) CreateRule(ctx context.Context, rule *AutomationRule) err
 	rm.mu.Lock()
 	rm.ruleCache[rm.cacheKey(rule.Organization, rule.ID)] = rule
 	rm.enabledRules[rm.cacheKey(rule.Organization, rule.ID)] = rule.Enabled
+	rm.storeCompiledLocked(rule)
 	rm.mu.Unlock()
 
+	rm.ruleIndex.upsert(rule)
+
 	rm.logger.Info("Automation rule created successfully", "rule_id", rule.ID)
 
 	return nil
@@ -241,8 +255,11 @@ func (rm *RuleManager) UpdateRule(ctx context.Context, rule *AutomationRule) err
 	rm.mu.Lock()
 	rm.ruleCache[cacheKey] = rule
 	rm.enabledRules[cacheKey] = rule.Enabled
+	rm.storeCompiledLocked(rule)
 	rm.mu.Unlock()
 
+	rm.ruleIndex.upsert(rule)
+
 	rm.logger.Info("Automation rule updated successfully", "rule_id", rule.ID)
 
 	return nil
@@ -262,13 +279,102 @@ func (rm *RuleManager) DeleteRule(ctx context.Context, org, ruleID string) error
 	rm.mu.Lock()
 	delete(rm.ruleCache, cacheKey)
 	delete(rm.enabledRules, cacheKey)
+	delete(rm.compiledRules, cacheKey)
 	rm.mu.Unlock()
 
+	rm.ruleIndex.remove(org, ruleID)
+
 	rm.logger.Info("Automation rule deleted successfully", "rule_id", ruleID)
 
 	return nil
 }
 
+// CandidateRules returns the enabled rules of the event's organization that
+// could match the event. Rules are looked up in the in-memory dispatch index by
+// event type and action, which is loaded from storage once on first use per
+// organization and kept current by CreateRule, UpdateRule and DeleteRule.
+// Rules whose repository or branch conditions exclude the event are dropped.
+func (rm *RuleManager) CandidateRules(ctx context.Context, event *GitHubEvent) ([]*AutomationRule, error) {
+	err := rm.ruleIndex.ensureLoaded(ctx, event.Organization, func() ([]*AutomationRule, error) {
+		rules, err := rm.storage.ListRules(ctx, event.Organization, &RuleFilter{
+			Organization: event.Organization,
+			Enabled:      boolPtr(true),
+		})
+		if err != nil {
+			return nil, err
+		}
+
+		rm.mu.Lock()
+
+		for _, rule := range rules {
+			// Keep cached rules: a concurrent CreateRule or UpdateRule may have
+			// cached a newer version than this snapshot
+			cacheKey := rm.cacheKey(rule.Organization, rule.ID)
+			if _, cached := rm.ruleCache[cacheKey]; !cached {
+				rm.ruleCache[cacheKey] = rule
+				rm.enabledRules[cacheKey] = rule.Enabled
+			}
+		}
+
+		rm.mu.Unlock()
+
+		return rules, nil
+	})
+	if err != nil {
+		return nil, err
+	}
+
+	indexed := rm.ruleIndex.candidates(event)
+	branch := branchFromPayload(event.Payload)
+
+	candidates := indexed[:0]
+	for _, rule := range indexed {
+		if rm.mayMatch(rule, event, branch) {
+			candidates = append(candidates, rule)
+		}
+	}
+
+	return candidates, nil
+}
+
+// InvalidateRuleIndex drops the dispatch index of an organization so that its
+// rules are reloaded from storage, e.g. after storage was changed externally.
+func (rm *RuleManager) InvalidateRuleIndex(org string) {
+	rm.ruleIndex.invalidate(org)
+}
+
+// mayMatch is a cheap pre-filter on the repository and branch conditions of
+// rules that require every condition to pass. It only rejects rules that
+// EvaluateConditions would certainly reject.
+func (rm *RuleManager) mayMatch(rule *AutomationRule, event *GitHubEvent, branch string) bool {
+	if !requiresEventMatch(rule) {
+		return true
+	}
+
+	conditions := &rule.Conditions
+	if conditions.Organization != "" && conditions.Organization != event.Organization {
+		return false
+	}
+
+	if conditions.Repository != "" && conditions.Repository != event.Repository {
+		return false
+	}
+
+	if branch == "" || len(conditions.BranchPatterns) == 0 {
+		return true
+	}
+
+	compiled := rm.compiledFor(rule)
+	for i := range compiled.branchPatterns {
+		// Invalid patterns surface as evaluation errors, so leave them to the evaluator
+		if matched, err := compiled.branchPatterns[i].match(branch); err != nil || matched {
+			return true
+		}
+	}
+
+	return false
+}
+
 // EnableRule enables an automation rule.
 func (rm *RuleManager) EnableRule(ctx context.Context, org, ruleID string) error {
 	return rm.setRuleEnabled(ctx, org, ruleID, true)
@@ -326,8 +432,18 @@ func (rm *RuleManager) EvaluateConditions(ctx context.Context, rule *AutomationR
 		}
 	}
 
-	// Evaluate conditions
-	result, err := rm.evaluator.EvaluateConditions(ctx, &rule.Conditions, event, evalContext)
+	// Evaluate conditions, reusing the rule's compiled conditions when supported
+	var (
+		result *EvaluationResult
+		err    error
+	)
+
+	if compiledEvaluator, ok := rm.evaluator.(CompiledConditionEvaluator); ok {
+		result, err = compiledEvaluator.EvaluateCompiledConditions(ctx, rm.compiledFor(rule), event, evalContext)
+	} else {
+		result, err = rm.evaluator.EvaluateConditions(ctx, &rule.Conditions, event, evalContext)
+	}
+
 	if err != nil {
 		return false, fmt.Errorf("condition evaluation failed: %w", err)
 	}
@@ -873,6 +989,40 @@ func (rm *RuleManager) cacheKey(org, ruleID string) string {
 	return fmt.Sprintf("%s:%s", org, ruleID)
 }
 
+// storeCompiledLocked compiles the rule's conditions and caches them under the
+// rule's cache key. The caller must hold rm.mu.
+func (rm *RuleManager) storeCompiledLocked(rule *AutomationRule) *CompiledConditions {
+	compiled := CompileConditions(&rule.Conditions)
+	if rule.ID != "" {
+		rm.compiledRules[rm.cacheKey(rule.Organization, rule.ID)] = &compiledRuleEntry{
+			conditions: &rule.Conditions,
+			updatedAt:  rule.UpdatedAt,
+			compiled:   compiled,
+		}
+	}
+
+	return compiled
+}
+
+// compiledFor returns the cached compiled conditions for the rule, compiling
+// them again when the rule was replaced or updated since they were cached.
+func (rm *RuleManager) compiledFor(rule *AutomationRule) *CompiledConditions {
+	cacheKey := rm.cacheKey(rule.Organization, rule.ID)
+
+	rm.mu.RLock()
+	entry, exists := rm.compiledRules[cacheKey]
+	rm.mu.RUnlock()
+
+	if exists && entry.conditions == &rule.Conditions && entry.updatedAt.Equal(rule.UpdatedAt) {
+		return entry.compiled
+	}
+
+	rm.mu.Lock()
+	defer rm.mu.Unlock()
+
+	return rm.storeCompiledLocked(rule)
+}
+
 func (rm *RuleManager) getRepositoryInfo(ctx context.Context, org, repo string) (*RepositoryInfo, error) {
 	// This would typically call the GitHub API to get repository information
 	// For now, return a basic structure
@@ -0,0 +1,581 @@
+package github
+
+import (
+	"context"
+	"encoding/json"
+	"errors"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"sync"
+	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/journal"
+)
+
+// DefaultSegmentMaxBytes is the size at which SegmentStore starts a new segment file.
+const DefaultSegmentMaxBytes = 64 * 1024 * 1024
+
+// defaultCompactMinSuperseded is how many index records must have been
+// replaced or deleted before the index journal is compacted.
+const defaultCompactMinSuperseded = 1024
+
+// segmentIndexEntry locates one change record inside a segment file and carries
+// every field ChangeFilter can match on, so queries never read non-matching records.
+type segmentIndexEntry struct {
+	ID           string    `json:"id"`
+	Timestamp    time.Time `json:"ts"`
+	Organization string    `json:"org,omitempty"`
+	Repository   string    `json:"repo,omitempty"`
+	User         string    `json:"user,omitempty"`
+	Operation    string    `json:"op,omitempty"`
+	Category     string    `json:"cat,omitempty"`
+	Segment      int       `json:"seg"`
+	Offset       int64     `json:"off"`
+	Length       int       `json:"len"`
+	Deleted      bool      `json:"deleted,omitempty"`
+
+	// superseded entries were replaced or deleted; they stay in the ordered
+	// lists until the next compaction so removal does not shift the lists.
+	superseded bool
+}
+
+// segmentIndexSnapshot is the compacted index: the live entries, oldest first.
+type segmentIndexSnapshot struct {
+	Segment int                  `json:"segment"`
+	Entries []*segmentIndexEntry `json:"entries"`
+}
+
+// SegmentStore implements ChangeStore with append-only segment files and a
+// persistent index.
+//
+// Records are appended as JSON lines to segments/NNNNNN.ndjson. Every write
+// appends an index entry to index.journal, which is replayed into memory on
+// open on top of index.snapshot. The in-memory index keeps records
+// time-ordered globally and per organization and repository, so List
+// resolves filters, ordering and pagination from the index and reads only the
+// records it returns.
+//
+// Once more index records have been superseded than are live, the live
+// entries are written to index.snapshot and the journal is truncated.
+type SegmentStore struct {
+	basePath   string
+	maxBytes   int64
+	mu         sync.RWMutex
+	index      *journal.Writer
+	segment    *os.File
+	segmentID  int
+	segmentLen int64
+	readers    map[int]*os.File
+
+	byID   map[string]*segmentIndexEntry
+	all    []*segmentIndexEntry // oldest first
+	byOrg  map[string][]*segmentIndexEntry
+	byRepo map[string][]*segmentIndexEntry
+
+	// superseded counts the index records replaced or deleted since the last
+	// compaction; compactMin is the count below which it never compacts.
+	superseded int
+	compactMin int
+}
+
+// NewSegmentStore opens or creates a segment store rooted at basePath.
+func NewSegmentStore(basePath string) (*SegmentStore, error) {
+	segmentDir := filepath.Join(basePath, "segments")
+	if err := os.MkdirAll(segmentDir, 0o750); err != nil {
+		return nil, fmt.Errorf("failed to create segment directory: %w", err)
+	}
+
+	ss := &SegmentStore{
+		basePath:   basePath,
+		maxBytes:   DefaultSegmentMaxBytes,
+		readers:    make(map[int]*os.File),
+		byID:       make(map[string]*segmentIndexEntry),
+		byOrg:      make(map[string][]*segmentIndexEntry),
+		byRepo:     make(map[string][]*segmentIndexEntry),
+		compactMin: defaultCompactMinSuperseded,
+	}
+
+	if err := ss.loadSnapshot(); err != nil {
+		return nil, err
+	}
+
+	indexPath := ss.indexPath()
+
+	_, err := journal.Replay(indexPath, func(raw json.RawMessage) error {
+		var entry segmentIndexEntry
+		if err := json.Unmarshal(raw, &entry); err != nil {
+			return err
+		}
+
+		ss.segmentID = max(ss.segmentID, entry.Segment)
+		ss.applyIndexEntry(&entry)
+
+		return nil
+	})
+	if err != nil {
+		return nil, fmt.Errorf("failed to load segment index: %w", err)
+	}
+
+	ss.index, err = journal.Open(indexPath, journal.Options{SyncEvery: 1})
+	if err != nil {
+		return nil, err
+	}
+
+	if err := ss.openSegment(max(ss.segmentID, 1)); err != nil {
+		_ = ss.index.Close()
+		return nil, err
+	}
+
+	ss.maybeCompact()
+
+	return ss, nil
+}
+
+func (ss *SegmentStore) indexPath() string {
+	return filepath.Join(ss.basePath, "index.journal")
+}
+
+func (ss *SegmentStore) snapshotPath() string {
+	return filepath.Join(ss.basePath, "index.snapshot")
+}
+
+// loadSnapshot loads the compacted index, if there is one.
+func (ss *SegmentStore) loadSnapshot() error {
+	data, err := os.ReadFile(ss.snapshotPath())
+	if errors.Is(err, os.ErrNotExist) {
+		return nil
+	}
+
+	if err != nil {
+		return fmt.Errorf("failed to read segment index snapshot: %w", err)
+	}
+
+	var snapshot segmentIndexSnapshot
+	if err := json.Unmarshal(data, &snapshot); err != nil {
+		return fmt.Errorf("failed to unmarshal segment index snapshot: %w", err)
+	}
+
+	ss.segmentID = snapshot.Segment
+
+	for _, entry := range snapshot.Entries {
+		ss.applyIndexEntry(entry)
+	}
+
+	return nil
+}
+
+func (ss *SegmentStore) segmentPath(id int) string {
+	return filepath.Join(ss.basePath, "segments", fmt.Sprintf("%06d.ndjson", id))
+}
+
+// openSegment makes id the active segment for appends. Caller must hold ss.mu or own ss exclusively.
+func (ss *SegmentStore) openSegment(id int) error {
+	file, err := os.OpenFile(ss.segmentPath(id), os.O_CREATE|os.O_WRONLY|os.O_APPEND, 0o600)
+	if err != nil {
+		return fmt.Errorf("failed to open segment: %w", err)
+	}
+
+	info, err := file.Stat()
+	if err != nil {
+		_ = file.Close()
+		return fmt.Errorf("failed to stat segment: %w", err)
+	}
+
+	if ss.segment != nil {
+		_ = ss.segment.Close()
+	}
+
+	ss.segment = file
+	ss.segmentID = id
+	ss.segmentLen = info.Size()
+
+	return nil
+}
+
+// Store appends a change record. Storing an existing ID replaces the previous record.
+func (ss *SegmentStore) Store(ctx context.Context, record *ChangeRecord) error {
+	data, err := json.Marshal(record)
+	if err != nil {
+		return fmt.Errorf("failed to marshal change record: %w", err)
+	}
+
+	data = append(data, '\n')
+
+	ss.mu.Lock()
+	defer ss.mu.Unlock()
+
+	if ss.segmentLen > 0 && ss.segmentLen+int64(len(data)) > ss.maxBytes {
+		if err := ss.openSegment(ss.segmentID + 1); err != nil {
+			return err
+		}
+	}
+
+	offset := ss.segmentLen
+
+	if _, err := ss.segment.Write(data); err != nil {
+		return fmt.Errorf("failed to write change record: %w", err)
+	}
+
+	if err := ss.segment.Sync(); err != nil {
+		return fmt.Errorf("failed to sync change record: %w", err)
+	}
+
+	ss.segmentLen += int64(len(data))
+
+	entry := &segmentIndexEntry{
+		ID:           record.ID,
+		Timestamp:    record.Timestamp,
+		Organization: record.Organization,
+		Repository:   record.Repository,
+		User:         record.User,
+		Operation:    record.Operation,
+		Category:     record.Category,
+		Segment:      ss.segmentID,
+		Offset:       offset,
+		Length:       len(data),
+	}
+
+	// The record only becomes visible once its index entry is durable
+	if err := ss.index.Append(entry); err != nil {
+		return fmt.Errorf("failed to index change record: %w", err)
+	}
+
+	ss.applyIndexEntry(entry)
+	ss.maybeCompact()
+
+	return nil
+}
+
+// Get retrieves a change record by ID.
+func (ss *SegmentStore) Get(ctx context.Context, id string) (*ChangeRecord, error) {
+	ss.mu.RLock()
+	entry, ok := ss.byID[id]
+	ss.mu.RUnlock()
+
+	if !ok {
+		return nil, fmt.Errorf("change record not found: record file not found for ID: %s", id)
+	}
+
+	return ss.readRecord(entry)
+}
+
+// List retrieves change records based on filter criteria, newest first.
+func (ss *SegmentStore) List(ctx context.Context, filter ChangeFilter) ([]*ChangeRecord, error) {
+	ss.mu.RLock()
+	entries := ss.selectEntries(filter)
+	ss.mu.RUnlock()
+
+	records := make([]*ChangeRecord, 0, len(entries))
+
+	for _, entry := range entries {
+		if err := ctx.Err(); err != nil {
+			return nil, err
+		}
+
+		record, err := ss.readRecord(entry)
+		if err != nil {
+			return nil, err
+		}
+
+		records = append(records, record)
+	}
+
+	return records, nil
+}
+
+// selectEntries resolves filter against the index. Caller must hold ss.mu for reading.
+func (ss *SegmentStore) selectEntries(filter ChangeFilter) []*segmentIndexEntry {
+	candidates := ss.all
+
+	if filter.Organization != "" {
+		candidates = ss.byOrg[filter.Organization]
+	}
+
+	if filter.Repository != "" {
+		if repoEntries := ss.byRepo[filter.Repository]; filter.Organization == "" || len(repoEntries) < len(candidates) {
+			candidates = repoEntries
+		}
+	}
+
+	// Narrow to [Since, Until] by binary search on the time-ordered list
+	lo := 0
+	if !filter.Since.IsZero() {
+		lo = sort.Search(len(candidates), func(i int) bool {
+			return !candidates[i].Timestamp.Before(filter.Since)
+		})
+	}
+
+	hi := len(candidates)
+	if !filter.Until.IsZero() {
+		hi = sort.Search(len(candidates), func(i int) bool {
+			return candidates[i].Timestamp.After(filter.Until)
+		})
+	}
+
+	var selected []*segmentIndexEntry
+
+	skipped := 0
+
+	for i := hi - 1; i >= lo; i-- {
+		entry := candidates[i]
+		if entry.superseded || !entry.matches(filter) {
+			continue
+		}
+
+		if skipped < filter.Offset {
+			skipped++
+			continue
+		}
+
+		selected = append(selected, entry)
+
+		if filter.Limit > 0 && len(selected) == filter.Limit {
+			break
+		}
+	}
+
+	return selected
+}
+
+func (e *segmentIndexEntry) matches(filter ChangeFilter) bool {
+	return (filter.Organization == "" || e.Organization == filter.Organization) &&
+		(filter.Repository == "" || e.Repository == filter.Repository) &&
+		(filter.User == "" || e.User == filter.User) &&
+		(filter.Operation == "" || e.Operation == filter.Operation) &&
+		(filter.Category == "" || e.Category == filter.Category)
+}
+
+// readRecord reads one record from its segment using a cached read handle.
+func (ss *SegmentStore) readRecord(entry *segmentIndexEntry) (*ChangeRecord, error) {
+	file, err := ss.reader(entry.Segment)
+	if err != nil {
+		return nil, err
+	}
+
+	data := make([]byte, entry.Length)
+	if _, err := file.ReadAt(data, entry.Offset); err != nil {
+		return nil, fmt.Errorf("failed to read change record: %w", err)
+	}
+
+	var record ChangeRecord
+	if err := json.Unmarshal(data, &record); err != nil {
+		return nil, fmt.Errorf("failed to unmarshal change record: %w", err)
+	}
+
+	return &record, nil
+}
+
+func (ss *SegmentStore) reader(segment int) (*os.File, error) {
+	ss.mu.RLock()
+	file, ok := ss.readers[segment]
+	ss.mu.RUnlock()
+
+	if ok {
+		return file, nil
+	}
+
+	ss.mu.Lock()
+	defer ss.mu.Unlock()
+
+	if file, ok := ss.readers[segment]; ok {
+		return file, nil
+	}
+
+	file, err := os.Open(ss.segmentPath(segment))
+	if err != nil {
+		return nil, fmt.Errorf("failed to open segment: %w", err)
+	}
+
+	ss.readers[segment] = file
+
+	return file, nil
+}
+
+// Delete removes a change record by appending a tombstone to the index.
+// Segment space is not reclaimed.
+func (ss *SegmentStore) Delete(ctx context.Context, id string) error {
+	ss.mu.Lock()
+	defer ss.mu.Unlock()
+
+	if _, ok := ss.byID[id]; !ok {
+		return fmt.Errorf("change record not found: record file not found for ID: %s", id)
+	}
+
+	tombstone := &segmentIndexEntry{ID: id, Deleted: true}
+	if err := ss.index.Append(tombstone); err != nil {
+		return fmt.Errorf("failed to delete change record: %w", err)
+	}
+
+	ss.applyIndexEntry(tombstone)
+	ss.maybeCompact()
+
+	return nil
+}
+
+// applyIndexEntry adds, replaces or removes an entry in the in-memory index.
+// Caller must hold ss.mu for writing or own ss exclusively.
+func (ss *SegmentStore) applyIndexEntry(entry *segmentIndexEntry) {
+	if old, ok := ss.byID[entry.ID]; ok {
+		delete(ss.byID, entry.ID)
+		old.superseded = true
+		ss.superseded++
+	}
+
+	if entry.Deleted {
+		// The tombstone itself is superseded as soon as it is applied
+		ss.superseded++
+		return
+	}
+
+	ss.byID[entry.ID] = entry
+	ss.all = insertIndexEntry(ss.all, entry)
+	ss.byOrg[entry.Organization] = insertIndexEntry(ss.byOrg[entry.Organization], entry)
+	ss.byRepo[entry.Repository] = insertIndexEntry(ss.byRepo[entry.Repository], entry)
+}
+
+// insertIndexEntry keeps entries ordered by timestamp; in-order appends are O(1).
+func insertIndexEntry(entries []*segmentIndexEntry, entry *segmentIndexEntry) []*segmentIndexEntry {
+	i := sort.Search(len(entries), func(i int) bool {
+		return entries[i].Timestamp.After(entry.Timestamp)
+	})
+
+	if i == len(entries) {
+		return append(entries, entry)
+	}
+
+	entries = append(entries, nil)
+	copy(entries[i+1:], entries[i:])
+	entries[i] = entry
+
+	return entries
+}
+
+// maybeCompact compacts the index once more records have been superseded than
+// are live. A failed compaction only leaves the journal longer and is retried
+// on the next write. Caller must hold ss.mu for writing or own ss exclusively.
+func (ss *SegmentStore) maybeCompact() {
+	if ss.superseded < ss.compactMin || ss.superseded < len(ss.byID) {
+		return
+	}
+
+	_ = ss.compact()
+}
+
+// compact drops superseded entries from the in-memory lists, writes the live
+// entries to the snapshot and truncates the journal. A crash between the two
+// steps replays the journal on top of the new snapshot, which is harmless.
+func (ss *SegmentStore) compact() error {
+	ss.all = liveIndexEntries(ss.all)
+
+	for _, lists := range []map[string][]*segmentIndexEntry{ss.byOrg, ss.byRepo} {
+		for key, entries := range lists {
+			if live := liveIndexEntries(entries); len(live) > 0 {
+				lists[key] = live
+			} else {
+				delete(lists, key)
+			}
+		}
+	}
+
+	snapshot := segmentIndexSnapshot{Segment: ss.segmentID, Entries: ss.all}
+	if err := journal.WriteSnapshot(ss.snapshotPath(), snapshot, 0o600); err != nil {
+		return fmt.Errorf("failed to compact segment index: %w", err)
+	}
+
+	if err := ss.index.Truncate(); err != nil {
+		return fmt.Errorf("failed to compact segment index: %w", err)
+	}
+
+	ss.superseded = 0
+
+	return nil
+}
+
+// liveIndexEntries removes superseded entries in place, keeping the order.
+func liveIndexEntries(entries []*segmentIndexEntry) []*segmentIndexEntry {
+	live := entries[:0]
+
+	for _, entry := range entries {
+		if !entry.superseded {
+			live = append(live, entry)
+		}
+	}
+
+	clear(entries[len(live):])
+
+	return live
+}
+
+// ImportFileStore copies every record of a legacy FileStore into the segment store.
+func (ss *SegmentStore) ImportFileStore(ctx context.Context, fs *FileStore) (int, error) {
+	records, err := fs.List(ctx, ChangeFilter{})
+	if err != nil {
+		return 0, fmt.Errorf("failed to list legacy change records: %w", err)
+	}
+
+	// FileStore lists newest first; append oldest first to keep segments time-ordered
+	for i := len(records) - 1; i >= 0; i-- {
+		if err := ss.Store(ctx, records[i]); err != nil {
+			return len(records) - 1 - i, err
+		}
+	}
+
+	return len(records), nil
+}
+
+// GetStorePath returns the base storage path.
+func (ss *SegmentStore) GetStorePath() string {
+	return ss.basePath
+}
+
+// GetStats returns storage statistics.
+func (ss *SegmentStore) GetStats(ctx context.Context) (map[string]any, error) {
+	ss.mu.RLock()
+	totalRecords := len(ss.byID)
+	segments := ss.segmentID
+	ss.mu.RUnlock()
+
+	totalSize := int64(0)
+
+	for id := 1; id <= segments; id++ {
+		info, err := os.Stat(ss.segmentPath(id))
+		if err != nil {
+			if errors.Is(err, os.ErrNotExist) {
+				continue
+			}
+
+			return nil, fmt.Errorf("failed to calculate stats: %w", err)
+		}
+
+		totalSize += info.Size()
+	}
+
+	return map[string]any{
+		"total_records":    totalRecords,
+		"total_size_bytes": totalSize,
+		"total_segments":   segments,
+		"storage_path":     ss.basePath,
+	}, nil
+}
+
+// Close releases the segment and index files.
+func (ss *SegmentStore) Close() error {
+	ss.mu.Lock()
+	defer ss.mu.Unlock()
+
+	errs := []error{ss.index.Close()}
+
+	if ss.segment != nil {
+		errs = append(errs, ss.segment.Close())
+		ss.segment = nil
+	}
+
+	for id, file := range ss.readers {
+		errs = append(errs, file.Close())
+		delete(ss.readers, id)
+	}
+
+	return errors.Join(errs...)
+}
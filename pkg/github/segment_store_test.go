@@ -0,0 +1,187 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package github
+
+import (
+	"context"
+	"fmt"
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func TestSegmentStore_ListUsesIndex(t *testing.T) {
+	dir := t.TempDir()
+	ctx := context.Background()
+
+	store, err := NewSegmentStore(dir)
+	require.NoError(t, err)
+
+	store.maxBytes = 1024 // force several segments
+
+	base := time.Date(2026, 1, 1, 0, 0, 0, 0, time.UTC)
+
+	for i := range 30 {
+		org := "org-a"
+		if i%3 == 0 {
+			org = "org-b"
+		}
+
+		require.NoError(t, store.Store(ctx, &ChangeRecord{
+			ID:           fmt.Sprintf("change-%02d", i),
+			Timestamp:    base.Add(time.Duration(i) * time.Hour),
+			Organization: org,
+			Repository:   fmt.Sprintf("repo-%d", i%2),
+			Operation:    "update",
+			Category:     "settings",
+		}))
+	}
+
+	records, err := store.List(ctx, ChangeFilter{Organization: "org-b", Limit: 3, Offset: 1})
+	require.NoError(t, err)
+	require.Len(t, records, 3)
+	assert.Equal(t, []string{"change-24", "change-21", "change-18"},
+		[]string{records[0].ID, records[1].ID, records[2].ID})
+
+	records, err = store.List(ctx, ChangeFilter{
+		Repository: "repo-1",
+		Since:      base.Add(10 * time.Hour),
+		Until:      base.Add(15 * time.Hour),
+	})
+	require.NoError(t, err)
+	require.Len(t, records, 3) // 11, 13, 15
+	assert.Equal(t, "change-15", records[0].ID)
+
+	require.NoError(t, store.Delete(ctx, "change-15"))
+	require.NoError(t, store.Close())
+
+	// Reopen: the index journal is replayed, tombstones included
+	reopened, err := NewSegmentStore(dir)
+	require.NoError(t, err)
+	defer func() { _ = reopened.Close() }()
+
+	_, err = reopened.Get(ctx, "change-15")
+	require.Error(t, err)
+
+	record, err := reopened.Get(ctx, "change-29")
+	require.NoError(t, err)
+	assert.Equal(t, "org-a", record.Organization)
+
+	stats, err := reopened.GetStats(ctx)
+	require.NoError(t, err)
+	assert.Equal(t, 29, stats["total_records"])
+	assert.Greater(t, stats["total_segments"], 1)
+}
+
+func TestSegmentStore_ReplaceAndImport(t *testing.T) {
+	ctx := context.Background()
+
+	legacy, err := NewFileStore(t.TempDir())
+	require.NoError(t, err)
+
+	now := time.Now()
+	require.NoError(t, legacy.Store(ctx, &ChangeRecord{ID: "old-1", Timestamp: now.Add(-2 * time.Hour), Organization: "org"}))
+	require.NoError(t, legacy.Store(ctx, &ChangeRecord{ID: "old-2", Timestamp: now.Add(-time.Hour), Organization: "org"}))
+
+	store, err := NewSegmentStore(t.TempDir())
+	require.NoError(t, err)
+	defer func() { _ = store.Close() }()
+
+	imported, err := store.ImportFileStore(ctx, legacy)
+	require.NoError(t, err)
+	assert.Equal(t, 2, imported)
+
+	// Storing an existing ID replaces the record
+	require.NoError(t, store.Store(ctx, &ChangeRecord{ID: "old-1", Timestamp: now, Organization: "org", Description: "updated"}))
+
+	records, err := store.List(ctx, ChangeFilter{Organization: "org"})
+	require.NoError(t, err)
+	require.Len(t, records, 2)
+	assert.Equal(t, "old-1", records[0].ID)
+	assert.Equal(t, "updated", records[0].Description)
+}
+
+func TestSegmentStore_ReopensAfterTornWrite(t *testing.T) {
+	dir := t.TempDir()
+	ctx := context.Background()
+	now := time.Now()
+
+	store, err := NewSegmentStore(dir)
+	require.NoError(t, err)
+	require.NoError(t, store.Store(ctx, &ChangeRecord{ID: "before", Timestamp: now.Add(-time.Hour), Organization: "org"}))
+	require.NoError(t, store.Close())
+
+	// Simulate a crash in the middle of writing the next record and its index entry
+	appendTorn := func(path, fragment string) {
+		file, err := os.OpenFile(path, os.O_WRONLY|os.O_APPEND, 0o600)
+		require.NoError(t, err)
+		_, err = file.WriteString(fragment)
+		require.NoError(t, err)
+		require.NoError(t, file.Close())
+	}
+	appendTorn(filepath.Join(dir, "segments", "000001.ndjson"), `{"id":"lost","organiz`)
+	appendTorn(filepath.Join(dir, "index.journal"), `{"id":"lost","ts":"2026-`)
+
+	recovered, err := NewSegmentStore(dir)
+	require.NoError(t, err)
+	require.NoError(t, recovered.Store(ctx, &ChangeRecord{ID: "after", Timestamp: now, Organization: "org"}))
+	require.NoError(t, recovered.Close())
+
+	reopened, err := NewSegmentStore(dir)
+	require.NoError(t, err)
+	defer func() { _ = reopened.Close() }()
+
+	records, err := reopened.List(ctx, ChangeFilter{Organization: "org"})
+	require.NoError(t, err)
+	require.Len(t, records, 2)
+	assert.Equal(t, []string{"after", "before"}, []string{records[0].ID, records[1].ID})
+
+	_, err = reopened.Get(ctx, "lost")
+	require.Error(t, err)
+}
+
+func TestSegmentStore_CompactsSupersededIndexRecords(t *testing.T) {
+	dir := t.TempDir()
+	ctx := context.Background()
+	base := time.Date(2026, 1, 1, 0, 0, 0, 0, time.UTC)
+
+	store, err := NewSegmentStore(dir)
+	require.NoError(t, err)
+
+	store.compactMin = 4
+
+	// Keep rewriting the same two records, then delete one
+	for i := range 10 {
+		require.NoError(t, store.Store(ctx, &ChangeRecord{
+			ID:           fmt.Sprintf("change-%d", i%2),
+			Timestamp:    base.Add(time.Duration(i) * time.Minute),
+			Organization: "org",
+			Description:  fmt.Sprintf("v%d", i),
+		}))
+	}
+
+	require.NoError(t, store.Delete(ctx, "change-0"))
+
+	// Superseded entries are dropped from memory and from the journal
+	assert.Less(t, len(store.all), 5)
+	assert.Less(t, store.index.Records(), 5)
+	assert.FileExists(t, filepath.Join(dir, "index.snapshot"))
+	require.NoError(t, store.Close())
+
+	reopened, err := NewSegmentStore(dir)
+	require.NoError(t, err)
+	defer func() { _ = reopened.Close() }()
+
+	records, err := reopened.List(ctx, ChangeFilter{Organization: "org"})
+	require.NoError(t, err)
+	require.Len(t, records, 1)
+	assert.Equal(t, "change-1", records[0].ID)
+	assert.Equal(t, "v9", records[0].Description)
+
+	stats, err := reopened.GetStats(ctx)
+	require.NoError(t, err)
+	assert.Equal(t, 1, stats["total_records"])
+}
@@ -1,14 +1,14 @@
 package github
 
 import (
-	"bufio"
+	"bytes"
 	"context"
-	"encoding/json"
 	"fmt"
 	"io"
 	"net/http"
 	"net/url"
 	"strconv"
+	"strings"
 	"sync"
 	"time"
 
@@ -19,6 +19,7 @@ import (
 // StreamingClient provides streaming API access for large-scale operations.
 type StreamingClient struct {
 	httpClient     *http.Client
+	baseURL        string
 	token          string
 	rateLimiter    *RateLimiter
 	memoryPool     *MemoryPool
@@ -36,6 +37,39 @@ type MemoryPool struct {
 	resultPool     sync.Pool
 }
 
+// maxPageBytes bounds the size of one buffered listing page. A full page of
+// 100 repositories is well under a megabyte.
+const maxPageBytes = 32 * constants.BytesPerKB * constants.BytesPerKB
+
+// readPage reads a whole response body into a pooled buffer, failing when it
+// exceeds maxPageBytes. Return the buffer with putPage.
+func (mp *MemoryPool) readPage(body io.Reader) ([]byte, error) {
+	buf, ok := mp.bufferPool.Get().([]byte)
+	if !ok {
+		buf = make([]byte, 0, constants.BytesPerKB*64)
+	}
+
+	b := bytes.NewBuffer(buf[:0])
+
+	n, err := b.ReadFrom(io.LimitReader(body, maxPageBytes+1))
+	if err != nil {
+		mp.putPage(b.Bytes())
+		return nil, err
+	}
+
+	if n > maxPageBytes {
+		mp.putPage(b.Bytes())
+		return nil, fmt.Errorf("page exceeds %d bytes", maxPageBytes)
+	}
+
+	return b.Bytes(), nil
+}
+
+// putPage returns a buffer obtained from readPage to the pool.
+func (mp *MemoryPool) putPage(buf []byte) {
+	mp.bufferPool.Put(buf[:0]) //nolint:staticcheck // SA6002: slices are pooled by value like the rest of MemoryPool
+}
+
 // RequestMetrics tracks API usage statistics.
 type RequestMetrics struct {
 	totalRequests   int64
@@ -150,6 +184,7 @@ func NewStreamingClient(token string, config StreamingConfig) *StreamingClient {
 
 	return &StreamingClient{
 		httpClient:     httpClient,
+		baseURL:        "https://api.github.com",
 		token:          token,
 		rateLimiter:    rateLimiter,
 		memoryPool:     memoryPool,
@@ -162,202 +197,51 @@ func NewStreamingClient(token string, config StreamingConfig) *StreamingClient {
 	}
 }
 
+// SetBaseURL updates the API base URL (useful for GitHub Enterprise).
+func (sc *StreamingClient) SetBaseURL(baseURL string) {
+	sc.baseURL = strings.TrimSuffix(baseURL, "/")
+}
+
 // StreamOrganizationRepositories streams repositories for an organization with memory optimization.
+// It runs an OrganizationRepositories iterator on a goroutine; consumers that
+// can pull should use the iterator directly.
 func (sc *StreamingClient) StreamOrganizationRepositories(ctx context.Context, org string, config StreamingConfig) (<-chan RepositoryStream, error) {
 	resultChan := make(chan RepositoryStream, config.BufferSize)
 
 	go func() {
 		defer close(resultChan)
 
-		// Use cursor-based pagination for efficient traversal
-		cursor := CursorPagination{
-			First: config.PageSize,
-		}
+		it := sc.OrganizationRepositories(ctx, org, config)
+		defer func() { _ = it.Close() }()
 
-		pageNum := 1
-
-		for {
+		for it.Next() {
 			select {
 			case <-ctx.Done():
 				return
-			default:
+			case resultChan <- RepositoryStream{
+				// The receiver keeps the repository
+				Repository: it.TakeRepository(),
+				Metadata: StreamMetadata{
+					Page:        it.Page(),
+					TotalPages:  it.TotalPages(),
+					ProcessedAt: time.Now(),
+					MemoryUsage: sc.getCurrentMemoryUsage(),
+				},
+			}:
 			}
+		}
 
-			// Check memory usage before proceeding
-			if err := sc.checkMemoryLimit(config.MemoryLimit); err != nil {
-				sc.sendError(resultChan, fmt.Errorf("memory limit exceeded: %w", err))
-				return
-			}
-
-			// Check rate limit
-			if err := sc.waitForRateLimit(ctx, config.RateLimitBuffer); err != nil {
-				sc.sendError(resultChan, fmt.Errorf("rate limit check failed: %w", err))
-				return
-			}
-
-			// Fetch page with streaming
-			repos, pagination, err := sc.fetchRepositoryPage(ctx, org, cursor)
-			if err != nil {
-				sc.sendError(resultChan, fmt.Errorf("failed to fetch page %d: %w", pageNum, err))
-				return
-			}
-
-			// Stream repositories to channel
-			for _, repo := range repos {
-				select {
-				case <-ctx.Done():
-					return
-				case resultChan <- RepositoryStream{
-					Repository: repo,
-					Metadata: StreamMetadata{
-						Page:        pageNum,
-						ProcessedAt: time.Now(),
-						MemoryUsage: sc.getCurrentMemoryUsage(),
-					},
-				}:
-				}
-			}
-
-			// Check if we have more pages
-			if !pagination.HasNext {
-				break
-			}
-
-			// Update cursor for next page
-			cursor.After = pagination.EndCursor
-			pageNum++
-
-			// Trigger garbage collection periodically
-			if pageNum%10 == 0 {
-				sc.optimizeMemory()
-			}
+		if err := it.Err(); err != nil && ctx.Err() == nil {
+			sc.sendError(resultChan, err)
 		}
 	}()
 
 	return resultChan, nil
 }
 
-// fetchRepositoryPage fetches a single page of repositories with optimized memory usage.
-func (sc *StreamingClient) fetchRepositoryPage(ctx context.Context, org string, cursor CursorPagination) ([]*Repository, CursorPagination, error) {
-	url := sc.buildRepositoryURL(org, cursor)
-
-	req, err := http.NewRequestWithContext(ctx, "GET", url, nil)
-	if err != nil {
-		return nil, CursorPagination{}, fmt.Errorf("failed to create request: %w", err)
-	}
-
-	// Set headers
-	if sc.token != "" {
-		req.Header.Set("Authorization", "Bearer "+sc.token)
-	}
-
-	req.Header.Set("Accept", "application/vnd.github+json")
-	req.Header.Set("X-GitHub-Api-Version", "2022-11-28")
-
-	// Execute request
-	startTime := time.Now()
-
-	resp, err := sc.httpClient.Do(req)
-	if err != nil {
-		return nil, CursorPagination{}, fmt.Errorf("request failed: %w", err)
-	}
-	defer func() { _ = resp.Body.Close() }()
-
-	// Update metrics
-	sc.updateRequestMetrics(time.Since(startTime))
-
-	// Update rate limit info
-	sc.updateRateLimit(resp.Header)
-
-	if resp.StatusCode != http.StatusOK {
-		return nil, CursorPagination{}, fmt.Errorf("API request failed: %s", resp.Status)
-	}
-
-	// Stream parse response to minimize memory usage
-	return sc.parseRepositoryResponse(resp.Body, cursor)
-}
-
-// parseRepositoryResponse parses JSON response with streaming to minimize memory usage.
-func (sc *StreamingClient) parseRepositoryResponse(reader io.Reader, cursor CursorPagination) ([]*Repository, CursorPagination, error) {
-	// Use buffered reader for efficient streaming
-	bufReader := bufio.NewReaderSize(reader, constants.BytesPerKB*64)
-
-	var response struct {
-		Items []json.RawMessage `json:"items,omitempty"`
-		// For regular API calls without search
-		Repositories []json.RawMessage `json:"-"`
-	}
-
-	// Try to read as array first (for /orgs/{org}/repos)
-	decoder := json.NewDecoder(bufReader)
-
-	// Peek at first character to determine response type
-	firstByte, err := bufReader.Peek(1)
-	if err != nil {
-		return nil, CursorPagination{}, fmt.Errorf("failed to peek response: %w", err)
-	}
-
-	var (
-		repositories  []*Repository
-		newPagination CursorPagination
-	)
-
-	if firstByte[0] == '[' {
-		// Direct array response
-		var rawRepos []json.RawMessage
-		if err := decoder.Decode(&rawRepos); err != nil {
-			return nil, CursorPagination{}, fmt.Errorf("failed to decode repository array: %w", err)
-		}
-
-		repositories = make([]*Repository, 0, len(rawRepos))
-		for _, rawRepo := range rawRepos {
-			repoInterface := sc.memoryPool.repositoryPool.Get()
-			repo, ok := repoInterface.(*Repository)
-			if !ok {
-				// Skip this entry if type assertion fails
-				continue
-			}
-			if err := json.Unmarshal(rawRepo, repo); err != nil {
-				sc.memoryPool.repositoryPool.Put(repo)
-				continue // Skip malformed entries
-			}
-
-			repositories = append(repositories, repo)
-		}
-
-		// For array responses, pagination is handled via Link headers
-		newPagination = sc.parseLinkPagination(cursor)
-	} else {
-		// Object response (search results)
-		if err := decoder.Decode(&response); err != nil {
-			return nil, CursorPagination{}, fmt.Errorf("failed to decode repository response: %w", err)
-		}
-
-		repositories = make([]*Repository, 0, len(response.Items))
-		for _, rawRepo := range response.Items {
-			repoInterface := sc.memoryPool.repositoryPool.Get()
-			repo, ok := repoInterface.(*Repository)
-			if !ok {
-				// Skip this entry if type assertion fails
-				continue
-			}
-			if err := json.Unmarshal(rawRepo, repo); err != nil {
-				sc.memoryPool.repositoryPool.Put(repo)
-				continue
-			}
-
-			repositories = append(repositories, repo)
-		}
-
-		newPagination = cursor // Update based on actual response
-	}
-
-	return repositories, newPagination, nil
-}
-
 // buildRepositoryURL constructs the API URL with cursor pagination.
 func (sc *StreamingClient) buildRepositoryURL(org string, cursor CursorPagination) string {
-	baseURL := fmt.Sprintf("https://api.github.com/orgs/%s/repos", org)
+	baseURL := fmt.Sprintf("%s/orgs/%s/repos", sc.baseURL, url.PathEscape(org))
 
 	params := url.Values{}
 	params.Set("per_page", strconv.Itoa(cursor.First))
@@ -372,16 +256,6 @@ func (sc *StreamingClient) buildRepositoryURL(org string, cursor CursorPaginatio
 	return baseURL + "?" + params.Encode()
 }
 
-// parseLinkPagination extracts pagination info from Link headers.
-func (sc *StreamingClient) parseLinkPagination(current CursorPagination) CursorPagination {
-	// Implementation would parse GitHub's Link header for next/prev URLs
-	// For now, return a simplified version
-	return CursorPagination{
-		After:   current.After,
-		HasNext: true, // Would be determined by Link header presence
-	}
-}
-
 // waitForRateLimit waits if necessary to respect rate limits.
 func (sc *StreamingClient) waitForRateLimit(ctx context.Context, buffer int) error {
 	sc.rateLimiter.mu.Lock()
@@ -399,12 +273,7 @@ func (sc *StreamingClient) waitForRateLimit(ctx context.Context, buffer int) err
 		if waitDuration > 0 {
 			fmt.Printf("Rate limit approached, waiting %v...\n", waitDuration)
 
-			select {
-			case <-time.After(waitDuration):
-				return nil
-			case <-ctx.Done():
-				return ctx.Err()
-			}
+			return sleepRateLimited(ctx, waitDuration)
 		}
 	}
 
@@ -531,12 +400,9 @@ func (sc *StreamingClient) GetMetrics() RequestMetrics {
 	}
 }
 
-// Close cleans up resources.
+// Close cleans up resources. Idle connections are deliberately left open:
+// the client's transport is the shared provider transport, whose warm
+// connections the other clients of the process keep reusing.
 func (sc *StreamingClient) Close() error {
-	// Clean up HTTP client connections
-	if transport, ok := sc.httpClient.Transport.(*http.Transport); ok {
-		transport.CloseIdleConnections()
-	}
-
 	return nil
 }
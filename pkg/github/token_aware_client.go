@@ -9,15 +9,23 @@ import (
 	"strconv"
 	"strings"
 	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/httpclient"
+	"github.com/gizzahub/gzh-cli/pkg/github/tokenpool"
 )
 
 // TokenAwareGitHubClient provides GitHub API operations with automatic token expiration handling - DISABLED (recovery package removed)
 // Simple HTTP client implementation to replace deleted recovery package.
+//
+// Requests are authenticated through a token pool holding the primary and
+// fallback tokens plus any extra credentials, so each request uses the token
+// with the most rate limit headroom left.
 type TokenAwareGitHubClient struct {
 	httpClient     *http.Client
 	baseURL        string
 	primaryToken   string
 	fallbackTokens []string
+	pool           *tokenpool.Pool
 }
 
 // TokenAwareGitHubClientConfig configures the token-aware GitHub client - DISABLED (recovery package removed)
@@ -26,6 +34,9 @@ type TokenAwareGitHubClientConfig struct {
 	BaseURL        string
 	PrimaryToken   string
 	FallbackTokens []string
+	// Credentials are added to the token pool after the tokens, e.g. GitHub
+	// App installations.
+	Credentials []tokenpool.Credential
 	// OAuth2Config   *recovery.OAuth2Config // Disabled - recovery package removed
 
 	// HTTP client configuration
@@ -52,16 +63,28 @@ func NewTokenAwareGitHubClient(config TokenAwareGitHubClientConfig) (*TokenAware
 		timeout = 30 * time.Second
 	}
 
+	pool := tokenpool.FromTokens(append([]string{config.PrimaryToken}, config.FallbackTokens...)...)
+	for _, cred := range config.Credentials {
+		pool.Add(cred)
+	}
+
+	httpClient := httpclient.GetGlobalClientWithTimeout("github", timeout)
+	httpClient.Transport = pool.Transport(httpClient.Transport)
+
 	return &TokenAwareGitHubClient{
-		httpClient: &http.Client{
-			Timeout: timeout,
-		},
+		httpClient:     httpClient,
 		baseURL:        config.BaseURL,
 		primaryToken:   config.PrimaryToken,
 		fallbackTokens: config.FallbackTokens,
+		pool:           pool,
 	}, nil
 }
 
+// TokenPool returns the pool the client's requests are authenticated with.
+func (c *TokenAwareGitHubClient) TokenPool() *tokenpool.Pool {
+	return c.pool
+}
+
 // Start initializes the token expiration monitoring - DISABLED (recovery package removed)
 // Simple implementation without external recovery dependency.
 func (c *TokenAwareGitHubClient) Start(ctx context.Context) error {
@@ -97,9 +120,15 @@ func (c *TokenAwareGitHubClient) GetTokenStatus() (map[string]any, error) {
 		return nil, err
 	}
 
+	remaining, limit, reset := c.pool.Budget(tokenpool.ResourceCore)
+
 	return map[string]any{
-		"has_token": token != "",
-		"note":      "recovery package removed, using simple token management",
+		"has_token":          token != "",
+		"note":               "recovery package removed, using simple token management",
+		"tokens":             c.pool.Status(tokenpool.ResourceCore),
+		"combined_remaining": remaining,
+		"combined_limit":     limit,
+		"next_reset":         reset,
 	}, nil
 }
 
@@ -120,13 +149,11 @@ func (c *TokenAwareGitHubClient) GetUser(ctx context.Context) (*GitHubUser, erro
 		return nil, fmt.Errorf("failed to create request: %w", err)
 	}
 
-	// Add authentication
-	token, err := c.GetCurrentToken()
-	if err != nil {
-		return nil, fmt.Errorf("failed to get token: %w", err)
+	// Authentication is added by the token pool
+	if c.pool.Len() == 0 {
+		return nil, fmt.Errorf("failed to get token: no tokens available")
 	}
 
-	req.Header.Set("Authorization", "token "+token)
 	req.Header.Set("Accept", "application/vnd.github.v3+json")
 
 	resp, err := c.httpClient.Do(req)
@@ -156,13 +183,11 @@ func (c *TokenAwareGitHubClient) GetOrganization(ctx context.Context, org string
 		return nil, fmt.Errorf("failed to create request: %w", err)
 	}
 
-	// Add authentication
-	token, err := c.GetCurrentToken()
-	if err != nil {
-		return nil, fmt.Errorf("failed to get token: %w", err)
+	// Authentication is added by the token pool
+	if c.pool.Len() == 0 {
+		return nil, fmt.Errorf("failed to get token: no tokens available")
 	}
 
-	req.Header.Set("Authorization", "token "+token)
 	req.Header.Set("Accept", "application/vnd.github.v3+json")
 
 	resp, err := c.httpClient.Do(req)
@@ -210,13 +235,7 @@ func (c *TokenAwareGitHubClient) ListRepositories(ctx context.Context, owner str
 		return nil, fmt.Errorf("failed to create request: %w", err)
 	}
 
-	// Add authentication if token is available
-	if c.primaryToken != "" {
-		token, err := c.GetCurrentToken()
-		if err == nil {
-			req.Header.Set("Authorization", "token "+token)
-		}
-	}
+	// Authentication is added by the token pool when tokens are available
 	req.Header.Set("Accept", "application/vnd.github.v3+json")
 
 	resp, err := c.httpClient.Do(req)
@@ -263,13 +282,11 @@ func (c *TokenAwareGitHubClient) GetRepository(ctx context.Context, owner, repo
 		return nil, fmt.Errorf("failed to create request: %w", err)
 	}
 
-	// Add authentication
-	token, err := c.GetCurrentToken()
-	if err != nil {
-		return nil, fmt.Errorf("failed to get token: %w", err)
+	// Authentication is added by the token pool
+	if c.pool.Len() == 0 {
+		return nil, fmt.Errorf("failed to get token: no tokens available")
 	}
 
-	req.Header.Set("Authorization", "token "+token)
 	req.Header.Set("Accept", "application/vnd.github.v3+json")
 
 	resp, err := c.httpClient.Do(req)
@@ -313,13 +330,11 @@ func (c *TokenAwareGitHubClient) GetRateLimit(ctx context.Context) (*RateLimitIn
 		return nil, fmt.Errorf("failed to create request: %w", err)
 	}
 
-	// Add authentication
-	token, err := c.GetCurrentToken()
-	if err != nil {
-		return nil, fmt.Errorf("failed to get token: %w", err)
+	// Authentication is added by the token pool
+	if c.pool.Len() == 0 {
+		return nil, fmt.Errorf("failed to get token: no tokens available")
 	}
 
-	req.Header.Set("Authorization", "token "+token)
 	req.Header.Set("Accept", "application/vnd.github.v3+json")
 
 	resp, err := c.httpClient.Do(req)
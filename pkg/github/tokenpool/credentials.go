@@ -0,0 +1,203 @@
+package tokenpool
+
+import (
+	"context"
+	"crypto"
+	"crypto/rand"
+	"crypto/rsa"
+	"crypto/sha256"
+	"crypto/x509"
+	"encoding/base64"
+	"encoding/json"
+	"encoding/pem"
+	"errors"
+	"fmt"
+	"net/http"
+	"strings"
+	"sync"
+	"time"
+)
+
+// Credential supplies the token used to authenticate a request.
+type Credential interface {
+	// Name identifies the credential in status output without revealing it.
+	Name() string
+	// Token returns a valid token, refreshing it if needed.
+	Token(ctx context.Context) (string, error)
+}
+
+// StaticToken is a personal access token or any other long-lived token.
+type StaticToken string
+
+// Name implements Credential.
+func (t StaticToken) Name() string {
+	if len(t) <= 4 {
+		return "token"
+	}
+
+	return "token…" + string(t[len(t)-4:])
+}
+
+// Token implements Credential.
+func (t StaticToken) Token(_ context.Context) (string, error) {
+	return string(t), nil
+}
+
+// installationTokenRefreshMargin is how long before expiry an installation
+// token is replaced.
+const installationTokenRefreshMargin = 5 * time.Minute
+
+// AppInstallation authenticates as a GitHub App installation. Installation
+// tokens are created from a JWT signed with the App's private key and
+// refreshed shortly before they expire. Every installation has its own rate
+// limit, so one App installed in several organizations adds a budget per
+// installation.
+type AppInstallation struct {
+	AppID          int64
+	InstallationID int64
+	// BaseURL is the API root, https://api.github.com when empty.
+	BaseURL string
+
+	key    *rsa.PrivateKey
+	client *http.Client
+
+	mu      sync.Mutex
+	token   string
+	expires time.Time
+}
+
+// NewAppInstallation creates a credential for an App installation from the
+// App's PEM encoded private key.
+func NewAppInstallation(appID, installationID int64, privateKeyPEM []byte, client *http.Client) (*AppInstallation, error) {
+	block, _ := pem.Decode(privateKeyPEM)
+	if block == nil {
+		return nil, errors.New("github app private key is not PEM encoded")
+	}
+
+	key, err := parseRSAPrivateKey(block.Bytes)
+	if err != nil {
+		return nil, fmt.Errorf("invalid github app private key: %w", err)
+	}
+
+	if client == nil {
+		client = &http.Client{Timeout: 30 * time.Second}
+	}
+
+	return &AppInstallation{
+		AppID:          appID,
+		InstallationID: installationID,
+		key:            key,
+		client:         client,
+	}, nil
+}
+
+func parseRSAPrivateKey(der []byte) (*rsa.PrivateKey, error) {
+	if key, err := x509.ParsePKCS1PrivateKey(der); err == nil {
+		return key, nil
+	}
+
+	parsed, err := x509.ParsePKCS8PrivateKey(der)
+	if err != nil {
+		return nil, err
+	}
+
+	key, ok := parsed.(*rsa.PrivateKey)
+	if !ok {
+		return nil, errors.New("not an RSA key")
+	}
+
+	return key, nil
+}
+
+// Name implements Credential.
+func (a *AppInstallation) Name() string {
+	return fmt.Sprintf("app:%d/installation:%d", a.AppID, a.InstallationID)
+}
+
+// Token implements Credential.
+func (a *AppInstallation) Token(ctx context.Context) (string, error) {
+	a.mu.Lock()
+	defer a.mu.Unlock()
+
+	if a.token != "" && time.Until(a.expires) > installationTokenRefreshMargin {
+		return a.token, nil
+	}
+
+	token, expires, err := a.createInstallationToken(ctx)
+	if err != nil {
+		return "", err
+	}
+
+	a.token, a.expires = token, expires
+
+	return token, nil
+}
+
+func (a *AppInstallation) createInstallationToken(ctx context.Context) (string, time.Time, error) {
+	jwt, err := a.appJWT(time.Now())
+	if err != nil {
+		return "", time.Time{}, err
+	}
+
+	baseURL := a.BaseURL
+	if baseURL == "" {
+		baseURL = "https://api.github.com"
+	}
+
+	url := fmt.Sprintf("%s/app/installations/%d/access_tokens", strings.TrimSuffix(baseURL, "/"), a.InstallationID)
+
+	req, err := http.NewRequestWithContext(ctx, http.MethodPost, url, nil)
+	if err != nil {
+		return "", time.Time{}, err
+	}
+
+	req.Header.Set("Authorization", "Bearer "+jwt)
+	req.Header.Set("Accept", "application/vnd.github+json")
+
+	resp, err := a.client.Do(req)
+	if err != nil {
+		return "", time.Time{}, fmt.Errorf("failed to create installation token: %w", err)
+	}
+	defer func() { _ = resp.Body.Close() }()
+
+	if resp.StatusCode != http.StatusCreated {
+		return "", time.Time{}, fmt.Errorf("failed to create installation token for %s: %s", a.Name(), resp.Status)
+	}
+
+	var body struct {
+		Token     string    `json:"token"`
+		ExpiresAt time.Time `json:"expires_at"`
+	}
+
+	if err := json.NewDecoder(resp.Body).Decode(&body); err != nil {
+		return "", time.Time{}, fmt.Errorf("failed to decode installation token: %w", err)
+	}
+
+	return body.Token, body.ExpiresAt, nil
+}
+
+// appJWT returns the RS256 signed JWT authenticating as the App. The issue
+// time is backdated to tolerate clock drift, and GitHub caps the lifetime at
+// ten minutes.
+func (a *AppInstallation) appJWT(now time.Time) (string, error) {
+	header := base64.RawURLEncoding.EncodeToString([]byte(`{"alg":"RS256","typ":"JWT"}`))
+
+	claims, err := json.Marshal(map[string]any{
+		"iat": now.Add(-time.Minute).Unix(),
+		"exp": now.Add(9 * time.Minute).Unix(),
+		"iss": fmt.Sprint(a.AppID),
+	})
+	if err != nil {
+		return "", err
+	}
+
+	signingInput := header + "." + base64.RawURLEncoding.EncodeToString(claims)
+	digest := sha256.Sum256([]byte(signingInput))
+
+	signature, err := rsa.SignPKCS1v15(rand.Reader, a.key, crypto.SHA256, digest[:])
+	if err != nil {
+		return "", fmt.Errorf("failed to sign github app JWT: %w", err)
+	}
+
+	return signingInput + "." + base64.RawURLEncoding.EncodeToString(signature), nil
+}
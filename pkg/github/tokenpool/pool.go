@@ -0,0 +1,528 @@
+// Package tokenpool spreads GitHub API requests over several tokens and GitHub
+// App installations.
+//
+// Every credential has its own rate limit per resource (core, graphql,
+// search). The pool tracks X-RateLimit-Remaining and X-RateLimit-Reset for
+// each credential and resource, and sends each request with the credential
+// that has the most headroom left, so an audit of a large organization drains
+// the combined budget instead of sleeping once the first token runs out.
+// Secondary rate limit responses back the offending credential off.
+package tokenpool
+
+import (
+	"bytes"
+	"context"
+	"errors"
+	"fmt"
+	"io"
+	"math"
+	"net/http"
+	"os"
+	"sort"
+	"strconv"
+	"strings"
+	"sync"
+	"time"
+)
+
+// Resource is a GitHub rate limit bucket.
+type Resource string
+
+// Rate limit resources tracked by the pool.
+const (
+	ResourceCore    Resource = "core"
+	ResourceGraphQL Resource = "graphql"
+	ResourceSearch  Resource = "search"
+)
+
+// resourceLimit is the budget assumed for a resource before its headers were seen.
+type resourceLimit struct {
+	limit  int
+	window time.Duration
+}
+
+var defaultLimits = map[Resource]resourceLimit{
+	ResourceCore:    {limit: 5000, window: time.Hour},
+	ResourceGraphQL: {limit: 5000, window: time.Hour},
+	ResourceSearch:  {limit: 30, window: time.Minute},
+}
+
+func limitFor(resource Resource) resourceLimit {
+	if limit, ok := defaultLimits[resource]; ok {
+		return limit
+	}
+
+	return defaultLimits[ResourceCore]
+}
+
+// Secondary rate limit backoff without a Retry-After header: GitHub asks to
+// wait at least a minute and back off exponentially on repeated hits.
+const (
+	secondaryBackoffBase = time.Minute
+	secondaryBackoffMax  = 15 * time.Minute
+)
+
+// ErrNoCredentials is returned when a pool has no credentials.
+var ErrNoCredentials = errors.New("token pool has no credentials")
+
+// ResourceFor returns the rate limit resource a request is counted against.
+func ResourceFor(req *http.Request) Resource {
+	return ResourceForPath(req.URL.Path)
+}
+
+// ResourceForPath returns the rate limit resource of an API path.
+func ResourceForPath(path string) Resource {
+	switch {
+	case strings.HasSuffix(path, "/graphql"):
+		return ResourceGraphQL
+	case strings.HasPrefix(path, "/search/"), strings.Contains(path, "/api/v3/search/"):
+		return ResourceSearch
+	default:
+		return ResourceCore
+	}
+}
+
+type budget struct {
+	limit     int
+	remaining int
+	reset     time.Time
+}
+
+type member struct {
+	cred    Credential
+	budgets map[Resource]*budget
+
+	backoffUntil  time.Time
+	secondaryHits int
+}
+
+// budget returns the member's budget for resource, refilled when its reset
+// time has passed.
+func (m *member) budget(resource Resource, now time.Time) *budget {
+	b, ok := m.budgets[resource]
+	if !ok {
+		limit := limitFor(resource)
+		b = &budget{limit: limit.limit, remaining: limit.limit, reset: now.Add(limit.window)}
+		m.budgets[resource] = b
+	} else if !now.Before(b.reset) {
+		b.remaining = b.limit
+		b.reset = now.Add(limitFor(resource).window)
+	}
+
+	return b
+}
+
+// Pool is a set of credentials sharing the request load.
+type Pool struct {
+	mu      sync.Mutex
+	members []*member
+	now     func() time.Time
+}
+
+// New creates a pool of the given credentials.
+func New(creds ...Credential) *Pool {
+	p := &Pool{now: time.Now}
+	for _, cred := range creds {
+		p.Add(cred)
+	}
+
+	return p
+}
+
+// FromTokens creates a pool of static tokens, skipping empty and duplicate ones.
+func FromTokens(tokens ...string) *Pool {
+	p := New()
+	seen := make(map[string]bool)
+
+	for _, token := range tokens {
+		if token = strings.TrimSpace(token); token != "" && !seen[token] {
+			seen[token] = true
+			p.Add(StaticToken(token))
+		}
+	}
+
+	return p
+}
+
+// Add adds a credential to the pool.
+func (p *Pool) Add(cred Credential) {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
+	p.members = append(p.members, &member{cred: cred, budgets: make(map[Resource]*budget)})
+}
+
+// Len returns the number of credentials in the pool.
+func (p *Pool) Len() int {
+	if p == nil {
+		return 0
+	}
+
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
+	return len(p.members)
+}
+
+// Lease is the credential chosen for one request.
+type Lease struct {
+	// Token is the token to send the request with.
+	Token string
+	// Name identifies the credential.
+	Name string
+
+	pool     *Pool
+	member   *member
+	resource Resource
+}
+
+// Acquire returns the credential with the most remaining budget for
+// resource. When every credential is exhausted or backed off, it waits until
+// the first one becomes available again.
+func (p *Pool) Acquire(ctx context.Context, resource Resource) (*Lease, error) {
+	if p.Len() == 0 {
+		return nil, ErrNoCredentials
+	}
+
+	for {
+		m, wait := p.pick(resource)
+		if m != nil {
+			token, err := m.cred.Token(ctx)
+			if err != nil {
+				p.backOff(m, secondaryBackoffBase)
+				return nil, err
+			}
+
+			return &Lease{Token: token, Name: m.cred.Name(), pool: p, member: m, resource: resource}, nil
+		}
+
+		timer := time.NewTimer(wait)
+		select {
+		case <-ctx.Done():
+			timer.Stop()
+			return nil, ctx.Err()
+		case <-timer.C:
+		}
+	}
+}
+
+// pick reserves one request of the member with the most headroom, or returns
+// how long to wait for one to become available.
+func (p *Pool) pick(resource Resource) (*member, time.Duration) {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
+	now := p.now()
+
+	var (
+		best     *member
+		bestLeft = 0
+		earliest time.Time
+	)
+
+	availableAt := func(t time.Time) {
+		if earliest.IsZero() || t.Before(earliest) {
+			earliest = t
+		}
+	}
+
+	for _, m := range p.members {
+		if now.Before(m.backoffUntil) {
+			availableAt(m.backoffUntil)
+			continue
+		}
+
+		b := m.budget(resource, now)
+		if b.remaining <= 0 {
+			availableAt(b.reset)
+			continue
+		}
+
+		if b.remaining > bestLeft {
+			best, bestLeft = m, b.remaining
+		}
+	}
+
+	if best != nil {
+		best.budgets[resource].remaining--
+		return best, 0
+	}
+
+	return nil, max(earliest.Sub(now), time.Millisecond)
+}
+
+func (p *Pool) backOff(m *member, d time.Duration) {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
+	if until := p.now().Add(d); until.After(m.backoffUntil) {
+		m.backoffUntil = until
+	}
+}
+
+// Observe updates the credential's budget from the response headers and
+// reports whether the request was rejected by a rate limit and should be
+// retried, which then uses another credential or waits for one.
+func (l *Lease) Observe(resp *http.Response) bool {
+	secondary := isSecondaryRateLimit(resp)
+
+	p := l.pool
+
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
+	now := p.now()
+	header := resp.Header
+
+	resource := l.resource
+	if name := header.Get("X-RateLimit-Resource"); name != "" {
+		resource = Resource(name)
+	}
+
+	b := l.member.budget(resource, now)
+
+	if limit, err := strconv.Atoi(header.Get("X-RateLimit-Limit")); err == nil {
+		b.limit = limit
+	}
+
+	if remaining, err := strconv.Atoi(header.Get("X-RateLimit-Remaining")); err == nil {
+		reset, resetErr := strconv.ParseInt(header.Get("X-RateLimit-Reset"), 10, 64)
+
+		switch {
+		case resetErr != nil:
+			b.remaining = remaining
+		case time.Unix(reset, 0).Equal(b.reset):
+			// Responses of concurrent requests arrive out of order; within
+			// one window the lowest count is the most recent
+			b.remaining = min(b.remaining, remaining)
+		default:
+			b.remaining = remaining
+			b.reset = time.Unix(reset, 0)
+		}
+	}
+
+	if resp.StatusCode < http.StatusBadRequest {
+		l.member.secondaryHits = 0
+		return false
+	}
+
+	if resp.StatusCode != http.StatusForbidden && resp.StatusCode != http.StatusTooManyRequests {
+		return false
+	}
+
+	if retryAfter, ok := parseRetryAfter(header.Get("Retry-After"), now); ok {
+		l.member.secondaryHits++
+		l.member.backoffUntil = now.Add(retryAfter)
+
+		return true
+	}
+
+	if header.Get("X-RateLimit-Remaining") == "0" {
+		// Primary limit exhausted; the budget now waits for its reset
+		b.remaining = 0
+		return true
+	}
+
+	if secondary {
+		backoff := min(secondaryBackoffBase<<min(l.member.secondaryHits, 4), secondaryBackoffMax)
+		l.member.secondaryHits++
+		l.member.backoffUntil = now.Add(backoff)
+
+		return true
+	}
+
+	return false
+}
+
+// isSecondaryRateLimit reports whether a 403 or 429 response is a secondary
+// rate limit. Forbidden responses are also returned for missing permissions,
+// so their message is checked; the body is restored for the caller.
+func isSecondaryRateLimit(resp *http.Response) bool {
+	switch resp.StatusCode {
+	case http.StatusTooManyRequests:
+		return true
+	case http.StatusForbidden:
+	default:
+		return false
+	}
+
+	if resp.Body == nil {
+		return false
+	}
+
+	prefix, _ := io.ReadAll(io.LimitReader(resp.Body, 4096))
+	resp.Body = struct {
+		io.Reader
+		io.Closer
+	}{io.MultiReader(bytes.NewReader(prefix), resp.Body), resp.Body}
+
+	message := strings.ToLower(string(prefix))
+
+	return strings.Contains(message, "secondary rate limit") || strings.Contains(message, "abuse detection")
+}
+
+func parseRetryAfter(value string, now time.Time) (time.Duration, bool) {
+	if value == "" {
+		return 0, false
+	}
+
+	if seconds, err := strconv.Atoi(value); err == nil {
+		return time.Duration(seconds) * time.Second, true
+	}
+
+	if at, err := http.ParseTime(value); err == nil {
+		return max(at.Sub(now), 0), true
+	}
+
+	return 0, false
+}
+
+// TokenStatus is the rate limit state of one credential.
+type TokenStatus struct {
+	Name         string    `json:"name"`
+	Limit        int       `json:"limit"`
+	Remaining    int       `json:"remaining"`
+	Reset        time.Time `json:"reset"`
+	BackoffUntil time.Time `json:"backoffUntil,omitzero"`
+}
+
+// Status returns the state of every credential for resource.
+func (p *Pool) Status(resource Resource) []TokenStatus {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
+	now := p.now()
+	status := make([]TokenStatus, 0, len(p.members))
+
+	for _, m := range p.members {
+		b := m.budget(resource, now)
+
+		s := TokenStatus{Name: m.cred.Name(), Limit: b.limit, Remaining: b.remaining, Reset: b.reset}
+		if now.Before(m.backoffUntil) {
+			s.BackoffUntil = m.backoffUntil
+		}
+
+		status = append(status, s)
+	}
+
+	return status
+}
+
+// Budget returns the combined remaining requests and limit of the pool for
+// resource, and the earliest reset among its credentials.
+func (p *Pool) Budget(resource Resource) (remaining, limit int, reset time.Time) {
+	for _, s := range p.Status(resource) {
+		remaining += max(s.Remaining, 0)
+		limit += s.Limit
+
+		if reset.IsZero() || s.Reset.Before(reset) {
+			reset = s.Reset
+		}
+	}
+
+	return remaining, limit, reset
+}
+
+// EstimateTimeToCompletion estimates how long until requests more requests
+// for resource can be made, using the combined budget of every credential:
+// the remaining requests are available now, and each credential's limit is
+// restored at its reset time and every window after that.
+func (p *Pool) EstimateTimeToCompletion(resource Resource, requests int) time.Duration {
+	status := p.Status(resource)
+
+	available := 0
+	for _, s := range status {
+		available += max(s.Remaining, 0)
+	}
+
+	needed := requests - available
+	if needed <= 0 {
+		return 0
+	}
+
+	sort.Slice(status, func(i, j int) bool { return status[i].Reset.Before(status[j].Reset) })
+
+	refill := 0
+	for _, s := range status {
+		refill += s.Limit
+	}
+
+	if refill <= 0 {
+		return time.Duration(math.MaxInt64)
+	}
+
+	now := p.now()
+	window := limitFor(resource).window
+
+	// Whole windows in which the full combined limit is restored
+	cycles := (needed - 1) / refill
+	needed -= cycles * refill
+
+	for _, s := range status {
+		needed -= s.Limit
+		if needed <= 0 {
+			return max(s.Reset.Add(time.Duration(cycles)*window).Sub(now), 0)
+		}
+	}
+
+	return time.Duration(cycles+1) * window
+}
+
+// Environment variables configuring the pool.
+const (
+	// EnvTokens lists additional tokens, separated by commas or whitespace.
+	EnvTokens = "GITHUB_TOKENS"
+	// EnvAppID is the ID of a GitHub App to authenticate as.
+	EnvAppID = "GZH_GITHUB_APP_ID"
+	// EnvAppInstallations lists the App's installation IDs, separated by commas.
+	EnvAppInstallations = "GZH_GITHUB_APP_INSTALLATIONS"
+	// EnvAppPrivateKeyPath is the path of the App's PEM private key.
+	EnvAppPrivateKeyPath = "GZH_GITHUB_APP_PRIVATE_KEY_PATH"
+)
+
+// FromEnv creates a pool of the given tokens, the tokens listed in
+// GITHUB_TOKENS and the GitHub App installations configured by
+// GZH_GITHUB_APP_ID, GZH_GITHUB_APP_INSTALLATIONS and
+// GZH_GITHUB_APP_PRIVATE_KEY_PATH.
+func FromEnv(tokens ...string) (*Pool, error) {
+	tokens = append(tokens, strings.FieldsFunc(os.Getenv(EnvTokens), func(r rune) bool {
+		return r == ',' || r == ' ' || r == '\n' || r == '\t'
+	})...)
+
+	p := FromTokens(tokens...)
+
+	appID := os.Getenv(EnvAppID)
+	if appID == "" {
+		return p, nil
+	}
+
+	id, err := strconv.ParseInt(appID, 10, 64)
+	if err != nil {
+		return nil, fmt.Errorf("invalid %s: %s", EnvAppID, appID)
+	}
+
+	key, err := os.ReadFile(os.Getenv(EnvAppPrivateKeyPath))
+	if err != nil {
+		return nil, fmt.Errorf("failed to read %s: %w", EnvAppPrivateKeyPath, err)
+	}
+
+	for _, installation := range strings.Split(os.Getenv(EnvAppInstallations), ",") {
+		if installation = strings.TrimSpace(installation); installation == "" {
+			continue
+		}
+
+		installationID, err := strconv.ParseInt(installation, 10, 64)
+		if err != nil {
+			return nil, fmt.Errorf("invalid installation ID in %s: %s", EnvAppInstallations, installation)
+		}
+
+		cred, err := NewAppInstallation(id, installationID, key, nil)
+		if err != nil {
+			return nil, err
+		}
+
+		p.Add(cred)
+	}
+
+	return p, nil
+}
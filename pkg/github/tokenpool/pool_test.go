@@ -0,0 +1,258 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package tokenpool
+
+import (
+	"context"
+	"crypto/rand"
+	"crypto/rsa"
+	"crypto/x509"
+	"encoding/json"
+	"encoding/pem"
+	"net/http"
+	"net/http/httptest"
+	"strconv"
+	"strings"
+	"sync"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+func rateLimitResponse(status, limit, remaining int, reset time.Time) *http.Response {
+	header := http.Header{}
+	header.Set("X-RateLimit-Limit", strconv.Itoa(limit))
+	header.Set("X-RateLimit-Remaining", strconv.Itoa(remaining))
+	header.Set("X-RateLimit-Reset", strconv.FormatInt(reset.Unix(), 10))
+
+	return &http.Response{StatusCode: status, Header: header, Body: http.NoBody}
+}
+
+func TestPool_PicksTokenWithMostHeadroom(t *testing.T) {
+	ctx := context.Background()
+	pool := FromTokens("token-a", "token-b", "token-a", "")
+	require.Equal(t, 2, pool.Len())
+
+	reset := time.Now().Add(30 * time.Minute)
+
+	lease, err := pool.Acquire(ctx, ResourceCore)
+	require.NoError(t, err)
+	assert.Equal(t, "token-a", lease.Token)
+	assert.False(t, lease.Observe(rateLimitResponse(http.StatusOK, 5000, 100, reset)))
+
+	// token-b has not been used and still has the default budget
+	for i := range 3 {
+		lease, err = pool.Acquire(ctx, ResourceCore)
+		require.NoError(t, err)
+		assert.Equal(t, "token-b", lease.Token)
+		assert.False(t, lease.Observe(rateLimitResponse(http.StatusOK, 5000, 4000-i, reset)))
+	}
+
+	remaining, limit, _ := pool.Budget(ResourceCore)
+	assert.Equal(t, 4098, remaining)
+	assert.Equal(t, 10000, limit)
+
+	// Budgets are tracked per resource
+	lease, err = pool.Acquire(ctx, ResourceSearch)
+	require.NoError(t, err)
+	assert.Equal(t, "token-a", lease.Token)
+}
+
+func TestPool_ExhaustedTokenWaitsForReset(t *testing.T) {
+	ctx := context.Background()
+	pool := FromTokens("token-a", "token-b")
+
+	now := time.Now()
+	pool.now = func() time.Time { return now }
+
+	reset := now.Add(10 * time.Minute)
+
+	for _, token := range []string{"token-a", "token-b"} {
+		lease, err := pool.Acquire(ctx, ResourceCore)
+		require.NoError(t, err)
+		assert.Equal(t, token, lease.Token)
+		assert.True(t, lease.Observe(rateLimitResponse(http.StatusForbidden, 5000, 0, reset)))
+	}
+
+	// Both tokens are exhausted until the reset
+	shortCtx, cancel := context.WithTimeout(ctx, 20*time.Millisecond)
+	defer cancel()
+
+	_, err := pool.Acquire(shortCtx, ResourceCore)
+	require.ErrorIs(t, err, context.DeadlineExceeded)
+
+	now = reset
+	lease, err := pool.Acquire(ctx, ResourceCore)
+	require.NoError(t, err)
+	assert.Equal(t, "token-a", lease.Token)
+}
+
+func TestLease_ObserveSecondaryRateLimit(t *testing.T) {
+	tests := []struct {
+		name        string
+		status      int
+		retryAfter  string
+		body        string
+		limited     bool
+		wantBackoff time.Duration
+	}{
+		{name: "retry after", status: http.StatusForbidden, retryAfter: "30", limited: true, wantBackoff: 30 * time.Second},
+		{name: "secondary message", status: http.StatusForbidden, body: `{"message":"You have exceeded a secondary rate limit"}`, limited: true, wantBackoff: time.Minute},
+		{name: "too many requests", status: http.StatusTooManyRequests, limited: true, wantBackoff: time.Minute},
+		{name: "missing permission", status: http.StatusForbidden, body: `{"message":"Resource not accessible by integration"}`},
+		{name: "not found", status: http.StatusNotFound},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			pool := FromTokens("token-a")
+			now := time.Now()
+			pool.now = func() time.Time { return now }
+
+			lease, err := pool.Acquire(context.Background(), ResourceCore)
+			require.NoError(t, err)
+
+			resp := rateLimitResponse(tt.status, 5000, 4000, now.Add(time.Hour))
+			resp.Body = http.NoBody
+			if tt.body != "" {
+				resp.Body = nopCloser{strings.NewReader(tt.body)}
+			}
+
+			if tt.retryAfter != "" {
+				resp.Header.Set("Retry-After", tt.retryAfter)
+			}
+
+			assert.Equal(t, tt.limited, lease.Observe(resp))
+
+			status := pool.Status(ResourceCore)[0]
+			if tt.wantBackoff > 0 {
+				assert.Equal(t, now.Add(tt.wantBackoff), status.BackoffUntil)
+			} else {
+				assert.True(t, status.BackoffUntil.IsZero())
+			}
+
+			// The body is still readable by the caller
+			if tt.body != "" {
+				data := make([]byte, len(tt.body))
+				_, err := resp.Body.Read(data)
+				require.NoError(t, err)
+				assert.Equal(t, tt.body, string(data))
+			}
+		})
+	}
+}
+
+type nopCloser struct{ *strings.Reader }
+
+func (nopCloser) Close() error { return nil }
+
+func TestPool_EstimateTimeToCompletion(t *testing.T) {
+	pool := FromTokens("token-a", "token-b")
+	// Reset headers have a resolution of one second
+	now := time.Now().Truncate(time.Second)
+	pool.now = func() time.Time { return now }
+
+	for i, reset := range []time.Duration{10 * time.Minute, 20 * time.Minute} {
+		lease, err := pool.Acquire(context.Background(), ResourceCore)
+		require.NoError(t, err)
+		lease.Observe(rateLimitResponse(http.StatusOK, 5000, 1000*(i+1), now.Add(reset)))
+	}
+
+	// 3000 requests are available now
+	assert.Zero(t, pool.EstimateTimeToCompletion(ResourceCore, 3000))
+	// The first token's reset adds another 5000
+	assert.Equal(t, 10*time.Minute, pool.EstimateTimeToCompletion(ResourceCore, 8000))
+	// Both resets together cover 13000
+	assert.Equal(t, 20*time.Minute, pool.EstimateTimeToCompletion(ResourceCore, 13000))
+	// Beyond that another window is needed
+	assert.Equal(t, 70*time.Minute, pool.EstimateTimeToCompletion(ResourceCore, 14000))
+}
+
+func TestTransport_RotatesTokens(t *testing.T) {
+	var (
+		mu   sync.Mutex
+		seen []string
+	)
+
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		mu.Lock()
+		seen = append(seen, r.Header.Get("Authorization"))
+		mu.Unlock()
+
+		reset := strconv.FormatInt(time.Now().Add(time.Hour).Unix(), 10)
+		w.Header().Set("X-RateLimit-Reset", reset)
+
+		if r.Header.Get("Authorization") == "token token-a" {
+			w.Header().Set("X-RateLimit-Remaining", "0")
+			w.WriteHeader(http.StatusForbidden)
+
+			return
+		}
+
+		w.Header().Set("X-RateLimit-Remaining", "4999")
+		_, _ = w.Write([]byte("ok"))
+	}))
+	defer server.Close()
+
+	pool := FromTokens("token-a", "token-b")
+	client := &http.Client{Transport: pool.Transport(http.DefaultTransport)}
+
+	resp, err := client.Get(server.URL + "/orgs/test/repos")
+	require.NoError(t, err)
+	defer resp.Body.Close()
+
+	assert.Equal(t, http.StatusOK, resp.StatusCode)
+	assert.Equal(t, []string{"token token-a", "token token-b"}, seen)
+
+	// An explicit Authorization header is left alone
+	req, err := http.NewRequest(http.MethodGet, server.URL+"/user", nil)
+	require.NoError(t, err)
+	req.Header.Set("Authorization", "token explicit")
+
+	resp, err = client.Do(req)
+	require.NoError(t, err)
+	resp.Body.Close()
+	assert.Equal(t, "token explicit", seen[len(seen)-1])
+}
+
+func TestAppInstallation_Token(t *testing.T) {
+	key, err := rsa.GenerateKey(rand.Reader, 2048)
+	require.NoError(t, err)
+
+	keyPEM := pem.EncodeToMemory(&pem.Block{Type: "RSA PRIVATE KEY", Bytes: x509.MarshalPKCS1PrivateKey(key)})
+
+	requests := 0
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		requests++
+
+		assert.Equal(t, "/app/installations/42/access_tokens", r.URL.Path)
+		assert.True(t, strings.HasPrefix(r.Header.Get("Authorization"), "Bearer "))
+		assert.Len(t, strings.Split(strings.TrimPrefix(r.Header.Get("Authorization"), "Bearer "), "."), 3)
+
+		w.WriteHeader(http.StatusCreated)
+		_ = json.NewEncoder(w).Encode(map[string]any{
+			"token":      "ghs_installation",
+			"expires_at": time.Now().Add(time.Hour),
+		})
+	}))
+	defer server.Close()
+
+	cred, err := NewAppInstallation(7, 42, keyPEM, server.Client())
+	require.NoError(t, err)
+
+	cred.BaseURL = server.URL
+
+	for range 2 {
+		token, err := cred.Token(context.Background())
+		require.NoError(t, err)
+		assert.Equal(t, "ghs_installation", token)
+	}
+
+	// The token is cached until shortly before it expires
+	assert.Equal(t, 1, requests)
+	assert.Equal(t, "app:7/installation:42", cred.Name())
+
+	_, err = NewAppInstallation(7, 42, []byte("not a key"), nil)
+	assert.Error(t, err)
+}
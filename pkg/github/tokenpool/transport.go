@@ -0,0 +1,81 @@
+package tokenpool
+
+import (
+	"io"
+	"net/http"
+)
+
+// defaultMaxAttempts bounds how often a rate limited request is resent.
+const defaultMaxAttempts = 4
+
+// Transport authenticates each request with the pool credential that has the
+// most headroom and resends requests rejected by a rate limit. Requests that
+// already carry an Authorization header, and all requests of an empty pool,
+// are passed through unchanged.
+type Transport struct {
+	Pool *Pool
+	Base http.RoundTripper
+	// MaxAttempts bounds the attempts per request, 4 when zero.
+	MaxAttempts int
+}
+
+// Transport returns a round tripper sending requests through base with the
+// pool's credentials.
+func (p *Pool) Transport(base http.RoundTripper) *Transport {
+	if base == nil {
+		base = http.DefaultTransport
+	}
+
+	return &Transport{Pool: p, Base: base}
+}
+
+// RoundTrip implements http.RoundTripper.
+func (t *Transport) RoundTrip(req *http.Request) (*http.Response, error) {
+	if t.Pool.Len() == 0 || req.Header.Get("Authorization") != "" {
+		return t.Base.RoundTrip(req)
+	}
+
+	maxAttempts := t.MaxAttempts
+	if maxAttempts <= 0 {
+		maxAttempts = defaultMaxAttempts
+	}
+
+	resource := ResourceFor(req)
+
+	for attempt := 1; ; attempt++ {
+		lease, err := t.Pool.Acquire(req.Context(), resource)
+		if err != nil {
+			return nil, err
+		}
+
+		attemptReq := req.Clone(req.Context())
+		if attempt > 1 && req.Body != nil && req.Body != http.NoBody {
+			body, err := req.GetBody()
+			if err != nil {
+				return nil, err
+			}
+
+			attemptReq.Body = body
+		}
+
+		attemptReq.Header.Set("Authorization", "token "+lease.Token)
+
+		resp, err := t.Base.RoundTrip(attemptReq)
+		if err != nil {
+			return nil, err
+		}
+
+		limited := lease.Observe(resp)
+		if !limited || attempt >= maxAttempts || !replayable(req) {
+			return resp, nil
+		}
+
+		_, _ = io.Copy(io.Discard, io.LimitReader(resp.Body, 64<<10))
+		_ = resp.Body.Close()
+	}
+}
+
+// replayable reports whether the request body can be sent again.
+func replayable(req *http.Request) bool {
+	return req.Body == nil || req.Body == http.NoBody || req.GetBody != nil
+}
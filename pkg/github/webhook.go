@@ -8,7 +8,12 @@ import (
 	"io"
 	"net/http"
 	"slices"
+	"strconv"
+	"sync"
 	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/httpclient"
+	"github.com/gizzahub/gzh-cli/pkg/github/largescale"
 )
 
 // WebhookInfo represents a GitHub webhook configuration.
@@ -86,12 +91,25 @@ type WebhookService interface {
 	GetWebhookDeliveries(ctx context.Context, owner, repo string, webhookID int64) ([]*WebhookDelivery, error)
 }
 
+// BulkWebhookOptions controls how a bulk webhook operation is executed.
+type BulkWebhookOptions struct {
+	// Concurrency is the number of repositories processed at the same time;
+	// zero uses DefaultPipelineConcurrency.
+	Concurrency int `json:"concurrency,omitempty"`
+
+	// OnResult, when set, receives every operation result as soon as its
+	// repository is done instead of collecting it in BulkWebhookResult.Results.
+	// It is called from a single goroutine.
+	OnResult func(WebhookOperationResult) `json:"-"`
+}
+
 // BulkWebhookRequest represents a bulk webhook creation request.
 type BulkWebhookRequest struct {
 	Organization string               `json:"organization"`
 	Repositories []string             `json:"repositories,omitempty"` // if empty, apply to all repos
 	Template     WebhookCreateRequest `json:"template"`
-	Filters      *RepositoryFilters   `json:"filters,omitempty"`
+	Filters      *RepositoryFilters   `json:"filters,omitempty"` // applies to the organization listing
+	BulkWebhookOptions
 }
 
 // BulkWebhookUpdateRequest represents a bulk webhook update request.
@@ -101,6 +119,7 @@ type BulkWebhookUpdateRequest struct {
 	Template     WebhookUpdateRequest `json:"template"`
 	Filters      *RepositoryFilters   `json:"filters,omitempty"`
 	SelectBy     WebhookSelector      `json:"select_by"` // how to find webhooks to update
+	BulkWebhookOptions
 }
 
 // BulkWebhookDeleteRequest represents a bulk webhook deletion request.
@@ -109,6 +128,7 @@ type BulkWebhookDeleteRequest struct {
 	Repositories []string           `json:"repositories,omitempty"`
 	SelectBy     WebhookSelector    `json:"select_by"` // how to find webhooks to delete
 	Filters      *RepositoryFilters `json:"filters,omitempty"`
+	BulkWebhookOptions
 }
 
 // WebhookSelector defines how to select webhooks for bulk operations.
@@ -120,6 +140,7 @@ type WebhookSelector struct {
 }
 
 // BulkWebhookResult represents the result of bulk webhook operations.
+// Results stays empty when the request streams them through OnResult.
 type BulkWebhookResult struct {
 	TotalRepositories int                      `json:"total_repositories"`
 	SuccessCount      int                      `json:"success_count"`
@@ -169,26 +190,33 @@ type webhookServiceImpl struct {
 	baseURL    string
 	token      string
 	logger     Logger
+
+	// limiter paces the per-repository requests of bulk operations and is
+	// fed the rate limit headers of every response.
+	limiter *largescale.AdaptiveRateLimiter
+
+	// hooks caches repository webhook listings by "owner/repo", so bulk
+	// selectors only list each repository once. Writes through this service
+	// keep the cached listings current.
+	hooksMu sync.Mutex
+	hooks   map[string][]*WebhookInfo
 }
 
 // NewWebhookService creates a new webhook service instance.
 func NewWebhookService(apiClient APIClient, logger Logger) WebhookService {
-	return &webhookServiceImpl{
-		apiClient:  apiClient,
-		httpClient: &http.Client{Timeout: 30 * time.Second},
-		baseURL:    "https://api.github.com",
-		logger:     logger,
-	}
+	return NewWebhookServiceWithToken(apiClient, "", logger)
 }
 
 // NewWebhookServiceWithToken creates a webhook service with a token for API calls.
 func NewWebhookServiceWithToken(apiClient APIClient, token string, logger Logger) WebhookService {
 	return &webhookServiceImpl{
 		apiClient:  apiClient,
-		httpClient: &http.Client{Timeout: 30 * time.Second},
+		httpClient: httpclient.GetGlobalClientWithTimeout("github", 30*time.Second),
 		baseURL:    "https://api.github.com",
 		token:      token,
 		logger:     logger,
+		limiter:    largescale.NewAdaptiveRateLimiter(),
+		hooks:      make(map[string][]*WebhookInfo),
 	}
 }
 
@@ -197,6 +225,12 @@ func (w *webhookServiceImpl) SetToken(token string) {
 	w.token = token
 }
 
+// SetRateLimiter makes bulk operations share limiter, e.g. with repository
+// pipelines running against the same API budget.
+func (w *webhookServiceImpl) SetRateLimiter(limiter *largescale.AdaptiveRateLimiter) {
+	w.limiter = limiter
+}
+
 // doRequest performs an HTTP request with authentication.
 func (w *webhookServiceImpl) doRequest(ctx context.Context, method, url string, body any) (*http.Response, error) {
 	var bodyReader io.Reader
@@ -220,7 +254,23 @@ func (w *webhookServiceImpl) doRequest(ctx context.Context, method, url string,
 	req.Header.Set("Content-Type", "application/json")
 	req.Header.Set("User-Agent", "gzh-cli")
 
-	return w.httpClient.Do(req)
+	resp, err := w.httpClient.Do(req)
+	if err == nil {
+		w.observeRateLimit(resp.Header)
+	}
+
+	return resp, err
+}
+
+// observeRateLimit feeds the rate limit headers of a response into the limiter.
+func (w *webhookServiceImpl) observeRateLimit(header http.Header) {
+	if remaining, err := strconv.Atoi(header.Get("X-RateLimit-Remaining")); err == nil {
+		w.limiter.UpdateRemaining(remaining)
+	}
+
+	if reset, err := strconv.ParseInt(header.Get("X-RateLimit-Reset"), 10, 64); err == nil {
+		w.limiter.UpdateResetTime(time.Unix(reset, 0))
+	}
 }
 
 // Repository webhook operations
@@ -270,6 +320,9 @@ func (w *webhookServiceImpl) CreateRepositoryWebhook(ctx context.Context, owner,
 	}
 
 	webhook.Repository = fmt.Sprintf("%s/%s", owner, repo)
+	w.updateCachedWebhooks(owner, repo, func(hooks []*WebhookInfo) []*WebhookInfo {
+		return append(hooks, &webhook)
+	})
 	w.logger.Info("Successfully created repository webhook", "webhook_id", webhook.ID)
 
 	return &webhook, nil
@@ -341,9 +394,41 @@ func (w *webhookServiceImpl) ListRepositoryWebhooks(ctx context.Context, owner,
 		wh.Repository = fmt.Sprintf("%s/%s", owner, repo)
 	}
 
+	// Only a complete first page describes all webhooks of the repository
+	if page == 1 && len(webhooks) < perPage {
+		w.hooksMu.Lock()
+		w.hooks[owner+"/"+repo] = slices.Clone(webhooks)
+		w.hooksMu.Unlock()
+	}
+
 	return webhooks, nil
 }
 
+// repositoryWebhooks returns the webhooks of a repository, listing them only
+// when they are not cached yet.
+func (w *webhookServiceImpl) repositoryWebhooks(ctx context.Context, owner, repo string) ([]*WebhookInfo, error) {
+	w.hooksMu.Lock()
+	hooks, ok := w.hooks[owner+"/"+repo]
+	w.hooksMu.Unlock()
+
+	if ok {
+		return hooks, nil
+	}
+
+	return w.ListRepositoryWebhooks(ctx, owner, repo, nil)
+}
+
+// updateCachedWebhooks replaces the cached webhooks of a repository with the
+// result of fn, which receives a copy. Uncached repositories are left alone.
+func (w *webhookServiceImpl) updateCachedWebhooks(owner, repo string, fn func([]*WebhookInfo) []*WebhookInfo) {
+	w.hooksMu.Lock()
+	defer w.hooksMu.Unlock()
+
+	if hooks, ok := w.hooks[owner+"/"+repo]; ok {
+		w.hooks[owner+"/"+repo] = fn(slices.Clone(hooks))
+	}
+}
+
 // UpdateRepositoryWebhook updates an existing webhook for a repository.
 func (w *webhookServiceImpl) UpdateRepositoryWebhook(ctx context.Context, owner, repo string, request *WebhookUpdateRequest) (*WebhookInfo, error) {
 	w.logger.Info("Updating repository webhook", "owner", owner, "repo", repo, "webhook_id", request.ID)
@@ -393,6 +478,15 @@ func (w *webhookServiceImpl) UpdateRepositoryWebhook(ctx context.Context, owner,
 	}
 
 	webhook.Repository = fmt.Sprintf("%s/%s", owner, repo)
+	w.updateCachedWebhooks(owner, repo, func(hooks []*WebhookInfo) []*WebhookInfo {
+		for i, hook := range hooks {
+			if hook.ID == webhook.ID {
+				hooks[i] = &webhook
+			}
+		}
+
+		return hooks
+	})
 	w.logger.Info("Successfully updated repository webhook", "webhook_id", webhook.ID)
 
 	return &webhook, nil
@@ -414,6 +508,9 @@ func (w *webhookServiceImpl) DeleteRepositoryWebhook(ctx context.Context, owner,
 		return fmt.Errorf("failed to delete webhook: HTTP %d - %s", resp.StatusCode, string(body))
 	}
 
+	w.updateCachedWebhooks(owner, repo, func(hooks []*WebhookInfo) []*WebhookInfo {
+		return slices.DeleteFunc(hooks, func(hook *WebhookInfo) bool { return hook.ID == webhookID })
+	})
 	w.logger.Info("Successfully deleted repository webhook", "webhook_id", webhookID)
 
 	return nil
@@ -620,47 +717,30 @@ func (w *webhookServiceImpl) DeleteOrganizationWebhook(ctx context.Context, org
 func (w *webhookServiceImpl) BulkCreateWebhooks(ctx context.Context, request *BulkWebhookRequest) (*BulkWebhookResult, error) {
 	w.logger.Info("Starting bulk webhook creation", "org", request.Organization)
 
-	startTime := time.Now()
-	result := &BulkWebhookResult{
-		Results: make([]WebhookOperationResult, 0),
-	}
-
-	// Get repositories to process
-	repositories := request.Repositories
-	if len(repositories) == 0 {
-		// Get all repositories from organization
-		// TODO: Implement using APIClient.ListOrganizationRepositories
-		repositories = []string{"repo1", "repo2"} // Mock for now
-	}
-
-	result.TotalRepositories = len(repositories)
-
-	// Create webhooks for each repository
-	for _, repo := range repositories {
-		opResult := WebhookOperationResult{
-			Repository: repo,
-			Operation:  "create",
-		}
+	result, err := w.runBulk(ctx, request.Organization, request.Repositories, request.Filters, request.BulkWebhookOptions,
+		func(ctx context.Context, repo string) []WebhookOperationResult {
+			opResult := WebhookOperationResult{
+				Repository: repo,
+				Operation:  "create",
+			}
 
-		opStartTime := time.Now()
-		webhook, err := w.CreateRepositoryWebhook(ctx, request.Organization, repo, &request.Template)
-		opDuration := time.Since(opStartTime)
-		opResult.Duration = opDuration.String()
+			opStartTime := time.Now()
+			webhook, err := w.CreateRepositoryWebhook(ctx, request.Organization, repo, &request.Template)
+			opResult.Duration = time.Since(opStartTime).String()
 
-		if err != nil {
-			opResult.Success = false
-			opResult.Error = err.Error()
-			result.FailureCount++
-		} else {
-			opResult.Success = true
-			opResult.WebhookInfo = webhook
-			result.SuccessCount++
-		}
+			if err != nil {
+				opResult.Error = err.Error()
+			} else {
+				opResult.Success = true
+				opResult.WebhookInfo = webhook
+			}
 
-		result.Results = append(result.Results, opResult)
+			return []WebhookOperationResult{opResult}
+		})
+	if err != nil {
+		return nil, fmt.Errorf("bulk webhook creation failed: %w", err)
 	}
 
-	result.ExecutionTime = time.Since(startTime).String()
 	w.logger.Info("Completed bulk webhook creation",
 		"total", result.TotalRepositories,
 		"success", result.SuccessCount,
@@ -673,53 +753,118 @@ func (w *webhookServiceImpl) BulkCreateWebhooks(ctx context.Context, request *Bu
 func (w *webhookServiceImpl) BulkUpdateWebhooks(ctx context.Context, request *BulkWebhookUpdateRequest) (*BulkWebhookResult, error) {
 	w.logger.Info("Starting bulk webhook update", "org", request.Organization)
 
+	result, err := w.runBulk(ctx, request.Organization, request.Repositories, request.Filters, request.BulkWebhookOptions,
+		func(ctx context.Context, repo string) []WebhookOperationResult {
+			return w.forSelectedWebhooks(ctx, request.Organization, repo, &request.SelectBy, "update",
+				func(existing *WebhookInfo) (*WebhookInfo, error) {
+					update := request.Template
+					update.ID = existing.ID
+
+					return w.UpdateRepositoryWebhook(ctx, request.Organization, repo, &update)
+				})
+		})
+	if err != nil {
+		return nil, fmt.Errorf("bulk webhook update failed: %w", err)
+	}
+
+	return result, nil
+}
+
+// BulkDeleteWebhooks deletes webhooks across multiple repositories.
+func (w *webhookServiceImpl) BulkDeleteWebhooks(ctx context.Context, request *BulkWebhookDeleteRequest) (*BulkWebhookResult, error) {
+	w.logger.Info("Starting bulk webhook deletion", "org", request.Organization)
+
+	result, err := w.runBulk(ctx, request.Organization, request.Repositories, request.Filters, request.BulkWebhookOptions,
+		func(ctx context.Context, repo string) []WebhookOperationResult {
+			return w.forSelectedWebhooks(ctx, request.Organization, repo, &request.SelectBy, "delete",
+				func(existing *WebhookInfo) (*WebhookInfo, error) {
+					return nil, w.DeleteRepositoryWebhook(ctx, request.Organization, repo, existing.ID)
+				})
+		})
+	if err != nil {
+		return nil, fmt.Errorf("bulk webhook deletion failed: %w", err)
+	}
+
+	return result, nil
+}
+
+// runBulk runs op for every repository of a bulk request on a bounded number
+// of workers paced by the service rate limiter. Without explicit
+// repositories, the organization is listed page by page and work starts with
+// the first page. Results are counted and delivered from a single goroutine.
+func (w *webhookServiceImpl) runBulk(
+	ctx context.Context,
+	org string,
+	repositories []string,
+	filters *RepositoryFilters,
+	opts BulkWebhookOptions,
+	op func(ctx context.Context, repo string) []WebhookOperationResult,
+) (*BulkWebhookResult, error) {
 	startTime := time.Now()
 	result := &BulkWebhookResult{
 		Results: make([]WebhookOperationResult, 0),
 	}
 
-	// Get repositories to process
-	repositories := request.Repositories
-	if len(repositories) == 0 {
-		repositories = []string{"repo1", "repo2"} // Mock for now
+	source := func(ctx context.Context, yield func(*Repository) error) error {
+		for _, name := range repositories {
+			if err := yield(&Repository{Name: name}); err != nil {
+				return err
+			}
+		}
+
+		return nil
 	}
 
-	result.TotalRepositories = len(repositories)
+	if len(repositories) == 0 {
+		client := NewRepoConfigClient(w.token)
+		client.SetBaseURL(w.baseURL)
+
+		source = func(ctx context.Context, yield func(*Repository) error) error {
+			return client.ForEachRepositoryPage(ctx, org, &ListOptions{PerPage: 100}, func(repos []*Repository) error {
+				for _, repo := range repos {
+					if !filters.allows(repo, time.Now()) {
+						continue
+					}
+
+					if err := yield(repo); err != nil {
+						return err
+					}
+				}
 
-	// Update webhooks for each repository
-	for _, repo := range repositories {
-		// Find webhooks matching the selector
-		existingWebhooks, err := w.ListRepositoryWebhooks(ctx, request.Organization, repo, nil)
-		if err != nil {
-			continue
+				return nil
+			})
 		}
+	}
 
-		for _, existing := range existingWebhooks {
-			if w.webhookMatchesSelector(existing, &request.SelectBy) {
-				opResult := WebhookOperationResult{
-					Repository: repo,
-					Operation:  "update",
-				}
+	fetch := func(ctx context.Context, repo *Repository) ([]WebhookOperationResult, error) {
+		return op(ctx, repo.Name), nil
+	}
 
-				request.Template.ID = existing.ID
-				opStartTime := time.Now()
-				webhook, err := w.UpdateRepositoryWebhook(ctx, request.Organization, repo, &request.Template)
-				opDuration := time.Since(opStartTime)
-				opResult.Duration = opDuration.String()
-
-				if err != nil {
-					opResult.Success = false
-					opResult.Error = err.Error()
-					result.FailureCount++
-				} else {
-					opResult.Success = true
-					opResult.WebhookInfo = webhook
-					result.SuccessCount++
-				}
+	err := runPipeline(ctx, source, opts.Concurrency, w.limiter, nil, fetch, func(res PipelineResult[[]WebhookOperationResult]) error {
+		result.TotalRepositories++
+
+		if res.Err != nil {
+			res.Value = []WebhookOperationResult{{Repository: res.Repository.Name, Error: res.Err.Error()}}
+		}
 
+		for _, opResult := range res.Value {
+			if opResult.Success {
+				result.SuccessCount++
+			} else {
+				result.FailureCount++
+			}
+
+			if opts.OnResult != nil {
+				opts.OnResult(opResult)
+			} else {
 				result.Results = append(result.Results, opResult)
 			}
 		}
+
+		return nil
+	})
+	if err != nil {
+		return nil, err
 	}
 
 	result.ExecutionTime = time.Since(startTime).String()
@@ -727,57 +872,42 @@ func (w *webhookServiceImpl) BulkUpdateWebhooks(ctx context.Context, request *Bu
 	return result, nil
 }
 
-// BulkDeleteWebhooks deletes webhooks across multiple repositories.
-func (w *webhookServiceImpl) BulkDeleteWebhooks(ctx context.Context, request *BulkWebhookDeleteRequest) (*BulkWebhookResult, error) {
-	w.logger.Info("Starting bulk webhook deletion", "org", request.Organization)
-
-	startTime := time.Now()
-	result := &BulkWebhookResult{
-		Results: make([]WebhookOperationResult, 0),
-	}
-
-	repositories := request.Repositories
-	if len(repositories) == 0 {
-		repositories = []string{"repo1", "repo2"} // Mock for now
+// forSelectedWebhooks applies fn to the webhooks of a repository matching
+// selector. A failure to list the webhooks is reported as a single failed
+// result.
+func (w *webhookServiceImpl) forSelectedWebhooks(ctx context.Context, owner, repo string, selector *WebhookSelector, operation string, fn func(*WebhookInfo) (*WebhookInfo, error)) []WebhookOperationResult {
+	existingWebhooks, err := w.repositoryWebhooks(ctx, owner, repo)
+	if err != nil {
+		return []WebhookOperationResult{{Repository: repo, Operation: operation, Error: err.Error()}}
 	}
 
-	result.TotalRepositories = len(repositories)
+	var results []WebhookOperationResult
 
-	for _, repo := range repositories {
-		existingWebhooks, err := w.ListRepositoryWebhooks(ctx, request.Organization, repo, nil)
-		if err != nil {
+	for _, existing := range existingWebhooks {
+		if !w.webhookMatchesSelector(existing, selector) {
 			continue
 		}
 
-		for _, existing := range existingWebhooks {
-			if w.webhookMatchesSelector(existing, &request.SelectBy) {
-				opResult := WebhookOperationResult{
-					Repository: repo,
-					Operation:  "delete",
-				}
+		opResult := WebhookOperationResult{
+			Repository: repo,
+			Operation:  operation,
+		}
 
-				opStartTime := time.Now()
-				err := w.DeleteRepositoryWebhook(ctx, request.Organization, repo, existing.ID)
-				opDuration := time.Since(opStartTime)
-				opResult.Duration = opDuration.String()
-
-				if err != nil {
-					opResult.Success = false
-					opResult.Error = err.Error()
-					result.FailureCount++
-				} else {
-					opResult.Success = true
-					result.SuccessCount++
-				}
+		opStartTime := time.Now()
+		webhook, err := fn(existing)
+		opResult.Duration = time.Since(opStartTime).String()
 
-				result.Results = append(result.Results, opResult)
-			}
+		if err != nil {
+			opResult.Error = err.Error()
+		} else {
+			opResult.Success = true
+			opResult.WebhookInfo = webhook
 		}
-	}
 
-	result.ExecutionTime = time.Since(startTime).String()
+		results = append(results, opResult)
+	}
 
-	return result, nil
+	return results
 }
 
 // TestWebhook tests a webhook by sending a ping event.
@@ -879,4 +1009,46 @@ func (w *webhookServiceImpl) webhookMatchesSelector(webhook *WebhookInfo, select
 	return true
 }
 
+// allows reports whether repo passes the filters; nil filters allow every
+// repository that is not archived.
+func (f *RepositoryFilters) allows(repo *Repository, now time.Time) bool {
+	if repo.Archived {
+		return false
+	}
+
+	if f == nil {
+		return true
+	}
+
+	if len(f.IncludeNames) > 0 && !slices.Contains(f.IncludeNames, repo.Name) {
+		return false
+	}
+
+	if slices.Contains(f.ExcludeNames, repo.Name) {
+		return false
+	}
+
+	// Without either visibility flag both visibilities are included
+	if (f.IncludePrivate || f.IncludePublic) && (repo.Private && !f.IncludePrivate || !repo.Private && !f.IncludePublic) {
+		return false
+	}
+
+	if len(f.Languages) > 0 && !slices.Contains(f.Languages, repo.Language) {
+		return false
+	}
+
+	if f.SizeLimit > 0 && int64(repo.Size) > f.SizeLimit {
+		return false
+	}
+
+	if f.LastUpdatedDays > 0 {
+		updated, err := time.Parse(time.RFC3339, repo.UpdatedAt)
+		if err == nil && now.Sub(updated) > time.Duration(f.LastUpdatedDays)*24*time.Hour {
+			return false
+		}
+	}
+
+	return true
+}
+
 // Logger interface is defined in constructors.go
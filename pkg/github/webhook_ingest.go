@@ -0,0 +1,464 @@
+package github
+
+import (
+	"context"
+	"errors"
+	"fmt"
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+var (
+	// ErrDuplicateDelivery is returned by WebhookIngestor.Enqueue for a
+	// delivery ID that was accepted before.
+	ErrDuplicateDelivery = errors.New("duplicate webhook delivery")
+	// ErrIngestQueueFull is returned by WebhookIngestor.Enqueue when the
+	// queue has no room; the delivery should be rejected so GitHub retries it.
+	ErrIngestQueueFull = errors.New("webhook ingest queue is full")
+	// ErrIngestorStopped is returned by WebhookIngestor.Enqueue after Stop.
+	ErrIngestorStopped = errors.New("webhook ingestor is stopped")
+)
+
+// BatchEventStorage is implemented by storages that can write several events
+// in one operation. The ingestor falls back to StoreEvent for other storages.
+type BatchEventStorage interface {
+	StoreEvents(ctx context.Context, events []*GitHubEvent) error
+}
+
+// WebhookIngestConfig configures a WebhookIngestor.
+type WebhookIngestConfig struct {
+	// QueueSize is the number of accepted events waiting for a worker.
+	QueueSize int `json:"queueSize" yaml:"queueSize"`
+	// Workers is the number of goroutines draining the queue.
+	Workers int `json:"workers" yaml:"workers"`
+	// BatchSize caps the events a worker stores in one write.
+	BatchSize int `json:"batchSize" yaml:"batchSize"`
+	// BatchWindow is how long a worker waits to fill a batch.
+	BatchWindow time.Duration `json:"batchWindow" yaml:"batchWindow"`
+	// DedupWindow is how long a delivery ID is remembered.
+	DedupWindow time.Duration `json:"dedupWindow" yaml:"dedupWindow"`
+	// DedupCapacity caps the number of remembered delivery IDs.
+	DedupCapacity int `json:"dedupCapacity" yaml:"dedupCapacity"`
+}
+
+// DefaultWebhookIngestConfig returns the default ingestion configuration.
+func DefaultWebhookIngestConfig() *WebhookIngestConfig {
+	return &WebhookIngestConfig{
+		QueueSize:     1024,
+		Workers:       4,
+		BatchSize:     50,
+		BatchWindow:   100 * time.Millisecond,
+		DedupWindow:   time.Hour,
+		DedupCapacity: 10000,
+	}
+}
+
+// WebhookIngestMetrics reports the state of a WebhookIngestor.
+type WebhookIngestMetrics struct {
+	Received      int64 `json:"received"`
+	Accepted      int64 `json:"accepted"`
+	Duplicates    int64 `json:"duplicates"`
+	Rejected      int64 `json:"rejected"`
+	Stored        int64 `json:"stored"`
+	StoreErrors   int64 `json:"store_errors"`
+	Dispatched    int64 `json:"dispatched"`
+	DispatchFails int64 `json:"dispatch_failures"`
+	Batches       int64 `json:"batches"`
+	QueueDepth    int   `json:"queue_depth"`
+	QueueCapacity int   `json:"queue_capacity"`
+	// QueueHighWater is the deepest the queue has been.
+	QueueHighWater int64 `json:"queue_high_water"`
+}
+
+// WebhookIngestor decouples webhook acknowledgement from event processing.
+// Accepted deliveries are deduplicated by delivery ID and queued in a bounded
+// buffer; workers store them in batches and then hand them to the
+// dispatchers, so the webhook response time does not depend on how long
+// storage or handlers take.
+type WebhookIngestor struct {
+	storage     EventStorage
+	dispatchers []EventDispatcher
+	logger      Logger
+	config      *WebhookIngestConfig
+
+	mu      sync.RWMutex
+	queue   chan *GitHubEvent
+	stopped bool
+	wg      sync.WaitGroup
+
+	deliveries *deliverySet
+
+	received      atomic.Int64
+	accepted      atomic.Int64
+	duplicates    atomic.Int64
+	rejected      atomic.Int64
+	stored        atomic.Int64
+	storeErrors   atomic.Int64
+	dispatched    atomic.Int64
+	dispatchFails atomic.Int64
+	batches       atomic.Int64
+	highWater     atomic.Int64
+}
+
+// NewWebhookIngestor creates an ingestor that stores events in storage and
+// then passes them to every dispatcher in order.
+func NewWebhookIngestor(storage EventStorage, logger Logger, config *WebhookIngestConfig, dispatchers ...EventDispatcher) *WebhookIngestor {
+	defaults := DefaultWebhookIngestConfig()
+	if config == nil {
+		config = defaults
+	}
+
+	cfg := *config
+	if cfg.QueueSize <= 0 {
+		cfg.QueueSize = defaults.QueueSize
+	}
+
+	if cfg.Workers <= 0 {
+		cfg.Workers = defaults.Workers
+	}
+
+	if cfg.BatchSize <= 0 {
+		cfg.BatchSize = defaults.BatchSize
+	}
+
+	if cfg.DedupWindow <= 0 {
+		cfg.DedupWindow = defaults.DedupWindow
+	}
+
+	if cfg.DedupCapacity <= 0 {
+		cfg.DedupCapacity = defaults.DedupCapacity
+	}
+
+	return &WebhookIngestor{
+		storage:     storage,
+		dispatchers: dispatchers,
+		logger:      logger,
+		config:      &cfg,
+		queue:       make(chan *GitHubEvent, cfg.QueueSize),
+		deliveries:  newDeliverySet(cfg.DedupWindow, cfg.DedupCapacity),
+	}
+}
+
+// Start launches the workers. They run until Stop is called or ctx is done.
+func (wi *WebhookIngestor) Start(ctx context.Context) {
+	wi.logger.Info("Starting webhook ingestor",
+		"workers", wi.config.Workers,
+		"queue_size", wi.config.QueueSize,
+		"batch_size", wi.config.BatchSize)
+
+	for i := range wi.config.Workers {
+		wi.wg.Add(1)
+
+		go wi.worker(ctx, i)
+	}
+}
+
+// Stop stops accepting events and waits until the queued ones are processed
+// or ctx is done.
+func (wi *WebhookIngestor) Stop(ctx context.Context) error {
+	wi.mu.Lock()
+	if !wi.stopped {
+		wi.stopped = true
+		close(wi.queue)
+	}
+	wi.mu.Unlock()
+
+	done := make(chan struct{})
+
+	go func() {
+		wi.wg.Wait()
+		close(done)
+	}()
+
+	select {
+	case <-done:
+		return nil
+	case <-ctx.Done():
+		return fmt.Errorf("webhook ingestor stopped with %d queued events: %w", len(wi.queue), ctx.Err())
+	}
+}
+
+// Enqueue queues an event without blocking. It returns ErrDuplicateDelivery
+// for a delivery that was accepted before and ErrIngestQueueFull when the
+// queue has no room; a rejected delivery is not remembered so a retry of it
+// is accepted later.
+func (wi *WebhookIngestor) Enqueue(event *GitHubEvent) error {
+	wi.received.Add(1)
+
+	wi.mu.RLock()
+	defer wi.mu.RUnlock()
+
+	if wi.stopped {
+		wi.rejected.Add(1)
+		return ErrIngestorStopped
+	}
+
+	if !wi.deliveries.reserve(event.ID) {
+		wi.duplicates.Add(1)
+		return ErrDuplicateDelivery
+	}
+
+	select {
+	case wi.queue <- event:
+	default:
+		wi.deliveries.release(event.ID)
+		wi.rejected.Add(1)
+
+		return ErrIngestQueueFull
+	}
+
+	wi.accepted.Add(1)
+
+	depth := int64(len(wi.queue))
+	for {
+		high := wi.highWater.Load()
+		if depth <= high || wi.highWater.CompareAndSwap(high, depth) {
+			break
+		}
+	}
+
+	return nil
+}
+
+// GetMetrics returns a snapshot of the ingestion metrics.
+func (wi *WebhookIngestor) GetMetrics() *WebhookIngestMetrics {
+	return &WebhookIngestMetrics{
+		Received:       wi.received.Load(),
+		Accepted:       wi.accepted.Load(),
+		Duplicates:     wi.duplicates.Load(),
+		Rejected:       wi.rejected.Load(),
+		Stored:         wi.stored.Load(),
+		StoreErrors:    wi.storeErrors.Load(),
+		Dispatched:     wi.dispatched.Load(),
+		DispatchFails:  wi.dispatchFails.Load(),
+		Batches:        wi.batches.Load(),
+		QueueDepth:     len(wi.queue),
+		QueueCapacity:  cap(wi.queue),
+		QueueHighWater: wi.highWater.Load(),
+	}
+}
+
+func (wi *WebhookIngestor) worker(ctx context.Context, workerID int) {
+	defer wi.wg.Done()
+
+	wi.logger.Debug("Starting webhook ingest worker", "worker_id", workerID)
+
+	batch := make([]*GitHubEvent, 0, wi.config.BatchSize)
+
+	for {
+		var (
+			event *GitHubEvent
+			ok    bool
+		)
+
+		select {
+		case event, ok = <-wi.queue:
+		case <-ctx.Done():
+			return
+		}
+
+		if !ok {
+			return
+		}
+
+		batch = append(batch[:0], event)
+		open := wi.fillBatch(ctx, &batch)
+
+		wi.processBatch(ctx, batch)
+
+		if !open {
+			return
+		}
+	}
+}
+
+// fillBatch adds queued events to batch until it is full or the batch window
+// has passed. It reports false once the queue is closed and drained.
+func (wi *WebhookIngestor) fillBatch(ctx context.Context, batch *[]*GitHubEvent) bool {
+	var window <-chan time.Time
+
+	if wi.config.BatchWindow > 0 {
+		timer := time.NewTimer(wi.config.BatchWindow)
+		defer timer.Stop()
+
+		window = timer.C
+	}
+
+	for len(*batch) < wi.config.BatchSize {
+		// Take whatever is queued before waiting on the window
+		select {
+		case event, ok := <-wi.queue:
+			if !ok {
+				return false
+			}
+
+			*batch = append(*batch, event)
+
+			continue
+		default:
+		}
+
+		if window == nil {
+			return true
+		}
+
+		select {
+		case event, ok := <-wi.queue:
+			if !ok {
+				return false
+			}
+
+			*batch = append(*batch, event)
+		case <-window:
+			return true
+		case <-ctx.Done():
+			return true
+		}
+	}
+
+	return true
+}
+
+func (wi *WebhookIngestor) processBatch(ctx context.Context, batch []*GitHubEvent) {
+	wi.batches.Add(1)
+
+	for _, event := range wi.storeBatch(ctx, batch) {
+		for _, dispatcher := range wi.dispatchers {
+			if err := dispatcher.DispatchEvent(ctx, event); err != nil {
+				wi.dispatchFails.Add(1)
+				wi.logger.Error("Failed to dispatch event",
+					"dispatcher", fmt.Sprintf("%T", dispatcher),
+					"event_id", event.ID,
+					"error", err)
+
+				continue
+			}
+
+			wi.dispatched.Add(1)
+		}
+	}
+}
+
+// storeBatch writes the batch and returns the events that were stored. A
+// failed batch write is retried event by event so one bad event does not
+// hold back the others.
+func (wi *WebhookIngestor) storeBatch(ctx context.Context, batch []*GitHubEvent) []*GitHubEvent {
+	if wi.storage == nil {
+		return batch
+	}
+
+	if batchStorage, ok := wi.storage.(BatchEventStorage); ok && len(batch) > 1 {
+		err := batchStorage.StoreEvents(ctx, batch)
+		if err == nil {
+			wi.stored.Add(int64(len(batch)))
+			return batch
+		}
+
+		wi.logger.Warn("Batch event write failed, storing events individually",
+			"events", len(batch),
+			"error", err)
+	}
+
+	stored := batch[:0:0]
+
+	for _, event := range batch {
+		if err := wi.storage.StoreEvent(ctx, event); err != nil {
+			wi.storeErrors.Add(1)
+			wi.logger.Error("Failed to store event", "event_id", event.ID, "error", err)
+
+			// Let GitHub's redelivery of the lost event through
+			wi.deliveries.release(event.ID)
+
+			continue
+		}
+
+		stored = append(stored, event)
+	}
+
+	wi.stored.Add(int64(len(stored)))
+
+	return stored
+}
+
+// deliverySet remembers recently accepted delivery IDs. Entries expire after
+// the window and the oldest ones are evicted beyond the capacity.
+type deliverySet struct {
+	window   time.Duration
+	capacity int
+	now      func() time.Time
+
+	mu    sync.Mutex
+	seen  map[string]time.Time
+	order []string
+}
+
+func newDeliverySet(window time.Duration, capacity int) *deliverySet {
+	return &deliverySet{
+		window:   window,
+		capacity: capacity,
+		now:      time.Now,
+		seen:     make(map[string]time.Time),
+	}
+}
+
+// reserve records id and reports whether it was not seen within the window.
+// Events without a delivery ID are never treated as duplicates.
+func (d *deliverySet) reserve(id string) bool {
+	if id == "" {
+		return true
+	}
+
+	d.mu.Lock()
+	defer d.mu.Unlock()
+
+	now := d.now()
+	d.expire(now)
+
+	if _, ok := d.seen[id]; ok {
+		return false
+	}
+
+	d.seen[id] = now
+	d.order = append(d.order, id)
+
+	return true
+}
+
+// release forgets id so a later delivery of it is accepted.
+func (d *deliverySet) release(id string) {
+	d.mu.Lock()
+	defer d.mu.Unlock()
+
+	if _, ok := d.seen[id]; !ok {
+		return
+	}
+
+	delete(d.seen, id)
+
+	// Releases follow the reservation closely, so search from the newest end
+	for i := len(d.order) - 1; i >= 0; i-- {
+		if d.order[i] == id {
+			d.order = append(d.order[:i], d.order[i+1:]...)
+			break
+		}
+	}
+}
+
+func (d *deliverySet) expire(now time.Time) {
+	drop := 0
+
+	for _, id := range d.order {
+		if now.Sub(d.seen[id]) < d.window && len(d.order)-drop <= d.capacity {
+			break
+		}
+
+		delete(d.seen, id)
+
+		drop++
+	}
+
+	if drop > 0 {
+		d.order = append(d.order[:0], d.order[drop:]...)
+	}
+}
@@ -0,0 +1,232 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package github
+
+import (
+	"bytes"
+	"context"
+	"crypto/hmac"
+	"crypto/sha256"
+	"encoding/hex"
+	"fmt"
+	"net/http"
+	"net/http/httptest"
+	"sync"
+	"testing"
+	"time"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+type batchRecordingStorage struct {
+	mu      sync.Mutex
+	batches [][]string
+	single  []string
+}
+
+func (s *batchRecordingStorage) StoreEvents(_ context.Context, events []*GitHubEvent) error {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	ids := make([]string, 0, len(events))
+	for _, event := range events {
+		ids = append(ids, event.ID)
+	}
+
+	s.batches = append(s.batches, ids)
+
+	return nil
+}
+
+func (s *batchRecordingStorage) StoreEvent(_ context.Context, event *GitHubEvent) error {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	s.single = append(s.single, event.ID)
+
+	return nil
+}
+
+func (s *batchRecordingStorage) GetEvent(context.Context, string) (*GitHubEvent, error) {
+	return nil, fmt.Errorf("not implemented")
+}
+
+func (s *batchRecordingStorage) ListEvents(context.Context, *EventFilter, int, int) ([]*GitHubEvent, error) {
+	return nil, nil
+}
+
+func (s *batchRecordingStorage) DeleteEvent(context.Context, string) error { return nil }
+
+func (s *batchRecordingStorage) CountEvents(context.Context, *EventFilter) (int, error) {
+	return 0, nil
+}
+
+type recordingDispatcher struct {
+	mu      sync.Mutex
+	events  []string
+	release chan struct{}
+}
+
+func (d *recordingDispatcher) DispatchEvent(ctx context.Context, event *GitHubEvent) error {
+	if d.release != nil {
+		select {
+		case <-d.release:
+		case <-ctx.Done():
+			return ctx.Err()
+		}
+	}
+
+	d.mu.Lock()
+	defer d.mu.Unlock()
+
+	d.events = append(d.events, event.ID)
+
+	return nil
+}
+
+func TestWebhookIngestor_BatchesAndDispatches(t *testing.T) {
+	storage := &batchRecordingStorage{}
+	dispatcher := &recordingDispatcher{}
+
+	ingestor := NewWebhookIngestor(storage, &simpleLogger{}, &WebhookIngestConfig{
+		QueueSize:   16,
+		Workers:     1,
+		BatchSize:   4,
+		BatchWindow: time.Second,
+	}, dispatcher)
+
+	// Queue before starting so the worker sees full batches
+	for i := range 6 {
+		require.NoError(t, ingestor.Enqueue(&GitHubEvent{ID: fmt.Sprintf("delivery-%d", i), Type: "push"}))
+	}
+
+	require.ErrorIs(t, ingestor.Enqueue(&GitHubEvent{ID: "delivery-0", Type: "push"}), ErrDuplicateDelivery)
+
+	ingestor.Start(context.Background())
+	require.NoError(t, ingestor.Stop(context.Background()))
+
+	assert.Equal(t, [][]string{
+		{"delivery-0", "delivery-1", "delivery-2", "delivery-3"},
+		{"delivery-4", "delivery-5"},
+	}, storage.batches)
+	assert.Empty(t, storage.single)
+	assert.Len(t, dispatcher.events, 6)
+
+	metrics := ingestor.GetMetrics()
+	assert.Equal(t, int64(7), metrics.Received)
+	assert.Equal(t, int64(6), metrics.Accepted)
+	assert.Equal(t, int64(1), metrics.Duplicates)
+	assert.Equal(t, int64(6), metrics.Stored)
+	assert.Equal(t, int64(2), metrics.Batches)
+	assert.Equal(t, int64(6), metrics.QueueHighWater)
+	assert.Equal(t, 16, metrics.QueueCapacity)
+
+	require.ErrorIs(t, ingestor.Enqueue(&GitHubEvent{ID: "late"}), ErrIngestorStopped)
+}
+
+func TestWebhookIngestor_QueueFull(t *testing.T) {
+	ingestor := NewWebhookIngestor(nil, &simpleLogger{}, &WebhookIngestConfig{QueueSize: 1, Workers: 1})
+
+	require.NoError(t, ingestor.Enqueue(&GitHubEvent{ID: "first"}))
+	require.ErrorIs(t, ingestor.Enqueue(&GitHubEvent{ID: "second"}), ErrIngestQueueFull)
+
+	// A rejected delivery is accepted once GitHub retries it
+	<-ingestor.queue
+	require.NoError(t, ingestor.Enqueue(&GitHubEvent{ID: "second"}))
+	assert.Equal(t, int64(1), ingestor.GetMetrics().Rejected)
+}
+
+type failingEventStorage struct {
+	batchRecordingStorage
+}
+
+func (s *failingEventStorage) StoreEvent(context.Context, *GitHubEvent) error {
+	return fmt.Errorf("disk full")
+}
+
+func TestWebhookIngestor_StoreFailureAllowsRedelivery(t *testing.T) {
+	ingestor := NewWebhookIngestor(&failingEventStorage{}, &simpleLogger{}, &WebhookIngestConfig{QueueSize: 4, Workers: 1})
+
+	require.NoError(t, ingestor.Enqueue(&GitHubEvent{ID: "lost"}))
+	assert.Empty(t, ingestor.storeBatch(context.Background(), []*GitHubEvent{<-ingestor.queue}))
+
+	// The event was never stored, so GitHub's redelivery is not a duplicate
+	require.NoError(t, ingestor.Enqueue(&GitHubEvent{ID: "lost"}))
+	assert.Equal(t, int64(1), ingestor.GetMetrics().StoreErrors)
+}
+
+func TestEventWebhookServer_HandleWebhook_Ingestor(t *testing.T) {
+	const secret = "test-secret"
+
+	storage := &batchRecordingStorage{}
+	dispatcher := &recordingDispatcher{release: make(chan struct{})}
+
+	processor := NewEventProcessor(storage, &simpleLogger{})
+	ingestor := NewWebhookIngestor(storage, &simpleLogger{}, &WebhookIngestConfig{Workers: 1, BatchWindow: time.Millisecond}, dispatcher)
+	ingestor.Start(context.Background())
+
+	server := NewEventWebhookServer(processor, secret, &simpleLogger{})
+	server.SetIngestor(ingestor)
+
+	body := []byte(`{"action":"opened","repository":{"name":"repo","owner":{"login":"org"}}}`)
+	mac := hmac.New(sha256.New, []byte(secret))
+	mac.Write(body)
+	signature := "sha256=" + hex.EncodeToString(mac.Sum(nil))
+
+	deliver := func() int {
+		req := httptest.NewRequest(http.MethodPost, "/webhook", bytes.NewReader(body))
+		req.Header.Set("X-GitHub-Event", "pull_request")
+		req.Header.Set("X-GitHub-Delivery", "delivery-1")
+		req.Header.Set("X-Hub-Signature-256", signature)
+
+		w := httptest.NewRecorder()
+		server.HandleWebhook(w, req)
+
+		return w.Code
+	}
+
+	// The response does not wait for the blocked dispatcher
+	assert.Equal(t, http.StatusAccepted, deliver())
+	assert.Equal(t, http.StatusOK, deliver())
+
+	close(dispatcher.release)
+	require.NoError(t, ingestor.Stop(context.Background()))
+
+	assert.Equal(t, []string{"delivery-1"}, dispatcher.events)
+	assert.Equal(t, []string{"delivery-1"}, storage.single)
+}
+
+func TestDeliverySet_Expiry(t *testing.T) {
+	set := newDeliverySet(time.Minute, 2)
+	now := time.Now()
+	set.now = func() time.Time { return now }
+
+	assert.True(t, set.reserve("a"))
+	assert.False(t, set.reserve("a"))
+	assert.True(t, set.reserve(""))
+	assert.True(t, set.reserve(""))
+
+	now = now.Add(2 * time.Minute)
+	assert.True(t, set.reserve("a"))
+
+	// The oldest IDs are evicted beyond the capacity
+	assert.True(t, set.reserve("b"))
+	assert.True(t, set.reserve("c"))
+	assert.True(t, set.reserve("d"))
+	assert.True(t, set.reserve("a"))
+	assert.False(t, set.reserve("d"))
+}
+
+func TestDeliverySet_ReleaseForgetsPosition(t *testing.T) {
+	set := newDeliverySet(time.Minute, 2)
+
+	assert.True(t, set.reserve("a"))
+	set.release("a")
+
+	// The re-reservation must not be evicted as if it were the released one
+	assert.True(t, set.reserve("b"))
+	assert.True(t, set.reserve("a"))
+	assert.True(t, set.reserve("c"))
+	assert.False(t, set.reserve("a"))
+	assert.Equal(t, []string{"a", "c"}, set.order)
+}
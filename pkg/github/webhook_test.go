@@ -3,13 +3,24 @@ package github
 
 import (
 	"context"
+	"encoding/json"
+	"fmt"
+	"net/http"
+	"net/http/httptest"
+	"strconv"
+	"strings"
+	"sync"
+	"sync/atomic"
 	"testing"
+	"time"
 
 	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
 )
 
 // mockWebhookLogger implements the Logger interface for testing.
 type mockWebhookLogger struct {
+	mu   sync.Mutex
 	logs []mockWebhookLogEntry
 }
 
@@ -20,18 +31,30 @@ type mockWebhookLogEntry struct {
 }
 
 func (l *mockWebhookLogger) Debug(msg string, fields ...any) {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+
 	l.logs = append(l.logs, mockWebhookLogEntry{"debug", msg, fields})
 }
 
 func (l *mockWebhookLogger) Info(msg string, fields ...any) {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+
 	l.logs = append(l.logs, mockWebhookLogEntry{"info", msg, fields})
 }
 
 func (l *mockWebhookLogger) Warn(msg string, fields ...any) {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+
 	l.logs = append(l.logs, mockWebhookLogEntry{"warn", msg, fields})
 }
 
 func (l *mockWebhookLogger) Error(msg string, fields ...any) {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+
 	l.logs = append(l.logs, mockWebhookLogEntry{"error", msg, fields})
 }
 
@@ -219,8 +242,7 @@ func TestWebhookService_CreateOrganizationWebhook(t *testing.T) {
 }
 
 func TestWebhookService_BulkCreateWebhooks(t *testing.T) {
-	logger := &mockWebhookLogger{}
-	service := NewWebhookService(nil, logger)
+	service := newWebhookTestService(t, &webhookTestForge{})
 
 	request := &BulkWebhookRequest{
 		Organization: "testorg",
@@ -534,3 +556,179 @@ func BenchmarkWebhookMatchesSelector(b *testing.B) {
 		service.webhookMatchesSelector(webhook, selector)
 	}
 }
+
+// webhookTestForge serves an organization of repositories, each with one
+// "ci" webhook, and counts the hook listings per repository.
+type webhookTestForge struct {
+	repos    int
+	listings sync.Map // repo name → *atomic.Int32
+	inFlight atomic.Int32
+	peak     atomic.Int32
+}
+
+func (f *webhookTestForge) ServeHTTP(w http.ResponseWriter, r *http.Request) {
+	w.Header().Set("X-RateLimit-Remaining", "5000")
+	w.Header().Set("X-RateLimit-Reset", strconv.FormatInt(time.Now().Add(-time.Minute).Unix(), 10))
+
+	if strings.HasPrefix(r.URL.Path, "/orgs/") {
+		page, _ := strconv.Atoi(r.URL.Query().Get("page"))
+		perPage, _ := strconv.Atoi(r.URL.Query().Get("per_page"))
+
+		var repos []*Repository
+		for i := (page - 1) * perPage; i < min(page*perPage, f.repos); i++ {
+			repos = append(repos, &Repository{Name: fmt.Sprintf("repo-%d", i), Archived: i == 0})
+		}
+
+		_ = json.NewEncoder(w).Encode(repos)
+
+		return
+	}
+
+	current := f.inFlight.Add(1)
+	defer f.inFlight.Add(-1)
+
+	for {
+		old := f.peak.Load()
+		if current <= old || f.peak.CompareAndSwap(old, current) {
+			break
+		}
+	}
+
+	time.Sleep(2 * time.Millisecond)
+
+	// /repos/testorg/<repo>/hooks[/<id>]
+	parts := strings.Split(strings.Trim(r.URL.Path, "/"), "/")
+	repo := parts[2]
+
+	switch r.Method {
+	case http.MethodGet:
+		counter, _ := f.listings.LoadOrStore(repo, &atomic.Int32{})
+		counter.(*atomic.Int32).Add(1)
+
+		_ = json.NewEncoder(w).Encode([]*WebhookInfo{{ID: 1, Name: "ci", Active: true, Events: []string{"push"}}})
+	case http.MethodPost:
+		w.WriteHeader(http.StatusCreated)
+		_ = json.NewEncoder(w).Encode(&WebhookInfo{ID: 2, Name: "web"})
+	case http.MethodPatch:
+		_ = json.NewEncoder(w).Encode(&WebhookInfo{ID: 1, Name: "ci", Active: false})
+	case http.MethodDelete:
+		w.WriteHeader(http.StatusNoContent)
+	}
+}
+
+func newWebhookTestService(t *testing.T, forge *webhookTestForge) *webhookServiceImpl {
+	t.Helper()
+
+	server := httptest.NewServer(forge)
+	t.Cleanup(server.Close)
+
+	service := NewWebhookServiceWithToken(nil, "test-token", &mockWebhookLogger{}).(*webhookServiceImpl)
+	service.baseURL = server.URL
+	service.limiter = newPipelineTestLimiter()
+
+	return service
+}
+
+func TestWebhookService_BulkCreateWebhooks_Organization(t *testing.T) {
+	forge := &webhookTestForge{repos: 25}
+	service := newWebhookTestService(t, forge)
+
+	var streamed []string
+
+	result, err := service.BulkCreateWebhooks(context.Background(), &BulkWebhookRequest{
+		Organization: "testorg",
+		Template:     WebhookCreateRequest{Name: "web", URL: "https://example.com", Events: []string{"push"}},
+		Filters:      &RepositoryFilters{ExcludeNames: []string{"repo-1"}},
+		BulkWebhookOptions: BulkWebhookOptions{
+			Concurrency: 4,
+			OnResult:    func(r WebhookOperationResult) { streamed = append(streamed, r.Repository) },
+		},
+	})
+	require.NoError(t, err)
+
+	// repo-0 is archived and repo-1 is excluded
+	assert.Equal(t, 23, result.TotalRepositories)
+	assert.Equal(t, 23, result.SuccessCount)
+	assert.Empty(t, result.Results, "results are streamed")
+	assert.Len(t, streamed, 23)
+	assert.NotContains(t, streamed, "repo-0")
+	assert.NotContains(t, streamed, "repo-1")
+	assert.LessOrEqual(t, forge.peak.Load(), int32(4))
+	assert.Greater(t, forge.peak.Load(), int32(1), "repositories are processed concurrently")
+}
+
+func TestWebhookService_BulkUpdateAndDelete_CachesListings(t *testing.T) {
+	forge := &webhookTestForge{repos: 3}
+	service := newWebhookTestService(t, forge)
+	repos := []string{"repo-0", "repo-1", "repo-2"}
+	active := false
+
+	updated, err := service.BulkUpdateWebhooks(context.Background(), &BulkWebhookUpdateRequest{
+		Organization: "testorg",
+		Repositories: repos,
+		Template:     WebhookUpdateRequest{Active: &active},
+		SelectBy:     WebhookSelector{ByName: "ci"},
+	})
+	require.NoError(t, err)
+	assert.Equal(t, 3, updated.SuccessCount)
+	assert.Len(t, updated.Results, 3)
+
+	// The update is reflected in the cached listing, so the active selector
+	// no longer matches
+	selectActive := true
+	untouched, err := service.BulkDeleteWebhooks(context.Background(), &BulkWebhookDeleteRequest{
+		Organization: "testorg",
+		Repositories: repos,
+		SelectBy:     WebhookSelector{ByName: "ci", Active: &selectActive},
+	})
+	require.NoError(t, err)
+	assert.Zero(t, untouched.SuccessCount+untouched.FailureCount)
+
+	deleted, err := service.BulkDeleteWebhooks(context.Background(), &BulkWebhookDeleteRequest{
+		Organization: "testorg",
+		Repositories: repos,
+		SelectBy:     WebhookSelector{ByName: "ci"},
+	})
+	require.NoError(t, err)
+	assert.Equal(t, 3, deleted.SuccessCount)
+
+	hooks, err := service.repositoryWebhooks(context.Background(), "testorg", "repo-0")
+	require.NoError(t, err)
+	assert.Empty(t, hooks)
+
+	for _, repo := range repos {
+		counter, ok := forge.listings.Load(repo)
+		require.True(t, ok)
+		assert.Equal(t, int32(1), counter.(*atomic.Int32).Load(), "webhooks of %s listed once", repo)
+	}
+}
+
+func TestRepositoryFilters_Allows(t *testing.T) {
+	now := time.Date(2025, 6, 1, 0, 0, 0, 0, time.UTC)
+	repo := &Repository{Name: "api", Private: true, Language: "Go", Size: 500, UpdatedAt: "2025-05-20T00:00:00Z"}
+
+	tests := []struct {
+		name    string
+		filters *RepositoryFilters
+		want    bool
+	}{
+		{"nil filters", nil, true},
+		{"included", &RepositoryFilters{IncludeNames: []string{"api"}}, true},
+		{"not included", &RepositoryFilters{IncludeNames: []string{"web"}}, false},
+		{"excluded", &RepositoryFilters{ExcludeNames: []string{"api"}}, false},
+		{"private only", &RepositoryFilters{IncludePrivate: true}, true},
+		{"public only", &RepositoryFilters{IncludePublic: true}, false},
+		{"language", &RepositoryFilters{Languages: []string{"Rust"}}, false},
+		{"size limit", &RepositoryFilters{SizeLimit: 100}, false},
+		{"recently updated", &RepositoryFilters{LastUpdatedDays: 30}, true},
+		{"stale", &RepositoryFilters{LastUpdatedDays: 7}, false},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			assert.Equal(t, tt.want, tt.filters.allows(repo, now))
+		})
+	}
+
+	assert.False(t, (*RepositoryFilters)(nil).allows(&Repository{Archived: true}, now))
+}
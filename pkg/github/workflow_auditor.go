@@ -7,15 +7,24 @@ import (
 	"regexp"
 	"slices"
 	"strings"
+	"sync"
 	"time"
 
+	"golang.org/x/sync/errgroup"
+	"golang.org/x/sync/semaphore"
 	"gopkg.in/yaml.v3"
 )
 
 // WorkflowAuditor performs security audits on GitHub Actions workflows.
 type WorkflowAuditor struct {
-	logger    Logger
-	apiClient APIClient
+	logger      Logger
+	apiClient   APIClient
+	source      WorkflowSource
+	concurrency int
+	cacheDir    string // empty disables persistence
+
+	cachesMu sync.Mutex
+	caches   map[string]*WorkflowAuditCache // by organization
 }
 
 // WorkflowAuditResult represents the audit result for a repository.
@@ -179,14 +188,66 @@ type Step struct {
 	Env  map[string]string `yaml:"env"`
 }
 
-// NewWorkflowAuditor creates a new workflow auditor.
+// NewWorkflowAuditor creates a new workflow auditor. Workflows come from
+// sample content until a source is set with SetSource.
 func NewWorkflowAuditor(logger Logger, apiClient APIClient) *WorkflowAuditor {
 	return &WorkflowAuditor{
-		logger:    logger,
-		apiClient: apiClient,
+		logger:      logger,
+		apiClient:   apiClient,
+		source:      mockWorkflowSource{},
+		concurrency: DefaultPipelineConcurrency,
+		cacheDir:    filepath.Join(defaultDiskCacheDir(), "workflows"),
+		caches:      make(map[string]*WorkflowAuditCache),
 	}
 }
 
+// SetSource sets where workflow files are read from.
+func (wa *WorkflowAuditor) SetSource(source WorkflowSource) {
+	wa.source = source
+}
+
+// SetConcurrency sets how many repositories AuditOrganization audits at once.
+func (wa *WorkflowAuditor) SetConcurrency(workers int) {
+	if workers > 0 {
+		wa.concurrency = workers
+	}
+}
+
+// SetCacheDir sets the directory organization audits persist their workflow
+// cache to. An empty directory keeps the cache in memory only.
+func (wa *WorkflowAuditor) SetCacheDir(dir string) {
+	wa.cacheDir = dir
+}
+
+// cache returns the workflow cache of an organization, creating an in-memory
+// one if the organization has not been audited yet.
+func (wa *WorkflowAuditor) cache(organization string) *WorkflowAuditCache {
+	wa.cachesMu.Lock()
+	defer wa.cachesMu.Unlock()
+
+	cache, ok := wa.caches[organization]
+	if !ok {
+		cache = NewWorkflowAuditCache()
+		wa.caches[organization] = cache
+	}
+
+	return cache
+}
+
+// loadCache replaces the organization's cache with the one persisted on disk.
+func (wa *WorkflowAuditor) loadCache(organization string) *WorkflowAuditCache {
+	cache := NewWorkflowAuditCache()
+	if wa.cacheDir != "" {
+		cache = LoadWorkflowAuditCache(filepath.Join(wa.cacheDir, organization+".json"))
+	}
+
+	wa.cachesMu.Lock()
+	wa.caches[organization] = cache
+	wa.cachesMu.Unlock()
+
+	return cache
+}
+
 // AuditRepository performs a comprehensive audit of all workflows in a repository.
 func (wa *WorkflowAuditor) AuditRepository(ctx context.Context, organization, repository string) (*WorkflowAuditResult, error) {
 	wa.logger.Info("Starting workflow audit", "organization", organization, "repository", repository)
@@ -202,18 +263,19 @@ func (wa *WorkflowAuditor) AuditRepository(ctx context.Context, organization, re
 	}
 
 	// Get workflow files from repository
-	workflowFiles, err := wa.getWorkflowFiles(ctx, organization, repository)
+	workflowFiles, err := wa.source.ListWorkflows(ctx, organization, repository)
 	if err != nil {
 		return result, fmt.Errorf("failed to get workflow files: %w", err)
 	}
 
 	result.TotalWorkflows = len(workflowFiles)
+	cache := wa.cache(organization)
 
 	// Audit each workflow file
 	for _, file := range workflowFiles {
-		fileAudit, err := wa.auditWorkflowFile(ctx, organization, repository, file)
+		fileAudit, err := wa.auditWorkflowFile(ctx, cache, organization, repository, file)
 		if err != nil {
-			wa.logger.Error("Failed to audit workflow file", "file", file, "error", err)
+			wa.logger.Error("Failed to audit workflow file", "file", file.Path, "error", err)
 			continue
 		}
 
@@ -235,7 +297,10 @@ func (wa *WorkflowAuditor) AuditRepository(ctx context.Context, organization, re
 	return result, nil
 }
 
-// AuditOrganization performs workflow audit across all repositories in an organization.
+// AuditOrganization audits all active repositories of an organization
+// concurrently. Workflow files shared between repositories are analyzed once,
+// and the analyses are persisted so later audits only analyze workflows that
+// changed. Results are returned in repository listing order.
 func (wa *WorkflowAuditor) AuditOrganization(ctx context.Context, organization string) ([]*WorkflowAuditResult, error) {
 	wa.logger.Info("Starting organization-wide workflow audit", "organization", organization)
 
@@ -244,53 +309,77 @@ func (wa *WorkflowAuditor) AuditOrganization(ctx context.Context, organization s
 		return nil, fmt.Errorf("failed to list repositories: %w", err)
 	}
 
-	results := make([]*WorkflowAuditResult, 0)
+	cache := wa.loadCache(organization)
+	audited := make([]*WorkflowAuditResult, len(repos))
+
+	g, gCtx := errgroup.WithContext(ctx)
+	sem := semaphore.NewWeighted(int64(wa.concurrency))
 
-	for _, repo := range repos {
+	for i, repo := range repos {
 		if repo.Archived || repo.Disabled {
 			continue
 		}
 
-		result, err := wa.AuditRepository(ctx, organization, repo.Name)
-		if err != nil {
-			wa.logger.Error("Failed to audit repository", "repository", repo.Name, "error", err)
-			continue
-		}
+		g.Go(func() error {
+			if err := sem.Acquire(gCtx, 1); err != nil {
+				return err
+			}
+			defer sem.Release(1)
+
+			result, err := wa.AuditRepository(gCtx, organization, repo.Name)
+			if err != nil {
+				wa.logger.Error("Failed to audit repository", "repository", repo.Name, "error", err)
+				return nil
+			}
+
+			audited[i] = result
+
+			return nil
+		})
+	}
+
+	if err := g.Wait(); err != nil {
+		return nil, fmt.Errorf("organization audit cancelled: %w", err)
+	}
+
+	results := make([]*WorkflowAuditResult, 0)
 
-		if result.TotalWorkflows > 0 {
+	for _, result := range audited {
+		if result != nil && result.TotalWorkflows > 0 {
 			results = append(results, result)
 		}
 	}
 
+	if err := cache.Save(); err != nil {
+		wa.logger.Warn("Failed to save workflow cache", "organization", organization, "error", err)
+	}
+
 	wa.logger.Info("Organization audit completed",
 		"organization", organization,
-		"audited_repositories", len(results))
+		"audited_repositories", len(results),
+		"unique_workflows", cache.Len())
 
 	return results, nil
 }
 
-// getWorkflowFiles retrieves all workflow files from a repository.
-func (wa *WorkflowAuditor) getWorkflowFiles(ctx context.Context, organization, repository string) ([]string, error) {
-	// In a real implementation, this would use GitHub API to get files from .github/workflows/
-	// For now, return mock workflow files
-	return []string{
-		".github/workflows/ci.yml",
-		".github/workflows/release.yml",
-		".github/workflows/security.yml",
-	}, nil
-}
+// auditWorkflowFile audits a workflow file, reusing the cached analysis of
+// its blob when another file with the same content was already audited.
+func (wa *WorkflowAuditor) auditWorkflowFile(ctx context.Context, cache *WorkflowAuditCache, organization, repository string, file WorkflowBlob) (*WorkflowFileAudit, error) {
+	return cache.audit(file.SHA, file.Path, func() (*WorkflowFileAudit, error) {
+		content, err := wa.source.ReadBlob(ctx, organization, repository, file.SHA)
+		if err != nil {
+			return nil, fmt.Errorf("failed to get file content: %w", err)
+		}
 
-// auditWorkflowFile performs security audit on a single workflow file.
-func (wa *WorkflowAuditor) auditWorkflowFile(ctx context.Context, organization, repository, filePath string) (*WorkflowFileAudit, error) {
-	// Get file content - in real implementation, this would fetch from GitHub API
-	content, err := wa.getFileContent(ctx, organization, repository, filePath)
-	if err != nil {
-		return nil, fmt.Errorf("failed to get file content: %w", err)
-	}
+		return wa.analyzeWorkflow(content, "")
+	})
+}
 
+// analyzeWorkflow performs security audit on the content of a workflow file.
+func (wa *WorkflowAuditor) analyzeWorkflow(content []byte, filePath string) (*WorkflowFileAudit, error) {
 	// Parse workflow YAML
 	var workflow WorkflowFile
-	if err := yaml.Unmarshal([]byte(content), &workflow); err != nil {
+	if err := yaml.Unmarshal(content, &workflow); err != nil {
 		return nil, fmt.Errorf("failed to parse workflow YAML: %w", err)
 	}
 
@@ -551,7 +640,7 @@ func (wa *WorkflowAuditor) extractSecretsUsage(step Step) []string {
 
 	// Check in step.Run
 	if step.Run != "" {
-		matches := regexp.MustCompile(`\$\{\{\s*secrets\.([A-Z_]+)\s*\}\}`).FindAllStringSubmatch(step.Run, -1)
+		matches := secretsUsagePattern.FindAllStringSubmatch(step.Run, -1)
 		for _, match := range matches {
 			if len(match) > 1 {
 				secrets = append(secrets, match[1])
@@ -561,7 +650,7 @@ func (wa *WorkflowAuditor) extractSecretsUsage(step Step) []string {
 
 	// Check in step.With
 	for _, value := range step.With {
-		matches := regexp.MustCompile(`\$\{\{\s*secrets\.([A-Z_]+)\s*\}\}`).FindAllStringSubmatch(value, -1)
+		matches := secretsUsagePattern.FindAllStringSubmatch(value, -1)
 		for _, match := range matches {
 			if len(match) > 1 {
 				secrets = append(secrets, match[1])
@@ -577,7 +666,7 @@ func (wa *WorkflowAuditor) extractVariablesUsage(step Step) []string {
 
 	// Check in step.Run
 	if step.Run != "" {
-		matches := regexp.MustCompile(`\$\{\{\s*vars\.([A-Z_]+)\s*\}\}`).FindAllStringSubmatch(step.Run, -1)
+		matches := variablesUsagePattern.FindAllStringSubmatch(step.Run, -1)
 		for _, match := range matches {
 			if len(match) > 1 {
 				variables = append(variables, match[1])
@@ -588,6 +677,40 @@ func (wa *WorkflowAuditor) extractVariablesUsage(step Step) []string {
 	return wa.removeDuplicates(variables)
 }
 
+// Patterns used by the step analyzers, compiled once.
+var (
+	secretsUsagePattern   = regexp.MustCompile(`\$\{\{\s*secrets\.([A-Z_]+)\s*\}\}`)
+	variablesUsagePattern = regexp.MustCompile(`\$\{\{\s*vars\.([A-Z_]+)\s*\}\}`)
+	commitSHAPattern      = regexp.MustCompile(`^[a-f0-9]{40}$`)
+
+	codeInjectionPatterns = mustCompilePatterns(
+		`\$\{\{\s*github\.event\..*\}\}`,
+		`\$\{\{\s*github\.head_ref\s*\}\}`,
+		`eval\s*\(`,
+		`exec\s*\(`,
+	)
+	secretExposurePatterns = mustCompilePatterns(
+		`echo.*\$\{\{\s*secrets\.`,
+		`printf.*\$\{\{\s*secrets\.`,
+		`cat.*\$\{\{\s*secrets\.`,
+	)
+	privilegeEscalationPatterns = mustCompilePatterns(
+		`sudo\s+chmod`,
+		`sudo\s+chown`,
+		`sudo\s+su`,
+		`chmod\s+777`,
+	)
+)
+
+func mustCompilePatterns(patterns ...string) []*regexp.Regexp {
+	compiled := make([]*regexp.Regexp, len(patterns))
+	for i, pattern := range patterns {
+		compiled[i] = regexp.MustCompile(pattern)
+	}
+
+	return compiled
+}
+
 // Security check methods
 
 func (wa *WorkflowAuditor) isHighRiskScope(scope string) bool {
@@ -600,9 +723,7 @@ func (wa *WorkflowAuditor) isActionPinned(uses string) bool {
 	parts := strings.Split(uses, "@")
 	if len(parts) > 1 {
 		version := parts[1]
-		matched, _ := regexp.MatchString(`^[a-f0-9]{40}$`, version)
-
-		return matched
+		return commitSHAPattern.MatchString(version)
 	}
 
 	return false
@@ -656,15 +777,8 @@ func (wa *WorkflowAuditor) isHighRiskAction(uses string) bool {
 
 func (wa *WorkflowAuditor) hasCodeInjectionRisk(script string) bool {
 	// Check for potential code injection patterns
-	patterns := []string{
-		`\$\{\{\s*github\.event\..*\}\}`,
-		`\$\{\{\s*github\.head_ref\s*\}\}`,
-		`eval\s*\(`,
-		`exec\s*\(`,
-	}
-
-	for _, pattern := range patterns {
-		if matched, _ := regexp.MatchString(pattern, script); matched {
+	for _, pattern := range codeInjectionPatterns {
+		if pattern.MatchString(script) {
 			return true
 		}
 	}
@@ -674,14 +788,8 @@ func (wa *WorkflowAuditor) hasCodeInjectionRisk(script string) bool {
 
 func (wa *WorkflowAuditor) hasSecretExposureRisk(script string) bool {
 	// Check for potential secret exposure
-	patterns := []string{
-		`echo.*\$\{\{\s*secrets\.`,
-		`printf.*\$\{\{\s*secrets\.`,
-		`cat.*\$\{\{\s*secrets\.`,
-	}
-
-	for _, pattern := range patterns {
-		if matched, _ := regexp.MatchString(pattern, script); matched {
+	for _, pattern := range secretExposurePatterns {
+		if pattern.MatchString(script) {
 			return true
 		}
 	}
@@ -691,15 +799,8 @@ func (wa *WorkflowAuditor) hasSecretExposureRisk(script string) bool {
 
 func (wa *WorkflowAuditor) hasPrivilegeEscalationRisk(script string) bool {
 	// Check for privilege escalation attempts
-	patterns := []string{
-		`sudo\s+chmod`,
-		`sudo\s+chown`,
-		`sudo\s+su`,
-		`chmod\s+777`,
-	}
-
-	for _, pattern := range patterns {
-		if matched, _ := regexp.MatchString(pattern, script); matched {
+	for _, pattern := range privilegeEscalationPatterns {
+		if pattern.MatchString(script) {
 			return true
 		}
 	}
@@ -921,63 +1022,6 @@ func (wa *WorkflowAuditor) generateSummary(result *WorkflowAuditResult) Workflow
 
 // Helper methods
 
-func (wa *WorkflowAuditor) getFileContent(ctx context.Context, organization, repository, filePath string) (string, error) {
-	// Mock implementation - in real world, this would fetch from GitHub API
-	return wa.getMockWorkflowContent(filepath.Base(filePath)), nil
-}
-
-func (wa *WorkflowAuditor) getMockWorkflowContent(filename string) string {
-	switch filename {
-	case "ci.yml":
-		return `
-name: CI
-on: [push, pull_request]
-permissions:
-  contents: read
-  packages: write
-jobs:
-  test:
-    runs-on: ubuntu-latest
-    steps:
-      - uses: actions/checkout@v4
-      - uses: actions/setup-node@v4
-        with:
-          node-version: '18'
-      - run: npm test
-`
-	case "release.yml":
-		return `
-name: Release
-on:
-  push:
-    tags: ['v*']
-permissions:
-  contents: write
-  packages: write
-jobs:
-  release:
-    runs-on: ubuntu-latest
-    steps:
-      - uses: actions/checkout@v4
-      - uses: docker/build-push-action@v4
-        with:
-          push: true
-          tags: myapp:latest
-`
-	default:
-		return `
-name: Default Workflow
-on: push
-jobs:
-  build:
-    runs-on: ubuntu-latest
-    steps:
-      - uses: actions/checkout@v4
-      - run: echo "Hello World"
-`
-	}
-}
-
 func (wa *WorkflowAuditor) getRecommendedPermission(scope, permission string) string {
 	if wa.isHighRiskScope(scope) && permission == "write" {
 		return "read"
@@ -559,7 +559,8 @@ func TestWorkflowAuditor_AuditWorkflowFile_Integration(t *testing.T) {
 	ctx := context.Background()
 
 	// Test CI workflow audit
-	audit, err := auditor.auditWorkflowFile(ctx, "testorg", "testrepo", ".github/workflows/ci.yml")
+	file := WorkflowBlob{Path: ".github/workflows/ci.yml", SHA: gitBlobSHA([]byte(mockWorkflowContent("ci.yml")))}
+	audit, err := auditor.auditWorkflowFile(ctx, NewWorkflowAuditCache(), "testorg", "testrepo", file)
 	require.NoError(t, err)
 	require.NotNil(t, audit)
 
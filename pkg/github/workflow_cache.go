@@ -0,0 +1,189 @@
+package github
+
+import (
+	"encoding/json"
+	"fmt"
+	"maps"
+	"os"
+	"path/filepath"
+	"slices"
+	"sync"
+)
+
+// workflowCacheVersion is bumped whenever the analysis rules change, so that
+// audits cached by older versions are discarded instead of reused.
+const workflowCacheVersion = 1
+
+// WorkflowAuditCache memoizes workflow analyses by git blob SHA. Identical
+// workflow files shared across repositories are read, parsed and analyzed
+// once; concurrent requests for the same SHA wait for the first analysis.
+//
+// Analyses are stored without a file path and relocated to the path of each
+// file they are served for.
+type WorkflowAuditCache struct {
+	mu      sync.Mutex
+	path    string // empty for a memory-only cache
+	entries map[string]*workflowCacheEntry
+}
+
+type workflowCacheEntry struct {
+	ready chan struct{} // closed once audit or err is set
+	audit *WorkflowFileAudit
+	err   error
+	used  bool // served during the current audit
+}
+
+// workflowCacheFile is the on-disk form of a WorkflowAuditCache.
+type workflowCacheFile struct {
+	Version int                           `json:"version"`
+	Audits  map[string]*WorkflowFileAudit `json:"audits"`
+}
+
+// NewWorkflowAuditCache creates an empty in-memory cache.
+func NewWorkflowAuditCache() *WorkflowAuditCache {
+	return &WorkflowAuditCache{entries: make(map[string]*workflowCacheEntry)}
+}
+
+// LoadWorkflowAuditCache opens the cache persisted at path. A missing,
+// corrupt or outdated file yields an empty cache that Save will replace.
+func LoadWorkflowAuditCache(path string) *WorkflowAuditCache {
+	cache := NewWorkflowAuditCache()
+	cache.path = path
+
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return cache
+	}
+
+	var file workflowCacheFile
+	if err := json.Unmarshal(data, &file); err != nil || file.Version != workflowCacheVersion {
+		return cache
+	}
+
+	for sha, audit := range file.Audits {
+		if audit == nil {
+			continue
+		}
+
+		entry := &workflowCacheEntry{ready: make(chan struct{}), audit: audit}
+		close(entry.ready)
+		cache.entries[sha] = entry
+	}
+
+	return cache
+}
+
+// Len returns the number of analyses in the cache.
+func (c *WorkflowAuditCache) Len() int {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	return len(c.entries)
+}
+
+// audit returns the analysis of the blob with the given SHA relocated to
+// filePath, calling analyze only if no analysis is cached or in flight.
+// Failed analyses are not cached.
+func (c *WorkflowAuditCache) audit(sha, filePath string, analyze func() (*WorkflowFileAudit, error)) (*WorkflowFileAudit, error) {
+	c.mu.Lock()
+
+	entry, ok := c.entries[sha]
+	if !ok {
+		entry = &workflowCacheEntry{ready: make(chan struct{})}
+		c.entries[sha] = entry
+	}
+
+	entry.used = true
+	c.mu.Unlock()
+
+	if !ok {
+		entry.audit, entry.err = analyze()
+		close(entry.ready)
+
+		if entry.err != nil {
+			c.mu.Lock()
+			delete(c.entries, sha)
+			c.mu.Unlock()
+		}
+	} else {
+		<-entry.ready
+	}
+
+	if entry.err != nil {
+		return nil, entry.err
+	}
+
+	return relocateWorkflowAudit(entry.audit, filePath), nil
+}
+
+// Save persists the analyses served since the cache was loaded, dropping
+// those of workflows no longer present. It is a no-op for memory-only caches.
+func (c *WorkflowAuditCache) Save() error {
+	if c.path == "" {
+		return nil
+	}
+
+	c.mu.Lock()
+
+	file := workflowCacheFile{Version: workflowCacheVersion, Audits: make(map[string]*WorkflowFileAudit)}
+
+	for sha, entry := range c.entries {
+		select {
+		case <-entry.ready:
+			if entry.used && entry.audit != nil {
+				file.Audits[sha] = entry.audit
+			}
+		default: // still being analyzed
+		}
+	}
+
+	c.mu.Unlock()
+
+	data, err := json.Marshal(file)
+	if err != nil {
+		return fmt.Errorf("failed to encode workflow cache: %w", err)
+	}
+
+	dir := filepath.Dir(c.path)
+	if err := os.MkdirAll(dir, 0o700); err != nil {
+		return fmt.Errorf("failed to create workflow cache directory: %w", err)
+	}
+
+	tmp, err := os.CreateTemp(dir, ".workflows-*")
+	if err != nil {
+		return fmt.Errorf("failed to write workflow cache: %w", err)
+	}
+
+	_, err = tmp.Write(data)
+	if closeErr := tmp.Close(); err == nil {
+		err = closeErr
+	}
+
+	if err == nil {
+		err = os.Rename(tmp.Name(), c.path)
+	}
+
+	if err != nil {
+		_ = os.Remove(tmp.Name())
+		return fmt.Errorf("failed to write workflow cache: %w", err)
+	}
+
+	return nil
+}
+
+// relocateWorkflowAudit copies a path-independent analysis for filePath.
+// Issue IDs were generated with an empty path, so the path is prefixed.
+func relocateWorkflowAudit(audit *WorkflowFileAudit, filePath string) *WorkflowFileAudit {
+	relocated := *audit
+	relocated.FilePath = filePath
+	relocated.Permissions = maps.Clone(audit.Permissions)
+	relocated.Jobs = slices.Clone(audit.Jobs)
+	relocated.Issues = slices.Clone(audit.Issues)
+
+	for i := range relocated.Issues {
+		relocated.Issues[i].ID = filePath + relocated.Issues[i].ID
+		relocated.Issues[i].FilePath = filePath
+	}
+
+	return &relocated
+}
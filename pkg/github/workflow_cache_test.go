@@ -0,0 +1,201 @@
+//nolint:testpackage // White-box testing needed for internal function access
+package github
+
+import (
+	"context"
+	"encoding/base64"
+	"fmt"
+	"net/http"
+	"net/http/httptest"
+	"os"
+	"path/filepath"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+	"github.com/stretchr/testify/require"
+)
+
+// countingWorkflowSource serves fixed workflow content and counts blob reads.
+type countingWorkflowSource struct {
+	mu    sync.Mutex
+	files map[string]string // path -> content
+	reads atomic.Int32
+}
+
+func newCountingWorkflowSource() *countingWorkflowSource {
+	files := make(map[string]string)
+	for _, name := range mockWorkflowFiles {
+		files[workflowsDir+"/"+name] = mockWorkflowContent(name)
+	}
+
+	return &countingWorkflowSource{files: files}
+}
+
+func (s *countingWorkflowSource) set(path, content string) {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	s.files[path] = content
+}
+
+func (s *countingWorkflowSource) ListWorkflows(_ context.Context, _, _ string) ([]WorkflowBlob, error) {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	blobs := make([]WorkflowBlob, 0, len(s.files))
+	for path, content := range s.files {
+		blobs = append(blobs, WorkflowBlob{Path: path, SHA: gitBlobSHA([]byte(content))})
+	}
+
+	return blobs, nil
+}
+
+func (s *countingWorkflowSource) ReadBlob(_ context.Context, _, _, sha string) ([]byte, error) {
+	s.reads.Add(1)
+
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	for _, content := range s.files {
+		if gitBlobSHA([]byte(content)) == sha {
+			return []byte(content), nil
+		}
+	}
+
+	return nil, fmt.Errorf("blob %s not found", sha)
+}
+
+// orgAPIClient lists a fixed set of repositories.
+type orgAPIClient struct {
+	simpleAPIClient
+	repos []RepositoryInfo
+}
+
+func (c *orgAPIClient) ListOrganizationRepositories(context.Context, string) ([]RepositoryInfo, error) {
+	return c.repos, nil
+}
+
+func newOrgTestAuditor(t *testing.T, cacheDir string, source WorkflowSource) *WorkflowAuditor {
+	t.Helper()
+
+	client := &orgAPIClient{}
+	for i := 0; i < 10; i++ {
+		client.repos = append(client.repos, RepositoryInfo{Name: fmt.Sprintf("repo-%02d", i)})
+	}
+
+	client.repos = append(client.repos, RepositoryInfo{Name: "archived", Archived: true})
+
+	auditor := NewWorkflowAuditor(&simpleLogger{}, client)
+	auditor.SetSource(source)
+	auditor.SetCacheDir(cacheDir)
+	auditor.SetConcurrency(4)
+
+	return auditor
+}
+
+func TestWorkflowAuditor_AuditOrganization_DedupesBlobs(t *testing.T) {
+	source := newCountingWorkflowSource()
+	auditor := newOrgTestAuditor(t, t.TempDir(), source)
+
+	results, err := auditor.AuditOrganization(context.Background(), "testorg")
+	require.NoError(t, err)
+	require.Len(t, results, 10)
+	assert.EqualValues(t, 3, source.reads.Load(), "each distinct blob is read once per organization")
+
+	for i, result := range results {
+		assert.Equal(t, fmt.Sprintf("repo-%02d", i), result.Repository, "results keep listing order")
+		assert.Len(t, result.AuditedFiles, 3)
+
+		for _, issue := range result.SecurityIssues {
+			assert.True(t, strings.HasPrefix(issue.ID, issue.FilePath+"-"), issue.ID)
+		}
+	}
+
+	// Served copies must not alias each other
+	results[0].AuditedFiles[0].Issues = append(results[0].AuditedFiles[0].Issues[:0], WorkflowSecurityIssue{ID: "changed"})
+
+	again, err := auditor.AuditRepository(context.Background(), "testorg", "repo-00")
+	require.NoError(t, err)
+	assert.EqualValues(t, 3, source.reads.Load())
+
+	for _, issue := range again.SecurityIssues {
+		assert.NotEqual(t, "changed", issue.ID)
+	}
+}
+
+func TestWorkflowAuditor_AuditOrganization_PersistsCache(t *testing.T) {
+	dir := t.TempDir()
+	source := newCountingWorkflowSource()
+
+	_, err := newOrgTestAuditor(t, dir, source).AuditOrganization(context.Background(), "testorg")
+	require.NoError(t, err)
+	require.FileExists(t, filepath.Join(dir, "testorg.json"))
+
+	// A fresh auditor reuses every persisted analysis
+	source.reads.Store(0)
+
+	results, err := newOrgTestAuditor(t, dir, source).AuditOrganization(context.Background(), "testorg")
+	require.NoError(t, err)
+	require.Len(t, results, 10)
+	assert.Zero(t, source.reads.Load())
+
+	// Only the changed workflow is analyzed again, and the stale one is pruned
+	source.set(workflowsDir+"/ci.yml", strings.Replace(mockWorkflowContent("ci.yml"), "npm test", "npm ci && npm test", 1))
+
+	_, err = newOrgTestAuditor(t, dir, source).AuditOrganization(context.Background(), "testorg")
+	require.NoError(t, err)
+	assert.EqualValues(t, 1, source.reads.Load())
+	assert.Equal(t, 3, LoadWorkflowAuditCache(filepath.Join(dir, "testorg.json")).Len())
+}
+
+func TestLoadWorkflowAuditCache_Invalid(t *testing.T) {
+	dir := t.TempDir()
+
+	outdated := filepath.Join(dir, "outdated.json")
+	require.NoError(t, os.WriteFile(outdated, []byte(`{"version":0,"audits":{"abc":{"file_path":""}}}`), 0o600))
+	assert.Zero(t, LoadWorkflowAuditCache(outdated).Len())
+
+	corrupt := filepath.Join(dir, "corrupt.json")
+	require.NoError(t, os.WriteFile(corrupt, []byte("{"), 0o600))
+	assert.Zero(t, LoadWorkflowAuditCache(corrupt).Len())
+
+	assert.Zero(t, LoadWorkflowAuditCache(filepath.Join(dir, "missing.json")).Len())
+}
+
+func TestGitHubWorkflowSource(t *testing.T) {
+	content := mockWorkflowContent("ci.yml")
+	sha := gitBlobSHA([]byte(content))
+
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		switch r.URL.Path {
+		case "/repos/org/app/contents/.github/workflows":
+			fmt.Fprintf(w, `[{"type":"file","path":".github/workflows/ci.yml","sha":%q},
+				{"type":"file","path":".github/workflows/README.md","sha":"1"},
+				{"type":"dir","path":".github/workflows/shared.yml","sha":"2"}]`, sha)
+		case "/repos/org/app/git/blobs/" + sha:
+			encoded := base64.StdEncoding.EncodeToString([]byte(content))
+			fmt.Fprintf(w, `{"encoding":"base64","content":%q}`, encoded[:60]+"\n"+encoded[60:])
+		default:
+			http.NotFound(w, r)
+		}
+	}))
+	defer server.Close()
+
+	source := NewGitHubWorkflowSource("token")
+	source.SetBaseURL(server.URL)
+
+	blobs, err := source.ListWorkflows(context.Background(), "org", "app")
+	require.NoError(t, err)
+	assert.Equal(t, []WorkflowBlob{{Path: ".github/workflows/ci.yml", SHA: sha}}, blobs)
+
+	data, err := source.ReadBlob(context.Background(), "org", "app", sha)
+	require.NoError(t, err)
+	assert.Equal(t, content, string(data))
+
+	blobs, err = source.ListWorkflows(context.Background(), "org", "empty")
+	require.NoError(t, err)
+	assert.Empty(t, blobs, "repositories without workflows are not an error")
+}
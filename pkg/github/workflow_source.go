@@ -0,0 +1,238 @@
+package github
+
+import (
+	"context"
+	"crypto/sha1" //nolint:gosec // Git object IDs are SHA-1
+	"encoding/base64"
+	"encoding/hex"
+	"encoding/json"
+	"fmt"
+	"io"
+	"net/http"
+	"path"
+	"strconv"
+	"strings"
+	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/httpclient"
+)
+
+// workflowsDir is where GitHub Actions looks for workflow files.
+const workflowsDir = ".github/workflows"
+
+// WorkflowBlob identifies a workflow file by path and git blob SHA. Files
+// with the same SHA have the same content in every repository.
+type WorkflowBlob struct {
+	Path string `json:"path"`
+	SHA  string `json:"sha"`
+}
+
+// WorkflowSource provides the workflow files of repositories.
+type WorkflowSource interface {
+	// ListWorkflows returns the workflow files of a repository without
+	// downloading their content.
+	ListWorkflows(ctx context.Context, organization, repository string) ([]WorkflowBlob, error)
+
+	// ReadBlob returns the content of a blob listed by ListWorkflows.
+	ReadBlob(ctx context.Context, organization, repository, sha string) ([]byte, error)
+}
+
+// GitHubWorkflowSource reads workflow files through the GitHub contents and
+// git blob APIs.
+type GitHubWorkflowSource struct {
+	httpClient *http.Client
+	baseURL    string
+	token      string
+}
+
+// NewGitHubWorkflowSource creates a workflow source authenticated with token.
+func NewGitHubWorkflowSource(token string) *GitHubWorkflowSource {
+	return &GitHubWorkflowSource{
+		httpClient: httpclient.GetGlobalClientWithTimeout("github", 30*time.Second),
+		baseURL:    "https://api.github.com",
+		token:      token,
+	}
+}
+
+// SetBaseURL updates the API base URL (useful for GitHub Enterprise).
+func (s *GitHubWorkflowSource) SetBaseURL(baseURL string) {
+	s.baseURL = strings.TrimSuffix(baseURL, "/")
+}
+
+// ListWorkflows lists the YAML files in .github/workflows. Repositories
+// without the directory have no workflows.
+func (s *GitHubWorkflowSource) ListWorkflows(ctx context.Context, organization, repository string) ([]WorkflowBlob, error) {
+	var entries []struct {
+		Type string `json:"type"`
+		Path string `json:"path"`
+		SHA  string `json:"sha"`
+	}
+
+	found, err := s.get(ctx, fmt.Sprintf("/repos/%s/%s/contents/%s", organization, repository, workflowsDir), &entries)
+	if err != nil || !found {
+		return nil, err
+	}
+
+	blobs := make([]WorkflowBlob, 0, len(entries))
+
+	for _, entry := range entries {
+		if entry.Type == "file" && isWorkflowFile(entry.Path) {
+			blobs = append(blobs, WorkflowBlob{Path: entry.Path, SHA: entry.SHA})
+		}
+	}
+
+	return blobs, nil
+}
+
+// ReadBlob downloads a blob by SHA.
+func (s *GitHubWorkflowSource) ReadBlob(ctx context.Context, organization, repository, sha string) ([]byte, error) {
+	var blob struct {
+		Content  string `json:"content"`
+		Encoding string `json:"encoding"`
+	}
+
+	found, err := s.get(ctx, fmt.Sprintf("/repos/%s/%s/git/blobs/%s", organization, repository, sha), &blob)
+	if err != nil {
+		return nil, err
+	}
+
+	if !found {
+		return nil, fmt.Errorf("blob %s not found in %s/%s", sha, organization, repository)
+	}
+
+	if blob.Encoding != "base64" {
+		return []byte(blob.Content), nil
+	}
+
+	// The API wraps base64 content at 60 columns
+	return base64.StdEncoding.DecodeString(strings.ReplaceAll(blob.Content, "\n", ""))
+}
+
+// get decodes the JSON response for apiPath into v and reports false for 404.
+func (s *GitHubWorkflowSource) get(ctx context.Context, apiPath string, v any) (bool, error) {
+	req, err := http.NewRequestWithContext(ctx, http.MethodGet, s.baseURL+apiPath, nil)
+	if err != nil {
+		return false, fmt.Errorf("failed to create request: %w", err)
+	}
+
+	if s.token != "" {
+		req.Header.Set("Authorization", "token "+s.token)
+	}
+
+	req.Header.Set("Accept", "application/vnd.github.v3+json")
+	req.Header.Set("User-Agent", "gzh-cli")
+
+	resp, err := s.httpClient.Do(req)
+	if err != nil {
+		return false, fmt.Errorf("request failed: %w", err)
+	}
+	defer resp.Body.Close()
+
+	if resp.StatusCode == http.StatusNotFound {
+		return false, nil
+	}
+
+	if resp.StatusCode != http.StatusOK {
+		body, _ := io.ReadAll(resp.Body)
+		return false, fmt.Errorf("GET %s: HTTP %d - %s", apiPath, resp.StatusCode, string(body))
+	}
+
+	if err := json.NewDecoder(resp.Body).Decode(v); err != nil {
+		return false, fmt.Errorf("failed to decode %s: %w", apiPath, err)
+	}
+
+	return true, nil
+}
+
+func isWorkflowFile(name string) bool {
+	ext := path.Ext(name)
+	return ext == ".yml" || ext == ".yaml"
+}
+
+// gitBlobSHA returns the git object ID of content stored as a blob.
+func gitBlobSHA(content []byte) string {
+	h := sha1.New() //nolint:gosec // Git object IDs are SHA-1
+	h.Write([]byte("blob " + strconv.Itoa(len(content)) + "\x00"))
+	h.Write(content)
+
+	return hex.EncodeToString(h.Sum(nil))
+}
+
+// mockWorkflowSource serves the same sample workflows for every repository.
+type mockWorkflowSource struct{}
+
+var mockWorkflowFiles = []string{"ci.yml", "release.yml", "security.yml"}
+
+func (mockWorkflowSource) ListWorkflows(_ context.Context, _, _ string) ([]WorkflowBlob, error) {
+	blobs := make([]WorkflowBlob, 0, len(mockWorkflowFiles))
+	for _, name := range mockWorkflowFiles {
+		blobs = append(blobs, WorkflowBlob{
+			Path: workflowsDir + "/" + name,
+			SHA:  gitBlobSHA([]byte(mockWorkflowContent(name))),
+		})
+	}
+
+	return blobs, nil
+}
+
+func (mockWorkflowSource) ReadBlob(_ context.Context, _, _, sha string) ([]byte, error) {
+	for _, name := range mockWorkflowFiles {
+		if content := mockWorkflowContent(name); gitBlobSHA([]byte(content)) == sha {
+			return []byte(content), nil
+		}
+	}
+
+	return nil, fmt.Errorf("blob %s not found", sha)
+}
+
+func mockWorkflowContent(filename string) string {
+	switch filename {
+	case "ci.yml":
+		return `
+name: CI
+on: [push, pull_request]
+permissions:
+  contents: read
+  packages: write
+jobs:
+  test:
+    runs-on: ubuntu-latest
+    steps:
+      - uses: actions/checkout@v4
+      - uses: actions/setup-node@v4
+        with:
+          node-version: '18'
+      - run: npm test
+`
+	case "release.yml":
+		return `
+name: Release
+on:
+  push:
+    tags: ['v*']
+permissions:
+  contents: write
+  packages: write
+jobs:
+  release:
+    runs-on: ubuntu-latest
+    steps:
+      - uses: actions/checkout@v4
+      - uses: docker/build-push-action@v4
+        with:
+          push: true
+          tags: myapp:latest
+`
+	default:
+		return `
+name: Default Workflow
+on: push
+jobs:
+  build:
+    runs-on: ubuntu-latest
+    steps:
+      - uses: actions/checkout@v4
+      - run: echo "Hello World"
+`
+	}
+}
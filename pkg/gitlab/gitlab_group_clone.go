@@ -10,13 +10,17 @@ import (
 	"net/url"
 	"os"
 	"path/filepath"
+	"strings"
 	"sync"
 
 	"golang.org/x/sync/errgroup"
 	"golang.org/x/sync/semaphore"
 
+	"github.com/gizzahub/gzh-cli/internal/constants"
 	"github.com/gizzahub/gzh-cli/internal/git"
+	"github.com/gizzahub/gzh-cli/internal/git/objectcache"
 	"github.com/gizzahub/gzh-cli/internal/httpclient"
+	"github.com/gizzahub/gzh-cli/pkg/git/provider"
 )
 
 var (
@@ -81,27 +85,16 @@ func GetDefaultBranch(ctx context.Context, group string, repo string) (string, e
 	return gitLabRepo.DefaultBranch, nil
 }
 
+// groupListingPageSize is the largest page GitLab serves.
+const groupListingPageSize = 100
+
 func listGroupRepos(ctx context.Context, group string, allRepos *[]string) error {
 	encodedGroup := url.PathEscape(group)
-	url := buildAPIURL(fmt.Sprintf("groups/%s/projects", encodedGroup))
-
-	req, err := http.NewRequestWithContext(ctx, "GET", url, nil)
-	if err != nil {
-		return fmt.Errorf("failed to create request: %w", err)
-	}
-	addAuthHeader(req)
-
 	client := httpclient.GetGlobalClient("gitlab")
 
-	resp, err := client.Do(req)
-	if err != nil {
-		return fmt.Errorf("%w: %w", ErrFailedToGetRepositories, err)
-	}
-	defer func() {
-		_ = resp.Body.Close() // Log error but don't override main error
-	}()
-
-	if resp.StatusCode != http.StatusOK {
+	repos, err := walkGroupListing[struct {
+		Name string `json:"name"`
+	}](ctx, client, fmt.Sprintf("groups/%s/projects", encodedGroup), ErrFailedToGetRepositories, func(resp *http.Response) error {
 		// 프라이빗 인스턴스/그룹에서 토큰이 없으면 401/403이 나올 수 있음
 		if (resp.StatusCode == http.StatusUnauthorized || resp.StatusCode == http.StatusForbidden) && configuredToken == "" {
 			return fmt.Errorf("%w: 인증 필요\n%s", ErrFailedToGetRepositories, accessGuidanceMessage())
@@ -110,18 +103,7 @@ func listGroupRepos(ctx context.Context, group string, allRepos *[]string) error
 			return fmt.Errorf("%w: %s (그룹 경로 확인 또는 숫자 group ID 사용 권장)\n%s", ErrFailedToGetRepositories, resp.Status, accessGuidanceMessage())
 		}
 		return fmt.Errorf("%w: %s", ErrFailedToGetRepositories, resp.Status)
-	}
-
-	body, err := io.ReadAll(resp.Body)
-	if err != nil {
-		return err
-	}
-
-	var repos []struct {
-		Name string `json:"name"`
-	}
-
-	err = json.Unmarshal(body, &repos)
+	})
 	if err != nil {
 		return err
 	}
@@ -131,38 +113,11 @@ func listGroupRepos(ctx context.Context, group string, allRepos *[]string) error
 	}
 
 	// Get subgroups
-	subgroupsURL := buildAPIURL(fmt.Sprintf("groups/%s/subgroups", encodedGroup))
-
-	subgroupsReq, err := http.NewRequestWithContext(ctx, "GET", subgroupsURL, nil)
-	if err != nil {
-		return fmt.Errorf("failed to create subgroups request: %w", err)
-	}
-	addAuthHeader(subgroupsReq)
-
-	subgroupsResp, err := client.Do(subgroupsReq)
-	if err != nil {
-		return fmt.Errorf("%w: %w", ErrFailedToGetSubgroups, err)
-	}
-	defer func() {
-		if err := subgroupsResp.Body.Close(); err != nil {
-			// Log error but don't override main error
-		}
-	}()
-
-	if subgroupsResp.StatusCode != http.StatusOK {
-		return fmt.Errorf("%w: %s", ErrFailedToGetSubgroups, subgroupsResp.Status)
-	}
-
-	subgroupsBody, err := io.ReadAll(subgroupsResp.Body)
-	if err != nil {
-		return err
-	}
-
-	var subgroups []struct {
+	subgroups, err := walkGroupListing[struct {
 		ID int `json:"id"`
-	}
-
-	err = json.Unmarshal(subgroupsBody, &subgroups)
+	}](ctx, client, fmt.Sprintf("groups/%s/subgroups", encodedGroup), ErrFailedToGetSubgroups, func(resp *http.Response) error {
+		return fmt.Errorf("%w: %s", ErrFailedToGetSubgroups, resp.Status)
+	})
 	if err != nil {
 		return err
 	}
@@ -177,6 +132,48 @@ func listGroupRepos(ctx context.Context, group string, allRepos *[]string) error
 	return nil
 }
 
+// walkGroupListing fetches every page of a group listing endpoint. Request
+// failures are wrapped in failure; statusError describes non-200 responses.
+func walkGroupListing[T any](ctx context.Context, client *http.Client, endpoint string, failure error, statusError func(*http.Response) error) ([]T, error) {
+	fetch := func(ctx context.Context, page provider.PageRequest) ([]T, provider.PageInfo, error) {
+		reqURL := buildAPIURL(fmt.Sprintf("%s?per_page=%d&page=%d", endpoint, groupListingPageSize, page.Page))
+
+		req, err := http.NewRequestWithContext(ctx, "GET", reqURL, nil)
+		if err != nil {
+			return nil, provider.PageInfo{}, fmt.Errorf("failed to create request: %w", err)
+		}
+		addAuthHeader(req)
+
+		resp, err := client.Do(req)
+		if err != nil {
+			return nil, provider.PageInfo{}, fmt.Errorf("%w: %w", failure, err)
+		}
+		defer func() {
+			_ = resp.Body.Close() // Log error but don't override main error
+		}()
+
+		if resp.StatusCode != http.StatusOK {
+			return nil, provider.PageInfo{}, statusError(resp)
+		}
+
+		var items []T
+		if err := json.NewDecoder(resp.Body).Decode(&items); err != nil {
+			return nil, provider.PageInfo{}, err
+		}
+
+		return items, provider.ParsePageInfo(resp.Header), nil
+	}
+
+	var all []T
+
+	err := provider.WalkPages(ctx, fetch, provider.PagerOptions{Concurrency: constants.DefaultParallelism}, func(page provider.Page[T]) error {
+		all = append(all, page.Items...)
+		return nil
+	})
+
+	return all, err
+}
+
 // List retrieves all project names for a GitLab group.
 // It makes paginated requests to the GitLab API to fetch all projects
 // in the specified group, handling pagination automatically.
@@ -247,10 +244,13 @@ func Clone(ctx context.Context, targetPath string, group string, repo string, br
 
 	// Execute secure git clone operation
 	// --verbose 모드에서는 전체 git 명령을 출력
+	args := append([]string{"clone"}, objectcache.DefaultStrategy().CloneArgs(ctx, cloneURL)...)
+	args = append(args, cloneURL, ".")
+
 	if os.Getenv("GZH_VERBOSE") == "1" {
-		fmt.Printf("git -C %s clone %s .\n", targetPath, cloneURL)
+		fmt.Printf("git -C %s %s\n", targetPath, strings.Join(args, " "))
 	}
-	if err := executor.ExecuteSecure(ctx, targetPath, "clone", cloneURL, "."); err != nil {
+	if err := executor.ExecuteSecure(ctx, targetPath, args...); err != nil {
 		return fmt.Errorf("clone failed (url: %s, branch: %s, targetPath: %s, err: %w)", cloneURL, branch, targetPath, err)
 	}
 
@@ -32,6 +32,7 @@ func (rcm *ResumableCloneManager) RefreshAllResumable(ctx context.Context, targe
 	// Initialize or load state
 	// 상태파일을 타겟 디렉토리 하위에 저장하도록 상태 매니저 경로를 설정
 	rcm.stateManager = synclonepkg.NewStateManager(filepath.Join(targetPath, ".gzh", "state"))
+	defer func() { _ = rcm.stateManager.Close() }()
 	state, err := rcm.initializeState(group, targetPath, strategy, parallel, maxRetries, resume)
 	if err != nil {
 		return err
@@ -442,11 +443,15 @@ func (rcm *ResumableCloneManager) trackResultsWithPeriodicSaving(ctx context.Con
 func (rcm *ResumableCloneManager) handleJobResult(result workerpool.RepositoryResult, state *synclonepkg.CloneState, progressTracker *synclonepkg.ProgressTracker, successCount, failureCount *int) {
 	if result.Error != nil {
 		*failureCount++
-		state.AddFailedRepository(result.Job.Repository, result.Job.Path, string(result.Job.Operation), result.Error.Error(), 1)
+		if err := rcm.stateManager.RecordFailed(state, result.Job.Repository, result.Job.Path, string(result.Job.Operation), result.Error.Error(), 1); err != nil {
+			fmt.Printf("\n⚠️  Warning: failed to record state: %v\n", err)
+		}
 		progressTracker.SetRepositoryError(result.Job.Repository, result.Error.Error())
 	} else {
 		*successCount++
-		state.AddCompletedRepository(result.Job.Repository, result.Job.Path, string(result.Job.Operation), result.Message)
+		if err := rcm.stateManager.RecordCompleted(state, result.Job.Repository, result.Job.Path, string(result.Job.Operation), result.Message); err != nil {
+			fmt.Printf("\n⚠️  Warning: failed to record state: %v\n", err)
+		}
 		progressTracker.CompleteRepository(result.Job.Repository, result.Message)
 	}
 }
@@ -14,6 +14,7 @@ import (
 
 	"github.com/gizzahub/gzh-cli/internal/constants"
 	"github.com/gizzahub/gzh-cli/internal/httpclient"
+	"github.com/gizzahub/gzh-cli/pkg/git/provider"
 )
 
 // StreamingClient provides streaming API access for GitLab large-scale operations.
@@ -174,54 +175,47 @@ func NewStreamingClient(token, baseURL string, config StreamingConfig) *Streamin
 	}
 }
 
-// StreamGroupProjects streams projects for a GitLab group with memory optimization.
+// StreamGroupProjects streams projects for a GitLab group with memory
+// optimization. When GitLab reports the page count, up to
+// config.MaxConcurrency pages are fetched at once; projects are still
+// streamed in page order.
 func (sc *StreamingClient) StreamGroupProjects(ctx context.Context, groupID string, config StreamingConfig) (<-chan ProjectStream, error) {
 	resultChan := make(chan ProjectStream, config.BufferSize)
 
 	go func() {
 		defer close(resultChan)
 
-		pagination := CursorPagination{
-			Page:    1,
-			PerPage: config.PageSize,
+		fetch := func(ctx context.Context, req provider.PageRequest) ([]*Project, provider.PageInfo, error) {
+			return sc.fetchProjectPage(ctx, groupID, req, config.PageSize)
 		}
 
-		for {
-			select {
-			case <-ctx.Done():
-				return
-			default:
-			}
-
-			// Check memory usage before proceeding
-			if err := sc.checkMemoryLimit(config.MemoryLimit); err != nil {
-				sc.sendError(resultChan, fmt.Errorf("memory limit exceeded: %w", err))
-				return
-			}
+		opts := provider.PagerOptions{
+			Concurrency: config.MaxConcurrency,
+			Wait: func(ctx context.Context) error {
+				// Check memory usage before proceeding
+				if err := sc.checkMemoryLimit(config.MemoryLimit); err != nil {
+					return fmt.Errorf("memory limit exceeded: %w", err)
+				}
 
-			// Check rate limit
-			if err := sc.waitForRateLimit(ctx, config.RateLimitBuffer); err != nil {
-				sc.sendError(resultChan, fmt.Errorf("rate limit check failed: %w", err))
-				return
-			}
+				if err := sc.waitForRateLimit(ctx, config.RateLimitBuffer); err != nil {
+					return fmt.Errorf("rate limit check failed: %w", err)
+				}
 
-			// Fetch page with streaming
-			projects, newPagination, err := sc.fetchProjectPage(ctx, groupID, pagination)
-			if err != nil {
-				sc.sendError(resultChan, fmt.Errorf("failed to fetch page %d: %w", pagination.Page, err))
-				return
-			}
+				return nil
+			},
+		}
 
+		err := provider.WalkPages(ctx, fetch, opts, func(page provider.Page[*Project]) error {
 			// Stream projects to channel
-			for _, project := range projects {
+			for _, project := range page.Items {
 				select {
 				case <-ctx.Done():
-					return
+					return ctx.Err()
 				case resultChan <- ProjectStream{
 					Project: project,
 					Metadata: StreamMetadata{
-						Page:        pagination.Page,
-						TotalPages:  newPagination.TotalPages,
+						Page:        page.Number,
+						TotalPages:  page.Info.TotalPages,
 						ProcessedAt: time.Now(),
 						MemoryUsage: sc.getCurrentMemoryUsage(),
 					},
@@ -229,33 +223,32 @@ func (sc *StreamingClient) StreamGroupProjects(ctx context.Context, groupID stri
 				}
 			}
 
-			// Check if we have more pages
-			if !newPagination.HasNext {
-				break
-			}
-
-			// Update pagination for next page
-			pagination = newPagination
-			pagination.Page++
-
 			// Trigger garbage collection periodically
-			if pagination.Page%10 == 0 {
+			if page.Number%10 == 0 {
 				sc.optimizeMemory()
 			}
+
+			return nil
+		})
+		if err != nil && ctx.Err() == nil {
+			sc.sendError(resultChan, err)
 		}
 	}()
 
 	return resultChan, nil
 }
 
-// fetchProjectPage fetches a single page of projects for a group.
-func (sc *StreamingClient) fetchProjectPage(ctx context.Context, groupID string, pagination CursorPagination) ([]*Project, CursorPagination, error) {
-	endpoint := fmt.Sprintf("groups/%s/projects?per_page=%d&page=%d", url.PathEscape(groupID), pagination.PerPage, pagination.Page)
-	reqURL := buildAPIURL(endpoint)
+// fetchProjectPage fetches a single page of projects for a group, following
+// the link of the previous page when GitLab gave one.
+func (sc *StreamingClient) fetchProjectPage(ctx context.Context, groupID string, page provider.PageRequest, perPage int) ([]*Project, provider.PageInfo, error) {
+	reqURL := page.URL
+	if reqURL == "" {
+		reqURL = buildAPIURL(fmt.Sprintf("groups/%s/projects?per_page=%d&page=%d", url.PathEscape(groupID), perPage, page.Page))
+	}
 
 	req, err := http.NewRequestWithContext(ctx, http.MethodGet, reqURL, nil)
 	if err != nil {
-		return nil, pagination, fmt.Errorf("failed to create request: %w", err)
+		return nil, provider.PageInfo{}, fmt.Errorf("failed to create request: %w", err)
 	}
 
 	if sc.token != "" {
@@ -264,22 +257,23 @@ func (sc *StreamingClient) fetchProjectPage(ctx context.Context, groupID string,
 
 	resp, err := sc.httpClient.Do(req)
 	if err != nil {
-		return nil, pagination, fmt.Errorf("request failed: %w", err)
+		return nil, provider.PageInfo{}, fmt.Errorf("failed to fetch page %d: request failed: %w", page.Page, err)
 	}
 	defer func() { _ = resp.Body.Close() }()
 
+	sc.updateRateLimit(resp.Header)
+
 	if resp.StatusCode != http.StatusOK {
-		return nil, pagination, fmt.Errorf("unexpected status: %s", resp.Status)
+		return nil, provider.PageInfo{}, fmt.Errorf("failed to fetch page %d: unexpected status: %s", page.Page, resp.Status)
 	}
 
 	var projects []*Project
 	dec := json.NewDecoder(bufio.NewReader(resp.Body))
 	if err := dec.Decode(&projects); err != nil {
-		return nil, pagination, fmt.Errorf("decode failed: %w", err)
+		return nil, provider.PageInfo{}, fmt.Errorf("failed to fetch page %d: decode failed: %w", page.Page, err)
 	}
 
-	newPagination := sc.parsePaginationHeaders(resp.Header, pagination)
-	return projects, newPagination, nil
+	return projects, provider.ParsePageInfo(resp.Header), nil
 }
 
 // parseProjectResponse parses JSON response with streaming to minimize memory usage.
@@ -329,41 +323,6 @@ func (sc *StreamingClient) buildProjectURL(groupID string, pagination CursorPagi
 	return baseURL + "?" + params.Encode()
 }
 
-// parsePaginationHeaders extracts pagination info from GitLab response headers.
-func (sc *StreamingClient) parsePaginationHeaders(headers http.Header, current CursorPagination) CursorPagination {
-	newPagination := current
-
-	if nextPage := headers.Get("X-Next-Page"); nextPage != "" {
-		if np, err := strconv.Atoi(nextPage); err == nil {
-			newPagination.NextPage = np
-			newPagination.HasNext = true
-		}
-	} else {
-		newPagination.HasNext = false
-	}
-
-	if prevPage := headers.Get("X-Prev-Page"); prevPage != "" {
-		if pp, err := strconv.Atoi(prevPage); err == nil {
-			newPagination.PrevPage = pp
-			newPagination.HasPrev = true
-		}
-	}
-
-	if totalPages := headers.Get("X-Total-Pages"); totalPages != "" {
-		if tp, err := strconv.Atoi(totalPages); err == nil {
-			newPagination.TotalPages = tp
-		}
-	}
-
-	if total := headers.Get("X-Total"); total != "" {
-		if t, err := strconv.Atoi(total); err == nil {
-			newPagination.Total = t
-		}
-	}
-
-	return newPagination
-}
-
 // waitForRateLimit waits if necessary to respect GitLab rate limits.
 func (sc *StreamingClient) waitForRateLimit(ctx context.Context, buffer int) error {
 	sc.rateLimiter.mu.RLock()
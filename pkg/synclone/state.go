@@ -5,10 +5,15 @@ package bulkclone
 
 import (
 	"encoding/json"
+	"errors"
 	"fmt"
 	"os"
 	"path/filepath"
+	"strings"
+	"sync"
 	"time"
+
+	"github.com/gizzahub/gzh-cli/internal/journal"
 )
 
 // CloneState represents the state of a bulk clone operation.
@@ -33,6 +38,19 @@ type CloneState struct {
 
 	// Status
 	Status string `json:"status"` // "in_progress", "completed", "failed", "canceled"
+
+	// Incremental sync tracking. Incremental states are kept after completion
+	// so that the next run only processes repositories pushed since Watermark.
+	Incremental  bool                           `json:"incremental,omitempty"`
+	Watermark    time.Time                      `json:"watermark,omitzero"`
+	Repositories map[string]RepositorySyncState `json:"repositories,omitempty"`
+}
+
+// RepositorySyncState is the remote state a repository was last synced to.
+type RepositorySyncState struct {
+	PushedAt time.Time `json:"pushedAt"`
+	HeadSHA  string    `json:"headSha,omitempty"`
+	SyncedAt time.Time `json:"syncedAt"`
 }
 
 // CompletedRepository represents a successfully processed repository.
@@ -55,8 +73,30 @@ type FailedRepository struct {
 }
 
 // StateManager handles saving and loading clone states.
+//
+// A state is stored as a JSON snapshot plus an append-only journal of
+// repository results recorded since that snapshot. RecordCompleted and
+// RecordFailed append to the journal, SaveState compacts it into the
+// snapshot, and LoadState replays it on top of the snapshot.
 type StateManager struct {
 	stateDir string
+
+	mu       sync.Mutex
+	journals map[string]*journal.Writer
+}
+
+// stateRecord is one journaled repository result.
+type stateRecord struct {
+	Op        string    `json:"op"` // completed, failed, synced
+	Name      string    `json:"name"`
+	Path      string    `json:"path,omitempty"`
+	Operation string    `json:"operation,omitempty"`
+	Message   string    `json:"message,omitempty"`
+	Error     string    `json:"error,omitempty"`
+	Attempts  int       `json:"attempts,omitempty"`
+	PushedAt  time.Time `json:"pushedAt,omitzero"`
+	HeadSHA   string    `json:"headSha,omitempty"`
+	At        time.Time `json:"at"`
 }
 
 // NewStateManager creates a new state manager.
@@ -72,6 +112,7 @@ func NewStateManager(stateDir string) *StateManager {
 
 	return &StateManager{
 		stateDir: stateDir,
+		journals: make(map[string]*journal.Writer),
 	}
 }
 
@@ -81,7 +122,13 @@ func (sm *StateManager) GetStateFilePath(provider, organization string) string {
 	return filepath.Join(sm.stateDir, filename)
 }
 
-// SaveState saves the clone state to disk.
+// GetJournalFilePath returns the path to the journal file for a given operation.
+func (sm *StateManager) GetJournalFilePath(provider, organization string) string {
+	filename := fmt.Sprintf("%s_%s.journal", provider, organization)
+	return filepath.Join(sm.stateDir, filename)
+}
+
+// SaveState writes a full snapshot of the clone state and truncates its journal.
 func (sm *StateManager) SaveState(state *CloneState) error {
 	// Ensure state directory exists
 	if err := os.MkdirAll(sm.stateDir, 0o750); err != nil {
@@ -94,20 +141,83 @@ func (sm *StateManager) SaveState(state *CloneState) error {
 	// Get state file path
 	statePath := sm.GetStateFilePath(state.Provider, state.Organization)
 
-	// Marshal state to JSON
-	data, err := json.MarshalIndent(state, "", "  ")
-	if err != nil {
-		return fmt.Errorf("failed to marshal state: %w", err)
+	if err := journal.WriteSnapshot(statePath, state, 0o600); err != nil {
+		return fmt.Errorf("failed to write state file: %w", err)
 	}
 
-	// Write to file
-	if err := os.WriteFile(statePath, data, 0o600); err != nil {
-		return fmt.Errorf("failed to write state file: %w", err)
+	// Every journaled record is now part of the snapshot
+	journalPath := sm.GetJournalFilePath(state.Provider, state.Organization)
+
+	sm.mu.Lock()
+	defer sm.mu.Unlock()
+
+	if w, ok := sm.journals[journalPath]; ok {
+		if err := w.Truncate(); err != nil {
+			return fmt.Errorf("failed to truncate state journal: %w", err)
+		}
+	} else if err := os.Remove(journalPath); err != nil && !os.IsNotExist(err) {
+		return fmt.Errorf("failed to remove state journal: %w", err)
 	}
 
 	return nil
 }
 
+// RecordCompleted adds a completed repository to the state and appends it to the journal.
+func (sm *StateManager) RecordCompleted(state *CloneState, name, path, operation, message string) error {
+	return sm.record(state, stateRecord{Op: "completed", Name: name, Path: path, Operation: operation, Message: message})
+}
+
+// RecordFailed adds a failed repository to the state and appends it to the journal.
+func (sm *StateManager) RecordFailed(state *CloneState, name, path, operation, errorMsg string, attempts int) error {
+	return sm.record(state, stateRecord{
+		Op: "failed", Name: name, Path: path, Operation: operation, Error: errorMsg, Attempts: attempts,
+	})
+}
+
+// RecordSynced stores the remote state a repository was synced to and appends it to the journal.
+func (sm *StateManager) RecordSynced(state *CloneState, name string, pushedAt time.Time, headSHA string) error {
+	return sm.record(state, stateRecord{Op: "synced", Name: name, PushedAt: pushedAt, HeadSHA: headSHA})
+}
+
+func (sm *StateManager) record(state *CloneState, record stateRecord) error {
+	record.At = time.Now()
+	state.apply(record)
+
+	journalPath := sm.GetJournalFilePath(state.Provider, state.Organization)
+
+	sm.mu.Lock()
+	defer sm.mu.Unlock()
+
+	w, ok := sm.journals[journalPath]
+	if !ok {
+		var err error
+
+		w, err = journal.Open(journalPath, journal.Options{})
+		if err != nil {
+			return err
+		}
+
+		sm.journals[journalPath] = w
+	}
+
+	return w.Append(record)
+}
+
+// Close syncs and closes all journals opened by the state manager.
+func (sm *StateManager) Close() error {
+	sm.mu.Lock()
+	defer sm.mu.Unlock()
+
+	var errs []error
+
+	for path, w := range sm.journals {
+		errs = append(errs, w.Close())
+		delete(sm.journals, path)
+	}
+
+	return errors.Join(errs...)
+}
+
 // LoadState loads the clone state from disk.
 func (sm *StateManager) LoadState(provider, organization string) (*CloneState, error) {
 	statePath := sm.GetStateFilePath(provider, organization)
@@ -129,12 +239,47 @@ func (sm *StateManager) LoadState(provider, organization string) (*CloneState, e
 		return nil, fmt.Errorf("failed to unmarshal state: %w", err)
 	}
 
+	if err := replayStateJournal(sm.GetJournalFilePath(provider, organization), &state); err != nil {
+		return nil, err
+	}
+
 	return &state, nil
 }
 
-// DeleteState removes the state file.
+// replayStateJournal applies the records journaled since the snapshot was written.
+func replayStateJournal(path string, state *CloneState) error {
+	_, err := journal.Replay(path, func(raw json.RawMessage) error {
+		var record stateRecord
+		if err := json.Unmarshal(raw, &record); err != nil {
+			return fmt.Errorf("failed to unmarshal state journal record: %w", err)
+		}
+
+		state.apply(record)
+
+		return nil
+	})
+	if err != nil {
+		return fmt.Errorf("failed to replay state journal: %w", err)
+	}
+
+	return nil
+}
+
+// DeleteState removes the state file and its journal.
 func (sm *StateManager) DeleteState(provider, organization string) error {
 	statePath := sm.GetStateFilePath(provider, organization)
+	journalPath := sm.GetJournalFilePath(provider, organization)
+
+	sm.mu.Lock()
+	if w, ok := sm.journals[journalPath]; ok {
+		_ = w.Close()
+		delete(sm.journals, journalPath)
+	}
+	sm.mu.Unlock()
+
+	if err := os.Remove(journalPath); err != nil && !os.IsNotExist(err) {
+		return fmt.Errorf("failed to delete state journal: %w", err)
+	}
 
 	if _, err := os.Stat(statePath); os.IsNotExist(err) {
 		return nil // Already deleted
@@ -186,6 +331,11 @@ func (sm *StateManager) ListStates() ([]CloneState, error) {
 			continue // Skip invalid JSON
 		}
 
+		journalPath := filepath.Join(sm.stateDir, strings.TrimSuffix(entry.Name(), ".json")+".journal")
+		if err := replayStateJournal(journalPath, &state); err != nil {
+			continue // Skip states with a corrupt journal
+		}
+
 		states = append(states, state)
 	}
 
@@ -258,6 +408,36 @@ func (cs *CloneState) AddFailedRepository(name, path, operation, errorMsg string
 	cs.updateTotalRepositories()
 }
 
+// apply updates the state for a journal record. Replaying a record that is
+// already contained in the snapshot leaves the state unchanged.
+func (cs *CloneState) apply(record stateRecord) {
+	switch record.Op {
+	case "completed":
+		if cs.IsCompleted(record.Name) {
+			return
+		}
+
+		cs.AddCompletedRepository(record.Name, record.Path, record.Operation, record.Message)
+		cs.CompletedRepos[len(cs.CompletedRepos)-1].CompletedAt = record.At
+	case "failed":
+		cs.AddFailedRepository(record.Name, record.Path, record.Operation, record.Error, record.Attempts)
+
+		for i := range cs.FailedRepos {
+			if cs.FailedRepos[i].Name == record.Name {
+				cs.FailedRepos[i].LastAttempt = record.At
+			}
+		}
+	case "synced":
+		cs.SetRepositorySynced(record.Name, record.PushedAt, record.HeadSHA)
+
+		synced := cs.Repositories[record.Name]
+		synced.SyncedAt = record.At
+		cs.Repositories[record.Name] = synced
+	}
+
+	cs.LastUpdated = record.At
+}
+
 // IsCompleted checks if a repository has been completed.
 func (cs *CloneState) IsCompleted(name string) bool {
 	for _, completed := range cs.CompletedRepos {
@@ -340,3 +520,43 @@ func (cs *CloneState) MarkCancelled() {
 	cs.Status = "canceled"
 	cs.LastUpdated = time.Now()
 }
+
+// SetRepositorySynced records the remote state a repository was synced to.
+func (cs *CloneState) SetRepositorySynced(name string, pushedAt time.Time, headSHA string) {
+	if cs.Repositories == nil {
+		cs.Repositories = make(map[string]RepositorySyncState)
+	}
+
+	cs.Repositories[name] = RepositorySyncState{PushedAt: pushedAt, HeadSHA: headSHA, SyncedAt: time.Now()}
+}
+
+// BeginIncrementalRun resets the progress of a previous incremental run while
+// keeping the watermark and per-repository sync state. Repositories the
+// previous run did not finish are returned so they can be processed again.
+func (cs *CloneState) BeginIncrementalRun(strategy string, parallel, maxRetries int) []string {
+	carryOver := append([]string{}, cs.PendingRepos...)
+	for _, failed := range cs.FailedRepos {
+		carryOver = append(carryOver, failed.Name)
+	}
+
+	cs.StartTime = time.Now()
+	cs.LastUpdated = cs.StartTime
+	cs.Strategy = strategy
+	cs.Parallel = parallel
+	cs.MaxRetries = maxRetries
+	cs.CompletedRepos = []CompletedRepository{}
+	cs.FailedRepos = []FailedRepository{}
+	cs.PendingRepos = []string{}
+	cs.TotalRepositories = 0
+	cs.Status = "in_progress"
+	cs.Incremental = true
+
+	return carryOver
+}
+
+// AdvanceWatermark moves the watermark forward to t. It never moves backwards.
+func (cs *CloneState) AdvanceWatermark(t time.Time) {
+	if t.After(cs.Watermark) {
+		cs.Watermark = t
+	}
+}
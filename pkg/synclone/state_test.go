@@ -157,6 +157,69 @@ func TestStateManager_SaveAndLoadState(t *testing.T) {
 	assert.Equal(t, len(state.CompletedRepos), len(loadedState.CompletedRepos))
 }
 
+func TestStateManager_JournalReplay(t *testing.T) {
+	sm := NewStateManager(t.TempDir())
+
+	state := NewCloneState("github", "myorg", "/tmp/repos", "reset", 10, 3)
+	state.SetPendingRepositories([]string{"repo1", "repo2", "repo3"})
+	require.NoError(t, sm.SaveState(state))
+
+	require.NoError(t, sm.RecordCompleted(state, "repo1", "/tmp/repos/repo1", "clone", "ok"))
+	require.NoError(t, sm.RecordFailed(state, "repo2", "/tmp/repos/repo2", "clone", "Network error", 2))
+	require.NoError(t, sm.Close())
+
+	// The snapshot is untouched; the results live only in the journal
+	assert.FileExists(t, sm.GetJournalFilePath("github", "myorg"))
+
+	loaded, err := sm.LoadState("github", "myorg")
+	require.NoError(t, err)
+	assert.True(t, loaded.IsCompleted("repo1"))
+	assert.True(t, loaded.IsFailed("repo2"))
+	assert.Equal(t, []string{"repo3"}, loaded.GetRemainingRepositories())
+
+	// Compaction folds the journal into the snapshot; replaying it again is harmless
+	require.NoError(t, sm.SaveState(loaded))
+	assert.NoFileExists(t, sm.GetJournalFilePath("github", "myorg"))
+
+	reloaded, err := sm.LoadState("github", "myorg")
+	require.NoError(t, err)
+	reloaded.apply(stateRecord{Op: "completed", Name: "repo1"})
+	assert.Len(t, reloaded.CompletedRepos, 1)
+	assert.Len(t, reloaded.FailedRepos, 1)
+}
+
+func TestStateManager_IncrementalState(t *testing.T) {
+	sm := NewStateManager(t.TempDir())
+	pushedAt := time.Date(2025, 3, 1, 12, 0, 0, 0, time.UTC)
+
+	state := NewCloneState("github", "myorg", "/tmp/repos", "pull", 10, 3)
+	state.SetPendingRepositories([]string{"repo1", "repo2", "repo3"})
+	require.NoError(t, sm.SaveState(state))
+
+	require.NoError(t, sm.RecordSynced(state, "repo1", pushedAt, "abc123"))
+	require.NoError(t, sm.RecordCompleted(state, "repo1", "/tmp/repos/repo1", "pull", "ok"))
+	require.NoError(t, sm.RecordFailed(state, "repo2", "/tmp/repos/repo2", "pull", "Network error", 1))
+	require.NoError(t, sm.Close())
+
+	loaded, err := sm.LoadState("github", "myorg")
+	require.NoError(t, err)
+	assert.Equal(t, pushedAt, loaded.Repositories["repo1"].PushedAt.UTC())
+	assert.Equal(t, "abc123", loaded.Repositories["repo1"].HeadSHA)
+
+	// A new run keeps the sync state and carries over unfinished repositories
+	carryOver := loaded.BeginIncrementalRun("reset", 5, 2)
+	assert.ElementsMatch(t, []string{"repo2", "repo3"}, carryOver)
+	assert.True(t, loaded.Incremental)
+	assert.Equal(t, "reset", loaded.Strategy)
+	assert.Empty(t, loaded.CompletedRepos)
+	assert.Empty(t, loaded.FailedRepos)
+	assert.Contains(t, loaded.Repositories, "repo1")
+
+	loaded.AdvanceWatermark(pushedAt)
+	loaded.AdvanceWatermark(pushedAt.Add(-time.Hour))
+	assert.Equal(t, pushedAt, loaded.Watermark)
+}
+
 func TestStateManager_HasState(t *testing.T) {
 	// Create temporary directory for testing
 	tempDir, err := os.MkdirTemp("", "gzh-test-*")